@@ -22,9 +22,11 @@ import (
 
 func init() {
 	RegisterVppProxyTests(VppProxyHttpGetTcpTest, VppProxyHttpGetTlsTest, VppProxyHttpPutTcpTest, VppProxyHttpPutTlsTest,
-		VppConnectProxyGetTest, VppConnectProxyPutTest)
+		VppConnectProxyGetTest, VppConnectProxyPutTest, VppReverseProxyHttpGetTest, VppReverseProxyHttpPoolTest,
+		VppReverseProxyHttpConnectFailedTest, VppReverseProxyHttpPipelineTest)
 	RegisterVppProxySoloTests(VppProxyHttpGetTcpMTTest, VppProxyHttpPutTcpMTTest, VppProxyTcpIperfMTTest,
-		VppProxyUdpIperfMTTest, VppConnectProxyStressTest, VppConnectProxyStressMTTest, VppConnectProxyConnectionFailedMTTest)
+		VppProxyUdpIperfMTTest, VppConnectProxyStressTest, VppConnectProxyStressMTTest, VppConnectProxyConnectionFailedMTTest,
+		VppReverseProxyHttpPoolMTTest)
 	RegisterVppUdpProxyTests(VppProxyUdpTest, VppConnectUdpProxyTest, VppConnectUdpInvalidCapsuleTest,
 		VppConnectUdpUnknownCapsuleTest, VppConnectUdpClientCloseTest, VppConnectUdpInvalidTargetTest)
 	RegisterVppUdpProxySoloTests(VppProxyUdpMigrationMTTest, VppConnectUdpStressMTTest, VppConnectUdpStressTest)
@@ -652,3 +654,164 @@ func VppConnectUdpStressMTTest(s *VppUdpProxySuite) {
 
 	vppConnectUdpStressLoad(s)
 }
+
+func configureVppReverseProxy(s *VppProxySuite, proxyPort uint16, backendPort uint16) {
+	vppProxy := s.Containers.VppProxy.VppInstance
+	cmd := fmt.Sprintf("test proxy server fifo-size 512k server-uri http://%s/%d backend http://%s/%d max-backend-connections 1",
+		s.VppProxyAddr(), proxyPort, s.ServerAddr(), backendPort)
+	output := vppProxy.Vppctl(cmd)
+	s.Log("proxy configured: " + output)
+}
+
+// backend replies with request path, Host and X-Forwarded-Host it got and counts new connections
+func startReverseProxyBackend(s *VppProxySuite, conns *atomic.Uint32) *http.Server {
+	listener, err := net.Listen("tcp", fmt.Sprintf("%s:%d", s.ServerAddr(), s.ServerPort()))
+	s.AssertNil(err, fmt.Sprint(err))
+	server := &http.Server{
+		Handler: http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+			fmt.Fprintf(w, "%s|%s|%s", r.URL.Path, r.Host, r.Header.Get("X-Forwarded-Host"))
+		}),
+		ConnState: func(c net.Conn, state http.ConnState) {
+			if state == http.StateNew {
+				conns.Add(1)
+			}
+		},
+	}
+	go server.Serve(listener)
+	s.Log("* started http backend " + listener.Addr().String())
+	return server
+}
+
+// requests are sent in one write, so proxy gets them pipelined
+func reverseProxyRequests(s *VppProxySuite, proxyPort uint16, requests []string) ([]int, []string) {
+	conn, err := net.DialTimeout("tcp", fmt.Sprintf("%s:%d", s.VppProxyAddr(), proxyPort), time.Second*5)
+	s.AssertNil(err, fmt.Sprint(err))
+	defer conn.Close()
+	conn.SetDeadline(time.Now().Add(time.Second * 10))
+
+	_, err = conn.Write([]byte(strings.Join(requests, "")))
+	s.AssertNil(err, fmt.Sprint(err))
+
+	var codes []int
+	var bodies []string
+	r := bufio.NewReader(conn)
+	for range requests {
+		resp, err := http.ReadResponse(r, nil)
+		s.AssertNil(err, fmt.Sprint(err))
+		body, err := io.ReadAll(resp.Body)
+		s.AssertNil(err, fmt.Sprint(err))
+		resp.Body.Close()
+		s.AssertContains(resp.Header.Get("Via"), "vpp-proxy")
+		codes = append(codes, resp.StatusCode)
+		bodies = append(bodies, string(body))
+	}
+	return codes, bodies
+}
+
+func reverseProxyGet(path string) string {
+	return fmt.Sprintf("GET %s HTTP/1.1\r\nHost: example.com\r\nUser-Agent: hs-test\r\n\r\n", path)
+}
+
+func VppReverseProxyHttpGetTest(s *VppProxySuite) {
+	var proxyPort uint16 = 8080
+	var conns atomic.Uint32
+	server := startReverseProxyBackend(s, &conns)
+	defer server.Close()
+	configureVppReverseProxy(s, proxyPort, s.ServerPort())
+
+	codes, bodies := reverseProxyRequests(s, proxyPort, []string{reverseProxyGet("/test")})
+	s.AssertEqual(http.StatusOK, codes[0])
+	// client Host is forwarded and reported as X-Forwarded-Host
+	s.AssertEqual("/test|example.com|example.com", bodies[0])
+}
+
+func VppReverseProxyHttpPoolTest(s *VppProxySuite) {
+	var proxyPort uint16 = 8080
+	var conns atomic.Uint32
+	server := startReverseProxyBackend(s, &conns)
+	defer server.Close()
+	configureVppReverseProxy(s, proxyPort, s.ServerPort())
+
+	// new downstream connection for each request, upstream one is reused
+	for i := 0; i < 5; i++ {
+		codes, _ := reverseProxyRequests(s, proxyPort, []string{reverseProxyGet("/test")})
+		s.AssertEqual(http.StatusOK, codes[0])
+	}
+	s.AssertEqual(uint32(1), conns.Load())
+	o := s.Containers.VppProxy.VppInstance.Vppctl("show test proxy http")
+	s.Log(o)
+	s.AssertContains(o, "5 requests, 1 connects")
+}
+
+func VppReverseProxyHttpPoolMTTest(s *VppProxySuite) {
+	var proxyPort uint16 = 8080
+	var conns atomic.Uint32
+	var wg sync.WaitGroup
+	server := startReverseProxyBackend(s, &conns)
+	defer server.Close()
+
+	vppProxy := s.Containers.VppProxy.VppInstance
+	// spread downstream connections over workers, upstream connection is
+	// handed over to worker that asked for it
+	s.AssertNil(vppProxy.DeleteTap(s.Interfaces.Client))
+	s.AssertNil(vppProxy.CreateTap(s.Interfaces.Client, 2, uint32(s.Interfaces.Client.Peer.Index), Consistent_qp))
+	configureVppReverseProxy(s, proxyPort, s.ServerPort())
+
+	for i := 0; i < 10; i++ {
+		wg.Add(1)
+		go func() {
+			defer GinkgoRecover()
+			defer wg.Done()
+			requests := []string{reverseProxyGet("/a"), reverseProxyGet("/b")}
+			codes, bodies := reverseProxyRequests(s, proxyPort, requests)
+			s.AssertEqual(http.StatusOK, codes[0])
+			s.AssertEqual(http.StatusOK, codes[1])
+			s.AssertEqual("/a|example.com|example.com", bodies[0])
+			s.AssertEqual("/b|example.com|example.com", bodies[1])
+		}()
+	}
+	wg.Wait()
+	o := vppProxy.Vppctl("show test proxy http")
+	s.Log(o)
+	s.AssertContains(o, "20 requests")
+	s.AssertContains(o, "0 errors")
+}
+
+func VppReverseProxyHttpConnectFailedTest(s *VppProxySuite) {
+	var proxyPort uint16 = 8080
+	configureVppReverseProxy(s, proxyPort, s.ServerPort()+1)
+
+	// only failed request is dropped, the ones pipelined after it get own reply
+	requests := []string{
+		"POST /test HTTP/1.1\r\nHost: example.com\r\nContent-Length: 5\r\n\r\nhello",
+		reverseProxyGet("/test1"),
+		reverseProxyGet("/test2"),
+	}
+	codes, _ := reverseProxyRequests(s, proxyPort, requests)
+	for _, code := range codes {
+		s.AssertEqual(http.StatusBadGateway, code)
+	}
+	o := s.Containers.VppProxy.VppInstance.Vppctl("show test proxy http")
+	s.Log(o)
+	s.AssertContains(o, "3 errors")
+}
+
+func VppReverseProxyHttpPipelineTest(s *VppProxySuite) {
+	var proxyPort uint16 = 8080
+	var conns atomic.Uint32
+	server := startReverseProxyBackend(s, &conns)
+	defer server.Close()
+	configureVppReverseProxy(s, proxyPort, s.ServerPort())
+
+	requests := []string{
+		reverseProxyGet("/test1"),
+		"POST /test2 HTTP/1.1\r\nHost: example.com\r\nContent-Length: 5\r\n\r\nhello",
+		reverseProxyGet("/test3"),
+	}
+	codes, bodies := reverseProxyRequests(s, proxyPort, requests)
+	for i, code := range codes {
+		s.AssertEqual(http.StatusOK, code)
+		s.AssertEqual(fmt.Sprintf("/test%d|example.com|example.com", i+1), bodies[i])
+	}
+	s.AssertEqual(uint32(1), conns.Load())
+}
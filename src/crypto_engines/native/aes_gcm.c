@@ -85,6 +85,42 @@ next:
   return n_ops;
 }
 
+static_always_inline u32
+aes_ops_aes_gmac (vnet_crypto_op_t *ops[], u32 n_ops, aes_key_size_t ks,
+		  u32 fixed, u32 aad_len, int verify)
+{
+  crypto_native_main_t *cm = &crypto_native_main;
+  vnet_crypto_op_t *op = ops[0];
+  aes_gcm_key_data_t *kd;
+  u32 n_left = n_ops;
+  int rv;
+
+next:
+  kd = (aes_gcm_key_data_t *) cm->key_data[op->key_index];
+  /* null cipher, both aad and src are authenticated only */
+  rv = aes_gmac (op->aad, fixed ? aad_len : op->aad_len, op->src, op->len,
+		 op->iv, op->tag, fixed ? 16 : op->tag_len, kd,
+		 AES_KEY_ROUNDS (ks), verify);
+
+  if (rv || !verify)
+    {
+      op->status = VNET_CRYPTO_OP_STATUS_COMPLETED;
+    }
+  else
+    {
+      op->status = VNET_CRYPTO_OP_STATUS_FAIL_BAD_HMAC;
+      n_ops--;
+    }
+
+  if (--n_left)
+    {
+      op += 1;
+      goto next;
+    }
+
+  return n_ops;
+}
+
 static_always_inline void *
 aes_gcm_key_exp (vnet_crypto_key_t *key, aes_key_size_t ks)
 {
@@ -130,6 +166,36 @@ aes_gcm_key_exp (vnet_crypto_key_t *key, aes_key_size_t ks)
   {                                                                           \
     return aes_ops_enc_aes_gcm (ops, n_ops, AES_KEY_##x, 1, 12);              \
   }                                                                           \
+  static u32 aes_ops_dec_aes_gmac_##x (vlib_main_t *vm,                       \
+				       vnet_crypto_op_t *ops[], u32 n_ops)    \
+  {                                                                           \
+    return aes_ops_aes_gmac (ops, n_ops, AES_KEY_##x, 0, 0, 1);               \
+  }                                                                           \
+  static u32 aes_ops_enc_aes_gmac_##x (vlib_main_t *vm,                       \
+				       vnet_crypto_op_t *ops[], u32 n_ops)    \
+  {                                                                           \
+    return aes_ops_aes_gmac (ops, n_ops, AES_KEY_##x, 0, 0, 0);               \
+  }                                                                           \
+  static u32 aes_ops_dec_aes_gmac_##x##_tag16_aad8 (                          \
+    vlib_main_t *vm, vnet_crypto_op_t *ops[], u32 n_ops)                      \
+  {                                                                           \
+    return aes_ops_aes_gmac (ops, n_ops, AES_KEY_##x, 1, 8, 1);               \
+  }                                                                           \
+  static u32 aes_ops_enc_aes_gmac_##x##_tag16_aad8 (                          \
+    vlib_main_t *vm, vnet_crypto_op_t *ops[], u32 n_ops)                      \
+  {                                                                           \
+    return aes_ops_aes_gmac (ops, n_ops, AES_KEY_##x, 1, 8, 0);               \
+  }                                                                           \
+  static u32 aes_ops_dec_aes_gmac_##x##_tag16_aad12 (                         \
+    vlib_main_t *vm, vnet_crypto_op_t *ops[], u32 n_ops)                      \
+  {                                                                           \
+    return aes_ops_aes_gmac (ops, n_ops, AES_KEY_##x, 1, 12, 1);              \
+  }                                                                           \
+  static u32 aes_ops_enc_aes_gmac_##x##_tag16_aad12 (                         \
+    vlib_main_t *vm, vnet_crypto_op_t *ops[], u32 n_ops)                      \
+  {                                                                           \
+    return aes_ops_aes_gmac (ops, n_ops, AES_KEY_##x, 1, 12, 0);              \
+  }                                                                           \
   static void *aes_gcm_key_exp_##x (vnet_crypto_key_t *key)                   \
   {                                                                           \
     return aes_gcm_key_exp (key, AES_KEY_##x);                                \
@@ -204,6 +270,48 @@ probe ()
     .alg_id = VNET_CRYPTO_ALG_AES_##b##_GCM,                                  \
     .key_fn = aes_gcm_key_exp_##b,                                            \
     .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gmac_enc) = {                           \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_NULL_GMAC_ENC,                          \
+    .fn = aes_ops_enc_aes_gmac_##b,                                           \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gmac_dec) = {                           \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_NULL_GMAC_DEC,                          \
+    .fn = aes_ops_dec_aes_gmac_##b,                                           \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gmac_enc_tag16_aad8) = {                \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_NULL_GMAC_TAG16_AAD8_ENC,               \
+    .fn = aes_ops_enc_aes_gmac_##b##_tag16_aad8,                              \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gmac_dec_tag16_aad8) = {                \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_NULL_GMAC_TAG16_AAD8_DEC,               \
+    .fn = aes_ops_dec_aes_gmac_##b##_tag16_aad8,                              \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gmac_enc_tag16_aad12) = {               \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_NULL_GMAC_TAG16_AAD12_ENC,              \
+    .fn = aes_ops_enc_aes_gmac_##b##_tag16_aad12,                             \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gmac_dec_tag16_aad12) = {               \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_NULL_GMAC_TAG16_AAD12_DEC,              \
+    .fn = aes_ops_dec_aes_gmac_##b##_tag16_aad12,                             \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_KEY_HANDLER (aes_##b##_gmac) = {                              \
+    .alg_id = VNET_CRYPTO_ALG_AES_##b##_NULL_GMAC,                            \
+    .key_fn = aes_gcm_key_exp_##b,                                            \
+    .probe = probe,                                                           \
   };
 
 _ (128) _ (192) _ (256)
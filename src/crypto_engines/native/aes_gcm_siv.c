@@ -0,0 +1,170 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright(c) 2025 Cisco Systems, Inc.
+ */
+
+#include <vlib/vlib.h>
+#include <vnet/plugin/plugin.h>
+#include <vnet/crypto/crypto.h>
+#include <native/crypto_native.h>
+#include <vppinfra/crypto/aes_gcm_siv.h>
+
+#if __GNUC__ > 4 && !__clang__ && CLIB_DEBUG == 0
+#pragma GCC optimize("O3")
+#endif
+
+/* AES-GCM-SIV tag is always 16 bytes, op->tag_len is not used */
+static_always_inline u32
+aes_ops_aes_gcm_siv (vnet_crypto_op_t *ops[], u32 n_ops, aes_key_size_t ks,
+		     u32 fixed, u32 aad_len, int is_encrypt)
+{
+  crypto_native_main_t *cm = &crypto_native_main;
+  vnet_crypto_op_t *op = ops[0];
+  aes_gcm_siv_key_data_t *kd;
+  u32 n_left = n_ops;
+  int rv;
+
+next:
+  kd = (aes_gcm_siv_key_data_t *) cm->key_data[op->key_index];
+  rv = aes_gcm_siv (op->src, op->dst, op->aad, op->iv, op->tag, op->len,
+		    fixed ? aad_len : op->aad_len, kd, ks, is_encrypt);
+
+  if (rv)
+    {
+      op->status = VNET_CRYPTO_OP_STATUS_COMPLETED;
+    }
+  else
+    {
+      op->status = VNET_CRYPTO_OP_STATUS_FAIL_BAD_HMAC;
+      n_ops--;
+    }
+
+  if (--n_left)
+    {
+      op += 1;
+      goto next;
+    }
+
+  return n_ops;
+}
+
+static_always_inline void *
+aes_gcm_siv_key_exp (vnet_crypto_key_t *key, aes_key_size_t ks)
+{
+  aes_gcm_siv_key_data_t *kd;
+
+  kd = clib_mem_alloc_aligned (sizeof (*kd), CLIB_CACHE_LINE_BYTES);
+
+  clib_aes_gcm_siv_key_expand (kd, key->data, ks);
+
+  return kd;
+}
+
+#define foreach_aes_gcm_siv_handler_type _ (128) _ (256)
+
+#define _(x)                                                                  \
+  static u32 aes_ops_dec_aes_gcm_siv_##x (vlib_main_t *vm,                    \
+					  vnet_crypto_op_t *ops[], u32 n_ops) \
+  {                                                                           \
+    return aes_ops_aes_gcm_siv (ops, n_ops, AES_KEY_##x, 0, 0, 0);            \
+  }                                                                           \
+  static u32 aes_ops_enc_aes_gcm_siv_##x (vlib_main_t *vm,                    \
+					  vnet_crypto_op_t *ops[], u32 n_ops) \
+  {                                                                           \
+    return aes_ops_aes_gcm_siv (ops, n_ops, AES_KEY_##x, 0, 0, 1);            \
+  }                                                                           \
+  static u32 aes_ops_dec_aes_gcm_siv_##x##_tag16_aad8 (                       \
+    vlib_main_t *vm, vnet_crypto_op_t *ops[], u32 n_ops)                      \
+  {                                                                           \
+    return aes_ops_aes_gcm_siv (ops, n_ops, AES_KEY_##x, 1, 8, 0);            \
+  }                                                                           \
+  static u32 aes_ops_enc_aes_gcm_siv_##x##_tag16_aad8 (                       \
+    vlib_main_t *vm, vnet_crypto_op_t *ops[], u32 n_ops)                      \
+  {                                                                           \
+    return aes_ops_aes_gcm_siv (ops, n_ops, AES_KEY_##x, 1, 8, 1);            \
+  }                                                                           \
+  static u32 aes_ops_dec_aes_gcm_siv_##x##_tag16_aad12 (                      \
+    vlib_main_t *vm, vnet_crypto_op_t *ops[], u32 n_ops)                      \
+  {                                                                           \
+    return aes_ops_aes_gcm_siv (ops, n_ops, AES_KEY_##x, 1, 12, 0);           \
+  }                                                                           \
+  static u32 aes_ops_enc_aes_gcm_siv_##x##_tag16_aad12 (                      \
+    vlib_main_t *vm, vnet_crypto_op_t *ops[], u32 n_ops)                      \
+  {                                                                           \
+    return aes_ops_aes_gcm_siv (ops, n_ops, AES_KEY_##x, 1, 12, 1);           \
+  }                                                                           \
+  static void *aes_gcm_siv_key_exp_##x (vnet_crypto_key_t *key)               \
+  {                                                                           \
+    return aes_gcm_siv_key_exp (key, AES_KEY_##x);                            \
+  }
+
+foreach_aes_gcm_siv_handler_type;
+#undef _
+
+static int
+probe ()
+{
+#if defined(__VAES__) && defined(__AVX512F__)
+  if (clib_cpu_supports_vpclmulqdq () && clib_cpu_supports_vaes () &&
+      clib_cpu_supports_avx512f ())
+    return 50;
+#elif defined(__VAES__)
+  if (clib_cpu_supports_vpclmulqdq () && clib_cpu_supports_vaes ())
+    return 40;
+#elif defined(__AVX512F__)
+  if (clib_cpu_supports_pclmulqdq () && clib_cpu_supports_avx512f ())
+    return 30;
+#elif defined(__AVX2__)
+  if (clib_cpu_supports_pclmulqdq () && clib_cpu_supports_avx2 ())
+    return 20;
+#elif __AES__
+  if (clib_cpu_supports_pclmulqdq () && clib_cpu_supports_aes ())
+    return 10;
+#endif
+  return -1;
+}
+
+#define _(b)                                                                  \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gcm_siv_enc) = {                        \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_GCM_SIV_ENC,                            \
+    .fn = aes_ops_enc_aes_gcm_siv_##b,                                        \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gcm_siv_dec) = {                        \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_GCM_SIV_DEC,                            \
+    .fn = aes_ops_dec_aes_gcm_siv_##b,                                        \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gcm_siv_enc_tag16_aad8) = {             \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_GCM_SIV_TAG16_AAD8_ENC,                 \
+    .fn = aes_ops_enc_aes_gcm_siv_##b##_tag16_aad8,                           \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gcm_siv_dec_tag16_aad8) = {             \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_GCM_SIV_TAG16_AAD8_DEC,                 \
+    .fn = aes_ops_dec_aes_gcm_siv_##b##_tag16_aad8,                           \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gcm_siv_enc_tag16_aad12) = {            \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_GCM_SIV_TAG16_AAD12_ENC,                \
+    .fn = aes_ops_enc_aes_gcm_siv_##b##_tag16_aad12,                          \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_OP_HANDLER (aes_##b##_gcm_siv_dec_tag16_aad12) = {            \
+    .op_id = VNET_CRYPTO_OP_AES_##b##_GCM_SIV_TAG16_AAD12_DEC,                \
+    .fn = aes_ops_dec_aes_gcm_siv_##b##_tag16_aad12,                          \
+    .probe = probe,                                                           \
+  };                                                                          \
+                                                                              \
+  CRYPTO_NATIVE_KEY_HANDLER (aes_##b##_gcm_siv) = {                           \
+    .alg_id = VNET_CRYPTO_ALG_AES_##b##_GCM_SIV,                              \
+    .key_fn = aes_gcm_siv_key_exp_##b,                                        \
+    .probe = probe,                                                           \
+  };
+
+_ (128) _ (256)
+#undef _
@@ -0,0 +1,197 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright(c) 2025 Cisco Systems, Inc.
+ */
+
+#include <vlib/vlib.h>
+#include <vnet/plugin/plugin.h>
+#include <vnet/crypto/crypto.h>
+#include <native/crypto_native.h>
+#include <vppinfra/crypto/chacha20_poly1305.h>
+
+#if __GNUC__ > 4 && !__clang__ && CLIB_DEBUG == 0
+#pragma GCC optimize("O3")
+#endif
+
+/* number of ops handed to multi-buffer code at once */
+#define CHACHA20_POLY1305_BATCH_SIZE 32
+
+static_always_inline u32
+chacha20_poly1305_ops (vnet_crypto_op_t *ops[], u32 n_ops,
+		       chacha20_poly1305_op_type_t type, u32 fixed,
+		       u32 aad_len)
+{
+  crypto_native_main_t *cm = &crypto_native_main;
+  clib_chacha20_poly1305_op_t cops[CHACHA20_POLY1305_BATCH_SIZE];
+  u32 n_fail = 0;
+
+  for (u32 i = 0; i < n_ops; i += CHACHA20_POLY1305_BATCH_SIZE)
+    {
+      u32 n = clib_min (n_ops - i, CHACHA20_POLY1305_BATCH_SIZE);
+
+      for (u32 j = 0; j < n; j++)
+	{
+	  vnet_crypto_op_t *op = ops[i + j];
+	  cops[j] = (clib_chacha20_poly1305_op_t){
+	    .key = cm->key_data[op->key_index],
+	    .iv = op->iv,
+	    .aad = op->aad,
+	    .aad_len = fixed ? aad_len : op->aad_len,
+	    .src = op->src,
+	    .dst = op->dst,
+	    .len = op->len,
+	    .tag = op->tag,
+	    .tag_len = fixed ? 16 : op->tag_len,
+	  };
+	}
+
+      n_fail += clib_chacha20_poly1305_ops (cops, n, type);
+
+      for (u32 j = 0; j < n; j++)
+	ops[i + j]->status = cops[j].bad_tag ?
+			       VNET_CRYPTO_OP_STATUS_FAIL_BAD_HMAC :
+			       VNET_CRYPTO_OP_STATUS_COMPLETED;
+    }
+
+  return n_ops - n_fail;
+}
+
+static_always_inline u32
+chacha20_poly1305_chained_ops (vnet_crypto_op_t *ops[],
+			       vnet_crypto_op_chunk_t *chunks, u32 n_ops,
+			       chacha20_poly1305_op_type_t type, u32 fixed,
+			       u32 aad_len)
+{
+  crypto_native_main_t *cm = &crypto_native_main;
+  clib_chacha20_poly1305_ctx_t ctx;
+  u32 n_fail = 0;
+  u8 tag[16];
+
+  for (u32 i = 0; i < n_ops; i++)
+    {
+      vnet_crypto_op_t *op = ops[i];
+      u32 tag_len = fixed ? 16 : op->tag_len;
+
+      clib_chacha20_poly1305_init (&ctx, cm->key_data[op->key_index], op->iv,
+				   op->aad, fixed ? aad_len : op->aad_len);
+
+      if (op->flags & VNET_CRYPTO_OP_FLAG_CHAINED_BUFFERS)
+	{
+	  vnet_crypto_op_chunk_t *chp = chunks + op->chunk_index;
+	  for (int j = 0; j < op->n_chunks; j++, chp++)
+	    clib_chacha20_poly1305_update (&ctx, chp->src, chp->dst, chp->len,
+					   type);
+	}
+      else
+	clib_chacha20_poly1305_update (&ctx, op->src, op->dst, op->len, type);
+
+      clib_chacha20_poly1305_final (&ctx, tag);
+
+      if (type == CHACHA20_POLY1305_OP_ENCRYPT)
+	u8x16_store_partial (*(u8x16u *) tag, op->tag, tag_len);
+      else if (memcmp (op->tag, tag, tag_len))
+	{
+	  op->status = VNET_CRYPTO_OP_STATUS_FAIL_BAD_HMAC;
+	  n_fail++;
+	  continue;
+	}
+
+      op->status = VNET_CRYPTO_OP_STATUS_COMPLETED;
+    }
+
+  return n_ops - n_fail;
+}
+
+static void *
+chacha20_poly1305_key_exp (vnet_crypto_key_t *key)
+{
+  clib_chacha20_key_t *kd;
+
+  kd = clib_mem_alloc_aligned (sizeof (*kd), CLIB_CACHE_LINE_BYTES);
+  clib_chacha20_key_init (kd, key->data);
+
+  return kd;
+}
+
+#define foreach_chacha20_poly1305_handler_type                                \
+  _ (, 0, 0)                                                                  \
+  _ (_tag16_aad0, 1, 0)                                                       \
+  _ (_tag16_aad8, 1, 8)                                                       \
+  _ (_tag16_aad12, 1, 12)
+
+#define _(n, f, a)                                                            \
+  static u32 chacha20_poly1305_enc##n (vlib_main_t *vm,                       \
+				       vnet_crypto_op_t *ops[], u32 n_ops)    \
+  {                                                                           \
+    return chacha20_poly1305_ops (ops, n_ops, CHACHA20_POLY1305_OP_ENCRYPT,   \
+				  f, a);                                      \
+  }                                                                           \
+  static u32 chacha20_poly1305_dec##n (vlib_main_t *vm,                       \
+				       vnet_crypto_op_t *ops[], u32 n_ops)    \
+  {                                                                           \
+    return chacha20_poly1305_ops (ops, n_ops, CHACHA20_POLY1305_OP_DECRYPT,   \
+				  f, a);                                      \
+  }                                                                           \
+  static u32 chacha20_poly1305_enc##n##_chained (                             \
+    vlib_main_t *vm, vnet_crypto_op_t *ops[], vnet_crypto_op_chunk_t *chunks, \
+    u32 n_ops)                                                                \
+  {                                                                           \
+    return chacha20_poly1305_chained_ops (                                    \
+      ops, chunks, n_ops, CHACHA20_POLY1305_OP_ENCRYPT, f, a);                \
+  }                                                                           \
+  static u32 chacha20_poly1305_dec##n##_chained (                             \
+    vlib_main_t *vm, vnet_crypto_op_t *ops[], vnet_crypto_op_chunk_t *chunks, \
+    u32 n_ops)                                                                \
+  {                                                                           \
+    return chacha20_poly1305_chained_ops (                                    \
+      ops, chunks, n_ops, CHACHA20_POLY1305_OP_DECRYPT, f, a);                \
+  }
+
+foreach_chacha20_poly1305_handler_type;
+#undef _
+
+static int
+probe ()
+{
+#if defined(__AVX512BITALG__)
+  if (clib_cpu_supports_avx512_bitalg ())
+    return 50;
+#elif defined(__AVX512F__)
+  if (clib_cpu_supports_avx512f ())
+    return 30;
+#elif defined(__AVX2__)
+  if (clib_cpu_supports_avx2 ())
+    return 20;
+#elif defined(__SSE4_2__)
+  if (clib_cpu_supports_sse42 ())
+    return 10;
+#elif __aarch64__
+  return 10;
+#endif
+  return -1;
+}
+
+#define _(n, N)                                                               \
+  CRYPTO_NATIVE_OP_HANDLER (chacha20_poly1305##n##_enc) = {                   \
+    .op_id = VNET_CRYPTO_OP_CHACHA20_POLY1305##N##_ENC,                       \
+    .fn = chacha20_poly1305_enc##n,                                           \
+    .cfn = chacha20_poly1305_enc##n##_chained,                                \
+    .probe = probe,                                                           \
+  };                                                                          \
+  CRYPTO_NATIVE_OP_HANDLER (chacha20_poly1305##n##_dec) = {                   \
+    .op_id = VNET_CRYPTO_OP_CHACHA20_POLY1305##N##_DEC,                       \
+    .fn = chacha20_poly1305_dec##n,                                           \
+    .cfn = chacha20_poly1305_dec##n##_chained,                                \
+    .probe = probe,                                                           \
+  };
+
+_ (, )
+_ (_tag16_aad0, _TAG16_AAD0)
+_ (_tag16_aad8, _TAG16_AAD8)
+_ (_tag16_aad12, _TAG16_AAD12)
+#undef _
+
+CRYPTO_NATIVE_KEY_HANDLER (chacha20_poly1305) = {
+  .alg_id = VNET_CRYPTO_ALG_CHACHA20_POLY1305,
+  .key_fn = chacha20_poly1305_key_exp,
+  .probe = probe,
+};
@@ -40,6 +40,30 @@ next:
   return n_ops;
 }
 
+static_always_inline u32
+crypto_native_hmac_sha2_done (vnet_crypto_op_t *op, u8 *buffer,
+			      clib_sha2_type_t type)
+{
+  u32 sz = op->digest_len;
+
+  if (sz == 0)
+    sz = clib_sha2_variants[type].digest_size;
+
+  if (op->flags & VNET_CRYPTO_OP_FLAG_HMAC_CHECK)
+    {
+      if ((memcmp (op->digest, buffer, sz)))
+	{
+	  op->status = VNET_CRYPTO_OP_STATUS_FAIL_BAD_HMAC;
+	  return 1;
+	}
+    }
+  else
+    clib_memcpy_fast (op->digest, buffer, sz);
+
+  op->status = VNET_CRYPTO_OP_STATUS_COMPLETED;
+  return 0;
+}
+
 static_always_inline u32
 crypto_native_ops_hmac_sha2 (vlib_main_t *vm, vnet_crypto_op_t *ops[],
 			     u32 n_ops, vnet_crypto_op_chunk_t *chunks,
@@ -50,7 +74,7 @@ crypto_native_ops_hmac_sha2 (vlib_main_t *vm, vnet_crypto_op_t *ops[],
   u32 n_left = n_ops;
   clib_sha2_hmac_ctx_t ctx;
   u8 buffer[64];
-  u32 sz, n_fail = 0;
+  u32 n_fail = 0;
 
   for (; n_left; n_left--, op++)
     {
@@ -67,42 +91,52 @@ crypto_native_ops_hmac_sha2 (vlib_main_t *vm, vnet_crypto_op_t *ops[],
 
       clib_sha2_hmac_final (&ctx, buffer);
 
-      if (op->digest_len)
-	{
-	  sz = op->digest_len;
-	  if (op->flags & VNET_CRYPTO_OP_FLAG_HMAC_CHECK)
-	    {
-	      if ((memcmp (op->digest, buffer, sz)))
-		{
-		  n_fail++;
-		  op->status = VNET_CRYPTO_OP_STATUS_FAIL_BAD_HMAC;
-		  continue;
-		}
-	    }
-	  else
-	    clib_memcpy_fast (op->digest, buffer, sz);
-	}
-      else
+      n_fail += crypto_native_hmac_sha2_done (op, buffer, type);
+    }
+
+  return n_ops - n_fail;
+}
+
+#if defined(CLIB_SHA256_MB_N_LANES) && !defined(CLIB_SHA256_ISA)
+/* no SHA instructions, compute multiple ops in parallel in vector lanes */
+#define CRYPTO_NATIVE_HMAC_SHA2_MB
+
+/* number of ops handed to multi-buffer code at once */
+#define SHA2_HMAC_MB_BATCH_SIZE 64
+
+static_always_inline u32
+crypto_native_ops_hmac_sha2_mb (vnet_crypto_op_t *ops[], u32 n_ops,
+				clib_sha2_type_t type)
+{
+  crypto_native_main_t *cm = &crypto_native_main;
+  clib_sha2_hmac_mb_op_t mops[SHA2_HMAC_MB_BATCH_SIZE];
+  u8 digest[SHA2_HMAC_MB_BATCH_SIZE][32];
+  u32 n_fail = 0;
+
+  for (u32 i = 0; i < n_ops; i += SHA2_HMAC_MB_BATCH_SIZE)
+    {
+      u32 n = clib_min (n_ops - i, SHA2_HMAC_MB_BATCH_SIZE);
+
+      for (u32 j = 0; j < n; j++)
 	{
-	  sz = clib_sha2_variants[type].digest_size;
-	  if (op->flags & VNET_CRYPTO_OP_FLAG_HMAC_CHECK)
-	    {
-	      if ((memcmp (op->digest, buffer, sz)))
-		{
-		  n_fail++;
-		  op->status = VNET_CRYPTO_OP_STATUS_FAIL_BAD_HMAC;
-		  continue;
-		}
-	    }
-	  else
-	    clib_memcpy_fast (op->digest, buffer, sz);
+	  vnet_crypto_op_t *op = ops[i + j];
+	  mops[j] = (clib_sha2_hmac_mb_op_t){
+	    .kd = cm->key_data[op->key_index],
+	    .src = op->src,
+	    .len = op->len,
+	    .digest = digest[j],
+	  };
 	}
 
-      op->status = VNET_CRYPTO_OP_STATUS_COMPLETED;
+      clib_sha2_hmac_mb (type, mops, n);
+
+      for (u32 j = 0; j < n; j++)
+	n_fail += crypto_native_hmac_sha2_done (ops[i + j], digest[j], type);
     }
 
   return n_ops - n_fail;
 }
+#endif
 
 static void *
 sha2_key_add (vnet_crypto_key_t *key, clib_sha2_type_t type)
@@ -140,6 +174,37 @@ probe ()
   return -1;
 }
 
+static int
+probe_hmac ()
+{
+#if defined(CRYPTO_NATIVE_HMAC_SHA2_MB)
+  /* lower priority than any variant with SHA instructions */
+#if defined(__AVX512F__)
+  if (clib_cpu_supports_avx512f ())
+    return 9;
+#elif defined(__AVX2__)
+  if (clib_cpu_supports_avx2 ())
+    return 8;
+#elif defined(__SSE4_2__)
+  if (clib_cpu_supports_sse42 ())
+    return 5;
+#elif defined(__aarch64__)
+  return 5;
+#endif
+  return -1;
+#else
+  return probe ();
+#endif
+}
+
+#if defined(CRYPTO_NATIVE_HMAC_SHA2_MB)
+#define crypto_native_ops_hmac_sha2_single(vm, ops, n_ops, type)              \
+  crypto_native_ops_hmac_sha2_mb (ops, n_ops, type)
+#else
+#define crypto_native_ops_hmac_sha2_single(vm, ops, n_ops, type)              \
+  crypto_native_ops_hmac_sha2 (vm, ops, n_ops, 0, type)
+#endif
+
 #define _(b)                                                                  \
   static u32 crypto_native_ops_hash_sha##b (                                  \
     vlib_main_t *vm, vnet_crypto_op_t *ops[], u32 n_ops)                      \
@@ -158,7 +223,8 @@ probe ()
   static u32 crypto_native_ops_hmac_sha##b (                                  \
     vlib_main_t *vm, vnet_crypto_op_t *ops[], u32 n_ops)                      \
   {                                                                           \
-    return crypto_native_ops_hmac_sha2 (vm, ops, n_ops, 0, CLIB_SHA2_##b);    \
+    return crypto_native_ops_hmac_sha2_single (vm, ops, n_ops,               \
+					       CLIB_SHA2_##b);                \
   }                                                                           \
                                                                               \
   static u32 crypto_native_ops_chained_hmac_sha##b (                          \
@@ -184,12 +250,12 @@ probe ()
     .op_id = VNET_CRYPTO_OP_SHA##b##_HMAC,                                    \
     .fn = crypto_native_ops_hmac_sha##b,                                      \
     .cfn = crypto_native_ops_chained_hmac_sha##b,                             \
-    .probe = probe,                                                           \
+    .probe = probe_hmac,                                                      \
   };                                                                          \
   CRYPTO_NATIVE_KEY_HANDLER (crypto_native_hmac_sha##b) = {                   \
     .alg_id = VNET_CRYPTO_ALG_HMAC_SHA##b,                                    \
     .key_fn = sha2_##b##_key_add,                                             \
-    .probe = probe,                                                           \
+    .probe = probe_hmac,                                                      \
   };
 
 _ (224)
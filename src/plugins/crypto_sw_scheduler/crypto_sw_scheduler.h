@@ -21,6 +21,10 @@
 #define CRYPTO_SW_SCHEDULER_QUEUE_SIZE 64
 #define CRYPTO_SW_SCHEDULER_QUEUE_MASK (CRYPTO_SW_SCHEDULER_QUEUE_SIZE - 1)
 
+/* max number of dequeue calls a worker skips stealing for after finding
+ * nothing to steal, doubled on every miss */
+#define CRYPTO_SW_SCHEDULER_MAX_BACKOFF 64
+
 STATIC_ASSERT ((0 == (CRYPTO_SW_SCHEDULER_QUEUE_SIZE &
 		      (CRYPTO_SW_SCHEDULER_QUEUE_SIZE - 1))),
 	       "CRYPTO_SW_SCHEDULER_QUEUE_SIZE is not pow2");
@@ -37,14 +41,32 @@ typedef struct
   CLIB_CACHE_LINE_ALIGN_MARK (cacheline0);
   u32 head;
   u32 tail;
+  /* frames enqueued and not yet claimed by any thread, lets the threads
+   * looking for work skip empty queues without walking them */
+  u32 n_pending;
   vnet_crypto_async_frame_t **jobs;
 } crypto_sw_scheduler_queue_t;
 
+#define foreach_crypto_sw_scheduler_counter                                   \
+  _ (ENC_QUEUE_DEPTH, "enc-queue-depth")                                      \
+  _ (DEC_QUEUE_DEPTH, "dec-queue-depth")                                      \
+  _ (FRAMES_OWN, "frames-own")                                                \
+  _ (FRAMES_STOLEN, "frames-stolen")                                          \
+  _ (STEAL_MISSES, "steal-misses")
+
+typedef enum
+{
+#define _(sym, str) CRYPTO_SW_SCHEDULER_COUNTER_##sym,
+  foreach_crypto_sw_scheduler_counter
+#undef _
+    CRYPTO_SW_SCHEDULER_N_COUNTERS,
+} crypto_sw_scheduler_counter_t;
+
 typedef struct
 {
   CLIB_CACHE_LINE_ALIGN_MARK (cacheline0);
   crypto_sw_scheduler_queue_t queue[CRYPTO_SW_SCHED_QUEUE_N_TYPES];
-  u32 last_serve_lcore_id;
+  u32 last_steal;
   u8 last_serve_encrypt;
   u8 last_return_queue;
   vnet_crypto_op_t *crypto_ops;
@@ -53,6 +75,14 @@ typedef struct
   vnet_crypto_op_t *chained_integ_ops;
   vnet_crypto_op_chunk_t *chunks;
   u8 self_crypto_enabled;
+  /* dedicated crypto workers steal without back-off and across numa
+   * nodes */
+  u8 dedicated;
+  u16 backoff;
+  u16 backoff_left;
+  /* threads to steal from, on the same numa node and on other ones */
+  u32 *steal_local;
+  u32 *steal_remote;
 } crypto_sw_scheduler_per_thread_data_t;
 
 typedef struct
@@ -61,11 +91,14 @@ typedef struct
   crypto_sw_scheduler_per_thread_data_t *per_thread_data;
   vnet_crypto_key_t *keys;
   u32 crypto_sw_scheduler_queue_mask;
+  vlib_simple_counter_main_t counters[CRYPTO_SW_SCHEDULER_N_COUNTERS];
 } crypto_sw_scheduler_main_t;
 
 extern crypto_sw_scheduler_main_t crypto_sw_scheduler_main;
 
 extern int crypto_sw_scheduler_set_worker_crypto (u32 worker_idx, u8 enabled);
+extern int crypto_sw_scheduler_set_worker_dedicated (u32 worker_idx,
+						     u8 dedicated);
 
 extern clib_error_t *crypto_sw_scheduler_api_init (vlib_main_t * vm);
 
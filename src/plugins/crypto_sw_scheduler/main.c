@@ -40,8 +40,10 @@ crypto_sw_scheduler_set_worker_crypto (u32 worker_idx, u8 enabled)
 
   if (enabled || count > 1)
     {
-      cm->per_thread_data[vlib_get_worker_thread_index
-			  (worker_idx)].self_crypto_enabled = enabled;
+      ptd = cm->per_thread_data + vlib_get_worker_thread_index (worker_idx);
+      ptd->self_crypto_enabled = enabled;
+      if (!enabled)
+	ptd->dedicated = 0;
     }
   else				/* cannot disable all crypto workers */
     {
@@ -50,6 +52,35 @@ crypto_sw_scheduler_set_worker_crypto (u32 worker_idx, u8 enabled)
   return 0;
 }
 
+int
+crypto_sw_scheduler_set_worker_dedicated (u32 worker_idx, u8 dedicated)
+{
+  crypto_sw_scheduler_main_t *cm = &crypto_sw_scheduler_main;
+  crypto_sw_scheduler_per_thread_data_t *ptd;
+
+  if (worker_idx >= vlib_num_workers ())
+    return VNET_API_ERROR_INVALID_VALUE;
+
+  ptd = cm->per_thread_data + vlib_get_worker_thread_index (worker_idx);
+  ptd->dedicated = dedicated;
+  ptd->backoff = ptd->backoff_left = 0;
+  if (dedicated)
+    ptd->self_crypto_enabled = 1;
+
+  return 0;
+}
+
+static_always_inline void
+crypto_sw_scheduler_update_depth (crypto_sw_scheduler_main_t *cm,
+				  crypto_sw_scheduler_queue_t *q,
+				  u32 thread_index, u8 is_enc)
+{
+  vlib_set_simple_counter (
+    &cm->counters[is_enc ? CRYPTO_SW_SCHEDULER_COUNTER_ENC_QUEUE_DEPTH :
+			   CRYPTO_SW_SCHEDULER_COUNTER_DEC_QUEUE_DEPTH],
+    thread_index, 0, q->head - q->tail);
+}
+
 static void
 crypto_sw_scheduler_key_handler (vnet_crypto_key_op_t kop,
 				 vnet_crypto_key_index_t idx)
@@ -97,6 +128,9 @@ crypto_sw_scheduler_frame_enqueue (vlib_main_t *vm,
   head += 1;
   CLIB_MEMORY_STORE_BARRIER ();
   current_queue->head = head;
+  clib_atomic_add_fetch (&current_queue->n_pending, 1);
+  crypto_sw_scheduler_update_depth (cm, current_queue, vm->thread_index,
+				    is_enc);
   return 0;
 }
 
@@ -444,84 +478,204 @@ convert_async_crypto_id (vnet_crypto_op_id_t async_op_id, u32 *crypto_op,
   return -1;
 }
 
+/* claim the oldest pending frame of a queue, owned by this or any other
+ * thread */
 static_always_inline vnet_crypto_async_frame_t *
-crypto_sw_scheduler_dequeue (vlib_main_t *vm, u32 *nb_elts_processed,
-			     u32 *enqueue_thread_idx)
+crypto_sw_scheduler_claim (crypto_sw_scheduler_main_t *cm,
+			   crypto_sw_scheduler_queue_t *q)
 {
-  crypto_sw_scheduler_main_t *cm = &crypto_sw_scheduler_main;
-  crypto_sw_scheduler_per_thread_data_t *ptd =
-    cm->per_thread_data + vm->thread_index;
-  vnet_crypto_async_frame_t *f = 0;
-  crypto_sw_scheduler_queue_t *current_queue = 0;
-  u32 tail, head;
-  u8 found = 0;
-  u8 recheck_queues = 1;
+  vnet_crypto_async_frame_t *f;
+  u32 head, tail, j;
 
-run_next_queues:
-  /* get a pending frame to process */
-  if (ptd->self_crypto_enabled)
+  if (clib_atomic_load_relax_n (&q->n_pending) == 0)
+    return 0;
+
+  head = clib_atomic_load_acq_n (&q->head);
+  tail = clib_atomic_load_acq_n (&q->tail);
+
+  /* the owner may have moved tail past our head snapshot */
+  if (head - tail > cm->crypto_sw_scheduler_queue_mask + 1)
+    return 0;
+
+  for (j = tail; j != head; j++)
     {
-      u32 i = ptd->last_serve_lcore_id + 1;
+      f = q->jobs[j & cm->crypto_sw_scheduler_queue_mask];
+
+      if (!f)
+	continue;
 
-      while (1)
+      if (clib_atomic_bool_cmp_and_swap (
+	    &f->state, VNET_CRYPTO_FRAME_STATE_PENDING,
+	    VNET_CRYPTO_FRAME_STATE_WORK_IN_PROGRESS))
 	{
-	  crypto_sw_scheduler_per_thread_data_t *st;
-	  u32 j;
+	  clib_atomic_sub_fetch (&q->n_pending, 1);
+	  return f;
+	}
+    }
 
-	  if (i >= vec_len (cm->per_thread_data))
-	    i = 0;
+  return 0;
+}
 
-	  st = cm->per_thread_data + i;
+static_always_inline vnet_crypto_async_frame_t *
+crypto_sw_scheduler_claim_own (crypto_sw_scheduler_main_t *cm,
+			       crypto_sw_scheduler_per_thread_data_t *ptd)
+{
+  vnet_crypto_async_frame_t *f;
+  u8 is_enc;
+  int i;
 
-	  if (ptd->last_serve_encrypt)
-	    current_queue = &st->queue[CRYPTO_SW_SCHED_QUEUE_TYPE_DECRYPT];
-	  else
-	    current_queue = &st->queue[CRYPTO_SW_SCHED_QUEUE_TYPE_ENCRYPT];
+  /* alternate between encrypt and decrypt so neither starves */
+  for (i = 0; i < CRYPTO_SW_SCHED_QUEUE_N_TYPES; i++)
+    {
+      is_enc = !ptd->last_serve_encrypt;
+      ptd->last_serve_encrypt = is_enc;
+      f = crypto_sw_scheduler_claim (
+	cm, &ptd->queue[is_enc ? CRYPTO_SW_SCHED_QUEUE_TYPE_ENCRYPT :
+				 CRYPTO_SW_SCHED_QUEUE_TYPE_DECRYPT]);
+      if (f)
+	return f;
+    }
 
-	  tail = current_queue->tail;
-	  head = current_queue->head;
+  return 0;
+}
 
-	  /* Skip this queue unless tail < head or head has overflowed
-	   * and tail has not. At the point where tail overflows (== 0),
-	   * the largest possible value of head is (queue size - 1).
-	   * Prior to that, the largest possible value of head is
-	   * (queue size - 2).
-	   */
-	  if ((tail > head) && (head >= cm->crypto_sw_scheduler_queue_mask))
-	    goto skip_queue;
+static_always_inline vnet_crypto_async_frame_t *
+crypto_sw_scheduler_steal_from (crypto_sw_scheduler_main_t *cm,
+				crypto_sw_scheduler_per_thread_data_t *ptd,
+				u32 *victims)
+{
+  crypto_sw_scheduler_per_thread_data_t *st;
+  vnet_crypto_async_frame_t *f;
+  u32 n_victims = vec_len (victims), i, v;
+  int j;
 
-	  for (j = tail; j != head; j++)
-	    {
+  for (i = 0; i < n_victims; i++)
+    {
+      v = (ptd->last_steal + i) % n_victims;
+      st = cm->per_thread_data + victims[v];
+
+      for (j = 0; j < CRYPTO_SW_SCHED_QUEUE_N_TYPES; j++)
+	if ((f = crypto_sw_scheduler_claim (cm, &st->queue[j])))
+	  {
+	    /* next time start with the one after this victim */
+	    ptd->last_steal = v + 1;
+	    return f;
+	  }
+    }
 
-	      f = current_queue->jobs[j & cm->crypto_sw_scheduler_queue_mask];
+  return 0;
+}
 
-	      if (!f)
-		continue;
+static_always_inline vnet_crypto_async_frame_t *
+crypto_sw_scheduler_steal (vlib_main_t *vm, crypto_sw_scheduler_main_t *cm,
+			   crypto_sw_scheduler_per_thread_data_t *ptd)
+{
+  vnet_crypto_async_frame_t *f;
+  u32 *local = clib_atomic_load_acq_n (&ptd->steal_local);
+  u32 *remote = clib_atomic_load_acq_n (&ptd->steal_remote);
 
-	      if (clib_atomic_bool_cmp_and_swap (
-		    &f->state, VNET_CRYPTO_FRAME_STATE_PENDING,
-		    VNET_CRYPTO_FRAME_STATE_WORK_IN_PROGRESS))
-		{
-		  found = 1;
-		  break;
-		}
-	    }
+  if (!local && !remote)
+    return 0;
 
-	skip_queue:
-	  if (found || i == ptd->last_serve_lcore_id)
-	    {
-	      CLIB_MEMORY_STORE_BARRIER ();
-	      ptd->last_serve_encrypt = !ptd->last_serve_encrypt;
-	      break;
-	    }
+  /* Shared workers back off after a miss, so an idle worker does not keep
+   * pulling the other workers' queue cache lines every loop. Only done in
+   * polling mode, in interrupt mode there may be no next call to steal on. */
+  if (ptd->backoff_left)
+    {
+      if (vlib_node_get_state (vm, crypto_main.crypto_node_index) ==
+	  VLIB_NODE_STATE_POLLING)
+	{
+	  ptd->backoff_left--;
+	  return 0;
+	}
+      ptd->backoff_left = 0;
+    }
+
+  f = crypto_sw_scheduler_steal_from (cm, ptd, local);
+
+  /* only dedicated workers go to other numa nodes */
+  if (!f && ptd->dedicated)
+    f = crypto_sw_scheduler_steal_from (cm, ptd, remote);
+
+  if (f)
+    {
+      ptd->backoff = 0;
+      vlib_increment_simple_counter (
+	&cm->counters[CRYPTO_SW_SCHEDULER_COUNTER_FRAMES_STOLEN],
+	vm->thread_index, 0, 1);
+      return f;
+    }
+
+  vlib_increment_simple_counter (
+    &cm->counters[CRYPTO_SW_SCHEDULER_COUNTER_STEAL_MISSES], vm->thread_index,
+    0, 1);
 
-	  i++;
+  if (!ptd->dedicated)
+    {
+      ptd->backoff = clib_min (ptd->backoff ? ptd->backoff << 1 : 1,
+			       CRYPTO_SW_SCHEDULER_MAX_BACKOFF);
+      ptd->backoff_left = ptd->backoff;
+    }
+
+  return 0;
+}
+
+/* completed frames go back to the enqueue thread in submission order */
+static_always_inline vnet_crypto_async_frame_t *
+crypto_sw_scheduler_return (crypto_sw_scheduler_main_t *cm,
+			    crypto_sw_scheduler_per_thread_data_t *ptd,
+			    u32 thread_index)
+{
+  crypto_sw_scheduler_queue_t *q;
+  vnet_crypto_async_frame_t *f;
+  u32 tail;
+  u8 is_enc;
+  int i;
+
+  for (i = 0; i < CRYPTO_SW_SCHED_QUEUE_N_TYPES; i++)
+    {
+      is_enc = !ptd->last_return_queue;
+      ptd->last_return_queue = is_enc;
+      q = &ptd->queue[is_enc ? CRYPTO_SW_SCHED_QUEUE_TYPE_ENCRYPT :
+			       CRYPTO_SW_SCHED_QUEUE_TYPE_DECRYPT];
+      tail = q->tail & cm->crypto_sw_scheduler_queue_mask;
+      f = q->jobs[tail];
+
+      if (f && f->state >= VNET_CRYPTO_FRAME_STATE_SUCCESS)
+	{
+	  CLIB_MEMORY_STORE_BARRIER ();
+	  q->tail++;
+	  q->jobs[tail] = 0;
+	  crypto_sw_scheduler_update_depth (cm, q, thread_index, is_enc);
+	  return f;
 	}
+    }
+
+  return 0;
+}
 
-      ptd->last_serve_lcore_id = i;
+static_always_inline vnet_crypto_async_frame_t *
+crypto_sw_scheduler_dequeue (vlib_main_t *vm, u32 *nb_elts_processed,
+			     u32 *enqueue_thread_idx)
+{
+  crypto_sw_scheduler_main_t *cm = &crypto_sw_scheduler_main;
+  crypto_sw_scheduler_per_thread_data_t *ptd =
+    cm->per_thread_data + vm->thread_index;
+  vnet_crypto_async_frame_t *f = 0;
+
+  /* own queues first, then steal from the other threads */
+  if (ptd->self_crypto_enabled)
+    {
+      f = crypto_sw_scheduler_claim_own (cm, ptd);
+      if (f)
+	vlib_increment_simple_counter (
+	  &cm->counters[CRYPTO_SW_SCHEDULER_COUNTER_FRAMES_OWN],
+	  vm->thread_index, 0, 1);
+      else
+	f = crypto_sw_scheduler_steal (vm, cm, ptd);
     }
 
-  if (found)
+  if (f)
     {
       u32 crypto_op, auth_op_or_aad_len;
       u16 digest_len;
@@ -542,37 +696,7 @@ run_next_queues:
       *nb_elts_processed = f->n_elts;
     }
 
-  if (ptd->last_return_queue)
-    {
-      current_queue = &ptd->queue[CRYPTO_SW_SCHED_QUEUE_TYPE_DECRYPT];
-      ptd->last_return_queue = 0;
-    }
-  else
-    {
-      current_queue = &ptd->queue[CRYPTO_SW_SCHED_QUEUE_TYPE_ENCRYPT];
-      ptd->last_return_queue = 1;
-    }
-
-  tail = current_queue->tail & cm->crypto_sw_scheduler_queue_mask;
-
-  if (current_queue->jobs[tail] &&
-      current_queue->jobs[tail]->state >= VNET_CRYPTO_FRAME_STATE_SUCCESS)
-    {
-
-      CLIB_MEMORY_STORE_BARRIER ();
-      current_queue->tail++;
-      f = current_queue->jobs[tail];
-      current_queue->jobs[tail] = 0;
-
-      return f;
-    }
-
-  if (!found && recheck_queues)
-    {
-      recheck_queues = 0;
-      goto run_next_queues;
-    }
-  return 0;
+  return crypto_sw_scheduler_return (cm, ptd, vm->thread_index);
 }
 
 static clib_error_t *
@@ -582,6 +706,7 @@ sw_scheduler_set_worker_crypto (vlib_main_t * vm, unformat_input_t * input,
   unformat_input_t _line_input, *line_input = &_line_input;
   u32 worker_index;
   u8 crypto_enable;
+  u8 dedicated = 0;
   int rv;
 
   /* Get a line of input. */
@@ -596,6 +721,8 @@ sw_scheduler_set_worker_crypto (vlib_main_t * vm, unformat_input_t * input,
 	    {
 	      if (unformat (line_input, "on"))
 		crypto_enable = 1;
+	      else if (unformat (line_input, "dedicated"))
+		crypto_enable = dedicated = 1;
 	      else if (unformat (line_input, "off"))
 		crypto_enable = 0;
 	      else
@@ -621,11 +748,15 @@ sw_scheduler_set_worker_crypto (vlib_main_t * vm, unformat_input_t * input,
     {
       return (clib_error_return (0, "cannot disable all crypto workers"));
     }
+  if (crypto_enable)
+    crypto_sw_scheduler_set_worker_dedicated (worker_index, dedicated);
   return 0;
 }
 
 /*?
- * This command sets if worker will do crypto processing.
+ * This command sets if worker will do crypto processing. A dedicated
+ * worker steals frames from the other workers without backing off, and
+ * also from workers on other numa nodes.
  *
  * @cliexpar
  * Example of how to set worker crypto processing off:
@@ -634,7 +765,7 @@ sw_scheduler_set_worker_crypto (vlib_main_t * vm, unformat_input_t * input,
  ?*/
 VLIB_CLI_COMMAND (cmd_set_sw_scheduler_worker_crypto, static) = {
   .path = "set sw_scheduler",
-  .short_help = "set sw_scheduler worker <idx> crypto <on|off>",
+  .short_help = "set sw_scheduler worker <idx> crypto <on|off|dedicated>",
   .function = sw_scheduler_set_worker_crypto,
   .is_mp_safe = 1,
 };
@@ -644,16 +775,27 @@ sw_scheduler_show_workers (vlib_main_t * vm, unformat_input_t * input,
 			   vlib_cli_command_t * cmd)
 {
   crypto_sw_scheduler_main_t *cm = &crypto_sw_scheduler_main;
+  crypto_sw_scheduler_per_thread_data_t *ptd;
   u32 i;
 
-  vlib_cli_output (vm, "%-7s%-20s%-8s", "ID", "Name", "Crypto");
+#define _(c) cm->counters[CRYPTO_SW_SCHEDULER_COUNTER_##c].counters[i][0]
+  vlib_cli_output (vm, "%-7s%-20s%-11s%-6s%-6s%-6s%-12s%-12s%-12s", "ID",
+		   "Name", "Crypto", "Numa", "Enc", "Dec", "Own", "Stolen",
+		   "Misses");
   for (i = 1; i < vlib_thread_main.n_vlib_mains; i++)
     {
-      vlib_cli_output (vm, "%-7d%-20s%-8s", vlib_get_worker_index (i),
-		       (vlib_worker_threads + i)->name,
-		       cm->
-		       per_thread_data[i].self_crypto_enabled ? "on" : "off");
+      ptd = cm->per_thread_data + i;
+      vlib_cli_output (
+	vm, "%-7d%-20s%-11s%-6d%-6Lu%-6Lu%-12Lu%-12Lu%-12Lu",
+	vlib_get_worker_index (i), (vlib_worker_threads + i)->name,
+	ptd->dedicated           ? "dedicated" :
+	ptd->self_crypto_enabled ? "on" :
+				   "off",
+	(vlib_worker_threads + i)->numa_id, _ (ENC_QUEUE_DEPTH),
+	_ (DEC_QUEUE_DEPTH), _ (FRAMES_OWN), _ (FRAMES_STOLEN),
+	_ (STEAL_MISSES));
     }
+#undef _
 
   return 0;
 }
@@ -682,6 +824,42 @@ sw_scheduler_cli_init (vlib_main_t * vm)
 VLIB_INIT_FUNCTION (sw_scheduler_cli_init);
 
 crypto_sw_scheduler_main_t crypto_sw_scheduler_main;
+
+/* the thread numa nodes are only known once the workers are launched */
+static clib_error_t *
+crypto_sw_scheduler_main_loop_enter (vlib_main_t *vm)
+{
+  crypto_sw_scheduler_main_t *cm = &crypto_sw_scheduler_main;
+  crypto_sw_scheduler_per_thread_data_t *ptd;
+  u32 n_threads = vec_len (cm->per_thread_data);
+  u32 i, j, *local, *remote;
+
+  for (i = 0; i < n_threads; i++)
+    {
+      ptd = cm->per_thread_data + i;
+      local = remote = 0;
+
+      for (j = 0; j < n_threads; j++)
+	{
+	  if (j == i)
+	    continue;
+	  if (vlib_worker_threads[j].numa_id == vlib_worker_threads[i].numa_id)
+	    vec_add1 (local, j);
+	  else
+	    vec_add1 (remote, j);
+	}
+
+      clib_atomic_store_rel_n (&ptd->steal_remote, remote);
+      clib_atomic_store_rel_n (&ptd->steal_local, local);
+    }
+
+  return 0;
+}
+
+VLIB_MAIN_LOOP_ENTER_FUNCTION (crypto_sw_scheduler_main_loop_enter) = {
+  .runs_after = VLIB_INITS ("start_workers"),
+};
+
 clib_error_t *
 crypto_sw_scheduler_init (vlib_main_t * vm)
 {
@@ -732,6 +910,18 @@ VLIB_PLUGIN_REGISTER () = {
   .description = "SW Scheduler Crypto Async Engine plugin",
 };
 
+static char *crypto_sw_scheduler_counter_names[] = {
+#define _(sym, str) str,
+  foreach_crypto_sw_scheduler_counter
+#undef _
+};
+
+static char *crypto_sw_scheduler_counter_stat_names[] = {
+#define _(sym, str) "/crypto/sw-scheduler/" str,
+  foreach_crypto_sw_scheduler_counter
+#undef _
+};
+
 static clib_error_t *
 crypto_sw_scheduler_config (vlib_main_t *vm, unformat_input_t *input)
 {
@@ -740,6 +930,7 @@ crypto_sw_scheduler_config (vlib_main_t *vm, unformat_input_t *input)
   clib_error_t *error = 0;
   vlib_thread_main_t *tm = vlib_get_thread_main ();
   crypto_sw_scheduler_per_thread_data_t *ptd;
+  uword *dedicated = 0;
   u32 i;
 
   while (unformat_check_input (input) != UNFORMAT_END_OF_INPUT)
@@ -750,10 +941,18 @@ crypto_sw_scheduler_config (vlib_main_t *vm, unformat_input_t *input)
 	  if (!is_pow2 (crypto_sw_scheduler_queue_size))
 	    {
 	      return clib_error_return (0, "input %d is not pow2",
-					format_unformat_error,
 					crypto_sw_scheduler_queue_size);
 	    }
 	}
+      else if (unformat (input, "dedicated-workers %U", unformat_bitmap_list,
+			 &dedicated))
+	{
+	  if (clib_bitmap_last_set (dedicated) >= vlib_num_workers ())
+	    {
+	      clib_bitmap_free (dedicated);
+	      return clib_error_return (0, "invalid dedicated worker");
+	    }
+	}
       else
 	{
 	  cm->crypto_sw_scheduler_queue_mask =
@@ -778,7 +977,7 @@ crypto_sw_scheduler_config (vlib_main_t *vm, unformat_input_t *input)
 
       vec_validate_aligned (
 	ptd->queue[CRYPTO_SW_SCHED_QUEUE_TYPE_DECRYPT].jobs,
-	CRYPTO_SW_SCHEDULER_QUEUE_SIZE - 1, CLIB_CACHE_LINE_BYTES);
+	crypto_sw_scheduler_queue_size - 1, CLIB_CACHE_LINE_BYTES);
 
       ptd->queue[CRYPTO_SW_SCHED_QUEUE_TYPE_ENCRYPT].head = 0;
       ptd->queue[CRYPTO_SW_SCHED_QUEUE_TYPE_ENCRYPT].tail = 0;
@@ -788,7 +987,23 @@ crypto_sw_scheduler_config (vlib_main_t *vm, unformat_input_t *input)
 
       vec_validate_aligned (
 	ptd->queue[CRYPTO_SW_SCHED_QUEUE_TYPE_ENCRYPT].jobs,
-	CRYPTO_SW_SCHEDULER_QUEUE_SIZE - 1, CLIB_CACHE_LINE_BYTES);
+	crypto_sw_scheduler_queue_size - 1, CLIB_CACHE_LINE_BYTES);
+    }
+
+  clib_bitmap_foreach (i, dedicated)
+    {
+      ptd = cm->per_thread_data + vlib_get_worker_thread_index (i);
+      ptd->self_crypto_enabled = ptd->dedicated = 1;
+    }
+  clib_bitmap_free (dedicated);
+
+  for (i = 0; i < CRYPTO_SW_SCHEDULER_N_COUNTERS; i++)
+    {
+      cm->counters[i].name = crypto_sw_scheduler_counter_names[i];
+      cm->counters[i].stat_segment_name =
+	crypto_sw_scheduler_counter_stat_names[i];
+      vlib_validate_simple_counter (&cm->counters[i], 0);
+      vlib_zero_simple_counter (&cm->counters[i], 0);
     }
 
   if (error)
@@ -71,6 +71,7 @@ dns_cache_clear (dns_main_t * dm)
   hash_free (dm->cache_entry_by_name);
   dm->cache_entry_by_name = hash_create_string (0, sizeof (uword));
   vec_free (dm->unresolved_entries);
+  dns_fast_cache_changed (dm);
   dns_cache_unlock (dm);
   return 0;
 }
@@ -603,6 +604,8 @@ vnet_dns_delete_entry_by_index_nolock (dns_main_t * dm, u32 index)
     }
 
 found:
+  if (ep->flags & DNS_CACHE_ENTRY_FLAG_VALID)
+    dns_fast_cache_changed (dm);
   hash_unset_mem (dm->cache_entry_by_name, ep->name);
   vec_free (ep->name);
   vec_free (ep->pending_requests);
@@ -634,12 +637,19 @@ dns_delete_by_name (dns_main_t * dm, u8 * name)
   return rv;
 }
 
+#define DNS_EVICTION_SAMPLES 8
+
+/**
+ * Make room in the cache. Samples a few random valid, non-static entries
+ * and deletes the one closest to expiring, expired entries first.
+ */
 static int
 delete_random_entry (dns_main_t * dm)
 {
   int rv;
-  u32 victim_index, start_index, i;
+  u32 victim_index = ~0, start_index, i, n_samples = 0;
   u32 limit;
+  f64 victim_expiration_time = CLIB_TIME_MAX;
   dns_cache_entry_t *ep;
 
   if (dm->is_enabled == 0)
@@ -655,26 +665,36 @@ delete_random_entry (dns_main_t * dm)
 #endif
 
   dns_cache_lock (dm, 3);
-  limit = pool_elts (dm->entries);
+  limit = pool_len (dm->entries);
   start_index = random_u32 (&dm->random_seed) % limit;
 
-  for (i = 0; i < limit; i++)
+  for (i = 0; i < limit && n_samples < DNS_EVICTION_SAMPLES; i++)
     {
-      victim_index = (start_index + i) % limit;
+      u32 index = (start_index + i) % limit;
+
+      if (pool_is_free_index (dm->entries, index))
+	continue;
 
-      if (!pool_is_free_index (dm->entries, victim_index))
+      ep = pool_elt_at_index (dm->entries, index);
+      /* Delete only valid, non-static entries */
+      if ((ep->flags & DNS_CACHE_ENTRY_FLAG_VALID)
+	  && ((ep->flags & DNS_CACHE_ENTRY_FLAG_STATIC) == 0))
 	{
-	  ep = pool_elt_at_index (dm->entries, victim_index);
-	  /* Delete only valid, non-static entries */
-	  if ((ep->flags & DNS_CACHE_ENTRY_FLAG_VALID)
-	      && ((ep->flags & DNS_CACHE_ENTRY_FLAG_STATIC) == 0))
+	  n_samples++;
+	  if (ep->expiration_time < victim_expiration_time)
 	    {
-	      rv = vnet_dns_delete_entry_by_index_nolock (dm, victim_index);
-	      dns_cache_unlock (dm);
-	      return rv;
+	      victim_index = index;
+	      victim_expiration_time = ep->expiration_time;
 	    }
 	}
     }
+
+  if (victim_index != ~0)
+    {
+      rv = vnet_dns_delete_entry_by_index_nolock (dm, victim_index);
+      dns_cache_unlock (dm);
+      return rv;
+    }
   dns_cache_unlock (dm);
 
   clib_warning ("Couldn't find an entry to delete?");
@@ -720,6 +740,7 @@ dns_add_static_entry (dns_main_t * dm, u8 * name, u8 * dns_reply_data)
   hash_set_mem (dm->cache_entry_by_name, ep->name, ep - dm->entries);
   ep->flags = DNS_CACHE_ENTRY_FLAG_VALID | DNS_CACHE_ENTRY_FLAG_STATIC;
   ep->dns_response = dns_reply_data;
+  dns_fast_cache_changed (dm);
 
   dns_cache_unlock (dm);
   return 0;
@@ -1494,6 +1515,9 @@ dns_config_fn (vlib_main_t * vm, unformat_input_t * input)
 	;
       else if (unformat (input, "max-ttl %u", &dm->max_ttl_in_seconds))
 	;
+      else if (unformat (input, "negative-ttl %u",
+			 &dm->negative_ttl_in_seconds))
+	;
       else
 	return clib_error_return (0, "unknown input `%U'",
 				  format_unformat_error, input);
@@ -2058,6 +2082,8 @@ format_dns_cache (u8 * s, va_list * args)
 	      ASSERT (ep->dns_response);
 	      if (ep->flags & DNS_CACHE_ENTRY_FLAG_STATIC)
 		ss = "[S] ";
+	      else if (ep->flags & DNS_CACHE_ENTRY_FLAG_NEGATIVE)
+		ss = "[N] ";
 	      else
 		ss = "    ";
 
@@ -2087,6 +2113,9 @@ format_dns_cache (u8 * s, va_list * args)
     }
 
   s = format (s, "DNS cache contains %d entries\n", pool_elts (dm->entries));
+  s = format (s, "Worker cache contains %d entries, %llu published\n",
+	      dm->fast_cache ? vec_len (dm->fast_cache->entries) : 0,
+	      dm->fast_cache_n_publish);
 
   if (verbose > 0)
     {
@@ -2097,6 +2126,8 @@ format_dns_cache (u8 * s, va_list * args)
             ASSERT (ep->dns_response);
             if (ep->flags & DNS_CACHE_ENTRY_FLAG_STATIC)
               ss = "[S] ";
+            else if (ep->flags & DNS_CACHE_ENTRY_FLAG_NEGATIVE)
+              ss = "[N] ";
             else
               ss = "    ";
 
@@ -2699,6 +2730,8 @@ test_dns_expire_command_fn (vlib_main_t * vm,
   ep = pool_elt_at_index (dm->entries, p[0]);
 
   ep->expiration_time = 0;
+  dns_fast_cache_changed (dm);
+  dns_cache_unlock (dm);
 
   return 0;
 }
@@ -2941,6 +2974,7 @@ dns_init (vlib_main_t * vm)
   dm->vnet_main = vnet_get_main ();
   dm->name_cache_size = 1000;
   dm->max_ttl_in_seconds = 86400;
+  dm->negative_ttl_in_seconds = 300;
   dm->random_seed = 0xDEADDABE;
   dm->api_main = vlibapi_get_main ();
 
@@ -86,11 +86,52 @@ typedef struct
 #define DNS_CACHE_ENTRY_FLAG_VALID	(1<<0) /**< we have Actual Data */
 #define DNS_CACHE_ENTRY_FLAG_STATIC	(1<<1) /**< static entry */
 #define DNS_CACHE_ENTRY_FLAG_CNAME	(1<<2) /**< CNAME (indirect) entry */
+#define DNS_CACHE_ENTRY_FLAG_NEGATIVE	(1<<3) /**< cached NXDOMAIN */
 
 #define DNS_RETRIES_PER_SERVER 3
 
 #define DNS_RESOLVER_EVENT_RESOLVED	1
 #define DNS_RESOLVER_EVENT_PENDING	2
+#define DNS_RESOLVER_EVENT_CACHE_CHANGED 3
+
+/**
+ * Worker readable copy of a resolved name. Answers are precomputed so
+ * workers can reply to cached queries without touching the main cache.
+ */
+typedef struct
+{
+  /** Lowercased name, in wire (label) format */
+  u8 *labels;
+
+  /** Hash of labels, see dns_labels_hash */
+  u64 hash;
+
+  /** Expiration time, CLIB_TIME_MAX for static entries */
+  f64 expiration_time;
+
+  /** Query type answered, A or PTR */
+  u16 qtype;
+
+  /** Answer is NXDOMAIN */
+  u8 is_negative;
+
+  /** Answer ttl from the cached response */
+  u32 ttl;
+
+  /** Answer RR: name pointer, RR header and rdata. Empty if negative */
+  u8 *answer;
+} dns_fast_cache_entry_t;
+
+/**
+ * Immutable, RCU published snapshot of the valid part of the cache.
+ * Open addressed hash table of entry indices, linear probing.
+ */
+typedef struct
+{
+  dns_fast_cache_entry_t *entries;
+  u32 *buckets;
+  u32 bucket_mask;
+} dns_fast_cache_t;
 
 
 typedef struct
@@ -106,6 +147,15 @@ typedef struct
   clib_spinlock_t cache_lock;
   int cache_lock_tag;
 
+  /** Snapshot read by workers, replaced by the resolver process */
+  dns_fast_cache_t *fast_cache;
+
+  /** Cache changed since the last snapshot was published */
+  volatile u32 fast_cache_dirty;
+
+  /** Number of snapshots published */
+  u64 fast_cache_n_publish;
+
   /** enable / disable flag */
   int is_enabled;
 
@@ -122,6 +172,7 @@ typedef struct
   /** config parameters */
   u32 name_cache_size;
   u32 max_ttl_in_seconds;
+  u32 negative_ttl_in_seconds;
   u32 random_seed;
 
   /** message-ID base */
@@ -145,7 +196,9 @@ _(PROCESSED, "DNS request pkts processed")                              \
 _(IP_OPTIONS, "DNS pkts with ip options (dropped)")                     \
 _(BAD_REQUEST, "DNS pkts with serious discrepancies (dropped)")         \
 _(TOO_MANY_REQUESTS, "DNS pkts asking too many questions")              \
-_(RESOLUTION_REQUIRED, "DNS pkts pending upstream name resolution")
+_(RESOLUTION_REQUIRED, "DNS pkts pending upstream name resolution")   \
+_(CACHE_HIT, "DNS pkts answered from worker cache")                     \
+_(NEGATIVE_CACHE_HIT, "DNS pkts answered NXDOMAIN from worker cache")
 
 typedef enum
 {
@@ -203,6 +256,13 @@ u8 *vnet_dns_labels_to_name (u8 * label, u8 * full_text,
 
 void vnet_dns_create_resolver_process (vlib_main_t * vm, dns_main_t * dm);
 
+u8 *name_to_labels (u8 * name);
+
+void dns_fast_cache_changed (dns_main_t *dm);
+void dns_fast_cache_publish (vlib_main_t *vm, dns_main_t *dm);
+u32 dns_response_min_ttl (u8 *response);
+u32 dns_response_negative_ttl (u8 *response, u32 max_ttl);
+
 format_function_t format_dns_reply;
 
 static inline void
@@ -228,6 +288,72 @@ dns_cache_unlock (dns_main_t * dm)
     }
 }
 
+static_always_inline u8
+dns_tolower (u8 c)
+{
+  return (c >= 'A' && c <= 'Z') ? c | 0x20 : c;
+}
+
+/**
+ * Hash a name in wire format, case insensitive. Stops at the root label
+ * or at the end of data, whatever comes first.
+ *
+ * @return length of the labels including the root label, 0 if the
+ * labels are compressed or don't fit in the data
+ */
+static_always_inline u32
+dns_labels_hash (u8 *labels, u8 *end, u64 *hashp)
+{
+  u64 hash = 0xcbf29ce484222325ULL;
+  u8 *pos = labels;
+  u32 i, len;
+
+  while (pos < end)
+    {
+      len = *pos;
+      if (len == 0)
+	{
+	  *hashp = hash;
+	  return pos - labels + 1;
+	}
+      if (len > 63 || pos + len + 1 >= end)
+	return 0;
+      for (i = 0; i <= len; i++)
+	hash = (hash ^ dns_tolower (pos[i])) * 0x100000001b3ULL;
+      pos += len + 1;
+    }
+  return 0;
+}
+
+static_always_inline int
+dns_labels_equal (u8 *a, u8 *lowercase, u32 len)
+{
+  u32 i;
+
+  for (i = 0; i < len; i++)
+    if (dns_tolower (a[i]) != lowercase[i])
+      return 0;
+  return 1;
+}
+
+static_always_inline dns_fast_cache_entry_t *
+dns_fast_cache_lookup (dns_fast_cache_t *fc, u8 *labels, u32 len, u64 hash,
+		       u16 qtype)
+{
+  dns_fast_cache_entry_t *e;
+  u32 i = hash & fc->bucket_mask;
+
+  while (fc->buckets[i] != ~0)
+    {
+      e = vec_elt_at_index (fc->entries, fc->buckets[i]);
+      if (e->hash == hash && e->qtype == qtype && vec_len (e->labels) == len &&
+	  dns_labels_equal (labels, e->labels, len))
+	return e;
+      i = (i + 1) & fc->bucket_mask;
+    }
+  return 0;
+}
+
 extern int dns_resolve_name (u8 *name, dns_cache_entry_t **ep,
 			     dns_pending_request_t *t0,
 			     dns_resolve_name_t *rn);
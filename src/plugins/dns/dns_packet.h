@@ -124,6 +124,7 @@ _(AAAA, 28)     /**< ip6 host address */        \
 _(ALL, 255)     /**< all available data */      \
 _(TEXT, 16)     /**< a text string */           \
 _(NAMESERVER, 2) /**< a nameserver */           \
+_(SOA, 6)        /**< start of authority */    \
 _(CNAME, 5)      /**< a CNAME (alias) */	\
 _(MAIL_EXCHANGE, 15) /**< a mail exchange  */	\
 _(PTR, 12)      /**< a PTR (pointer) record */	\
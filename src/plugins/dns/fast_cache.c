@@ -0,0 +1,347 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright(c) 2025 Cisco Systems, Inc.
+ */
+
+/**
+ * Worker readable DNS cache.
+ *
+ * The main cache is a hash + pool guarded by a spinlock and is only
+ * written by the main thread, the resolver process and the request slow
+ * path. Valid entries are periodically copied into an immutable snapshot
+ * with precomputed answers. The snapshot is swapped in with a release
+ * store and the previous one is freed once all workers went through one
+ * main loop, so workers can look it up without locking.
+ */
+
+#include <dns/dns.h>
+#include <vlibapi/api.h>
+#include <vlibmemory/api.h>
+
+#include <vlib/vlib.h>
+#include <vnet/vnet.h>
+
+#include <dns/dns.api_enum.h>
+#include <dns/dns.api_types.h>
+
+int vnet_dns_response_to_reply (u8 *response, dns_resolve_name_t *rn,
+				u32 *min_ttlp);
+int vnet_dns_response_to_name (u8 *response,
+			       vl_api_dns_resolve_ip_reply_t *rmp,
+			       u32 *min_ttlp);
+
+#define DNS_FAST_CACHE_MAX_CNAME_HOPS 8
+
+static void
+dns_fast_cache_free (dns_fast_cache_t *fc)
+{
+  dns_fast_cache_entry_t *fe;
+
+  if (!fc)
+    return;
+
+  vec_foreach (fe, fc->entries)
+    {
+      vec_free (fe->labels);
+      vec_free (fe->answer);
+    }
+  vec_free (fc->entries);
+  vec_free (fc->buckets);
+  clib_mem_free (fc);
+}
+
+static u8 *
+dns_fast_cache_build_answer (u8 *response, int is_ptr, u32 *ttl)
+{
+  dns_resolve_name_t _rn, *rn = &_rn;
+  vl_api_dns_resolve_ip_reply_t _rir, *rir = &_rir;
+  u8 *answer = 0, *rrptr, *name, *labels;
+  dns_rr_t *rr;
+
+  *ttl = ~0;
+
+  if (is_ptr)
+    {
+      clib_memset (rir, 0, sizeof (*rir));
+      if (vnet_dns_response_to_name (response, rir, ttl))
+	return 0;
+      name = format (0, "%s", rir->name);
+      labels = name_to_labels (name);
+      vec_free (name);
+    }
+  else
+    {
+      clib_memset (rn, 0, sizeof (*rn));
+      if (vnet_dns_response_to_reply (response, rn, ttl) ||
+	  ip_addr_version (&rn->address) != AF_IP4)
+	return 0;
+      labels = 0;
+    }
+
+  /* Name pointer to the question (0xC00C), then a single RR */
+  vec_add1 (answer, 0xC0);
+  vec_add1 (answer, 0x0C);
+  vec_add2 (answer, rrptr,
+	    sizeof (dns_rr_t) + (is_ptr ? vec_len (labels) : 4));
+  rr = (dns_rr_t *) rrptr;
+  rr->class = clib_host_to_net_u16 (DNS_CLASS_IN);
+  /* Set when replying */
+  rr->ttl = 0;
+  if (is_ptr)
+    {
+      rr->type = clib_host_to_net_u16 (DNS_TYPE_PTR);
+      rr->rdlength = clib_host_to_net_u16 (vec_len (labels));
+      clib_memcpy (rr->rdata, labels, vec_len (labels));
+      vec_free (labels);
+    }
+  else
+    {
+      rr->type = clib_host_to_net_u16 (DNS_TYPE_A);
+      rr->rdlength = clib_host_to_net_u16 (4);
+      ip_address_copy_addr (rr->rdata, &rn->address);
+    }
+
+  if (*ttl == ~0)
+    *ttl = 64;
+
+  return answer;
+}
+
+/**
+ * Add snapshot entry for a valid cache entry. Called with the cache
+ * locked.
+ */
+static void
+dns_fast_cache_add_entry (dns_main_t *dm, dns_fast_cache_t *fc,
+			  dns_cache_entry_t *ep)
+{
+  dns_cache_entry_t *target = ep;
+  dns_fast_cache_entry_t *fe;
+  f64 expiration_time = CLIB_TIME_MAX;
+  u8 *name, *labels;
+  int n_hops = 0, is_ptr = 0, is_negative, i;
+  u8 *answer = 0;
+  u32 len, ttl = 0;
+  uword *p;
+  u64 hash;
+
+  /* Follow the CNAME chain to the entry that holds the answer */
+  while (1)
+    {
+      if (!(target->flags & DNS_CACHE_ENTRY_FLAG_VALID))
+	return;
+      if (!(target->flags & DNS_CACHE_ENTRY_FLAG_STATIC))
+	expiration_time = clib_min (expiration_time, target->expiration_time);
+      if (!(target->flags & DNS_CACHE_ENTRY_FLAG_CNAME))
+	break;
+      if (++n_hops > DNS_FAST_CACHE_MAX_CNAME_HOPS)
+	return;
+      p = hash_get_mem (dm->cache_entry_by_name, target->cname);
+      if (!p)
+	return;
+      target = pool_elt_at_index (dm->entries, p[0]);
+    }
+
+  if (!target->dns_response)
+    return;
+
+  name = format (0, "%s", ep->name);
+  if (vec_len (name) > 5 && !memcmp (vec_end (name) - 5, ".arpa", 5))
+    is_ptr = 1;
+  labels = name_to_labels (name);
+  vec_free (name);
+
+  for (i = 0; i < vec_len (labels); i++)
+    labels[i] = dns_tolower (labels[i]);
+  len = dns_labels_hash (labels, vec_end (labels), &hash);
+  if (len != vec_len (labels))
+    {
+      vec_free (labels);
+      return;
+    }
+
+  /* Only NXDOMAIN is answered negatively. Responses we can't turn into
+   * a single answer record are left to the slow path */
+  is_negative = (target->flags & DNS_CACHE_ENTRY_FLAG_NEGATIVE) != 0;
+  if (!is_negative)
+    {
+      answer = dns_fast_cache_build_answer (target->dns_response, is_ptr,
+					    &ttl);
+      if (!answer)
+	{
+	  vec_free (labels);
+	  return;
+	}
+    }
+
+  vec_add2 (fc->entries, fe, 1);
+  fe->labels = labels;
+  fe->hash = hash;
+  fe->expiration_time = expiration_time;
+  fe->qtype = is_ptr ? DNS_TYPE_PTR : DNS_TYPE_A;
+  fe->answer = answer;
+  fe->ttl = ttl;
+  fe->is_negative = is_negative;
+}
+
+/**
+ * Rebuild the worker snapshot from the main cache and publish it. Main
+ * thread only, must not be called with the cache locked.
+ */
+void
+dns_fast_cache_publish (vlib_main_t *vm, dns_main_t *dm)
+{
+  dns_fast_cache_t *fc, *old;
+  dns_fast_cache_entry_t *fe;
+  dns_cache_entry_t *ep;
+  u32 n_buckets, i;
+
+  ASSERT (vlib_get_thread_index () == 0);
+
+  fc = clib_mem_alloc (sizeof (*fc));
+  clib_memset (fc, 0, sizeof (*fc));
+
+  dns_cache_lock (dm, 12);
+  dm->fast_cache_dirty = 0;
+  if (dm->is_enabled)
+    pool_foreach (ep, dm->entries)
+      dns_fast_cache_add_entry (dm, fc, ep);
+  dns_cache_unlock (dm);
+
+  n_buckets = max_pow2 (clib_max (2 * vec_len (fc->entries), 16));
+  vec_validate_init_empty (fc->buckets, n_buckets - 1, ~0);
+  fc->bucket_mask = n_buckets - 1;
+  vec_foreach_index (i, fc->entries)
+    {
+      u32 bucket;
+
+      fe = vec_elt_at_index (fc->entries, i);
+      bucket = fe->hash & fc->bucket_mask;
+      while (fc->buckets[bucket] != ~0)
+	bucket = (bucket + 1) & fc->bucket_mask;
+      fc->buckets[bucket] = i;
+    }
+
+  old = dm->fast_cache;
+  clib_atomic_store_rel_n (&dm->fast_cache, fc);
+  dm->fast_cache_n_publish += 1;
+
+  /* Workers load the snapshot once per frame, so after one loop nobody
+   * can reference the old one */
+  vlib_worker_wait_one_loop ();
+  dns_fast_cache_free (old);
+}
+
+/**
+ * Mark the cache as changed and ask the resolver process to publish a
+ * new snapshot. Called with the cache locked, from any thread.
+ */
+void
+dns_fast_cache_changed (dns_main_t *dm)
+{
+  if (dm->fast_cache_dirty || dm->resolver_process_node_index == 0)
+    return;
+
+  dm->fast_cache_dirty = 1;
+  vlib_process_signal_event_mt (vlib_get_main (),
+				dm->resolver_process_node_index,
+				DNS_RESOLVER_EVENT_CACHE_CHANGED, 0);
+}
+
+static u8 *
+dns_skip_name (u8 *pos, u8 *end)
+{
+  while (pos < end)
+    {
+      if ((pos[0] & 0xC0) == 0xC0)
+	return pos + 2;
+      if (pos[0] == 0)
+	return pos + 1;
+      pos += pos[0] + 1;
+    }
+  return 0;
+}
+
+/**
+ * Smallest ttl of the records in the answer section, ~0 if none
+ */
+u32
+dns_response_min_ttl (u8 *response)
+{
+  dns_header_t *h = (dns_header_t *) response;
+  u8 *pos, *end = vec_end (response);
+  u32 i, min_ttl = ~0;
+  dns_rr_t *rr;
+
+  if (vec_len (response) < sizeof (*h))
+    return min_ttl;
+
+  pos = (u8 *) (h + 1);
+  for (i = 0; i < clib_net_to_host_u16 (h->qdcount); i++)
+    {
+      pos = dns_skip_name (pos, end);
+      if (!pos)
+	return min_ttl;
+      pos += sizeof (dns_query_t);
+    }
+
+  for (i = 0; i < clib_net_to_host_u16 (h->anscount); i++)
+    {
+      pos = dns_skip_name (pos, end);
+      if (!pos || pos + sizeof (*rr) > end)
+	break;
+      rr = (dns_rr_t *) pos;
+      min_ttl = clib_min (min_ttl, clib_net_to_host_u32 (rr->ttl));
+      pos += sizeof (*rr) + clib_net_to_host_u16 (rr->rdlength);
+    }
+
+  return min_ttl;
+}
+
+/**
+ * Time a negative response may be cached for, per RFC 2308: the smaller
+ * of the SOA record ttl and the SOA minimum field, capped at max_ttl.
+ */
+u32
+dns_response_negative_ttl (u8 *response, u32 max_ttl)
+{
+  dns_header_t *h = (dns_header_t *) response;
+  u8 *pos, *end = vec_end (response);
+  u32 i, n_answers, n_records, minimum;
+  dns_rr_t *rr;
+
+  if (vec_len (response) < sizeof (*h))
+    return max_ttl;
+
+  pos = (u8 *) (h + 1);
+  for (i = 0; i < clib_net_to_host_u16 (h->qdcount); i++)
+    {
+      pos = dns_skip_name (pos, end);
+      if (!pos)
+	return max_ttl;
+      pos += sizeof (dns_query_t);
+    }
+
+  n_answers = clib_net_to_host_u16 (h->anscount);
+  n_records = n_answers + clib_net_to_host_u16 (h->nscount);
+  for (i = 0; i < n_records; i++)
+    {
+      pos = dns_skip_name (pos, end);
+      if (!pos || pos + sizeof (*rr) > end)
+	return max_ttl;
+      rr = (dns_rr_t *) pos;
+      pos += sizeof (*rr) + clib_net_to_host_u16 (rr->rdlength);
+      if (pos > end)
+	return max_ttl;
+      if (i < n_answers || clib_net_to_host_u16 (rr->type) != DNS_TYPE_SOA)
+	continue;
+
+      /* SOA rdata ends with serial, refresh, retry, expire and minimum */
+      if (clib_net_to_host_u16 (rr->rdlength) < 5 * sizeof (u32))
+	return max_ttl;
+      minimum = clib_net_to_host_u32 (clib_mem_unaligned (pos - 4, u32));
+      minimum = clib_min (minimum, clib_net_to_host_u32 (rr->ttl));
+      return clib_min (minimum, max_ttl);
+    }
+
+  return max_ttl;
+}
@@ -55,6 +55,78 @@ typedef enum
   DNS46_REQUEST_N_NEXT,
 } dns46_request_next_t;
 
+/**
+ * Turn a request around into a reply from a worker cache entry. Returns 0
+ * if the reply doesn't fit in the buffer and the slow path should handle
+ * the request.
+ */
+static_always_inline u32
+dns4_fast_cache_reply (vlib_main_t *vm, vlib_buffer_t *b0, ip4_header_t *ip40,
+		       udp_header_t *u0, dns_header_t *d0, dns_query_t *q0,
+		       dns_fast_cache_entry_t *fe0, f64 now)
+{
+  u8 *answer0 = (u8 *) (q0 + 1);
+  u32 dns_len0, ttl0, fib_index0;
+  ip4_address_t addr0;
+  u16 flags0, port0;
+  dns_rr_t *rr0;
+
+  dns_len0 = answer0 - (u8 *) d0 + vec_len (fe0->answer);
+  if (PREDICT_FALSE ((u8 *) d0 + dns_len0 >
+		     b0->data + vlib_buffer_get_default_data_size (vm)))
+    return 0;
+
+  flags0 = DNS_AA | DNS_RA | DNS_RD | DNS_OPCODE_QUERY | DNS_QR;
+  if (fe0->is_negative)
+    {
+      flags0 |= DNS_RCODE_NAME_ERROR;
+      d0->anscount = 0;
+    }
+  else
+    {
+      clib_memcpy_fast (answer0, fe0->answer, vec_len (fe0->answer));
+      /* Answer starts with a 2 byte name pointer */
+      rr0 = (dns_rr_t *) (answer0 + 2);
+      ttl0 = fe0->ttl;
+      if (fe0->expiration_time - now < ttl0)
+	ttl0 = fe0->expiration_time - now;
+      rr0->ttl = clib_host_to_net_u32 (ttl0);
+      d0->anscount = clib_host_to_net_u16 (1);
+    }
+  d0->flags = clib_host_to_net_u16 (flags0);
+  d0->nscount = 0;
+  d0->arcount = 0;
+
+  /* Reply from the address the request was sent to */
+  port0 = u0->src_port;
+  u0->src_port = u0->dst_port;
+  u0->dst_port = port0;
+  u0->length = clib_host_to_net_u16 (sizeof (*u0) + dns_len0);
+  u0->checksum = 0;
+
+  addr0 = ip40->src_address;
+  ip40->src_address = ip40->dst_address;
+  ip40->dst_address = addr0;
+  ip40->length =
+    clib_host_to_net_u16 (sizeof (*ip40) + sizeof (*u0) + dns_len0);
+  ip40->flags_and_fragment_offset = 0;
+  ip40->ttl = 255;
+  ip40->checksum = ip4_header_checksum (ip40);
+
+  if (b0->flags & VLIB_BUFFER_NEXT_PRESENT)
+    {
+      vlib_buffer_free_one (vm, b0->next_buffer);
+      b0->flags &= ~VLIB_BUFFER_NEXT_PRESENT;
+    }
+  fib_index0 = vnet_buffer (b0)->ip.fib_index;
+  b0->current_data = (u8 *) ip40 - b0->data;
+  b0->current_length = sizeof (*ip40) + sizeof (*u0) + dns_len0;
+  b0->flags |= VNET_BUFFER_F_LOCALLY_ORIGINATED;
+  vnet_buffer (b0)->sw_if_index[VLIB_TX] = fib_index0;
+
+  return 1;
+}
+
 static uword
 dns46_request_inline (vlib_main_t * vm,
 		      vlib_node_runtime_t * node, vlib_frame_t * frame,
@@ -63,6 +135,13 @@ dns46_request_inline (vlib_main_t * vm,
   u32 n_left_from, *from, *to_next;
   dns46_request_next_t next_index;
   dns_main_t *dm = &dns_main;
+  dns_fast_cache_t *fc;
+  u32 n_hits = 0, n_negative_hits = 0;
+  f64 now;
+
+  /* Snapshot can't be freed before this frame is done */
+  fc = clib_atomic_load_acq_n (&dm->fast_cache);
+  now = vlib_time_now (vm);
 
   from = vlib_frame_vector_args (frame);
   n_left_from = frame->n_vectors;
@@ -208,6 +287,42 @@ dns46_request_inline (vlib_main_t * vm,
 
 	  label0 = (u8 *) (d0 + 1);
 
+	  /* Answer from the worker cache if possible */
+	  if (PREDICT_TRUE (fc != 0) &&
+	      (flags0 & DNS_OPCODE_MASK) == DNS_OPCODE_QUERY)
+	    {
+	      dns_fast_cache_entry_t *fe0;
+	      u8 *end0 = (u8 *) d0 + b0->current_length;
+	      u64 hash0;
+	      u32 len0;
+
+	      len0 = dns_labels_hash (label0, end0, &hash0);
+	      q0 = (dns_query_t *) (label0 + len0);
+	      if (len0 && (u8 *) (q0 + 1) <= end0 &&
+		  q0->class == clib_host_to_net_u16 (DNS_CLASS_IN))
+		{
+		  fe0 = dns_fast_cache_lookup (fc, label0, len0, hash0,
+					       clib_net_to_host_u16 (q0->type));
+		  if (fe0 && fe0->expiration_time > now &&
+		      dns4_fast_cache_reply (vm, b0, ip40, u0, d0, q0, fe0,
+					     now))
+		    {
+		      next0 = DNS46_REQUEST_NEXT_IP_LOOKUP;
+		      if (fe0->is_negative)
+			{
+			  error0 = DNS46_REQUEST_ERROR_NEGATIVE_CACHE_HIT;
+			  n_negative_hits++;
+			}
+		      else
+			{
+			  error0 = DNS46_REQUEST_ERROR_CACHE_HIT;
+			  n_hits++;
+			}
+		      goto done0;
+		    }
+		}
+	    }
+
 	  name0 = vnet_dns_labels_to_name (label0, (u8 *) d0, (u8 **) & q0);
 
 	  t0->request_type = DNS_PEER_PENDING_NAME_TO_IP;
@@ -277,6 +392,12 @@ dns46_request_inline (vlib_main_t * vm,
       vlib_put_next_frame (vm, node, next_index, n_left_to_next);
     }
 
+  vlib_node_increment_counter (vm, node->node_index,
+			       DNS46_REQUEST_ERROR_CACHE_HIT, n_hits);
+  vlib_node_increment_counter (vm, node->node_index,
+			       DNS46_REQUEST_ERROR_NEGATIVE_CACHE_HIT,
+			       n_negative_hits);
+
   return frame->n_vectors;
 }
 
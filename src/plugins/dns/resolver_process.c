@@ -35,6 +35,9 @@ vnet_dns_response_to_name (u8 * response,
 			   vl_api_dns_resolve_ip_reply_t * rmp,
 			   u32 * min_ttlp);
 
+/** Seconds between scans for expired entries */
+#define DNS_EXPIRE_SCAN_INTERVAL 10.0
+
 static void
 resolve_event (vlib_main_t * vm, dns_main_t * dm, f64 now, u8 * reply)
 {
@@ -83,6 +86,11 @@ resolve_event (vlib_main_t * vm, dns_main_t * dm, f64 now, u8 * reply)
       dns_cache_unlock (dm);
       return;
     }
+  /* NXDOMAIN is an answer, cache it instead of asking other servers */
+  if (rv < 0 && rcode == DNS_RCODE_NAME_ERROR &&
+      dm->negative_ttl_in_seconds)
+    goto reply;
+
   /* Server backfire: refused to answer, or sent zero replies */
   if (rv < 0)
     {
@@ -142,10 +150,26 @@ reply:
   ep->dns_response = reply;
 
   /*
-   * Pick a sensible default cache entry expiration time.
-   * We don't play the 10-second timeout game.
+   * Expire with the smallest record ttl, up to the configured maximum,
+   * or pick a sensible default if there are no records. Negative
+   * responses are cached as told by the SOA record, see RFC 2308.
    */
-  ep->expiration_time = now + 600.0;
+  if (rcode == DNS_RCODE_NAME_ERROR)
+    {
+      ep->flags |= DNS_CACHE_ENTRY_FLAG_NEGATIVE;
+      ep->expiration_time =
+	now + dns_response_negative_ttl (reply, dm->negative_ttl_in_seconds);
+    }
+  else
+    {
+      ep->flags &= ~DNS_CACHE_ENTRY_FLAG_NEGATIVE;
+      min_ttl = dns_response_min_ttl (reply);
+      if (min_ttl == ~0)
+	ep->expiration_time = now + 600.0;
+      else
+	ep->expiration_time =
+	  now + clib_min (min_ttl, dm->max_ttl_in_seconds);
+    }
 
   if (0)
     clib_warning ("resolving '%s', was %s valid",
@@ -164,7 +188,10 @@ reply:
   entry_was_valid = (ep->flags & DNS_CACHE_ENTRY_FLAG_VALID) ? 1 : 0;
 
   if (vec_len (ep->dns_response))
-    ep->flags |= DNS_CACHE_ENTRY_FLAG_VALID;
+    {
+      ep->flags |= DNS_CACHE_ENTRY_FLAG_VALID;
+      dns_fast_cache_changed (dm);
+    }
 
   /* Most likely, send 1 message */
   for (i = 0; i < vec_len (ep->pending_requests); i++)
@@ -273,6 +300,10 @@ reply:
 		      dm->ip6_name_servers + ep->server_rotor, ep->name);
       /* FALLTHROUGH */
     case DNS_RCODE_NAME_ERROR:
+      /* Keep as negative entry, unless negative caching is disabled */
+      if (rcode == DNS_RCODE_NAME_ERROR && dm->negative_ttl_in_seconds)
+	break;
+      /* FALLTHROUGH */
     case DNS_RCODE_FORMAT_ERROR:
       /* remove trash from the cache... */
       vnet_dns_delete_entry_by_index_nolock (dm, ep - dm->entries);
@@ -301,6 +332,31 @@ retry_scan (vlib_main_t * vm, dns_main_t * dm, f64 now)
     }
 }
 
+/**
+ * Delete expired, resolved entries so they neither take space nor get
+ * published to workers.
+ */
+static void
+expire_scan (vlib_main_t * vm, dns_main_t * dm, f64 now)
+{
+  dns_cache_entry_t *ep;
+  u32 *to_delete = 0, *index;
+
+  dns_cache_lock (dm, 13);
+  pool_foreach (ep, dm->entries)
+    {
+      if ((ep->flags & DNS_CACHE_ENTRY_FLAG_VALID)
+	  && !(ep->flags & DNS_CACHE_ENTRY_FLAG_STATIC)
+	  && vec_len (ep->pending_requests) == 0
+	  && now > ep->expiration_time)
+	vec_add1 (to_delete, ep - dm->entries);
+    }
+  vec_foreach (index, to_delete)
+    vnet_dns_delete_entry_by_index_nolock (dm, *index);
+  dns_cache_unlock (dm);
+  vec_free (to_delete);
+}
+
 static uword
 dns_resolver_process (vlib_main_t * vm,
 		      vlib_node_runtime_t * rt, vlib_frame_t * f)
@@ -308,6 +364,7 @@ dns_resolver_process (vlib_main_t * vm,
   dns_main_t *dm = &dns_main;
   f64 now;
   f64 timeout = 1000.0;
+  f64 next_expire_scan = 0;
   uword *event_data = 0;
   uword event_type;
   int i;
@@ -332,15 +389,27 @@ dns_resolver_process (vlib_main_t * vm,
 	    resolve_event (vm, dm, now, (u8 *) event_data[i]);
 	  break;
 
+	case DNS_RESOLVER_EVENT_CACHE_CHANGED:
+	  break;
+
 	case ~0:		/* timeout */
 	  retry_scan (vm, dm, now);
 	  break;
 	}
       vec_reset_length (event_data);
 
+      if (now >= next_expire_scan)
+	{
+	  expire_scan (vm, dm, now);
+	  next_expire_scan = now + DNS_EXPIRE_SCAN_INTERVAL;
+	}
+
+      if (dm->fast_cache_dirty)
+	dns_fast_cache_publish (vm, dm);
+
       /* No work? Back to slow timeout mode... */
       if (vec_len (dm->unresolved_entries) == 0)
-	timeout = 1000.0;
+	timeout = pool_elts (dm->entries) ? DNS_EXPIRE_SCAN_INTERVAL : 1000.0;
     }
   return 0;			/* or not */
 }
@@ -524,7 +524,7 @@ hc_attach ()
 {
   hc_main_t *hcm = &hc_main;
   vnet_app_attach_args_t _a, *a = &_a;
-  u64 options[18];
+  u64 options[APP_OPTIONS_N_OPTIONS];
   u32 segment_size = 128 << 20;
   int rv;
 
@@ -333,7 +333,7 @@ hcc_attach ()
 {
   hcc_main_t *hcm = &hcc_main;
   vnet_app_attach_args_t _a, *a = &_a;
-  u64 options[18];
+  u64 options[APP_OPTIONS_N_OPTIONS];
   u32 segment_size = 128 << 20;
   vnet_app_add_cert_key_pair_args_t _ck_pair, *ck_pair = &_ck_pair;
   int rv;
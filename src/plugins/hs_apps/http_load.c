@@ -0,0 +1,643 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright(c) 2025 Cisco Systems, Inc.
+ */
+
+/*
+ * HTTP load generator, similar to h2load. Opens given number of client
+ * connections and keeps sending requests back to back on each of them,
+ * until total number of requests is reached or test duration expires.
+ */
+
+#include <vnet/session/application.h>
+#include <vnet/session/application_interface.h>
+#include <vnet/session/session.h>
+#include <http/http.h>
+#include <http/http_status_codes.h>
+
+typedef struct
+{
+  u32 session_index;
+  u32 thread_index;
+  session_handle_t vpp_session_handle;
+  u64 to_recv;
+  f64 req_start;
+  u8 is_closed;
+} hl_session_t;
+
+typedef struct
+{
+  hl_session_t *sessions;
+  u32 thread_index;
+  u8 *headers_buf;
+  http_headers_ctx_t req_headers;
+  http_msg_t msg;
+  f64 *latencies;
+  u64 n_responses;
+  u64 bytes_received;
+  u64 status_class[6];
+  u64 n_errors;
+} hl_worker_t;
+
+typedef struct
+{
+  u32 app_index;
+  u32 cli_node_index;
+  u8 attached;
+  u8 *uri;
+  u8 *target;
+  session_endpoint_cfg_t connect_sep;
+  hl_worker_t *wrk;
+  u32 n_clients;
+  u64 n_requests;
+  i64 n_to_send;
+  f64 duration;
+  f64 end_time;
+  f64 timeout;
+  u32 fifo_size;
+  u32 private_segment_size;
+  u8 *appns_id;
+  u64 appns_secret;
+  u32 n_done;
+  u32 n_connect_failed;
+} hl_main_t;
+
+typedef enum
+{
+  HL_EVT_DONE = 1,
+} hl_cli_signal_t;
+
+static hl_main_t hl_main;
+
+static inline hl_worker_t *
+hl_worker_get (u32 thread_index)
+{
+  return vec_elt_at_index (hl_main.wrk, thread_index);
+}
+
+static inline hl_session_t *
+hl_session_get (u32 session_index, u32 thread_index)
+{
+  hl_worker_t *wrk = hl_worker_get (thread_index);
+  return pool_elt_at_index (wrk->sessions, session_index);
+}
+
+static void
+hl_signal_done (u32 thread_index)
+{
+  hl_main_t *hlm = &hl_main;
+
+  if (clib_atomic_add_fetch (&hlm->n_done, 1) == hlm->n_clients)
+    vlib_process_signal_event_mt (vlib_get_main_by_index (thread_index),
+				  hlm->cli_node_index, HL_EVT_DONE, 0);
+}
+
+static void
+hl_session_done (session_t *s, hl_session_t *hl_session)
+{
+  hl_main_t *hlm = &hl_main;
+  vnet_disconnect_args_t _a = { 0 }, *a = &_a;
+  int rv;
+
+  if (hl_session->is_closed)
+    return;
+  hl_session->is_closed = 1;
+
+  a->handle = session_handle (s);
+  a->app_index = hlm->app_index;
+  if ((rv = vnet_disconnect_session (a)))
+    clib_warning ("warning: disconnect returned: %U", format_session_error,
+		  rv);
+  hl_signal_done (s->thread_index);
+}
+
+static int
+hl_send_request (session_t *s, hl_worker_t *wrk, hl_session_t *hl_session)
+{
+  hl_main_t *hlm = &hl_main;
+  svm_fifo_seg_t segs[3] = {
+    { (u8 *) &wrk->msg, sizeof (wrk->msg) },
+    { hlm->target, vec_len (hlm->target) },
+    { wrk->headers_buf, wrk->req_headers.tail_offset },
+  };
+  f64 now;
+  int rv;
+
+  now = vlib_time_now (vlib_get_main_by_index (s->thread_index));
+  if (hlm->duration && now >= hlm->end_time)
+    return -1;
+  if (hlm->n_requests && clib_atomic_sub_fetch (&hlm->n_to_send, 1) < 0)
+    return -1;
+
+  rv = svm_fifo_enqueue_segments (s->tx_fifo, segs, 3, 0 /* allow partial */);
+  ASSERT (rv == sizeof (wrk->msg) + wrk->msg.data.len);
+  hl_session->req_start = now;
+
+  if (svm_fifo_set_event (s->tx_fifo))
+    session_program_tx_io_evt (s->handle, SESSION_IO_EVT_TX);
+
+  return 0;
+}
+
+static int
+hl_session_connected_callback (u32 app_index, u32 api_context, session_t *s,
+			       session_error_t err)
+{
+  hl_main_t *hlm = &hl_main;
+  hl_worker_t *wrk;
+  hl_session_t *hl_session;
+
+  if (err)
+    {
+      clib_warning ("connect error: %U", format_session_error, err);
+      clib_atomic_add_fetch (&hlm->n_connect_failed, 1);
+      hl_signal_done (transport_cl_thread ());
+      return -1;
+    }
+
+  wrk = hl_worker_get (s->thread_index);
+  pool_get_zero (wrk->sessions, hl_session);
+  hl_session->session_index = hl_session - wrk->sessions;
+  hl_session->thread_index = s->thread_index;
+  hl_session->vpp_session_handle = session_handle (s);
+  s->opaque = hl_session->session_index;
+
+  if (hl_send_request (s, wrk, hl_session))
+    hl_session_done (s, hl_session);
+
+  return 0;
+}
+
+static void
+hl_session_disconnect_callback (session_t *s)
+{
+  hl_session_t *hl_session = hl_session_get (s->opaque, s->thread_index);
+
+  /* closed by peer before we finished */
+  if (!hl_session->is_closed)
+    hl_worker_get (s->thread_index)->n_errors++;
+  hl_session_done (s, hl_session);
+}
+
+static void
+hl_session_reset_callback (session_t *s)
+{
+  hl_session_disconnect_callback (s);
+}
+
+static int
+hl_rx_callback (session_t *s)
+{
+  hl_worker_t *wrk = hl_worker_get (s->thread_index);
+  hl_session_t *hl_session = hl_session_get (s->opaque, s->thread_index);
+  http_msg_t msg;
+  u32 max_deq, n_drop;
+  int rv;
+
+  if (PREDICT_FALSE (hl_session->is_closed))
+    {
+      svm_fifo_dequeue_drop_all (s->rx_fifo);
+      return 0;
+    }
+
+  max_deq = svm_fifo_max_dequeue_cons (s->rx_fifo);
+  while (max_deq)
+    {
+      if (hl_session->to_recv == 0)
+	{
+	  rv = svm_fifo_dequeue (s->rx_fifo, sizeof (msg), (u8 *) &msg);
+	  ASSERT (rv == sizeof (msg));
+	  max_deq -= sizeof (msg);
+
+	  if (msg.type != HTTP_MSG_REPLY)
+	    {
+	      clib_warning ("unexpected msg type %d", msg.type);
+	      wrk->n_errors++;
+	      hl_session_done (s, hl_session);
+	      return -1;
+	    }
+
+	  if (msg.code < HTTP_N_STATUS)
+	    wrk->status_class[http_status_code_str[msg.code][0] - '0']++;
+	  /* headers are not interesting, skip up to body */
+	  svm_fifo_dequeue_drop (s->rx_fifo, msg.data.body_offset);
+	  max_deq -= msg.data.body_offset;
+	  hl_session->to_recv = msg.data.body_len;
+	}
+
+      n_drop = clib_min (hl_session->to_recv, max_deq);
+      svm_fifo_dequeue_drop (s->rx_fifo, n_drop);
+      max_deq -= n_drop;
+      hl_session->to_recv -= n_drop;
+      wrk->bytes_received += n_drop;
+
+      if (hl_session->to_recv)
+	break;
+
+      /* response complete */
+      wrk->n_responses++;
+      vec_add1 (wrk->latencies,
+		vlib_time_now (vlib_get_main_by_index (s->thread_index)) -
+		  hl_session->req_start);
+      if (hl_send_request (s, wrk, hl_session))
+	{
+	  hl_session_done (s, hl_session);
+	  break;
+	}
+    }
+
+  return 0;
+}
+
+static int
+hl_tx_callback (session_t *s)
+{
+  return 0;
+}
+
+static session_cb_vft_t hl_session_cb_vft = {
+  .session_connected_callback = hl_session_connected_callback,
+  .session_disconnect_callback = hl_session_disconnect_callback,
+  .session_reset_callback = hl_session_reset_callback,
+  .builtin_app_rx_callback = hl_rx_callback,
+  .builtin_app_tx_callback = hl_tx_callback,
+};
+
+static clib_error_t *
+hl_attach ()
+{
+  hl_main_t *hlm = &hl_main;
+  vnet_app_attach_args_t _a, *a = &_a;
+  u64 options[APP_OPTIONS_N_OPTIONS];
+  u32 segment_size = 128 << 20;
+  int rv;
+
+  if (hlm->private_segment_size)
+    segment_size = hlm->private_segment_size;
+
+  clib_memset (a, 0, sizeof (*a));
+  clib_memset (options, 0, sizeof (options));
+
+  a->api_client_index = APP_INVALID_INDEX;
+  a->name = format (0, "http_load");
+  a->session_cb_vft = &hl_session_cb_vft;
+  a->options = options;
+  a->options[APP_OPTIONS_SEGMENT_SIZE] = segment_size;
+  a->options[APP_OPTIONS_ADD_SEGMENT_SIZE] = segment_size;
+  a->options[APP_OPTIONS_RX_FIFO_SIZE] =
+    hlm->fifo_size ? hlm->fifo_size : 32 << 10;
+  a->options[APP_OPTIONS_TX_FIFO_SIZE] =
+    hlm->fifo_size ? hlm->fifo_size : 8 << 10;
+  a->options[APP_OPTIONS_FLAGS] = APP_OPTIONS_FLAGS_IS_BUILTIN;
+  if (hlm->appns_id)
+    {
+      a->namespace_id = hlm->appns_id;
+      a->options[APP_OPTIONS_NAMESPACE_SECRET] = hlm->appns_secret;
+    }
+
+  if ((rv = vnet_application_attach (a)))
+    return clib_error_return (0, "attach returned: %U", format_session_error,
+			      rv);
+
+  hlm->app_index = a->app_index;
+  vec_free (a->name);
+  hlm->attached = 1;
+
+  return 0;
+}
+
+static int
+hl_detach ()
+{
+  hl_main_t *hlm = &hl_main;
+  vnet_app_detach_args_t _da, *da = &_da;
+  int rv;
+
+  if (!hlm->attached)
+    return 0;
+
+  da->app_index = hlm->app_index;
+  da->api_client_index = APP_INVALID_INDEX;
+  rv = vnet_application_detach (da);
+  hlm->attached = 0;
+  hlm->app_index = APP_INVALID_INDEX;
+
+  return rv;
+}
+
+static int
+hl_connect_rpc (void *rpc_args)
+{
+  vnet_connect_args_t *a = rpc_args;
+  hl_main_t *hlm = &hl_main;
+  u32 i;
+  int rv;
+
+  for (i = 0; i < hlm->n_clients; i++)
+    {
+      a->api_context = i;
+      if ((rv = vnet_connect (a)))
+	{
+	  clib_warning ("connect returned: %U", format_session_error, rv);
+	  clib_atomic_add_fetch (&hlm->n_connect_failed, 1);
+	  hl_signal_done (transport_cl_thread ());
+	}
+    }
+
+  session_endpoint_free_ext_cfgs (&a->sep_ext);
+  vec_free (a);
+
+  return 0;
+}
+
+static void
+hl_connect ()
+{
+  hl_main_t *hlm = &hl_main;
+  vnet_connect_args_t *a = 0;
+  transport_endpt_ext_cfg_t *ext_cfg;
+  transport_endpt_cfg_http_t http_cfg = { (u32) hlm->timeout, 0 };
+
+  vec_validate (a, 0);
+  clib_memset (a, 0, sizeof (a[0]));
+  clib_memcpy (&a->sep_ext, &hlm->connect_sep, sizeof (hlm->connect_sep));
+  a->app_index = hlm->app_index;
+
+  ext_cfg = session_endpoint_add_ext_cfg (
+    &a->sep_ext, TRANSPORT_ENDPT_EXT_CFG_HTTP, sizeof (http_cfg));
+  clib_memcpy (ext_cfg->data, &http_cfg, sizeof (http_cfg));
+
+  session_send_rpc_evt_to_thread_force (transport_cl_thread (), hl_connect_rpc,
+					a);
+}
+
+static int
+hl_f64_cmp (void *a1, void *a2)
+{
+  f64 *d1 = a1, *d2 = a2;
+  return (*d1 > *d2) - (*d1 < *d2);
+}
+
+static void
+hl_report (vlib_main_t *vm, f64 elapsed)
+{
+  hl_main_t *hlm = &hl_main;
+  hl_worker_t *wrk;
+  f64 *latencies = 0, sum = 0;
+  u64 n_responses = 0, bytes = 0, n_errors = 0, status_class[6] = {};
+  u32 i, n;
+
+  vec_foreach (wrk, hlm->wrk)
+    {
+      vec_append (latencies, wrk->latencies);
+      n_responses += wrk->n_responses;
+      bytes += wrk->bytes_received;
+      n_errors += wrk->n_errors;
+      for (i = 0; i < ARRAY_LEN (status_class); i++)
+	status_class[i] += wrk->status_class[i];
+    }
+
+  vlib_cli_output (vm, "finished in %.2fs, %.2f req/s, %U/s", elapsed,
+		   n_responses / elapsed, format_memory_size,
+		   (uword) (bytes / elapsed));
+  vlib_cli_output (vm,
+		   "requests: %lu done, %lu errored, %u connect failed, "
+		   "%u clients",
+		   n_responses, n_errors, hlm->n_connect_failed,
+		   hlm->n_clients);
+  vlib_cli_output (vm,
+		   "status codes: %lu 1xx, %lu 2xx, %lu 3xx, %lu 4xx, %lu 5xx",
+		   status_class[1], status_class[2], status_class[3],
+		   status_class[4], status_class[5]);
+
+  n = vec_len (latencies);
+  if (n)
+    {
+      vec_sort_with_function (latencies, hl_f64_cmp);
+      vec_foreach_index (i, latencies)
+	sum += latencies[i];
+      vlib_cli_output (vm,
+		       "latency (us): min %.1f avg %.1f p50 %.1f p90 %.1f "
+		       "p99 %.1f max %.1f",
+		       latencies[0] * 1e6, sum / n * 1e6,
+		       latencies[n / 2] * 1e6, latencies[(n * 90) / 100] * 1e6,
+		       latencies[(n * 99) / 100] * 1e6, latencies[n - 1] * 1e6);
+    }
+  vec_free (latencies);
+}
+
+static clib_error_t *
+hl_run (vlib_main_t *vm)
+{
+  hl_main_t *hlm = &hl_main;
+  uword event_type, *event_data = 0;
+  clib_error_t *err = 0;
+  hl_worker_t *wrk;
+  u32 num_threads;
+  f64 start, timeout;
+
+  num_threads = 1 /* main thread */ + vlib_num_workers ();
+  vec_validate (hlm->wrk, num_threads - 1);
+  vec_foreach (wrk, hlm->wrk)
+    {
+      wrk->thread_index = wrk - hlm->wrk;
+      vec_validate (wrk->headers_buf, 1023);
+      http_init_headers_ctx (&wrk->req_headers, wrk->headers_buf,
+			     vec_len (wrk->headers_buf));
+      http_add_header (&wrk->req_headers, HTTP_HEADER_ACCEPT,
+		       http_token_lit ("*/*"));
+      wrk->msg.type = HTTP_MSG_REQUEST;
+      wrk->msg.method_type = HTTP_REQ_GET;
+      wrk->msg.data.type = HTTP_MSG_DATA_INLINE;
+      wrk->msg.data.target_path_offset = 0;
+      wrk->msg.data.target_path_len = vec_len (hlm->target);
+      wrk->msg.data.headers_offset = vec_len (hlm->target);
+      wrk->msg.data.headers_len = wrk->req_headers.tail_offset;
+      wrk->msg.data.body_len = 0;
+      wrk->msg.data.len =
+	wrk->msg.data.target_path_len + wrk->msg.data.headers_len;
+    }
+
+  if ((err = hl_attach ()))
+    return clib_error_return (0, "http load attach: %U", format_clib_error,
+			      err);
+
+  start = vlib_time_now (vm);
+  hlm->end_time = start + hlm->duration;
+  hl_connect ();
+
+  timeout = hlm->duration ? hlm->duration + hlm->timeout : hlm->timeout;
+  vlib_process_wait_for_event_or_clock (vm, timeout);
+  event_type = vlib_process_get_events (vm, &event_data);
+
+  switch (event_type)
+    {
+    case ~0:
+      err = clib_error_return (0, "error: timeout");
+      break;
+    case HL_EVT_DONE:
+      break;
+    default:
+      err = clib_error_return (0, "error: unexpected event %d", event_type);
+      break;
+    }
+
+  hl_report (vm, vlib_time_now (vm) - start);
+
+  vec_free (event_data);
+  return err;
+}
+
+static void
+hl_cleanup ()
+{
+  hl_main_t *hlm = &hl_main;
+  hl_worker_t *wrk;
+
+  vec_foreach (wrk, hlm->wrk)
+    {
+      vec_free (wrk->headers_buf);
+      vec_free (wrk->latencies);
+      pool_free (wrk->sessions);
+    }
+  vec_free (hlm->wrk);
+  vec_free (hlm->uri);
+  vec_free (hlm->target);
+  vec_free (hlm->appns_id);
+}
+
+static clib_error_t *
+hl_command_fn (vlib_main_t *vm, unformat_input_t *input,
+	       vlib_cli_command_t *cmd)
+{
+  hl_main_t *hlm = &hl_main;
+  unformat_input_t _line_input, *line_input = &_line_input;
+  clib_error_t *err = 0;
+  u64 mem_size;
+  int rv;
+
+  if (hlm->attached)
+    return clib_error_return (0, "failed: already running!");
+
+  hlm->n_clients = 1;
+  hlm->n_requests = 0;
+  hlm->duration = 0;
+  hlm->timeout = 10;
+  hlm->fifo_size = 0;
+  hlm->private_segment_size = 0;
+  hlm->appns_secret = 0;
+  hlm->n_done = 0;
+  hlm->n_connect_failed = 0;
+
+  if (!unformat_user (input, unformat_line_input, line_input))
+    return clib_error_return (0, "expected required arguments");
+
+  while (unformat_check_input (line_input) != UNFORMAT_END_OF_INPUT)
+    {
+      if (unformat (line_input, "uri %s", &hlm->uri))
+	;
+      else if (unformat (line_input, "clients %u", &hlm->n_clients))
+	;
+      else if (unformat (line_input, "requests %lu", &hlm->n_requests))
+	;
+      else if (unformat (line_input, "duration %f", &hlm->duration))
+	;
+      else if (unformat (line_input, "timeout %f", &hlm->timeout))
+	;
+      else if (unformat (line_input, "fifo-size %U", unformat_memory_size,
+			 &mem_size))
+	hlm->fifo_size = mem_size;
+      else if (unformat (line_input, "private-segment-size %U",
+			 unformat_memory_size, &mem_size))
+	hlm->private_segment_size = mem_size;
+      else if (unformat (line_input, "appns %_%v%_", &hlm->appns_id))
+	;
+      else if (unformat (line_input, "secret %lu", &hlm->appns_secret))
+	;
+      else
+	{
+	  err = clib_error_return (0, "unknown input `%U'",
+				   format_unformat_error, line_input);
+	  goto done;
+	}
+    }
+
+  if (!hlm->uri)
+    {
+      err = clib_error_return (0, "URI not defined");
+      goto done;
+    }
+  if (hlm->n_clients == 0)
+    {
+      err = clib_error_return (0, "clients must be > 0");
+      goto done;
+    }
+  if (!hlm->n_requests && !hlm->duration)
+    hlm->n_requests = hlm->n_clients;
+  if (hlm->n_requests && hlm->duration)
+    {
+      err = clib_error_return (
+	0, "combining duration and requests is not supported");
+      goto done;
+    }
+  hlm->n_to_send = hlm->n_requests;
+
+  if ((rv = parse_target ((char **) &hlm->uri, (char **) &hlm->target)))
+    {
+      err = clib_error_return (0, "target parse error: %U",
+			       format_session_error, rv);
+      goto done;
+    }
+  if ((rv = parse_uri ((char *) hlm->uri, &hlm->connect_sep)))
+    {
+      err =
+	clib_error_return (0, "URI parse error: %U", format_session_error, rv);
+      goto done;
+    }
+
+  vlib_cli_output (vm, "Running, please wait...");
+
+  session_enable_disable_args_t args = { .is_en = 1,
+					 .rt_engine_type =
+					   RT_BACKEND_ENGINE_RULE_TABLE };
+  vlib_worker_thread_barrier_sync (vm);
+  vnet_session_enable_disable (vm, &args);
+  vlib_worker_thread_barrier_release (vm);
+
+  hlm->cli_node_index = vlib_get_current_process (vm)->node_runtime.node_index;
+  err = hl_run (vm);
+
+  if ((rv = hl_detach ()))
+    {
+      if (!err)
+	err = clib_error_return (0, "detach returned: %U",
+				 format_session_error, rv);
+      else
+	clib_warning ("warning: detach returned: %U", format_session_error,
+		      rv);
+    }
+
+done:
+  hl_cleanup ();
+  unformat_free (line_input);
+  return err;
+}
+
+VLIB_CLI_COMMAND (hl_command, static) = {
+  .path = "http load",
+  .short_help = "http load uri http://<ip-addr>/<origin-form> "
+		"[clients <n>] [requests <n> | duration <seconds>] "
+		"[timeout <seconds>] [appns <app-ns> secret <appns-secret>] "
+		"[fifo-size <nM|G>] [private-segment-size <nM|G>]",
+  .function = hl_command_fn,
+  .is_mp_safe = 1,
+};
+
+static clib_error_t *
+hl_main_init (vlib_main_t *vm)
+{
+  hl_main_t *hlm = &hl_main;
+  hlm->app_index = APP_INVALID_INDEX;
+  return 0;
+}
+
+VLIB_INIT_FUNCTION (hl_main_init);
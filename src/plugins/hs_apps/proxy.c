@@ -1354,9 +1354,11 @@ proxy_server_create_command_fn (vlib_main_t * vm, unformat_input_t * input,
   unformat_input_t _line_input, *line_input = &_line_input;
   char *default_server_uri = "tcp://0.0.0.0/23";
   char *default_client_uri = "tcp://6.0.2.2/23";
-  u8 *server_uri = 0, *client_uri = 0;
+  u8 *server_uri = 0, *client_uri = 0, *backend_uri, **backend_uris = 0;
+  u8 **backend_uris_it;
   proxy_main_t *pm = &proxy_main;
   clib_error_t *error = 0;
+  u32 max_backend_conns = 64;
   int rv, tmp32;
   u64 tmp64;
 
@@ -1402,6 +1404,14 @@ proxy_server_create_command_fn (vlib_main_t * vm, unformat_input_t * input,
 	vec_add1 (client_uri, 0);
       else if (unformat (line_input, "idle-timeout %d", &pm->idle_timeout))
 	;
+      else if (unformat (line_input, "backend %s", &backend_uri))
+	{
+	  vec_add1 (backend_uri, 0);
+	  vec_add1 (backend_uris, backend_uri);
+	}
+      else if (unformat (line_input, "max-backend-connections %u",
+			 &max_backend_conns))
+	;
       else
 	{
 	  error = clib_error_return (0, "unknown input `%U'",
@@ -1422,6 +1432,22 @@ proxy_server_create_command_fn (vlib_main_t * vm, unformat_input_t * input,
       goto done;
     }
 
+  /* http reverse proxy, forwards requests to backend servers */
+  if (vec_len (backend_uris))
+    {
+      if (pm->server_sep.transport_proto != TRANSPORT_PROTO_HTTP)
+	{
+	  error = clib_error_return (0, "backend requires http server-uri");
+	  goto done;
+	}
+      session_enable_disable_args_t args = { .is_en = 1,
+					     .rt_engine_type =
+					       RT_BACKEND_ENGINE_RULE_TABLE };
+      vnet_session_enable_disable (vm, &args);
+      error = proxy_http_server_create (vm, backend_uris, max_backend_conns);
+      goto done;
+    }
+
   /* http proxy get target within request */
   if (pm->server_sep.transport_proto != TRANSPORT_PROTO_HTTP)
     {
@@ -1460,6 +1486,9 @@ done:
   unformat_free (line_input);
   vec_free (client_uri);
   vec_free (server_uri);
+  vec_foreach (backend_uris_it, backend_uris)
+    vec_free (*backend_uris_it);
+  vec_free (backend_uris);
   return error;
 }
 
@@ -1470,7 +1499,8 @@ VLIB_CLI_COMMAND (proxy_create_command, static) = {
 		"[max-fifo-size <nn>[k|m]][high-watermark <nn>]"
 		"[low-watermark <nn>][rcv-buf-size <nn>][prealloc-fifos <nn>]"
 		"[private-segment-size <mem>][private-segment-count <nn>]"
-		"[idle-timeout <nn>]",
+		"[idle-timeout <nn>][backend <http://ip/port>]"
+		"[max-backend-connections <nn>]",
   .function = proxy_server_create_command_fn,
 };
 
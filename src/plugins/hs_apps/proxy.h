@@ -116,6 +116,9 @@ typedef struct
 
 extern proxy_main_t proxy_main;
 
+clib_error_t *proxy_http_server_create (vlib_main_t *vm, u8 **backend_uris,
+					u32 max_conns);
+
 static inline proxy_worker_t *
 proxy_worker_get (u32 thread_index)
 {
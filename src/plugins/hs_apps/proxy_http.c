@@ -0,0 +1,1453 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright(c) 2025 Cisco Systems, Inc.
+ */
+
+/*
+ * HTTP reverse proxy mode of the test proxy. Downstream HTTP/1.1 requests
+ * are terminated and forwarded over persistent upstream connections. The
+ * connections are pooled per worker and backend, so consecutive requests
+ * don't pay for upstream handshake. Backend with idle connection is
+ * preferred (round-robin), otherwise the least loaded one is picked.
+ *
+ * Upstream session lands on the thread picked by transport, which is not
+ * necessarily the worker that asked for it. The connection is handed over
+ * to the requesting worker: it owns the pool entry and uses the session
+ * fifos, while session callbacks are forwarded to it with rpcs.
+ */
+
+#include <vnet/session/application.h>
+#include <vnet/session/application_interface.h>
+#include <vnet/session/session.h>
+#include <hs_apps/proxy.h>
+#include <http/http_header_names.h>
+
+#define PROXY_HTTP_HEADERS_BUF_SIZE 4096
+#define PROXY_HTTP_BACKEND_DOWN_TIME 1.0
+
+typedef enum proxy_http_us_state_
+{
+  PROXY_HTTP_US_S_CONNECTING,
+  PROXY_HTTP_US_S_IDLE,
+  PROXY_HTTP_US_S_BUSY,
+  PROXY_HTTP_US_S_CLOSED,
+} proxy_http_us_state_t;
+
+typedef struct
+{
+  session_handle_t session_handle;
+  svm_fifo_t *rx_fifo;
+  svm_fifo_t *tx_fifo;
+  u32 thread_index;   /**< thread of the session, not the owner */
+  u32 us_index;
+  u32 backend_index;
+  u32 ds_index;	      /**< downstream being served, ~0 if idle */
+  u64 to_recv;	      /**< response body bytes left to forward */
+  u32 n_requests;     /**< requests sent over this connection */
+  u8 resp_started;    /**< response headers already forwarded */
+  proxy_http_us_state_t state;
+} proxy_http_upstream_t;
+
+typedef struct
+{
+  session_handle_t session_handle;
+  u32 ds_index;
+  u32 us_index; /**< upstream serving current request, ~0 if none */
+  u64 to_send;	/**< request body bytes left to forward */
+  u64 to_drop;	/**< bytes of failed request left to discard */
+  u32 req_hold; /**< forwarded request bytes kept in rx fifo for retry */
+  u8 is_pending;
+  u8 is_retry; /**< request resent, needs new upstream connection */
+  u8 is_closed;
+} proxy_http_downstream_t;
+
+typedef struct
+{
+  u32 *idle;	     /**< idle upstream connections, used as stack */
+  u32 n_conns;	     /**< established upstream connections */
+  u32 n_connecting;  /**< connects initiated by this worker */
+  f64 down_until;    /**< do not select until, set on connect failure */
+  u64 n_requests;
+  u64 n_connects;
+  u64 n_connect_failed;
+} proxy_http_backend_wrk_t;
+
+typedef struct
+{
+  proxy_http_downstream_t *ds_pool;
+  proxy_http_upstream_t *us_pool;
+  proxy_http_backend_wrk_t *backends;
+  u32 *pending; /**< downstream sessions waiting for upstream */
+  u32 rr_index;
+  u8 *ctrl_buf;
+  u8 *target;
+  u8 *headers_buf;
+  http_headers_ctx_t headers;
+  u64 n_requests;
+  u64 n_errors;
+  u64 n_retries;
+} proxy_http_worker_t;
+
+typedef struct
+{
+  u8 *uri;
+  session_endpoint_cfg_t sep;
+} proxy_http_backend_t;
+
+typedef struct
+{
+  proxy_http_worker_t *workers;
+  proxy_http_backend_t *backends;
+  u32 server_app_index;
+  u32 client_app_index;
+  u32 max_conns; /**< max upstream connections per backend and worker */
+  u8 *via;
+} proxy_http_main_t;
+
+static proxy_http_main_t proxy_http_main;
+
+/* upstream session opaque, worker that owns the connection and its index */
+#define proxy_http_us_opaque(thread_index, us_index)                          \
+  ((thread_index) << 24 | (us_index))
+#define proxy_http_us_opaque_thread(opaque) ((opaque) >> 24)
+#define proxy_http_us_opaque_index(opaque)  ((opaque) & 0xffffff)
+
+typedef enum proxy_http_us_evt_
+{
+  PROXY_HTTP_US_EVT_RX,
+  PROXY_HTTP_US_EVT_TX,
+  PROXY_HTTP_US_EVT_DISCONNECT,
+  PROXY_HTTP_US_EVT_CLEANUP,
+} proxy_http_us_evt_t;
+
+typedef struct
+{
+  session_handle_t session_handle;
+  svm_fifo_t *rx_fifo;
+  svm_fifo_t *tx_fifo;
+  u32 thread_index;
+  u32 us_index;
+} proxy_http_us_rpc_args_t;
+
+/* hop-by-hop and headers generated by http transport, Host is added back
+ * explicitly, so transport uses it instead of backend address */
+static const http_header_name_t proxy_http_req_skip[] = {
+  HTTP_HEADER_CONNECTION,	 HTTP_HEADER_KEEP_ALIVE,
+  HTTP_HEADER_TE,		 HTTP_HEADER_UPGRADE,
+  HTTP_HEADER_TRANSFER_ENCODING, HTTP_HEADER_HOST,
+  HTTP_HEADER_USER_AGENT,	 HTTP_HEADER_CONTENT_LENGTH,
+};
+
+static const http_header_name_t proxy_http_resp_skip[] = {
+  HTTP_HEADER_CONNECTION,	 HTTP_HEADER_KEEP_ALIVE,
+  HTTP_HEADER_UPGRADE,		 HTTP_HEADER_TRANSFER_ENCODING,
+  HTTP_HEADER_CONTENT_LENGTH,	 HTTP_HEADER_DATE,
+  HTTP_HEADER_SERVER,
+};
+
+static void proxy_http_ds_rx (proxy_http_worker_t *wrk,
+			      proxy_http_downstream_t *ds);
+
+static inline proxy_http_worker_t *
+proxy_http_worker_get (u32 thread_index)
+{
+  return vec_elt_at_index (proxy_http_main.workers, thread_index);
+}
+
+static inline proxy_http_downstream_t *
+proxy_http_ds_get (proxy_http_worker_t *wrk, u32 ds_index)
+{
+  return pool_elt_at_index (wrk->ds_pool, ds_index);
+}
+
+static inline proxy_http_upstream_t *
+proxy_http_us_get (proxy_http_worker_t *wrk, u32 us_index)
+{
+  return pool_elt_at_index (wrk->us_pool, us_index);
+}
+
+static void
+proxy_http_session_disconnect (session_handle_t sh, u32 app_index)
+{
+  vnet_disconnect_args_t _a = {}, *a = &_a;
+
+  a->handle = sh;
+  a->app_index = app_index;
+  vnet_disconnect_session (a);
+}
+
+/* fifos and io events can be used from any thread, only fifo producer and
+ * consumer must not change */
+static_always_inline void
+proxy_http_tx_notify (svm_fifo_t *f, session_handle_t sh)
+{
+  if (svm_fifo_set_event (f))
+    session_program_tx_io_evt (sh, SESSION_IO_EVT_TX);
+}
+
+/* let http transport know we made some room in rx fifo */
+static_always_inline void
+proxy_http_rx_dequeued (svm_fifo_t *f, session_handle_t sh, u32 n_read)
+{
+  if (svm_fifo_needs_deq_ntf (f, n_read))
+    {
+      svm_fifo_clear_deq_ntf (f);
+      session_program_transport_io_evt (sh, SESSION_IO_EVT_RX);
+    }
+}
+
+static void
+proxy_http_send_status (session_t *s, http_status_code_t sc)
+{
+  http_msg_t msg = {};
+  int rv;
+
+  msg.type = HTTP_MSG_REPLY;
+  msg.code = sc;
+  msg.data.type = HTTP_MSG_DATA_INLINE;
+
+  rv = svm_fifo_enqueue (s->tx_fifo, sizeof (msg), (u8 *) &msg);
+  ASSERT (rv == sizeof (msg));
+  proxy_http_tx_notify (s->tx_fifo, s->handle);
+}
+
+/* copy field lines except the ones from skip list into headers list */
+static int
+proxy_http_copy_headers (http_headers_ctx_t *ctx, u8 *buf, http_msg_t *msg,
+			 const http_header_name_t *skip, u32 n_skip)
+{
+  http_field_line_t *field_lines, *fl;
+  proxy_http_main_t *phm = &proxy_http_main;
+  u8 *name, *value;
+  u32 i;
+
+  http_truncate_headers_list (ctx);
+  field_lines = uword_to_pointer (msg->data.headers_ctx, http_field_line_t *);
+  vec_foreach (fl, field_lines)
+    {
+      name = buf + msg->data.headers_offset + fl->name_offset;
+      value = buf + msg->data.headers_offset + fl->value_offset;
+      for (i = 0; i < n_skip; i++)
+	if (http_token_is_case ((const char *) name, fl->name_len,
+				http_header_name_token (skip[i])))
+	  break;
+      if (i < n_skip)
+	continue;
+      if (http_add_custom_header (ctx, (const char *) name, fl->name_len,
+				  (const char *) value, fl->value_len))
+	return -1;
+    }
+
+  return http_add_header (ctx, HTTP_HEADER_VIA, (const char *) phm->via,
+			  vec_len (phm->via));
+}
+
+/* forward client Host, so backend serves the same virtual host, and
+ * also report it as X-Forwarded-Host */
+static int
+proxy_http_add_host (http_headers_ctx_t *ctx, u8 *buf, http_msg_t *msg)
+{
+  http_field_line_t *field_lines, *fl;
+  u8 *name, *value;
+
+  field_lines = uword_to_pointer (msg->data.headers_ctx, http_field_line_t *);
+  vec_foreach (fl, field_lines)
+    {
+      name = buf + msg->data.headers_offset + fl->name_offset;
+      if (!http_token_is_case ((const char *) name, fl->name_len,
+			       http_header_name_token (HTTP_HEADER_HOST)))
+	continue;
+      value = buf + msg->data.headers_offset + fl->value_offset;
+      if (http_add_header (ctx, HTTP_HEADER_HOST, (const char *) value,
+			   fl->value_len))
+	return -1;
+      return http_add_custom_header (ctx, http_token_lit ("X-Forwarded-Host"),
+				     (const char *) value, fl->value_len);
+    }
+
+  return 0;
+}
+
+static_always_inline u32
+proxy_http_msg_ctrl_len (http_msg_t *msg)
+{
+  /* body offset is set only if there is message body */
+  return msg->data.body_len ? msg->data.body_offset : msg->data.len;
+}
+
+/*
+ * Upstream connection pool
+ */
+
+static void proxy_http_connect_failed_rpc (void *arg);
+
+static void
+proxy_http_connect_rpc (void *rpc_args)
+{
+  vnet_connect_args_t *a = rpc_args;
+  int rv;
+
+  if ((rv = vnet_connect (a)))
+    {
+      clib_warning ("connect returned: %U", format_session_error, rv);
+      /* report failure back to requesting worker */
+      session_send_rpc_evt_to_thread_force (
+	proxy_http_us_opaque_thread (a->api_context),
+	proxy_http_connect_failed_rpc,
+	uword_to_pointer (proxy_http_us_opaque_index (a->api_context),
+			  void *));
+    }
+  session_endpoint_free_ext_cfgs (&a->sep_ext);
+  vec_free (a);
+}
+
+/* pool entry is allocated upfront, so connected session can be handed over
+ * to this worker */
+static void
+proxy_http_connect (proxy_http_worker_t *wrk, u32 backend_index)
+{
+  proxy_http_main_t *phm = &proxy_http_main;
+  proxy_http_upstream_t *us;
+  proxy_http_backend_t *b;
+  vnet_connect_args_t *a = 0;
+  u32 thread_index = wrk - phm->workers;
+
+  b = vec_elt_at_index (phm->backends, backend_index);
+  wrk->backends[backend_index].n_connecting++;
+
+  pool_get_zero (wrk->us_pool, us);
+  us->us_index = us - wrk->us_pool;
+  us->backend_index = backend_index;
+  us->session_handle = SESSION_INVALID_HANDLE;
+  us->ds_index = ~0;
+  us->state = PROXY_HTTP_US_S_CONNECTING;
+  ASSERT (us->us_index <= proxy_http_us_opaque_index (~0));
+
+  vec_validate (a, 0);
+  clib_memcpy (&a->sep_ext, &b->sep, sizeof (b->sep));
+  a->api_context = proxy_http_us_opaque (thread_index, us->us_index);
+  a->app_index = phm->client_app_index;
+
+  session_send_rpc_evt_to_thread_force (transport_cl_thread (),
+					proxy_http_connect_rpc, a);
+}
+
+static u32
+proxy_http_backend_select (proxy_http_worker_t *wrk, f64 now)
+{
+  proxy_http_backend_wrk_t *bw;
+  u32 i, b, n, best = ~0, load, best_load = ~0;
+
+  n = vec_len (wrk->backends);
+  for (i = 0; i < n; i++)
+    {
+      b = (wrk->rr_index + i) % n;
+      bw = vec_elt_at_index (wrk->backends, b);
+      if (bw->down_until > now)
+	continue;
+      if (vec_len (bw->idle))
+	{
+	  best = b;
+	  break;
+	}
+      load = bw->n_conns + bw->n_connecting;
+      if (load < best_load)
+	{
+	  best_load = load;
+	  best = b;
+	}
+    }
+  wrk->rr_index = (wrk->rr_index + 1) % n;
+
+  /* all backends down, try anyway */
+  return best == ~0 ? wrk->rr_index : best;
+}
+
+static inline void
+proxy_http_maybe_connect (proxy_http_worker_t *wrk, u32 backend_index)
+{
+  proxy_http_backend_wrk_t *bw;
+
+  bw = vec_elt_at_index (wrk->backends, backend_index);
+  if ((bw->n_conns + bw->n_connecting) < proxy_http_main.max_conns)
+    proxy_http_connect (wrk, backend_index);
+}
+
+/* get idle upstream connection, start new connect if none available and
+ * limit not reached yet */
+static proxy_http_upstream_t *
+proxy_http_us_alloc (proxy_http_worker_t *wrk, u8 can_connect)
+{
+  proxy_http_backend_wrk_t *bw;
+  u32 b, us_index;
+  f64 now;
+
+  now = vlib_time_now (vlib_get_main ());
+  b = proxy_http_backend_select (wrk, now);
+  bw = vec_elt_at_index (wrk->backends, b);
+
+  if (vec_len (bw->idle))
+    {
+      us_index = vec_pop (bw->idle);
+      return proxy_http_us_get (wrk, us_index);
+    }
+
+  if (can_connect)
+    proxy_http_maybe_connect (wrk, b);
+
+  return 0;
+}
+
+/* remove upstream connection from pool */
+static void
+proxy_http_us_release (proxy_http_worker_t *wrk, proxy_http_upstream_t *us)
+{
+  proxy_http_backend_wrk_t *bw;
+  u32 i;
+
+  bw = vec_elt_at_index (wrk->backends, us->backend_index);
+  if (us->state == PROXY_HTTP_US_S_IDLE)
+    {
+      i = vec_search (bw->idle, us->us_index);
+      if (i != ~0)
+	vec_del1 (bw->idle, i);
+    }
+  bw->n_conns--;
+  us->state = PROXY_HTTP_US_S_CLOSED;
+}
+
+static void
+proxy_http_us_disconnect_rpc (void *arg)
+{
+  proxy_http_session_disconnect (pointer_to_uword (arg),
+				 proxy_http_main.client_app_index);
+}
+
+static void
+proxy_http_us_close (proxy_http_worker_t *wrk, proxy_http_upstream_t *us)
+{
+  if (us->state == PROXY_HTTP_US_S_CLOSED)
+    return;
+
+  proxy_http_us_release (wrk, us);
+  /* session can be closed only by its thread */
+  if (us->thread_index == vlib_get_thread_index ())
+    proxy_http_session_disconnect (us->session_handle,
+				   proxy_http_main.client_app_index);
+  else
+    session_send_rpc_evt_to_thread_force (
+      us->thread_index, proxy_http_us_disconnect_rpc,
+      uword_to_pointer (us->session_handle, void *));
+}
+
+/* release resources held by downstream session */
+static void
+proxy_http_ds_detach (proxy_http_worker_t *wrk, proxy_http_downstream_t *ds)
+{
+  proxy_http_upstream_t *us;
+  u32 i;
+
+  ds->is_closed = 1;
+
+  if (ds->is_pending)
+    {
+      i = vec_search (wrk->pending, ds->ds_index);
+      if (i != ~0)
+	vec_delete (wrk->pending, 1, i);
+      ds->is_pending = 0;
+    }
+
+  /* upstream connection state is unknown at this point, don't reuse it */
+  if (ds->us_index != ~0)
+    {
+      us = proxy_http_us_get (wrk, ds->us_index);
+      us->ds_index = ~0;
+      proxy_http_us_close (wrk, us);
+      ds->us_index = ~0;
+    }
+}
+
+static void
+proxy_http_ds_close (proxy_http_worker_t *wrk, proxy_http_downstream_t *ds)
+{
+  if (ds->is_closed)
+    return;
+
+  proxy_http_ds_detach (wrk, ds);
+  proxy_http_session_disconnect (ds->session_handle,
+				 proxy_http_main.server_app_index);
+}
+
+static int proxy_http_forward_request (proxy_http_worker_t *wrk,
+				       proxy_http_downstream_t *ds,
+				       proxy_http_upstream_t *us);
+
+/* open new connection for retried request, other pooled connections to
+ * the backend are likely stale too, so make room by closing idle one */
+static void
+proxy_http_connect_fresh (proxy_http_worker_t *wrk)
+{
+  proxy_http_backend_wrk_t *bw;
+  u32 b;
+
+  b = proxy_http_backend_select (wrk, vlib_time_now (vlib_get_main ()));
+  bw = vec_elt_at_index (wrk->backends, b);
+  if (bw->n_connecting)
+    return;
+  if (bw->n_conns >= proxy_http_main.max_conns && vec_len (bw->idle))
+    proxy_http_us_close (wrk, proxy_http_us_get (wrk, vec_pop (bw->idle)));
+  proxy_http_maybe_connect (wrk, b);
+}
+
+static void
+proxy_http_dispatch_pending (proxy_http_worker_t *wrk, u8 can_connect)
+{
+  proxy_http_downstream_t *ds;
+  proxy_http_upstream_t *us;
+
+  while (vec_len (wrk->pending))
+    {
+      ds = proxy_http_ds_get (wrk, wrk->pending[0]);
+      /* served only by new connection, see proxy_http_us_put_idle */
+      if (ds->is_retry)
+	{
+	  if (can_connect)
+	    proxy_http_connect_fresh (wrk);
+	  break;
+	}
+      us = proxy_http_us_alloc (wrk, can_connect);
+      if (!us)
+	break;
+      vec_delete (wrk->pending, 1, 0);
+      ds->is_pending = 0;
+      proxy_http_forward_request (wrk, ds, us);
+    }
+}
+
+/* upstream connection is ready for next request */
+static void
+proxy_http_us_put_idle (proxy_http_worker_t *wrk, proxy_http_upstream_t *us)
+{
+  proxy_http_backend_wrk_t *bw;
+  proxy_http_downstream_t *ds;
+
+  us->state = PROXY_HTTP_US_S_IDLE;
+  us->ds_index = ~0;
+  us->resp_started = 0;
+
+  /* new connection, retried request goes first */
+  if (!us->n_requests && vec_len (wrk->pending))
+    {
+      ds = proxy_http_ds_get (wrk, wrk->pending[0]);
+      if (ds->is_retry)
+	{
+	  vec_delete (wrk->pending, 1, 0);
+	  ds->is_pending = 0;
+	  proxy_http_forward_request (wrk, ds, us);
+	  return;
+	}
+    }
+
+  bw = vec_elt_at_index (wrk->backends, us->backend_index);
+  vec_add1 (bw->idle, us->us_index);
+
+  proxy_http_dispatch_pending (wrk, 0 /* can_connect */);
+}
+
+/* drop request kept in downstream rx fifo for retry */
+static void
+proxy_http_ds_drop_held (proxy_http_downstream_t *ds, session_t *ds_s)
+{
+  ds->is_retry = 0;
+  if (!ds->req_hold)
+    return;
+  svm_fifo_dequeue_drop (ds_s->rx_fifo, ds->req_hold);
+  proxy_http_rx_dequeued (ds_s->rx_fifo, ds_s->handle, ds->req_hold);
+  ds->req_hold = 0;
+}
+
+/* discard rest of failed request, body might not be received yet */
+static void
+proxy_http_ds_drop (proxy_http_downstream_t *ds, session_t *ds_s)
+{
+  u32 n_drop;
+
+  n_drop = clib_min (svm_fifo_max_dequeue_cons (ds_s->rx_fifo), ds->to_drop);
+  if (!n_drop)
+    return;
+  svm_fifo_dequeue_drop (ds_s->rx_fifo, n_drop);
+  proxy_http_rx_dequeued (ds_s->rx_fifo, ds_s->handle, n_drop);
+  ds->to_drop -= n_drop;
+}
+
+/* reply with error to request at the head of downstream rx fifo, requests
+ * pipelined after it are kept */
+static void
+proxy_http_ds_fail_request (proxy_http_worker_t *wrk,
+			    proxy_http_downstream_t *ds, http_status_code_t sc)
+{
+  session_t *ds_s;
+  http_msg_t msg;
+  int rv;
+
+  ds->is_retry = 0;
+  ds->req_hold = 0;
+  ds_s = session_get_from_handle (ds->session_handle);
+  rv = svm_fifo_peek (ds_s->rx_fifo, 0, sizeof (msg), (u8 *) &msg);
+  ASSERT (rv == sizeof (msg));
+  ds->to_drop = sizeof (msg) + msg.data.len;
+  proxy_http_ds_drop (ds, ds_s);
+  proxy_http_send_status (ds_s, sc);
+}
+
+static void
+proxy_http_connect_failed_rpc (void *arg)
+{
+  proxy_http_worker_t *wrk;
+  proxy_http_backend_wrk_t *bw;
+  proxy_http_upstream_t *us;
+  proxy_http_downstream_t *ds;
+
+  wrk = proxy_http_worker_get (vlib_get_thread_index ());
+  us = proxy_http_us_get (wrk, pointer_to_uword (arg));
+  bw = vec_elt_at_index (wrk->backends, us->backend_index);
+  bw->n_connecting--;
+  bw->n_connect_failed++;
+  bw->down_until =
+    vlib_time_now (vlib_get_main ()) + PROXY_HTTP_BACKEND_DOWN_TIME;
+  pool_put (wrk->us_pool, us);
+
+  /* fail one of the waiting requests */
+  if (vec_len (wrk->pending))
+    {
+      ds = proxy_http_ds_get (wrk, wrk->pending[0]);
+      vec_delete (wrk->pending, 1, 0);
+      ds->is_pending = 0;
+      wrk->n_errors++;
+      proxy_http_ds_fail_request (wrk, ds, HTTP_STATUS_BAD_GATEWAY);
+    }
+}
+
+/* connection established, possibly on other thread, start using it */
+static void
+proxy_http_us_established (proxy_http_worker_t *wrk,
+			   proxy_http_us_rpc_args_t *a)
+{
+  proxy_http_backend_wrk_t *bw;
+  proxy_http_upstream_t *us;
+
+  us = proxy_http_us_get (wrk, a->us_index);
+  us->session_handle = a->session_handle;
+  us->rx_fifo = a->rx_fifo;
+  us->tx_fifo = a->tx_fifo;
+  us->thread_index = a->thread_index;
+
+  bw = vec_elt_at_index (wrk->backends, us->backend_index);
+  bw->n_connecting--;
+  bw->n_conns++;
+  bw->n_connects++;
+
+  proxy_http_us_put_idle (wrk, us);
+}
+
+static void
+proxy_http_us_established_rpc (void *arg)
+{
+  proxy_http_us_rpc_args_t *a = arg;
+
+  proxy_http_us_established (proxy_http_worker_get (vlib_get_thread_index ()),
+			     a);
+  vec_free (a);
+}
+
+/* session fifos are freed by the thread that allocated them */
+static void
+proxy_http_us_free_fifos_rpc (void *arg)
+{
+  proxy_http_us_rpc_args_t *a = arg;
+
+  segment_manager_dealloc_fifos (a->rx_fifo, a->tx_fifo);
+  vec_free (a);
+}
+
+/*
+ * Request and response forwarding
+ */
+
+static void
+proxy_http_forward_request_body (proxy_http_worker_t *wrk,
+				 proxy_http_downstream_t *ds,
+				 proxy_http_upstream_t *us)
+{
+  svm_fifo_seg_t segs[4];
+  u32 n_segs = 4, max_len;
+  session_t *ds_s;
+  int n_read;
+
+  ds_s = session_get_from_handle (ds->session_handle);
+
+  max_len = clib_min (svm_fifo_max_dequeue_cons (ds_s->rx_fifo),
+		      svm_fifo_max_enqueue_prod (us->tx_fifo));
+  max_len = clib_min (max_len, ds->to_send);
+  if (max_len)
+    {
+      n_read = svm_fifo_segments (ds_s->rx_fifo, 0, segs, &n_segs, max_len);
+      ASSERT (n_read > 0);
+      svm_fifo_enqueue_segments (us->tx_fifo, segs, n_segs, 0);
+      svm_fifo_dequeue_drop (ds_s->rx_fifo, n_read);
+      ds->to_send -= n_read;
+      proxy_http_rx_dequeued (ds_s->rx_fifo, ds_s->handle, n_read);
+      proxy_http_tx_notify (us->tx_fifo, us->session_handle);
+    }
+
+  if (ds->to_send && !svm_fifo_max_enqueue_prod (us->tx_fifo))
+    svm_fifo_add_want_deq_ntf (us->tx_fifo, SVM_FIFO_WANT_DEQ_NOTIF);
+}
+
+static int
+proxy_http_forward_request (proxy_http_worker_t *wrk,
+			    proxy_http_downstream_t *ds,
+			    proxy_http_upstream_t *us)
+{
+  http_msg_t msg, req = {};
+  session_t *ds_s;
+  u32 ctrl_len;
+  int rv;
+
+  ds_s = session_get_from_handle (ds->session_handle);
+
+  rv = svm_fifo_peek (ds_s->rx_fifo, 0, sizeof (msg), (u8 *) &msg);
+  ASSERT (rv == sizeof (msg));
+  ctrl_len = proxy_http_msg_ctrl_len (&msg);
+  vec_validate (wrk->ctrl_buf, ctrl_len);
+  rv = svm_fifo_peek (ds_s->rx_fifo, sizeof (msg), ctrl_len, wrk->ctrl_buf);
+  ASSERT (rv == ctrl_len);
+
+  /* origin-form target, path is without leading slash */
+  vec_reset_length (wrk->target);
+  wrk->target = format (wrk->target, "/%U", format_http_bytes,
+			wrk->ctrl_buf + msg.data.target_path_offset,
+			msg.data.target_path_len);
+  if (msg.data.target_query_len)
+    wrk->target = format (wrk->target, "?%U", format_http_bytes,
+			  wrk->ctrl_buf + msg.data.target_query_offset,
+			  msg.data.target_query_len);
+  vec_add1 (wrk->target, 0);
+
+  if (proxy_http_copy_headers (&wrk->headers, wrk->ctrl_buf, &msg,
+			       proxy_http_req_skip,
+			       ARRAY_LEN (proxy_http_req_skip)) ||
+      proxy_http_add_host (&wrk->headers, wrk->ctrl_buf, &msg))
+    {
+      clib_warning ("request headers too big");
+      goto error;
+    }
+
+  req.type = HTTP_MSG_REQUEST;
+  req.method_type = msg.method_type;
+  req.data.type = HTTP_MSG_DATA_INLINE;
+  req.data.target_path_offset = 0;
+  req.data.target_path_len = vec_len (wrk->target);
+  req.data.headers_offset = vec_len (wrk->target);
+  req.data.headers_len = wrk->headers.tail_offset;
+  req.data.body_offset = req.data.headers_offset + req.data.headers_len;
+  req.data.body_len = msg.data.body_len;
+  req.data.len = req.data.body_offset + req.data.body_len;
+
+  svm_fifo_seg_t segs[3] = {
+    { (u8 *) &req, sizeof (req) },
+    { wrk->target, vec_len (wrk->target) },
+    { wrk->headers_buf, wrk->headers.tail_offset },
+  };
+  if (svm_fifo_max_enqueue_prod (us->tx_fifo) <
+      sizeof (req) + req.data.body_offset)
+    {
+      clib_warning ("no space in upstream tx fifo");
+      goto error;
+    }
+  rv = svm_fifo_enqueue_segments (us->tx_fifo, segs, 3, 0);
+  ASSERT (rv == sizeof (req) + req.data.body_offset);
+
+  /* request without body is kept until response starts, so it can be
+   * resent if pooled connection turns out to be closed by backend */
+  if (msg.data.body_len)
+    {
+      svm_fifo_dequeue_drop (ds_s->rx_fifo, sizeof (msg) + ctrl_len);
+      proxy_http_rx_dequeued (ds_s->rx_fifo, ds_s->handle,
+			      sizeof (msg) + ctrl_len);
+    }
+  else
+    ds->req_hold = sizeof (msg) + ctrl_len;
+
+  ds->us_index = us->us_index;
+  ds->to_send = msg.data.body_len;
+  us->ds_index = ds->ds_index;
+  us->state = PROXY_HTTP_US_S_BUSY;
+  us->resp_started = 0;
+  us->n_requests++;
+  wrk->backends[us->backend_index].n_requests++;
+
+  if (ds->to_send)
+    proxy_http_forward_request_body (wrk, ds, us);
+  else
+    proxy_http_tx_notify (us->tx_fifo, us->session_handle);
+
+  return 0;
+
+error:
+  wrk->n_errors++;
+  proxy_http_ds_fail_request (wrk, ds, HTTP_STATUS_BAD_GATEWAY);
+  proxy_http_us_put_idle (wrk, us);
+  return -1;
+}
+
+/* response complete, release upstream connection */
+static void
+proxy_http_transaction_done (proxy_http_worker_t *wrk,
+			     proxy_http_downstream_t *ds,
+			     proxy_http_upstream_t *us)
+{
+  u8 reuse = ds->to_send == 0;
+
+  wrk->n_requests++;
+  ds->us_index = ~0;
+  /* upstream replied before we sent whole request body, not reusable */
+  if (reuse)
+    proxy_http_us_put_idle (wrk, us);
+  else
+    {
+      us->ds_index = ~0;
+      proxy_http_us_close (wrk, us);
+    }
+
+  /* pipelined request might be already waiting */
+  proxy_http_ds_rx (wrk, ds);
+}
+
+static void
+proxy_http_forward_response (proxy_http_worker_t *wrk,
+			     proxy_http_upstream_t *us)
+{
+  proxy_http_downstream_t *ds;
+  svm_fifo_seg_t segs[4];
+  u32 n_segs = 4, ctrl_len, max_len;
+  http_msg_t msg, resp = {};
+  session_t *ds_s;
+  int n_read, rv;
+
+  ds = proxy_http_ds_get (wrk, us->ds_index);
+  ds_s = session_get_from_handle (ds->session_handle);
+
+  if (!us->resp_started)
+    {
+      if (svm_fifo_max_dequeue_cons (us->rx_fifo) < sizeof (msg))
+	return;
+      rv = svm_fifo_peek (us->rx_fifo, 0, sizeof (msg), (u8 *) &msg);
+      ASSERT (rv == sizeof (msg));
+      if (msg.type != HTTP_MSG_REPLY)
+	{
+	  clib_warning ("unexpected msg type %d", msg.type);
+	  wrk->n_errors++;
+	  proxy_http_ds_close (wrk, ds);
+	  return;
+	}
+      ctrl_len = proxy_http_msg_ctrl_len (&msg);
+      vec_validate (wrk->ctrl_buf, ctrl_len);
+      rv = svm_fifo_peek (us->rx_fifo, sizeof (msg), ctrl_len,
+			  wrk->ctrl_buf);
+      ASSERT (rv == ctrl_len);
+
+      if (proxy_http_copy_headers (&wrk->headers, wrk->ctrl_buf, &msg,
+				   proxy_http_resp_skip,
+				   ARRAY_LEN (proxy_http_resp_skip)))
+	{
+	  clib_warning ("response headers too big");
+	  wrk->n_errors++;
+	  proxy_http_ds_close (wrk, ds);
+	  return;
+	}
+
+      resp.type = HTTP_MSG_REPLY;
+      resp.code = msg.code;
+      resp.data.type = HTTP_MSG_DATA_INLINE;
+      resp.data.headers_offset = 0;
+      resp.data.headers_len = wrk->headers.tail_offset;
+      resp.data.body_offset = resp.data.headers_len;
+      resp.data.body_len = msg.data.body_len;
+      resp.data.len = resp.data.body_offset + resp.data.body_len;
+
+      /* wait until there is enough space for whole control data */
+      if (svm_fifo_max_enqueue_prod (ds_s->tx_fifo) <
+	  sizeof (resp) + resp.data.headers_len)
+	{
+	  svm_fifo_add_want_deq_ntf (ds_s->tx_fifo, SVM_FIFO_WANT_DEQ_NOTIF);
+	  return;
+	}
+
+      svm_fifo_seg_t hdr_segs[2] = {
+	{ (u8 *) &resp, sizeof (resp) },
+	{ wrk->headers_buf, resp.data.headers_len },
+      };
+      rv = svm_fifo_enqueue_segments (ds_s->tx_fifo, hdr_segs, 2, 0);
+      ASSERT (rv == sizeof (resp) + resp.data.headers_len);
+
+      svm_fifo_dequeue_drop (us->rx_fifo, sizeof (msg) + ctrl_len);
+      proxy_http_rx_dequeued (us->rx_fifo, us->session_handle,
+			      sizeof (msg) + ctrl_len);
+      proxy_http_ds_drop_held (ds, ds_s);
+      us->resp_started = 1;
+      us->to_recv = msg.data.body_len;
+    }
+
+  max_len = clib_min (svm_fifo_max_dequeue_cons (us->rx_fifo),
+		      svm_fifo_max_enqueue_prod (ds_s->tx_fifo));
+  max_len = clib_min (max_len, us->to_recv);
+  if (max_len)
+    {
+      n_read = svm_fifo_segments (us->rx_fifo, 0, segs, &n_segs, max_len);
+      ASSERT (n_read > 0);
+      svm_fifo_enqueue_segments (ds_s->tx_fifo, segs, n_segs, 0);
+      svm_fifo_dequeue_drop (us->rx_fifo, n_read);
+      us->to_recv -= n_read;
+      proxy_http_rx_dequeued (us->rx_fifo, us->session_handle, n_read);
+    }
+  proxy_http_tx_notify (ds_s->tx_fifo, ds_s->handle);
+
+  if (us->to_recv == 0)
+    {
+      proxy_http_transaction_done (wrk, ds, us);
+      return;
+    }
+
+  if (!svm_fifo_max_enqueue_prod (ds_s->tx_fifo))
+    svm_fifo_add_want_deq_ntf (ds_s->tx_fifo, SVM_FIFO_WANT_DEQ_NOTIF);
+}
+
+static void
+proxy_http_ds_rx (proxy_http_worker_t *wrk, proxy_http_downstream_t *ds)
+{
+  proxy_http_upstream_t *us;
+  session_t *s;
+  http_msg_t msg;
+  int rv;
+
+  if (ds->is_closed || ds->is_pending)
+    return;
+
+  /* stream rest of the request body */
+  if (ds->us_index != ~0)
+    {
+      us = proxy_http_us_get (wrk, ds->us_index);
+      if (ds->to_send)
+	proxy_http_forward_request_body (wrk, ds, us);
+      return;
+    }
+
+  s = session_get_from_handle (ds->session_handle);
+  if (ds->to_drop)
+    {
+      proxy_http_ds_drop (ds, s);
+      if (ds->to_drop)
+	return;
+    }
+  if (svm_fifo_max_dequeue_cons (s->rx_fifo) < sizeof (msg))
+    return;
+
+  rv = svm_fifo_peek (s->rx_fifo, 0, sizeof (msg), (u8 *) &msg);
+  ASSERT (rv == sizeof (msg));
+  if (msg.type != HTTP_MSG_REQUEST)
+    {
+      clib_warning ("unexpected msg type %d", msg.type);
+      proxy_http_ds_close (wrk, ds);
+      return;
+    }
+  /* http client transport supports only these */
+  if (msg.method_type != HTTP_REQ_GET && msg.method_type != HTTP_REQ_POST)
+    {
+      proxy_http_ds_fail_request (wrk, ds, HTTP_STATUS_METHOD_NOT_ALLOWED);
+      return;
+    }
+
+  us = proxy_http_us_alloc (wrk, 1 /* can_connect */);
+  if (!us)
+    {
+      ds->is_pending = 1;
+      vec_add1 (wrk->pending, ds->ds_index);
+      return;
+    }
+
+  proxy_http_forward_request (wrk, ds, us);
+}
+
+/*
+ * Downstream (server) session callbacks
+ */
+
+static int
+proxy_http_ds_accept_callback (session_t *s)
+{
+  proxy_http_worker_t *wrk = proxy_http_worker_get (s->thread_index);
+  proxy_http_downstream_t *ds;
+
+  pool_get_zero (wrk->ds_pool, ds);
+  ds->ds_index = ds - wrk->ds_pool;
+  ds->session_handle = session_handle (s);
+  ds->us_index = ~0;
+  s->opaque = ds->ds_index;
+  s->session_state = SESSION_STATE_READY;
+
+  return 0;
+}
+
+static void
+proxy_http_ds_disconnect_callback (session_t *s)
+{
+  proxy_http_worker_t *wrk = proxy_http_worker_get (s->thread_index);
+  proxy_http_ds_close (wrk, proxy_http_ds_get (wrk, s->opaque));
+}
+
+static void
+proxy_http_ds_reset_callback (session_t *s)
+{
+  proxy_http_ds_disconnect_callback (s);
+}
+
+static int
+proxy_http_ds_rx_callback (session_t *s)
+{
+  proxy_http_worker_t *wrk = proxy_http_worker_get (s->thread_index);
+  proxy_http_ds_rx (wrk, proxy_http_ds_get (wrk, s->opaque));
+  return 0;
+}
+
+static int
+proxy_http_ds_tx_callback (session_t *s)
+{
+  proxy_http_worker_t *wrk = proxy_http_worker_get (s->thread_index);
+  proxy_http_downstream_t *ds = proxy_http_ds_get (wrk, s->opaque);
+
+  /* room in downstream tx fifo, continue with response */
+  if (!ds->is_closed && ds->us_index != ~0)
+    proxy_http_forward_response (wrk, proxy_http_us_get (wrk, ds->us_index));
+
+  return 0;
+}
+
+static void
+proxy_http_ds_cleanup_callback (session_t *s, session_cleanup_ntf_t ntf)
+{
+  proxy_http_worker_t *wrk;
+  proxy_http_downstream_t *ds;
+
+  if (ntf == SESSION_CLEANUP_TRANSPORT)
+    return;
+
+  wrk = proxy_http_worker_get (s->thread_index);
+  ds = proxy_http_ds_get (wrk, s->opaque);
+  if (!ds->is_closed)
+    proxy_http_ds_detach (wrk, ds);
+  pool_put (wrk->ds_pool, ds);
+}
+
+static int
+proxy_http_add_segment_callback (u32 client_index, u64 segment_handle)
+{
+  return 0;
+}
+
+static session_cb_vft_t proxy_http_server_cb_vft = {
+  .session_accept_callback = proxy_http_ds_accept_callback,
+  .session_disconnect_callback = proxy_http_ds_disconnect_callback,
+  .session_reset_callback = proxy_http_ds_reset_callback,
+  .session_cleanup_callback = proxy_http_ds_cleanup_callback,
+  .add_segment_callback = proxy_http_add_segment_callback,
+  .builtin_app_rx_callback = proxy_http_ds_rx_callback,
+  .builtin_app_tx_callback = proxy_http_ds_tx_callback,
+};
+
+/*
+ * Upstream (client) session callbacks
+ */
+
+static int
+proxy_http_us_connected_callback (u32 app_index, u32 api_context,
+				  session_t *s, session_error_t err)
+{
+  proxy_http_us_rpc_args_t _a, *a = &_a;
+  u32 thread_index = proxy_http_us_opaque_thread (api_context);
+
+  if (err)
+    {
+      clib_warning ("connect error: %U", format_session_error, err);
+      session_send_rpc_evt_to_thread_force (
+	thread_index, proxy_http_connect_failed_rpc,
+	uword_to_pointer (proxy_http_us_opaque_index (api_context), void *));
+      return -1;
+    }
+
+  s->opaque = api_context;
+  if (thread_index != s->thread_index)
+    {
+      a = 0;
+      vec_validate (a, 0);
+    }
+  a->session_handle = session_handle (s);
+  a->rx_fifo = s->rx_fifo;
+  a->tx_fifo = s->tx_fifo;
+  a->thread_index = s->thread_index;
+  a->us_index = proxy_http_us_opaque_index (api_context);
+
+  /* hand connection over to worker that asked for it, events for this
+   * session are sent after the rpc, so they find it established */
+  if (thread_index == s->thread_index)
+    proxy_http_us_established (proxy_http_worker_get (thread_index), a);
+  else
+    session_send_rpc_evt_to_thread_force (
+      thread_index, proxy_http_us_established_rpc, a);
+
+  return 0;
+}
+
+/* upstream connection went away, retry or fail request it was serving */
+static void
+proxy_http_us_lost (proxy_http_worker_t *wrk, proxy_http_upstream_t *us)
+{
+  proxy_http_downstream_t *ds;
+  session_t *ds_s;
+
+  if (us->state != PROXY_HTTP_US_S_BUSY || us->ds_index == ~0)
+    return;
+
+  ds = proxy_http_ds_get (wrk, us->ds_index);
+  ds->us_index = ~0;
+  us->ds_index = ~0;
+
+  if (us->resp_started || ds->to_send)
+    {
+      proxy_http_ds_close (wrk, ds);
+      return;
+    }
+
+  /* reused connection closed by backend before it replied, resend request
+   * once over new connection */
+  if (ds->req_hold && !ds->is_retry && us->n_requests > 1)
+    {
+      wrk->n_retries++;
+      ds->is_retry = 1;
+      ds->is_pending = 1;
+      vec_insert_elts (wrk->pending, &ds->ds_index, 1, 0);
+      return;
+    }
+
+  /* nothing sent downstream yet, reply with error */
+  wrk->n_errors++;
+  ds_s = session_get_from_handle (ds->session_handle);
+  proxy_http_ds_drop_held (ds, ds_s);
+  proxy_http_send_status (ds_s, HTTP_STATUS_BAD_GATEWAY);
+}
+
+static void
+proxy_http_us_handle_evt (proxy_http_worker_t *wrk, proxy_http_upstream_t *us,
+			  proxy_http_us_evt_t evt)
+{
+  proxy_http_us_rpc_args_t *a = 0;
+  proxy_http_downstream_t *ds;
+
+  switch (evt)
+    {
+    case PROXY_HTTP_US_EVT_RX:
+      if (us->state != PROXY_HTTP_US_S_BUSY || us->ds_index == ~0)
+	{
+	  svm_fifo_dequeue_drop_all (us->rx_fifo);
+	  break;
+	}
+      proxy_http_forward_response (wrk, us);
+      break;
+    case PROXY_HTTP_US_EVT_TX:
+      /* room in upstream tx fifo, continue with request body */
+      if (us->state == PROXY_HTTP_US_S_BUSY && us->ds_index != ~0)
+	{
+	  ds = proxy_http_ds_get (wrk, us->ds_index);
+	  if (ds->to_send)
+	    proxy_http_forward_request_body (wrk, ds, us);
+	}
+      break;
+    case PROXY_HTTP_US_EVT_DISCONNECT:
+      proxy_http_us_lost (wrk, us);
+      proxy_http_us_close (wrk, us);
+      /* connection slot freed, retried request might need it */
+      proxy_http_dispatch_pending (wrk, 1 /* can_connect */);
+      break;
+    case PROXY_HTTP_US_EVT_CLEANUP:
+      /* session is being freed, only release our state */
+      if (us->state != PROXY_HTTP_US_S_CLOSED)
+	{
+	  proxy_http_us_lost (wrk, us);
+	  proxy_http_us_release (wrk, us);
+	  proxy_http_dispatch_pending (wrk, 1 /* can_connect */);
+	}
+      /* fifos were kept for us by session thread, not used anymore */
+      if (us->thread_index != vlib_get_thread_index ())
+	{
+	  vec_validate (a, 0);
+	  a->rx_fifo = us->rx_fifo;
+	  a->tx_fifo = us->tx_fifo;
+	  session_send_rpc_evt_to_thread_force (
+	    us->thread_index, proxy_http_us_free_fifos_rpc, a);
+	}
+      pool_put (wrk->us_pool, us);
+      break;
+    }
+}
+
+static void
+proxy_http_us_evt_rpc (void *arg)
+{
+  uword data = pointer_to_uword (arg);
+  proxy_http_worker_t *wrk;
+
+  wrk = proxy_http_worker_get (vlib_get_thread_index ());
+  proxy_http_us_handle_evt (wrk, proxy_http_us_get (wrk, data >> 2),
+			    data & 3);
+}
+
+/* session callbacks run on thread of the session, forward them to worker
+ * that owns the connection */
+static void
+proxy_http_us_evt (session_t *s, proxy_http_us_evt_t evt)
+{
+  u32 thread_index = proxy_http_us_opaque_thread (s->opaque);
+  u32 us_index = proxy_http_us_opaque_index (s->opaque);
+  proxy_http_worker_t *wrk;
+
+  if (thread_index == s->thread_index)
+    {
+      wrk = proxy_http_worker_get (thread_index);
+      proxy_http_us_handle_evt (wrk, proxy_http_us_get (wrk, us_index), evt);
+      return;
+    }
+
+  session_send_rpc_evt_to_thread_force (
+    thread_index, proxy_http_us_evt_rpc,
+    uword_to_pointer ((uword) us_index << 2 | evt, void *));
+}
+
+static void
+proxy_http_us_disconnect_callback (session_t *s)
+{
+  proxy_http_us_evt (s, PROXY_HTTP_US_EVT_DISCONNECT);
+}
+
+static void
+proxy_http_us_reset_callback (session_t *s)
+{
+  proxy_http_us_disconnect_callback (s);
+}
+
+static int
+proxy_http_us_rx_callback (session_t *s)
+{
+  proxy_http_us_evt (s, PROXY_HTTP_US_EVT_RX);
+  return 0;
+}
+
+static int
+proxy_http_us_tx_callback (session_t *s)
+{
+  proxy_http_us_evt (s, PROXY_HTTP_US_EVT_TX);
+  return 0;
+}
+
+static void
+proxy_http_us_cleanup_callback (session_t *s, session_cleanup_ntf_t ntf)
+{
+  if (ntf == SESSION_CLEANUP_TRANSPORT)
+    return;
+
+  /* owner might still use fifos until it sees the cleanup, it hands them
+   * back to be freed on this thread */
+  if (proxy_http_us_opaque_thread (s->opaque) != s->thread_index)
+    {
+      s->rx_fifo = 0;
+      s->tx_fifo = 0;
+    }
+  proxy_http_us_evt (s, PROXY_HTTP_US_EVT_CLEANUP);
+}
+
+static session_cb_vft_t proxy_http_client_cb_vft = {
+  .session_connected_callback = proxy_http_us_connected_callback,
+  .session_disconnect_callback = proxy_http_us_disconnect_callback,
+  .session_reset_callback = proxy_http_us_reset_callback,
+  .session_cleanup_callback = proxy_http_us_cleanup_callback,
+  .add_segment_callback = proxy_http_add_segment_callback,
+  .builtin_app_rx_callback = proxy_http_us_rx_callback,
+  .builtin_app_tx_callback = proxy_http_us_tx_callback,
+};
+
+/*
+ * Setup
+ */
+
+static int
+proxy_http_attach (char *name, session_cb_vft_t *cb_vft, u32 *app_index)
+{
+  proxy_main_t *pm = &proxy_main;
+  vnet_app_attach_args_t _a, *a = &_a;
+  u64 options[APP_OPTIONS_N_OPTIONS];
+  int rv;
+
+  clib_memset (a, 0, sizeof (*a));
+  clib_memset (options, 0, sizeof (options));
+
+  a->api_client_index = APP_INVALID_INDEX;
+  a->name = format (0, name);
+  a->session_cb_vft = cb_vft;
+  a->options = options;
+  a->options[APP_OPTIONS_SEGMENT_SIZE] = pm->segment_size;
+  a->options[APP_OPTIONS_ADD_SEGMENT_SIZE] = pm->segment_size;
+  a->options[APP_OPTIONS_RX_FIFO_SIZE] = pm->fifo_size;
+  a->options[APP_OPTIONS_TX_FIFO_SIZE] = pm->fifo_size;
+  a->options[APP_OPTIONS_PRIVATE_SEGMENT_COUNT] = pm->private_segment_count;
+  a->options[APP_OPTIONS_PREALLOC_FIFO_PAIRS] = pm->prealloc_fifos;
+  a->options[APP_OPTIONS_FLAGS] = APP_OPTIONS_FLAGS_IS_BUILTIN;
+
+  rv = vnet_application_attach (a);
+  vec_free (a->name);
+  if (rv)
+    return rv;
+
+  *app_index = a->app_index;
+  return 0;
+}
+
+static int
+proxy_http_listen (void)
+{
+  proxy_http_main_t *phm = &proxy_http_main;
+  proxy_main_t *pm = &proxy_main;
+  vnet_listen_args_t _a = {}, *a = &_a;
+  transport_endpt_cfg_http_t http_cfg = { pm->idle_timeout,
+					  HTTP_UDP_TUNNEL_DGRAM };
+  transport_endpt_ext_cfg_t *ext_cfg;
+  int rv;
+
+  a->app_index = phm->server_app_index;
+  clib_memcpy (&a->sep_ext, &pm->server_sep, sizeof (pm->server_sep));
+  ext_cfg = session_endpoint_add_ext_cfg (
+    &a->sep_ext, TRANSPORT_ENDPT_EXT_CFG_HTTP, sizeof (http_cfg));
+  clib_memcpy (ext_cfg->data, &http_cfg, sizeof (http_cfg));
+
+  rv = vnet_listen (a);
+  session_endpoint_free_ext_cfgs (&a->sep_ext);
+
+  return rv;
+}
+
+clib_error_t *
+proxy_http_server_create (vlib_main_t *vm, u8 **backend_uris, u32 max_conns)
+{
+  proxy_http_main_t *phm = &proxy_http_main;
+  proxy_http_backend_t *b;
+  proxy_http_worker_t *wrk;
+  u32 i, n_workers;
+  int rv;
+
+  if (vec_len (phm->backends))
+    return clib_error_return (0, "http reverse proxy already running");
+
+  for (i = 0; i < vec_len (backend_uris); i++)
+    {
+      vec_add2 (phm->backends, b, 1);
+      b->uri = vec_dup (backend_uris[i]);
+      if (parse_uri ((char *) b->uri, &b->sep) ||
+	  b->sep.transport_proto != TRANSPORT_PROTO_HTTP)
+	{
+	  clib_error_t *error =
+	    clib_error_return (0, "invalid backend uri %s", b->uri);
+	  vec_foreach (b, phm->backends)
+	    vec_free (b->uri);
+	  vec_free (phm->backends);
+	  return error;
+	}
+    }
+
+  phm->max_conns = max_conns;
+  phm->via = format (0, "1.1 vpp-proxy");
+
+  n_workers = 1 /* main thread */ + vlib_num_workers ();
+  vec_validate (phm->workers, n_workers - 1);
+  vec_foreach (wrk, phm->workers)
+    {
+      vec_validate (wrk->backends, vec_len (phm->backends) - 1);
+      vec_validate (wrk->headers_buf, PROXY_HTTP_HEADERS_BUF_SIZE - 1);
+      http_init_headers_ctx (&wrk->headers, wrk->headers_buf,
+			     vec_len (wrk->headers_buf));
+    }
+
+  if ((rv = proxy_http_attach ("proxy-http-server", &proxy_http_server_cb_vft,
+			       &phm->server_app_index)))
+    return clib_error_return (0, "server attach returned: %U",
+			      format_session_error, rv);
+  if ((rv = proxy_http_attach ("proxy-http-client", &proxy_http_client_cb_vft,
+			       &phm->client_app_index)))
+    return clib_error_return (0, "client attach returned: %U",
+			      format_session_error, rv);
+
+  if ((rv = proxy_http_listen ()))
+    return clib_error_return (0, "listen returned: %U", format_session_error,
+			      rv);
+
+  return 0;
+}
+
+static clib_error_t *
+show_proxy_http_command_fn (vlib_main_t *vm, unformat_input_t *input,
+			    vlib_cli_command_t *cmd)
+{
+  proxy_http_main_t *phm = &proxy_http_main;
+  proxy_http_backend_wrk_t *bw;
+  proxy_http_worker_t *wrk;
+  proxy_http_backend_t *b;
+  u64 n_requests, n_connects, n_failed;
+  u32 n_conns, n_idle, n_pending;
+
+  if (!vec_len (phm->backends))
+    return clib_error_return (0, "http reverse proxy not running");
+
+  vec_foreach (b, phm->backends)
+    {
+      n_requests = n_connects = n_failed = 0;
+      n_conns = n_idle = 0;
+      vec_foreach (wrk, phm->workers)
+	{
+	  bw = vec_elt_at_index (wrk->backends, b - phm->backends);
+	  n_requests += bw->n_requests;
+	  n_connects += bw->n_connects;
+	  n_failed += bw->n_connect_failed;
+	  n_conns += bw->n_conns;
+	  n_idle += vec_len (bw->idle);
+	}
+      vlib_cli_output (vm,
+		       "backend %s: %u connections (%u idle), %lu requests, "
+		       "%lu connects, %lu connect failed",
+		       b->uri, n_conns, n_idle, n_requests, n_connects,
+		       n_failed);
+    }
+
+  vec_foreach (wrk, phm->workers)
+    {
+      n_pending = vec_len (wrk->pending);
+      vlib_cli_output (vm,
+		       "worker %u: %lu requests, %lu errors, %lu retries, "
+		       "%u pending, %u downstream sessions",
+		       wrk - phm->workers, wrk->n_requests, wrk->n_errors,
+		       wrk->n_retries, n_pending, pool_elts (wrk->ds_pool));
+    }
+
+  return 0;
+}
+
+VLIB_CLI_COMMAND (show_proxy_http_command, static) = {
+  .path = "show test proxy http",
+  .short_help = "show test proxy http",
+  .function = show_proxy_http_command_fn,
+};
@@ -228,10 +228,12 @@ vcl_test_stats_dump (char *header, vcl_test_stats_t * stats,
 	      "         writes:  %lu (0x%08lx)\n"
 	      "       tx bytes:  %lu (0x%08lx)\n"
 	      "      tx eagain:  %u (0x%08x)\n"
-	      "  tx incomplete:  %u (0x%08x)\n",
+	      "  tx incomplete:  %u (0x%08x)\n"
+	      "     writes/sec:  %.2lf\n",
 	      (void *) stats, stats->tx_xacts, stats->tx_xacts,
 	      stats->tx_bytes, stats->tx_bytes, stats->tx_eagain,
-	      stats->tx_eagain, stats->tx_incomp, stats->tx_incomp);
+	      stats->tx_eagain, stats->tx_incomp, stats->tx_incomp,
+	      (double) stats->tx_xacts / duration);
     }
   if (show_rx)
     {
@@ -240,10 +242,12 @@ vcl_test_stats_dump (char *header, vcl_test_stats_t * stats,
 	      "          reads:  %lu (0x%08lx)\n"
 	      "       rx bytes:  %lu (0x%08lx)\n"
 	      "      rx eagain:  %u (0x%08x)\n"
-	      "  rx incomplete:  %u (0x%08x)\n",
+	      "  rx incomplete:  %u (0x%08x)\n"
+	      "      reads/sec:  %.2lf\n",
 	      (void *) stats, stats->rx_xacts, stats->rx_xacts,
 	      stats->rx_bytes, stats->rx_bytes, stats->rx_eagain,
-	      stats->rx_eagain, stats->rx_incomp, stats->rx_incomp);
+	      stats->rx_eagain, stats->rx_incomp, stats->rx_incomp,
+	      (double) stats->rx_xacts / duration);
     }
   if (verbose)
     printf ("   start.tv_sec:  %ld\n"
@@ -5,6 +5,7 @@
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <string.h>
+#include <time.h>
 #include <vcl/vppcom.h>
 #include <hs_apps/vcl/vcl_test.h>
 
@@ -25,8 +26,13 @@ typedef struct vtclu_main_
     struct sockaddr_storage clnt_addr;
   };
   uint16_t port;
+  uint32_t n_dgrams;   /**< if non-zero, run pps benchmark */
+  uint32_t dgram_len;  /**< benchmark dgram length */
 } vt_clu_main_t;
 
+#define VT_CLU_BENCH_MAX_LEN 8192
+#define VT_CLU_BENCH_N_FIN   8
+
 static vt_clu_main_t vt_clu_main;
 
 static void
@@ -36,11 +42,26 @@ vt_clu_parse_args (vt_clu_main_t *vclum, int argc, char **argv)
 
   memset (vclum, 0, sizeof (*vclum));
   vclum->port = VCL_TEST_SERVER_PORT;
+  vclum->dgram_len = 64;
 
   opterr = 0;
-  while ((c = getopt (argc, argv, "s:c:")) != -1)
+  while ((c = getopt (argc, argv, "s:c:p:n:l:")) != -1)
     switch (c)
       {
+      case 'p':
+	vclum->port = atoi (optarg);
+	break;
+      case 'n':
+	vclum->n_dgrams = strtoul (optarg, 0, 10);
+	break;
+      case 'l':
+	vclum->dgram_len = atoi (optarg);
+	if (vclum->dgram_len < 2 || vclum->dgram_len > VT_CLU_BENCH_MAX_LEN)
+	  {
+	    vtwrn ("dgram length must be in [2, %u]", VT_CLU_BENCH_MAX_LEN);
+	    exit (1);
+	  }
+	break;
       case 's':
 	vclum->app_type = VT_CLU_TYPE_SERVER;
 	if (inet_pton (
@@ -65,7 +86,88 @@ vt_clu_parse_args (vt_clu_main_t *vclum, int argc, char **argv)
   vclum->endpt.is_ip4 = 1;
   vclum->endpt.ip =
     (uint8_t *) &((struct sockaddr_in *) &vclum->srvr_addr)->sin_addr;
-  vclum->endpt.port = htons (vclum->endpt.port);
+  vclum->endpt.port = htons (vclum->port);
+}
+
+/* Server side of the pps benchmark. Counts dgrams until the client's
+ * 1 byte end markers show up */
+static int
+vt_clu_bench_server (vt_clu_main_t *vclum, int vcl_sh)
+{
+  static char buf[VT_CLU_BENCH_MAX_LEN];
+  struct timespec start, stop;
+  uint64_t n_rx = 0, n_bytes = 0;
+  struct sockaddr_in _addr;
+  vppcom_endpt_t rmt_ep = { .ip = (void *) &_addr };
+  double duration;
+  int rv;
+
+  while (1)
+    {
+      rv = vppcom_session_recvfrom (vcl_sh, buf, sizeof (buf), 0, &rmt_ep);
+      if (rv < 0)
+	{
+	  vterr ("vppcom_session_recvfrom()", rv);
+	  return rv;
+	}
+      if (rv == 1)
+	{
+	  if (n_rx)
+	    break;
+	  continue;
+	}
+      if (!n_rx)
+	clock_gettime (CLOCK_REALTIME, &start);
+      n_rx += 1;
+      n_bytes += rv;
+    }
+  clock_gettime (CLOCK_REALTIME, &stop);
+
+  duration = vcl_test_time_diff (&start, &stop);
+  vtinf ("Received %lu of %u dgrams (%lu bytes) in %.3f sec: %.0f pps "
+	 "%.3f Gbps",
+	 n_rx, vclum->n_dgrams, n_bytes, duration,
+	 duration > 0 ? n_rx / duration : 0,
+	 duration > 0 ? n_bytes * 8 / duration / 1e9 : 0);
+  return 0;
+}
+
+/* Client side of the pps benchmark. Sends n_dgrams of dgram_len bytes
+ * followed by a few 1 byte end markers */
+static int
+vt_clu_bench_client (vt_clu_main_t *vclum, int vcl_sh)
+{
+  static char buf[VT_CLU_BENCH_MAX_LEN];
+  struct timespec start, stop;
+  uint32_t i;
+  double duration;
+  int rv;
+
+  memset (buf, 'a', vclum->dgram_len);
+  clock_gettime (CLOCK_REALTIME, &start);
+  for (i = 0; i < vclum->n_dgrams; i++)
+    {
+      rv = vppcom_session_sendto (vcl_sh, buf, vclum->dgram_len, 0,
+				  &vclum->endpt);
+      if (rv < 0)
+	{
+	  vterr ("vppcom_session_sendto()", rv);
+	  return rv;
+	}
+    }
+  clock_gettime (CLOCK_REALTIME, &stop);
+
+  for (i = 0; i < VT_CLU_BENCH_N_FIN; i++)
+    {
+      vppcom_session_sendto (vcl_sh, buf, 1, 0, &vclum->endpt);
+      usleep (500);
+    }
+
+  duration = vcl_test_time_diff (&start, &stop);
+  vtinf ("Sent %u dgrams of %u bytes in %.3f sec: %.0f pps", vclum->n_dgrams,
+	 vclum->dgram_len, duration,
+	 duration > 0 ? vclum->n_dgrams / duration : 0);
+  return 0;
 }
 
 int
@@ -102,6 +204,9 @@ main (int argc, char **argv)
 	  return rv;
 	}
 
+      if (vclum->n_dgrams)
+	return vt_clu_bench_server (vclum, vcl_sh);
+
       rv = vppcom_session_recvfrom (vcl_sh, buf, buflen, 0, &rmt_ep);
       if (rv < 0)
 	{
@@ -128,6 +233,9 @@ main (int argc, char **argv)
     }
   else if (vclum->app_type == VT_CLU_TYPE_CLIENT)
     {
+      if (vclum->n_dgrams)
+	return vt_clu_bench_client (vclum, vcl_sh);
+
       char *msg = "hello cl udp server";
       int msg_len = strnlen (msg, buflen);
       memcpy (buf, msg, msg_len);
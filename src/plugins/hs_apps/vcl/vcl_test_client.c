@@ -65,6 +65,7 @@ typedef struct
   hs_test_t post_test;
   uint8_t proto;
   uint8_t incremental_stats;
+  uint8_t pingpong;
   uint32_t n_workers;
   volatile int active_workers;
   volatile int test_running;
@@ -681,6 +682,145 @@ vtc_worker_run_epoll (vcl_test_client_worker_t *wrk)
   return 0;
 }
 
+static int
+vtc_rtt_cmp (const void *a, const void *b)
+{
+  double x = *(const double *) a, y = *(const double *) b;
+  return (x > y) - (x < y);
+}
+
+static void
+vtc_worker_pingpong_stats (vcl_test_client_worker_t *wrk, double *rtts,
+			   uint64_t n_rtts)
+{
+  vppcom_busy_poll_stats_t bps;
+  double sum = 0;
+  uint64_t i;
+
+  if (!n_rtts)
+    return;
+
+  qsort (rtts, n_rtts, sizeof (double), vtc_rtt_cmp);
+  for (i = 0; i < n_rtts; i++)
+    sum += rtts[i];
+
+  vtinf ("Worker %u ping-pong rtt (us) over %lu round trips:\n"
+	 "  min %.2lf avg %.2lf p50 %.2lf p99 %.2lf p99.9 %.2lf max %.2lf",
+	 wrk->wrk_index, n_rtts, rtts[0], sum / n_rtts, rtts[n_rtts / 2],
+	 rtts[(uint64_t) (n_rtts * 0.99)], rtts[(uint64_t) (n_rtts * 0.999)],
+	 rtts[n_rtts - 1]);
+
+  if (vppcom_worker_busy_poll_stats (&bps) == VPPCOM_OK)
+    vtinf ("Worker %u epoll busy-poll: spin hits %lu sleeps %lu spin %.3lfs "
+	   "sleep %.3lfs budget %.2lfus",
+	   wrk->wrk_index, bps.n_spin_hits, bps.n_sleeps, bps.spin_time,
+	   bps.sleep_time, bps.spin_budget * 1e6);
+}
+
+/**
+ * Ping-pong latency test. Each session writes one buffer and waits, in
+ * a blocking epoll wait, for the server to echo it back before sending
+ * the next one. Useful to measure vcl wakeup latency, e.g., with or
+ * without epoll busy-polling.
+ */
+static int
+vtc_worker_run_pingpong (vcl_test_client_worker_t *wrk)
+{
+  vcl_test_client_main_t *vcm = &vcl_client_main;
+  struct timespec start, end;
+  uint64_t n_rtts = 0, target;
+  vcl_test_session_t *ts;
+  double *rtts;
+  int i, rv = 0, n_ev;
+  uint32_t j;
+
+  rv = vtc_worker_connect_sessions_epoll (wrk);
+  if (rv < 0)
+    {
+      vterr ("vtc_worker_connect_sessions()", rv);
+      return rv;
+    }
+
+  rtts = calloc (wrk->cfg.num_writes * wrk->cfg.num_test_sessions,
+		 sizeof (double));
+  if (!rtts)
+    {
+      vterr ("failed to alloc rtts", -errno);
+      return -1;
+    }
+
+  vtc_worker_start_transfer (wrk);
+  rv = 0;
+
+  while (vcm->test_running && n_rtts < wrk->cfg.num_writes *
+					       wrk->cfg.num_test_sessions)
+    {
+      for (j = 0; j < wrk->cfg.num_test_sessions; j++)
+	{
+	  ts = &wrk->sessions[j];
+	  if (ts->is_done)
+	    continue;
+
+	  clock_gettime (CLOCK_MONOTONIC, &start);
+	  if (ts->write (ts, ts->txbuf, ts->cfg.txbuf_size) <= 0)
+	    {
+	      vtwrn ("vppcom_test_write (%d) failed -- aborting test", ts->fd);
+	      rv = -1;
+	      goto done;
+	    }
+
+	  /* Wait for the echo */
+	  target = ts->stats.tx_bytes;
+	  while (ts->stats.rx_bytes < target && vcm->test_running)
+	    {
+	      n_ev = vppcom_epoll_wait (wrk->epoll_sh, wrk->ep_evts,
+					VCL_TEST_CFG_MAX_EPOLL_EVENTS,
+					1000 /* timeout ms */);
+	      if (n_ev < 0)
+		{
+		  vterr ("vppcom_epoll_wait()", n_ev);
+		  rv = -1;
+		  goto done;
+		}
+	      for (i = 0; i < n_ev; i++)
+		{
+		  if (wrk->ep_evts[i].data.u32 != j)
+		    continue;
+		  if (wrk->ep_evts[i].events & (EPOLLERR | EPOLLHUP))
+		    {
+		      vtwrn ("session %u closed before test ended", ts->fd);
+		      rv = -1;
+		      goto done;
+		    }
+		  if (!(wrk->ep_evts[i].events & EPOLLIN))
+		    continue;
+		  /* Drain everything, events are edge triggered */
+		  do
+		    {
+		      if (ts->read (ts, ts->rxbuf, ts->rxbuf_size) < 0)
+			{
+			  rv = -1;
+			  goto done;
+			}
+		    }
+		  while (ts->stats.rx_bytes < target &&
+			 vppcom_session_attr (ts->fd, VPPCOM_ATTR_GET_NREAD, 0,
+					      0) > 0);
+		}
+	    }
+	  clock_gettime (CLOCK_MONOTONIC, &end);
+
+	  rtts[n_rtts++] = vcl_test_time_diff (&start, &end) * 1e6;
+	  vtc_session_check_is_done (ts, 1 /* check_rx */);
+	}
+    }
+
+done:
+  vtc_worker_pingpong_stats (wrk, rtts, n_rtts);
+  free (rtts);
+  return rv;
+}
+
 static inline int
 vtc_worker_run (vcl_test_client_worker_t *wrk)
 {
@@ -1012,7 +1152,9 @@ print_usage_and_exit (void)
     "  -I <N>           Use N sessions.\n"
     "  -s <N>           Use N sessions.\n"
     "  -S	       	Print incremental stats per session.\n"
-    "  -q <n>           QUIC : use N Ssessions on top of n Qsessions\n");
+    "  -q <n>           QUIC : use N Ssessions on top of n Qsessions\n"
+    "  -Q <n>           Batch up to n io events sent to vpp.\n"
+    "  -P               Run ping-pong latency test.\n");
   exit (1);
 }
 
@@ -1023,7 +1165,7 @@ vtc_process_opts (vcl_test_client_main_t * vcm, int argc, char **argv)
   int c, v;
 
   opterr = 0;
-  while ((c = getopt (argc, argv, "chnp:w:xXE:I:N:R:T:b:UBV6DLs:q:S")) != -1)
+  while ((c = getopt (argc, argv, "chnp:w:xXE:I:N:R:T:b:UBV6DLs:q:SQ:P")) != -1)
     switch (c)
       {
       case 'c':
@@ -1176,6 +1318,12 @@ vtc_process_opts (vcl_test_client_main_t * vcm, int argc, char **argv)
 	ctrl->cfg.test = HS_TEST_TYPE_BI;
 	break;
 
+      case 'P':
+	/* Server echoes back bi-directional test data */
+	vcm->pingpong = 1;
+	ctrl->cfg.test = HS_TEST_TYPE_BI;
+	break;
+
       case 'V':
 	ctrl->cfg.verbose = 1;
 	break;
@@ -1201,6 +1349,16 @@ vtc_process_opts (vcl_test_client_main_t * vcm, int argc, char **argv)
 	vcm->incremental_stats = 1;
 	break;
 
+      case 'Q':
+	if (sscanf (optarg, "%d", &v) != 1 || v < 0)
+	  {
+	    vtwrn ("Invalid io event batch size: %s", optarg);
+	    print_usage_and_exit ();
+	  }
+	/* Picked up by vcl when the app is created */
+	setenv (VPPCOM_ENV_IO_EVT_BATCH, optarg, 1);
+	break;
+
       case '?':
 	switch (optopt)
 	  {
@@ -1212,6 +1370,7 @@ vtc_process_opts (vcl_test_client_main_t * vcm, int argc, char **argv)
 	  case 'w':
 	  case 'p':
 	  case 'q':
+	  case 'Q':
 	    vtwrn ("Option -%c requires an argument.", optopt);
 	    break;
 
@@ -1372,7 +1531,10 @@ vtc_alloc_workers (vcl_test_client_main_t *vcm)
   vcm->workers = calloc (vcm->n_workers, sizeof (vcl_test_client_worker_t));
   vt->wrk = calloc (vcm->n_workers, sizeof (vcl_test_wrk_t));
 
-  if (vcm->ctrl_session.cfg.num_test_sessions > VCL_TEST_CFG_MAX_SELECT_SESS)
+  if (vcm->pingpong)
+    run_fn = vtc_worker_run_pingpong;
+  else if (vcm->ctrl_session.cfg.num_test_sessions >
+	   VCL_TEST_CFG_MAX_SELECT_SESS)
     run_fn = vtc_worker_run_epoll;
   else
     run_fn = vtc_worker_run_select;
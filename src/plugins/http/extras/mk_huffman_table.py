@@ -6,10 +6,33 @@ from io import StringIO
 # Copyright(c) 2025 Cisco Systems, Inc.
 
 
-# e.g. 5 bit code symbol has 8 slots (2^8-5), last 3 bits are irrelevant
-def generate_slots(fh, s, cl):
-    for i in range(1 << 8 - cl):
-        fh.write("  { 0x%02X, %d },\n" % (s, cl))
+# number of bits used to index multi-symbol decoding table
+MULTI_TABLE_BITS = 12
+
+
+# find symbol which code is prefix of given value of "bits" length
+def find_symbol(value, bits):
+    for symbol, code in enumerate(huff_code_table):
+        code_len = int(code[0])
+        if code_len > bits:
+            continue
+        if value >> (bits - code_len) == int(code[1], 16):
+            return symbol, code_len
+    return None, 0
+
+
+# each slot decodes up to two symbols with codes up to MULTI_TABLE_BITS long,
+# packed as (second code len << 24 | first code len << 16 | second symbol << 8
+# | first symbol), first code len zero means code is longer than index
+def generate_multi_slot(value):
+    symbol, code_len = find_symbol(value, MULTI_TABLE_BITS)
+    if symbol is None:
+        return 0
+    rest = MULTI_TABLE_BITS - code_len
+    symbol2, code_len2 = find_symbol(value & ((1 << rest) - 1), rest)
+    if symbol2 is None:
+        symbol2, code_len2 = 0, 0
+    return code_len2 << 24 | code_len << 16 | symbol2 << 8 | symbol
 
 
 # list of code and code length tuples
@@ -313,25 +336,18 @@ static hpack_huffman_symbol_t huff_sym_table[] = {
 f.write(
     """};
 
-typedef struct
-{
-  u8 symbol;
-  u8 code_len;
-} hpack_huffman_code_t;
+#define HPACK_HUFFMAN_MULTI_TABLE_BITS %d
 
-static hpack_huffman_code_t huff_code_table_fast[] = {
+/* multi-symbol decoding table, see mk_huffman_table.py for entry layout */
+static u32 huff_code_table_multi[] = {
 """
+    % MULTI_TABLE_BITS
 )
 
-# fast decoding table, symbols with code length from 5 to 8 bits (most of printable ASCII characters)
-[generate_slots(f, i, 5) for i, code in enumerate(huff_code_table) if code[0] == "5"]
-[generate_slots(f, i, 6) for i, code in enumerate(huff_code_table) if code[0] == "6"]
-[generate_slots(f, i, 7) for i, code in enumerate(huff_code_table) if code[0] == "7"]
-[generate_slots(f, i, 8) for i, code in enumerate(huff_code_table) if code[0] == "8"]
-
-# last 2 entries are longer codes prefixes, code_len set to 0
-f.write("  { 0x00, 0 },\n")
-f.write("  { 0x00, 0 },\n")
+# fast decoding table, one or two symbols with code length from 5 to 12 bits
+slots = [generate_multi_slot(i) for i in range(1 << MULTI_TABLE_BITS)]
+for i in range(0, len(slots), 6):
+    f.write("  " + " ".join("0x%08X," % v for v in slots[i : i + 6]) + "\n")
 
 f.write(
     """};
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+# SPDX-License-Identifier: Apache-2.0
+# Copyright(c) 2025 Cisco Systems, Inc.
+
+# Generates perfect hash for HPACK static table header names (RFC7541
+# Appendix A), to be pasted into hpack.c
+#
+# key is first 4 bytes of name (zero padded, little endian) xor-ed with name
+# length and last character, hash is upper bits of key multiplied by
+# constant found by random search
+
+import random
+import re
+
+HASH_BITS = 7
+
+src = open("../http2/hpack.c").read()
+names = re.findall(r'name_val_token_lit \("([^"]+)"', src)
+assert len(names) == 61
+
+# only first (lowest) index for each name
+static_names = []
+for index, name in enumerate(names):
+    if name not in [n for n, _ in static_names]:
+        static_names.append((name, index + 1))
+
+
+def key(name):
+    w = int.from_bytes((name.encode() + b"\0\0\0")[:4], "little")
+    return (w ^ (len(name) << 24) ^ (ord(name[-1]) << 16)) & 0xFFFFFFFF
+
+
+def hash(name, multiplier):
+    return ((key(name) * multiplier) & 0xFFFFFFFF) >> (32 - HASH_BITS)
+
+
+random.seed(1)
+while True:
+    multiplier = random.getrandbits(32) | 1
+    slots = {}
+    for name, index in static_names:
+        h = hash(name, multiplier)
+        if h in slots:
+            break
+        slots[h] = index
+    else:
+        break
+
+print("#define HPACK_STATIC_TABLE_HASH_BITS       %d" % HASH_BITS)
+print("#define HPACK_STATIC_TABLE_HASH_MULTIPLIER 0x%08X" % multiplier)
+print("")
+print("static u8 hpack_static_table_name_hash[] = {")
+values = [slots.get(i, 0) for i in range(1 << HASH_BITS)]
+for i in range(0, len(values), 12):
+    print("  " + " ".join("%d," % v for v in values[i : i + 12]))
+print("};")
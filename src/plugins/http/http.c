@@ -56,10 +56,19 @@ http_v_find_index (u8 *vec, u32 offset, u32 num, char *str)
       end_index = clib_min (end_index, offset + num - slen);
     }
 
-  for (; start_index <= end_index; start_index++)
+  if (start_index > end_index)
+    return -1;
+
+  u8 *p = vec + start_index, *end = vec + end_index + 1;
+  while (1)
     {
-      if (!memcmp (vec + start_index, str, slen))
-	return start_index;
+      /* vectorized search for first byte, then compare the rest */
+      p = http_scan_byte (p, end, str[0]);
+      if (p == end)
+	break;
+      if (!memcmp (p + 1, str + 1, slen - 1))
+	return p - vec;
+      p++;
     }
 
   return -1;
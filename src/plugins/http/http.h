@@ -705,6 +705,106 @@ http_token_contains (const char *haystack, uword haystack_len,
   return 0;
 }
 
+/**
+ * Find first occurrence of byte in buffer.
+ *
+ * @param p   Pointer to the start of the buffer.
+ * @param end Pointer to the end of the buffer.
+ * @param c   Byte to search for.
+ *
+ * @return Pointer to the first matching byte, @c end if not found.
+ */
+always_inline u8 *
+http_scan_byte (u8 *p, u8 *end, u8 c)
+{
+#if defined(CLIB_HAVE_VEC256)
+  u8x32 c32 = u8x32_splat (c);
+  while (end - p >= 32)
+    {
+      u32 mask = u8x32_msb_mask ((u8x32) (u8x32_load_unaligned (p) == c32));
+      if (mask)
+	return p + count_trailing_zeros (mask);
+      p += 32;
+    }
+#endif
+#if defined(CLIB_HAVE_VEC128) && defined(CLIB_HAVE_VEC128_MSB_MASK)
+  u8x16 c16 = u8x16_splat (c);
+  while (end - p >= 16)
+    {
+      u16 mask = u8x16_msb_mask ((u8x16) (u8x16_load_unaligned (p) == c16));
+      if (mask)
+	return p + count_trailing_zeros (mask);
+      p += 16;
+    }
+#endif
+  while (p < end && *p != c)
+    p++;
+  return p;
+}
+
+/**
+ * Find first control character (CR included, HTAB excluded) in buffer,
+ * used to find end of field value.
+ *
+ * @param p   Pointer to the start of the buffer.
+ * @param end Pointer to the end of the buffer.
+ *
+ * @return Pointer to the first control character, @c end if not found.
+ */
+always_inline u8 *
+http_scan_ctl (u8 *p, u8 *end)
+{
+#if defined(CLIB_HAVE_VEC256)
+  u8x32 hi32 = u8x32_splat (0xe0), tab32 = u8x32_splat ('\t');
+  while (end - p >= 32)
+    {
+      u8x32 v = u8x32_load_unaligned (p);
+      u32 mask = u8x32_msb_mask ((u8x32) ((v & hi32) == u8x32_splat (0)) &
+				 (u8x32) (v != tab32));
+      if (mask)
+	return p + count_trailing_zeros (mask);
+      p += 32;
+    }
+#endif
+#if defined(CLIB_HAVE_VEC128) && defined(CLIB_HAVE_VEC128_MSB_MASK)
+  u8x16 hi16 = u8x16_splat (0xe0), tab16 = u8x16_splat ('\t');
+  while (end - p >= 16)
+    {
+      u8x16 v = u8x16_load_unaligned (p);
+      u16 mask = u8x16_msb_mask ((u8x16) ((v & hi16) == u8x16_splat (0)) &
+				 (u8x16) (v != tab16));
+      if (mask)
+	return p + count_trailing_zeros (mask);
+      p += 16;
+    }
+#endif
+  while (p < end && (*p >= ' ' || *p == '\t'))
+    p++;
+  return p;
+}
+
+/**
+ * Find first CRLF in buffer.
+ *
+ * @param p   Pointer to the start of the buffer.
+ * @param end Pointer to the end of the buffer.
+ *
+ * @return Pointer to the CR of first CRLF, @c 0 if not found.
+ */
+always_inline u8 *
+http_scan_crlf (u8 *p, u8 *end)
+{
+  while (1)
+    {
+      p = http_scan_byte (p, end, '\r');
+      if (end - p < 2)
+	return 0;
+      if (p[1] == '\n')
+	return p;
+      p++;
+    }
+}
+
 /**
  * Reset header table before reuse.
  *
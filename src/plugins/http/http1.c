@@ -160,20 +160,15 @@ http1_read_message (http_conn_t *hc, u8 *rx_buf)
 static void
 http1_identify_optional_query (http_req_t *req, u8 *rx_buf)
 {
-  int i;
-  for (i = req->target_path_offset;
-       i < (req->target_path_offset + req->target_path_len); i++)
+  u8 *p, *end;
+
+  end = rx_buf + req->target_path_offset + req->target_path_len;
+  p = http_scan_byte (rx_buf + req->target_path_offset, end, '?');
+  if (p != end)
     {
-      if (rx_buf[i] == '?')
-	{
-	  req->target_query_offset = i + 1;
-	  req->target_query_len = req->target_path_offset +
-				  req->target_path_len -
-				  req->target_query_offset;
-	  req->target_path_len =
-	    req->target_path_len - req->target_query_len - 1;
-	  break;
-	}
+      req->target_query_offset = p - rx_buf + 1;
+      req->target_query_len = end - rx_buf - req->target_query_offset;
+      req->target_path_len = req->target_path_len - req->target_query_len - 1;
     }
 }
 
@@ -223,17 +218,13 @@ http1_parse_target (http_req_t *req, u8 *rx_buf)
 	  req->target_authority_offset = p - rx_buf;
 	  req->target_authority_len = 0;
 	  end = rx_buf + req->target_path_offset + req->target_path_len;
-	  while (p < end)
+	  p = http_scan_byte (p, end, '/');
+	  req->target_authority_len = p - rx_buf - req->target_authority_offset;
+	  if (p != end)
 	    {
-	      if (*p == '/')
-		{
-		  p++; /* drop leading slash */
-		  req->target_path_offset = p - rx_buf;
-		  req->target_path_len = end - p;
-		  break;
-		}
-	      req->target_authority_len++;
-	      p++;
+	      p++; /* drop leading slash */
+	      req->target_path_offset = p - rx_buf;
+	      req->target_path_len = end - p;
 	    }
 	  if (!req->target_path_len)
 	    {
@@ -270,15 +261,17 @@ http1_parse_request_line (http_req_t *req, u8 *rx_buf, http_status_code_t *ec)
 {
   int i, target_len;
   u32 next_line_offset, method_offset;
+  u8 *p;
 
   /* request-line = method SP request-target SP HTTP-version CRLF */
-  i = http_v_find_index (rx_buf, 8, 0, "\r\n");
-  if (i < 0)
+  p = http_scan_crlf (rx_buf + 8, vec_end (rx_buf));
+  if (!p)
     {
       clib_warning ("request line incomplete");
       *ec = HTTP_STATUS_BAD_REQUEST;
       return -1;
     }
+  i = p - rx_buf;
   HTTP_DBG (2, "request line length: %d", i);
   req->control_data_len = i + 2;
   next_line_offset = req->control_data_len;
@@ -399,13 +392,14 @@ http1_parse_status_line (http_req_t *req, u8 *rx_buf)
   u8 *p, *end;
   u16 status_code = 0;
 
-  i = http_v_find_index (rx_buf, 0, 0, "\r\n");
   /* status-line = HTTP-version SP status-code SP [ reason-phrase ] CRLF */
-  if (i < 0)
+  p = http_scan_crlf (rx_buf, vec_end (rx_buf));
+  if (!p)
     {
       clib_warning ("status line incomplete");
       return -1;
     }
+  i = p - rx_buf;
   HTTP_DBG (2, "status line length: %d", i);
   if (i < 12)
     {
@@ -482,8 +476,8 @@ always_inline int
 http1_parse_field_name (u8 **pos, u8 *end, u8 **field_name_start,
 			u32 *field_name_len)
 {
-  u32 name_len = 0;
-  u8 *p;
+  u32 name_len;
+  u8 *p, *colon;
 
   static uword tchar[4] = {
     /* !#$%'*+-.0123456789 */
@@ -497,33 +491,29 @@ http1_parse_field_name (u8 **pos, u8 *end, u8 **field_name_start,
   p = *pos;
 
   *field_name_start = p;
-  while (p != end)
+  colon = http_scan_byte (p, end, ':');
+  if (colon == end)
     {
-      if (clib_bitmap_get_no_check (tchar, *p))
-	{
-	  name_len++;
-	  p++;
-	}
-      else if (*p == ':')
-	{
-	  if (name_len == 0)
-	    {
-	      clib_warning ("empty field name");
-	      return -1;
-	    }
-	  *field_name_len = name_len;
-	  p++;
-	  *pos = p;
-	  return 0;
-	}
-      else
+      clib_warning ("field name end not found");
+      return -1;
+    }
+  name_len = colon - p;
+  if (name_len == 0)
+    {
+      clib_warning ("empty field name");
+      return -1;
+    }
+  for (; p < colon; p++)
+    {
+      if (!clib_bitmap_get_no_check (tchar, *p))
 	{
 	  clib_warning ("invalid character %d", *p);
 	  return -1;
 	}
     }
-  clib_warning ("field name end not found");
-  return -1;
+  *field_name_len = name_len;
+  *pos = colon + 1;
+  return 0;
 }
 
 always_inline int
@@ -551,49 +541,43 @@ http1_parse_field_value (u8 **pos, u8 *end, u8 **field_value_start,
     }
 
   *field_value_start = p;
-  while (p != end)
+  p = http_scan_ctl (p, end);
+  if (p == end)
     {
-      if (*p == '\r')
-	{
-	  if ((end - p) < 1)
-	    {
-	      clib_warning ("incorrect field line end");
-	      return -1;
-	    }
-	  p++;
-	  if (*p == '\n')
-	    {
-	      if (value_len == 0)
-		{
-		  clib_warning ("empty field value");
-		  return -1;
-		}
-	      p++;
-	      *pos = p;
-	      /* skip trailing whitespace */
-	      p = *field_value_start + value_len - 1;
-	      while (*p == ' ' || *p == '\t')
-		{
-		  p--;
-		  value_len--;
-		}
-	      *field_value_len = value_len;
-	      return 0;
-	    }
-	  clib_warning ("CR without LF");
-	  return -1;
-	}
-      if (*p < ' ' && *p != '\t')
-	{
-	  clib_warning ("invalid character %d", *p);
-	  return -1;
-	}
-      p++;
-      value_len++;
+      clib_warning ("field value end not found");
+      return -1;
     }
-
-  clib_warning ("field value end not found");
-  return -1;
+  if (*p != '\r')
+    {
+      clib_warning ("invalid character %d", *p);
+      return -1;
+    }
+  if ((end - p) < 2)
+    {
+      clib_warning ("incorrect field line end");
+      return -1;
+    }
+  if (p[1] != '\n')
+    {
+      clib_warning ("CR without LF");
+      return -1;
+    }
+  value_len = p - *field_value_start;
+  if (value_len == 0)
+    {
+      clib_warning ("empty field value");
+      return -1;
+    }
+  *pos = p + 2;
+  /* skip trailing whitespace */
+  p--;
+  while (*p == ' ' || *p == '\t')
+    {
+      p--;
+      value_len--;
+    }
+  *field_value_len = value_len;
+  return 0;
 }
 
 static int
@@ -806,17 +790,43 @@ http1_target_fixup (http_conn_t *hc, http_req_t *req)
   req->target_authority_len = host->value_len;
 }
 
+/* Host header set by app, client writes it instead of generated one */
+static http_custom_token_t *
+http1_app_headers_get_host (u8 *app_headers, u32 headers_len)
+{
+  http_custom_token_t *name, *value;
+  http_app_header_t *header;
+  u8 *end = app_headers + headers_len;
+
+  while (app_headers < end)
+    {
+      name = (http_custom_token_t *) app_headers;
+      if (name->len & HTTP_CUSTOM_HEADER_NAME_BIT)
+	{
+	  app_headers += sizeof (http_custom_token_t) +
+			 (name->len & ~HTTP_CUSTOM_HEADER_NAME_BIT);
+	  value = (http_custom_token_t *) app_headers;
+	  app_headers += sizeof (http_custom_token_t) + value->len;
+	  continue;
+	}
+      header = (http_app_header_t *) app_headers;
+      if (header->name == HTTP_HEADER_HOST)
+	return &header->value;
+      app_headers += sizeof (http_app_header_t) + header->value.len;
+    }
+
+  return 0;
+}
+
 static void
-http1_write_app_headers (http_req_t *req, http_msg_t *msg, u8 **tx_buf)
+http1_write_app_headers (u8 *app_headers, u32 headers_len, u8 **tx_buf,
+			 u8 skip_host)
 {
-  u8 *app_headers, *p, *end;
+  u8 *p, *end;
   u32 *tmp;
 
-  /* read app header list */
-  app_headers = http_get_app_header_list (req, msg);
-
   /* serialize app headers to tx_buf */
-  end = app_headers + msg->data.headers_len;
+  end = app_headers + headers_len;
   while (app_headers < end)
     {
       /* custom header name? */
@@ -844,6 +854,8 @@ http1_write_app_headers (http_req_t *req, http_msg_t *msg, u8 **tx_buf)
 	  http_app_header_t *header;
 	  header = (http_app_header_t *) app_headers;
 	  app_headers += sizeof (http_app_header_t) + header->value.len;
+	  if (skip_host && header->name == HTTP_HEADER_HOST)
+	    continue;
 	  http_token_t name = { http_header_name_token (header->name) };
 	  vec_add2 (*tx_buf, p, name.len + header->value.len + 4);
 	  clib_memcpy (p, name.base, name.len);
@@ -858,6 +870,44 @@ http1_write_app_headers (http_req_t *req, http_msg_t *msg, u8 **tx_buf)
     }
 }
 
+/**
+ * Parse HTTP/1.1 request at the start of the buffer (used by unit tests and
+ * parser benchmark).
+ *
+ * @param rx_buf   Buffer (vector) with request, might contain more requests.
+ * @param headers  Parsed field lines (reused between calls).
+ * @param msg_len  Length of the request including message body.
+ *
+ * @return @c 0 on success, status code of error response otherwise.
+ */
+__clib_export int
+http1_parse_request (u8 *rx_buf, http_field_line_t **headers, u32 *msg_len)
+{
+  http_req_t req = { .headers = *headers };
+  http_status_code_t ec = HTTP_STATUS_BAD_REQUEST;
+
+  if (vec_len (rx_buf) < 8 || http1_parse_request_line (&req, rx_buf, &ec) ||
+      http1_identify_headers (&req, rx_buf, &ec))
+    goto done;
+  http1_check_connection_upgrade (&req, rx_buf);
+  if (http1_identify_message_body (&req, rx_buf, &ec))
+    goto done;
+  ec = 0;
+  *msg_len = req.control_data_len + req.body_len;
+
+done:
+  *headers = req.headers;
+  return ec;
+}
+
+/* server finished transaction, next request might be already in rx fifo,
+ * client finished sending request, early response might be there */
+static_always_inline void
+http1_check_pipelined_request (http_conn_t *hc)
+{
+  http_io_ts_after_read (hc, 0);
+}
+
 /*************************************/
 /* request state machine handlers RX */
 /*************************************/
@@ -1004,7 +1054,7 @@ http1_req_state_wait_transport_method (http_conn_t *hc, http_req_t *req,
       ec = HTTP_STATUS_INTERNAL_ERROR;
       goto error;
     }
-  /* do not dequeue more than one HTTP request, we do not support pipelining */
+  /* do not dequeue more than one HTTP request, rest might be pipelined */
   max_deq = clib_min (req->control_data_len + req->body_len, vec_len (rx_buf));
   len = clib_min (max_enq, max_deq);
 
@@ -1032,16 +1082,15 @@ http1_req_state_wait_transport_method (http_conn_t *hc, http_req_t *req,
 
   body_sent = len - req->control_data_len;
   req->to_recv = req->body_len - body_sent;
+  http_io_ts_drain (hc, len);
   if (req->to_recv == 0)
     {
-      /* drop everything, we do not support pipelining */
-      http_io_ts_drain_all (hc);
-      /* all sent, we are done */
+      /* all sent, we are done, pipelined requests (if any) stay in rx fifo
+       * until we send response */
       http_req_state_change (req, HTTP_REQ_STATE_WAIT_APP_REPLY);
     }
   else
     {
-      http_io_ts_drain (hc, len);
       /* stream rest of the response body */
       http_req_state_change (req, HTTP_REQ_STATE_TRANSPORT_IO_MORE_DATA);
     }
@@ -1085,6 +1134,9 @@ http1_req_state_transport_io_more_data (http_conn_t *hc, http_req_t *req,
     }
 
   max_len = clib_min (max_enq, max_deq);
+  /* server do not read beyond request body, next request might follow */
+  if (hc->flags & HTTP_CONN_F_IS_SERVER)
+    max_len = clib_min (max_len, req->to_recv);
   http_io_ts_read_segs (hc, segs, &n_segs, max_len);
 
   n_written = http_io_as_write_segs (req, segs, n_segs);
@@ -1339,7 +1391,8 @@ http1_req_state_wait_app_reply (http_conn_t *hc, http_req_t *req,
   if (msg.data.headers_len)
     {
       HTTP_DBG (0, "got headers from app, len %d", msg.data.headers_len);
-      http1_write_app_headers (req, &msg, &response);
+      http1_write_app_headers (http_get_app_header_list (req, &msg),
+			       msg.data.headers_len, &response, 0);
     }
   /* Add empty line after headers */
   response = format (response, "\r\n");
@@ -1370,6 +1423,8 @@ http1_req_state_wait_app_reply (http_conn_t *hc, http_req_t *req,
   http_req_state_change (req, next_state);
 
   http_io_ts_after_write (hc, sp, 0, 1);
+  if (next_state == HTTP_REQ_STATE_WAIT_TRANSPORT_METHOD)
+    http1_check_pipelined_request (hc);
   return sm_result;
 
 error:
@@ -1384,7 +1439,8 @@ http1_req_state_wait_app_method (http_conn_t *hc, http_req_t *req,
 				 transport_send_params_t *sp)
 {
   http_msg_t msg;
-  u8 *request = 0, *target;
+  u8 *request = 0, *target, *app_headers = 0, *host = 0;
+  http_custom_token_t *app_host = 0;
   u32 max_enq;
   http_sm_result_t sm_result = HTTP_SM_ERROR;
   http_req_state_t next_state;
@@ -1406,6 +1462,20 @@ http1_req_state_wait_app_method (http_conn_t *hc, http_req_t *req,
   /* read request target */
   target = http_get_app_target (req, &msg);
 
+  /* app might override Host, e.g. proxy forwarding the one it received */
+  host = hc->host;
+  if (msg.data.headers_len)
+    {
+      HTTP_DBG (0, "got headers from app, len %d", msg.data.headers_len);
+      app_headers = http_get_app_header_list (req, &msg);
+      app_host = http1_app_headers_get_host (app_headers, msg.data.headers_len);
+      if (app_host)
+	{
+	  host = 0;
+	  vec_add (host, app_host->token, app_host->len);
+	}
+    }
+
   request = http_get_tx_buf (hc);
   /* currently we support only GET and POST method */
   if (msg.method_type == HTTP_REQ_GET)
@@ -1424,7 +1494,7 @@ http1_req_state_wait_app_method (http_conn_t *hc, http_req_t *req,
 			/* target */
 			target,
 			/* Host */
-			hc->host,
+			host,
 			/* User-Agent */
 			hc->app_name);
 
@@ -1448,7 +1518,7 @@ http1_req_state_wait_app_method (http_conn_t *hc, http_req_t *req,
 			/* target */
 			target,
 			/* Host */
-			hc->host,
+			host,
 			/* User-Agent */
 			hc->app_name,
 			/* Content-Length */
@@ -1467,10 +1537,8 @@ http1_req_state_wait_app_method (http_conn_t *hc, http_req_t *req,
 
   /* Add headers from app (if any) */
   if (msg.data.headers_len)
-    {
-      HTTP_DBG (0, "got headers from app, len %d", msg.data.headers_len);
-      http1_write_app_headers (req, &msg, &request);
-    }
+    http1_write_app_headers (app_headers, msg.data.headers_len, &request,
+			     app_host != 0);
   /* Add empty line after headers */
   request = format (request, "\r\n");
   HTTP_DBG (3, "%v", request);
@@ -1496,6 +1564,8 @@ error:
   http_disconnect_transport (hc);
 
 done:
+  if (host != hc->host)
+    vec_free (host);
   return sm_result;
 }
 
@@ -1541,6 +1611,8 @@ http1_req_state_app_io_more_data (http_conn_t *hc, http_req_t *req,
 
 check_fifo:
   http_io_ts_after_write (hc, sp, finished, !!n_written);
+  if (finished)
+    http1_check_pipelined_request (hc);
   return HTTP_SM_STOP;
 }
 
@@ -1792,6 +1864,9 @@ http1_app_rx_evt_callback (http_conn_t *hc, u32 req_index, u32 thread_index)
 
   if (req->state == HTTP_REQ_STATE_TUNNEL)
     http1_req_state_tunnel_rx (hc, req, 0);
+  /* app dequeued, we can continue streaming of message body */
+  else if (req->state == HTTP_REQ_STATE_TRANSPORT_IO_MORE_DATA)
+    http1_req_run_state_machine (hc, req, 0, 0);
 }
 
 static void
@@ -1859,6 +1934,21 @@ http1_transport_rx_callback (http_conn_t *hc)
 
   if (!http1_req_state_is_rx_valid (req))
     {
+      /* pipelined request, leave it in rx fifo until response is sent */
+      if ((hc->flags & HTTP_CONN_F_IS_SERVER) &&
+	  (req->state == HTTP_REQ_STATE_WAIT_APP_REPLY ||
+	   req->state == HTTP_REQ_STATE_APP_IO_MORE_DATA))
+	{
+	  HTTP_DBG (1, "pipelined request, wait for response");
+	  return;
+	}
+      /* early response, wait until request body is sent */
+      if (!(hc->flags & HTTP_CONN_F_IS_SERVER) &&
+	  req->state == HTTP_REQ_STATE_APP_IO_MORE_DATA)
+	{
+	  HTTP_DBG (1, "early response, wait for request body");
+	  return;
+	}
       clib_warning ("hc [%u]%x invalid rx state: http req state "
 		    "'%U', session state '%U'",
 		    hc->c_thread_index, hc->hc_hc_index, format_http_req_state,
@@ -100,6 +100,53 @@ static hpack_token_t hpack_headers[] = {
 #undef _
 };
 
+/* static table header names perfect hash, generated by
+ * mk_static_table_hash.py */
+#define HPACK_STATIC_TABLE_HASH_BITS       7
+#define HPACK_STATIC_TABLE_HASH_MULTIPLIER 0xBEE4CF6D
+
+static u8 hpack_static_table_name_hash[] = {
+  34, 15, 0, 0, 56, 31, 0, 18, 0, 0, 0, 0,
+  0, 0, 60, 38, 0, 8, 0, 0, 6, 0, 0, 0,
+  16, 0, 0, 51, 0, 43, 0, 0, 0, 0, 0, 37,
+  0, 0, 0, 0, 1, 57, 0, 33, 50, 0, 0, 39,
+  0, 44, 0, 55, 0, 0, 0, 0, 52, 2, 0, 30,
+  0, 0, 0, 0, 0, 0, 41, 27, 0, 32, 0, 0,
+  0, 0, 0, 0, 40, 19, 29, 0, 0, 0, 48, 61,
+  53, 21, 24, 0, 45, 0, 0, 54, 0, 0, 0, 42,
+  0, 4, 0, 49, 0, 0, 0, 17, 0, 59, 36, 28,
+  0, 0, 0, 22, 0, 25, 58, 26, 0, 0, 0, 0,
+  47, 0, 0, 0, 23, 0, 46, 20,
+};
+
+__clib_export u8
+hpack_static_table_lookup_name (const u8 *name, uword name_len)
+{
+  hpack_static_table_entry_t *e;
+  u32 key, w = 0;
+  u8 index;
+
+  if (PREDICT_FALSE (name_len == 0))
+    return 0;
+
+  if (name_len >= 4)
+    w = clib_mem_unaligned (name, u32);
+  else
+    clib_memcpy_fast (&w, name, name_len);
+  key = w ^ ((u32) name_len << 24) ^ ((u32) name[name_len - 1] << 16);
+  key *= HPACK_STATIC_TABLE_HASH_MULTIPLIER;
+  index = hpack_static_table_name_hash[key >>
+				       (32 - HPACK_STATIC_TABLE_HASH_BITS)];
+  if (!index)
+    return 0;
+
+  e = &hpack_static_table[index - 1];
+  if (e->name_len != name_len || memcmp (e->name, name, name_len))
+    return 0;
+
+  return index;
+}
+
 __clib_export uword
 hpack_decode_int (u8 **src, u8 *end, u8 prefix_len)
 {
@@ -146,16 +193,16 @@ http2_error_t
 hpack_decode_huffman (u8 **src, u8 *end, u8 **buf, uword *buf_len)
 {
   u64 accumulator = 0;
-  u8 accumulator_len = 0;
-  u8 *p;
-  hpack_huffman_code_t *code;
+  u8 accumulator_len = 0, code_len;
+  u8 *p, *b, *b_end;
+  u32 entry, pad;
 
   p = *src;
+  b = *buf;
+  b_end = b + *buf_len;
+
   while (1)
     {
-      /* out of space?  */
-      if (*buf_len == 0)
-	return HTTP2_ERROR_INTERNAL_ERROR;
       /* refill */
       while (p < end && accumulator_len <= 56)
 	{
@@ -163,74 +210,84 @@ hpack_decode_huffman (u8 **src, u8 *end, u8 **buf, uword *buf_len)
 	  accumulator_len += 8;
 	  accumulator |= (u64) *p++;
 	}
-      /* first try short codes (5 - 8 bits) */
-      code =
-	&huff_code_table_fast[(u8) (accumulator >> (accumulator_len - 8))];
+      /* nothing left to refill, finish bit by bit */
+      if (accumulator_len < HPACK_HUFFMAN_MULTI_TABLE_BITS)
+	break;
+      /* out of space?  */
+      if (b == b_end)
+	return HTTP2_ERROR_INTERNAL_ERROR;
+      /* first try short codes (5 - 12 bits), up to two symbols at once */
+      entry = huff_code_table_multi[(accumulator >>
+				     (accumulator_len -
+				      HPACK_HUFFMAN_MULTI_TABLE_BITS)) &
+				    pow2_mask (HPACK_HUFFMAN_MULTI_TABLE_BITS)];
+      code_len = (u8) (entry >> 16);
       /* zero code length mean no luck */
-      if (PREDICT_TRUE (code->code_len))
+      if (PREDICT_TRUE (code_len))
 	{
-	  **buf = code->symbol;
-	  (*buf)++;
-	  (*buf_len)--;
-	  accumulator_len -= code->code_len;
+	  *b++ = (u8) entry;
+	  accumulator_len -= code_len;
+	  code_len = (u8) (entry >> 24);
+	  if (code_len && b < b_end)
+	    {
+	      *b++ = (u8) (entry >> 8);
+	      accumulator_len -= code_len;
+	    }
 	}
       else
 	{
-	  /* slow path / long codes (10 - 30 bits) */
+	  /* slow path / long codes (13 - 30 bits) */
 	  u32 tmp;
 	  /* group boundaries are aligned to 32 bits */
 	  if (accumulator_len < 32)
 	    tmp = accumulator << (32 - accumulator_len);
 	  else
 	    tmp = accumulator >> (accumulator_len - 32);
+	  /* EOS in string is decoding error */
+	  if (PREDICT_FALSE (tmp >= 0xFFFFFFFC))
+	    return HTTP2_ERROR_COMPRESSION_ERROR;
 	  /* figure out which interval code falls into, this is possible
 	   * because HPACK use canonical Huffman codes
 	   * see Schwartz, E. and B. Kallick, “Generating a canonical prefix
 	   * encoding”
 	   */
 	  hpack_huffman_group_t *hg = hpack_huffman_get_group (tmp);
+	  /* truncated code */
+	  if (PREDICT_FALSE (hg->code_len > accumulator_len))
+	    return HTTP2_ERROR_COMPRESSION_ERROR;
 	  /* trim code to correct length */
 	  u32 code = (accumulator >> (accumulator_len - hg->code_len)) &
 		     ((1 << hg->code_len) - 1);
 	  /* find symbol in the list */
-	  **buf = hg->symbols[code - hg->first_code];
-	  (*buf)++;
-	  (*buf_len)--;
+	  *b++ = hg->symbols[code - hg->first_code];
 	  accumulator_len -= hg->code_len;
 	}
-      /* all done */
-      if (p == end && accumulator_len < 8)
-	{
-	  /* there might be one more symbol encoded with short code */
-	  if (accumulator_len >= 5)
-	    {
-	      /* first check EOF case */
-	      if (((1 << accumulator_len) - 1) ==
-		  (accumulator & ((1 << accumulator_len) - 1)))
-		break;
-
-	      /* out of space?  */
-	      if (*buf_len == 0)
-		return HTTP2_ERROR_INTERNAL_ERROR;
-
-	      /* if bogus EOF check bellow will fail */
-	      code = &huff_code_table_fast[(u8) (accumulator
-						 << (8 - accumulator_len))];
-	      **buf = code->symbol;
-	      (*buf)++;
-	      (*buf_len)--;
-	      accumulator_len -= code->code_len;
-	      /* end at byte boundary? */
-	      if (accumulator_len == 0)
-		break;
-	    }
-	  /* we must end with EOF here */
-	  if (((1 << accumulator_len) - 1) !=
-	      (accumulator & ((1 << accumulator_len) - 1)))
-	    return HTTP2_ERROR_COMPRESSION_ERROR;
-	  break;
-	}
     }
+
+  /* last few symbols, remaining bits are padded with ones like EOS */
+  while (accumulator_len >= 5)
+    {
+      pad = HPACK_HUFFMAN_MULTI_TABLE_BITS - accumulator_len;
+      entry = huff_code_table_multi[((accumulator << pad) | pow2_mask (pad)) &
+				    pow2_mask (HPACK_HUFFMAN_MULTI_TABLE_BITS)];
+      code_len = (u8) (entry >> 16);
+      /* rest is padding or bogus, EOF check bellow will tell */
+      if (!code_len || code_len > accumulator_len)
+	break;
+      /* out of space?  */
+      if (b == b_end)
+	return HTTP2_ERROR_INTERNAL_ERROR;
+      *b++ = (u8) entry;
+      accumulator_len -= code_len;
+    }
+
+  /* we must end with EOF (up to 7 bits of ones) here */
+  if (accumulator_len > 7 ||
+      pow2_mask (accumulator_len) != (accumulator & pow2_mask (accumulator_len)))
+    return HTTP2_ERROR_COMPRESSION_ERROR;
+
+  *buf_len -= b - *buf;
+  *buf = b;
   return HTTP2_ERROR_NO_ERROR;
 }
 
@@ -950,15 +1007,25 @@ hpack_encode_custom_header (u8 *dst, const u8 *name, u32 name_len,
 			    const u8 *value, u32 value_len)
 {
   u32 orig_len, actual_size;
-  u8 *a, *b;
+  u8 *a, *b, static_table_index;
 
   orig_len = vec_len (dst);
   /* one extra byte for 4 bit prefix */
   vec_add2 (dst, a, name_len + value_len + HPACK_ENCODED_INT_MAX_LEN * 2 + 1);
-  b = a;
-  /* Literal Header Field without Indexing — New Name */
-  *b++ = 0x00;
-  b = hpack_encode_string (b, name, name_len);
+  static_table_index = hpack_static_table_lookup_name (name, name_len);
+  if (static_table_index)
+    {
+      /* Literal Header Field without Indexing — Indexed Name */
+      *a = 0x00; /* zero first 4 bits */
+      b = hpack_encode_int (a, static_table_index, 4);
+    }
+  else
+    {
+      b = a;
+      /* Literal Header Field without Indexing — New Name */
+      *b++ = 0x00;
+      b = hpack_encode_string (b, name, name_len);
+    }
   b = hpack_encode_string (b, value, value_len);
   actual_size = b - a;
   vec_set_len (dst, orig_len + actual_size);
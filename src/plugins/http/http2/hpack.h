@@ -131,6 +131,16 @@ u8 *hpack_encode_huffman (u8 *dst, const u8 *value, uword value_len);
  */
 uword hpack_huffman_encoded_len (const u8 *value, uword value_len);
 
+/**
+ * Find header name in static table
+ *
+ * @param name     Header name (lowercase)
+ * @param name_len Length of the header name
+ *
+ * @return Lowest static table index with given name or zero if not found
+ */
+u8 hpack_static_table_lookup_name (const u8 *name, uword name_len);
+
 /**
  * Initialize HPACK dynamic table
  *
@@ -82,56 +82,693 @@ static hpack_huffman_symbol_t huff_sym_table[] = {
   { 27, 0x7ffffee }, { 27, 0x7ffffef },	 { 27, 0x7fffff0 },  { 26, 0x3ffffee },
 };
 
-typedef struct
-{
-  u8 symbol;
-  u8 code_len;
-} hpack_huffman_code_t;
+#define HPACK_HUFFMAN_MULTI_TABLE_BITS 12
 
-static hpack_huffman_code_t huff_code_table_fast[] = {
-  { 0x30, 5 }, { 0x30, 5 }, { 0x30, 5 }, { 0x30, 5 }, { 0x30, 5 }, { 0x30, 5 },
-  { 0x30, 5 }, { 0x30, 5 }, { 0x31, 5 }, { 0x31, 5 }, { 0x31, 5 }, { 0x31, 5 },
-  { 0x31, 5 }, { 0x31, 5 }, { 0x31, 5 }, { 0x31, 5 }, { 0x32, 5 }, { 0x32, 5 },
-  { 0x32, 5 }, { 0x32, 5 }, { 0x32, 5 }, { 0x32, 5 }, { 0x32, 5 }, { 0x32, 5 },
-  { 0x61, 5 }, { 0x61, 5 }, { 0x61, 5 }, { 0x61, 5 }, { 0x61, 5 }, { 0x61, 5 },
-  { 0x61, 5 }, { 0x61, 5 }, { 0x63, 5 }, { 0x63, 5 }, { 0x63, 5 }, { 0x63, 5 },
-  { 0x63, 5 }, { 0x63, 5 }, { 0x63, 5 }, { 0x63, 5 }, { 0x65, 5 }, { 0x65, 5 },
-  { 0x65, 5 }, { 0x65, 5 }, { 0x65, 5 }, { 0x65, 5 }, { 0x65, 5 }, { 0x65, 5 },
-  { 0x69, 5 }, { 0x69, 5 }, { 0x69, 5 }, { 0x69, 5 }, { 0x69, 5 }, { 0x69, 5 },
-  { 0x69, 5 }, { 0x69, 5 }, { 0x6F, 5 }, { 0x6F, 5 }, { 0x6F, 5 }, { 0x6F, 5 },
-  { 0x6F, 5 }, { 0x6F, 5 }, { 0x6F, 5 }, { 0x6F, 5 }, { 0x73, 5 }, { 0x73, 5 },
-  { 0x73, 5 }, { 0x73, 5 }, { 0x73, 5 }, { 0x73, 5 }, { 0x73, 5 }, { 0x73, 5 },
-  { 0x74, 5 }, { 0x74, 5 }, { 0x74, 5 }, { 0x74, 5 }, { 0x74, 5 }, { 0x74, 5 },
-  { 0x74, 5 }, { 0x74, 5 }, { 0x20, 6 }, { 0x20, 6 }, { 0x20, 6 }, { 0x20, 6 },
-  { 0x25, 6 }, { 0x25, 6 }, { 0x25, 6 }, { 0x25, 6 }, { 0x2D, 6 }, { 0x2D, 6 },
-  { 0x2D, 6 }, { 0x2D, 6 }, { 0x2E, 6 }, { 0x2E, 6 }, { 0x2E, 6 }, { 0x2E, 6 },
-  { 0x2F, 6 }, { 0x2F, 6 }, { 0x2F, 6 }, { 0x2F, 6 }, { 0x33, 6 }, { 0x33, 6 },
-  { 0x33, 6 }, { 0x33, 6 }, { 0x34, 6 }, { 0x34, 6 }, { 0x34, 6 }, { 0x34, 6 },
-  { 0x35, 6 }, { 0x35, 6 }, { 0x35, 6 }, { 0x35, 6 }, { 0x36, 6 }, { 0x36, 6 },
-  { 0x36, 6 }, { 0x36, 6 }, { 0x37, 6 }, { 0x37, 6 }, { 0x37, 6 }, { 0x37, 6 },
-  { 0x38, 6 }, { 0x38, 6 }, { 0x38, 6 }, { 0x38, 6 }, { 0x39, 6 }, { 0x39, 6 },
-  { 0x39, 6 }, { 0x39, 6 }, { 0x3D, 6 }, { 0x3D, 6 }, { 0x3D, 6 }, { 0x3D, 6 },
-  { 0x41, 6 }, { 0x41, 6 }, { 0x41, 6 }, { 0x41, 6 }, { 0x5F, 6 }, { 0x5F, 6 },
-  { 0x5F, 6 }, { 0x5F, 6 }, { 0x62, 6 }, { 0x62, 6 }, { 0x62, 6 }, { 0x62, 6 },
-  { 0x64, 6 }, { 0x64, 6 }, { 0x64, 6 }, { 0x64, 6 }, { 0x66, 6 }, { 0x66, 6 },
-  { 0x66, 6 }, { 0x66, 6 }, { 0x67, 6 }, { 0x67, 6 }, { 0x67, 6 }, { 0x67, 6 },
-  { 0x68, 6 }, { 0x68, 6 }, { 0x68, 6 }, { 0x68, 6 }, { 0x6C, 6 }, { 0x6C, 6 },
-  { 0x6C, 6 }, { 0x6C, 6 }, { 0x6D, 6 }, { 0x6D, 6 }, { 0x6D, 6 }, { 0x6D, 6 },
-  { 0x6E, 6 }, { 0x6E, 6 }, { 0x6E, 6 }, { 0x6E, 6 }, { 0x70, 6 }, { 0x70, 6 },
-  { 0x70, 6 }, { 0x70, 6 }, { 0x72, 6 }, { 0x72, 6 }, { 0x72, 6 }, { 0x72, 6 },
-  { 0x75, 6 }, { 0x75, 6 }, { 0x75, 6 }, { 0x75, 6 }, { 0x3A, 7 }, { 0x3A, 7 },
-  { 0x42, 7 }, { 0x42, 7 }, { 0x43, 7 }, { 0x43, 7 }, { 0x44, 7 }, { 0x44, 7 },
-  { 0x45, 7 }, { 0x45, 7 }, { 0x46, 7 }, { 0x46, 7 }, { 0x47, 7 }, { 0x47, 7 },
-  { 0x48, 7 }, { 0x48, 7 }, { 0x49, 7 }, { 0x49, 7 }, { 0x4A, 7 }, { 0x4A, 7 },
-  { 0x4B, 7 }, { 0x4B, 7 }, { 0x4C, 7 }, { 0x4C, 7 }, { 0x4D, 7 }, { 0x4D, 7 },
-  { 0x4E, 7 }, { 0x4E, 7 }, { 0x4F, 7 }, { 0x4F, 7 }, { 0x50, 7 }, { 0x50, 7 },
-  { 0x51, 7 }, { 0x51, 7 }, { 0x52, 7 }, { 0x52, 7 }, { 0x53, 7 }, { 0x53, 7 },
-  { 0x54, 7 }, { 0x54, 7 }, { 0x55, 7 }, { 0x55, 7 }, { 0x56, 7 }, { 0x56, 7 },
-  { 0x57, 7 }, { 0x57, 7 }, { 0x59, 7 }, { 0x59, 7 }, { 0x6A, 7 }, { 0x6A, 7 },
-  { 0x6B, 7 }, { 0x6B, 7 }, { 0x71, 7 }, { 0x71, 7 }, { 0x76, 7 }, { 0x76, 7 },
-  { 0x77, 7 }, { 0x77, 7 }, { 0x78, 7 }, { 0x78, 7 }, { 0x79, 7 }, { 0x79, 7 },
-  { 0x7A, 7 }, { 0x7A, 7 }, { 0x26, 8 }, { 0x2A, 8 }, { 0x2C, 8 }, { 0x3B, 8 },
-  { 0x58, 8 }, { 0x5A, 8 }, { 0x00, 0 }, { 0x00, 0 },
+/* multi-symbol decoding table, see mk_huffman_table.py for entry layout */
+static u32 huff_code_table_multi[] = {
+  0x05053030, 0x05053030, 0x05053030, 0x05053030, 0x05053130, 0x05053130,
+  0x05053130, 0x05053130, 0x05053230, 0x05053230, 0x05053230, 0x05053230,
+  0x05056130, 0x05056130, 0x05056130, 0x05056130, 0x05056330, 0x05056330,
+  0x05056330, 0x05056330, 0x05056530, 0x05056530, 0x05056530, 0x05056530,
+  0x05056930, 0x05056930, 0x05056930, 0x05056930, 0x05056F30, 0x05056F30,
+  0x05056F30, 0x05056F30, 0x05057330, 0x05057330, 0x05057330, 0x05057330,
+  0x05057430, 0x05057430, 0x05057430, 0x05057430, 0x06052030, 0x06052030,
+  0x06052530, 0x06052530, 0x06052D30, 0x06052D30, 0x06052E30, 0x06052E30,
+  0x06052F30, 0x06052F30, 0x06053330, 0x06053330, 0x06053430, 0x06053430,
+  0x06053530, 0x06053530, 0x06053630, 0x06053630, 0x06053730, 0x06053730,
+  0x06053830, 0x06053830, 0x06053930, 0x06053930, 0x06053D30, 0x06053D30,
+  0x06054130, 0x06054130, 0x06055F30, 0x06055F30, 0x06056230, 0x06056230,
+  0x06056430, 0x06056430, 0x06056630, 0x06056630, 0x06056730, 0x06056730,
+  0x06056830, 0x06056830, 0x06056C30, 0x06056C30, 0x06056D30, 0x06056D30,
+  0x06056E30, 0x06056E30, 0x06057030, 0x06057030, 0x06057230, 0x06057230,
+  0x06057530, 0x06057530, 0x07053A30, 0x07054230, 0x07054330, 0x07054430,
+  0x07054530, 0x07054630, 0x07054730, 0x07054830, 0x07054930, 0x07054A30,
+  0x07054B30, 0x07054C30, 0x07054D30, 0x07054E30, 0x07054F30, 0x07055030,
+  0x07055130, 0x07055230, 0x07055330, 0x07055430, 0x07055530, 0x07055630,
+  0x07055730, 0x07055930, 0x07056A30, 0x07056B30, 0x07057130, 0x07057630,
+  0x07057730, 0x07057830, 0x07057930, 0x07057A30, 0x00050030, 0x00050030,
+  0x00050030, 0x00050030, 0x05053031, 0x05053031, 0x05053031, 0x05053031,
+  0x05053131, 0x05053131, 0x05053131, 0x05053131, 0x05053231, 0x05053231,
+  0x05053231, 0x05053231, 0x05056131, 0x05056131, 0x05056131, 0x05056131,
+  0x05056331, 0x05056331, 0x05056331, 0x05056331, 0x05056531, 0x05056531,
+  0x05056531, 0x05056531, 0x05056931, 0x05056931, 0x05056931, 0x05056931,
+  0x05056F31, 0x05056F31, 0x05056F31, 0x05056F31, 0x05057331, 0x05057331,
+  0x05057331, 0x05057331, 0x05057431, 0x05057431, 0x05057431, 0x05057431,
+  0x06052031, 0x06052031, 0x06052531, 0x06052531, 0x06052D31, 0x06052D31,
+  0x06052E31, 0x06052E31, 0x06052F31, 0x06052F31, 0x06053331, 0x06053331,
+  0x06053431, 0x06053431, 0x06053531, 0x06053531, 0x06053631, 0x06053631,
+  0x06053731, 0x06053731, 0x06053831, 0x06053831, 0x06053931, 0x06053931,
+  0x06053D31, 0x06053D31, 0x06054131, 0x06054131, 0x06055F31, 0x06055F31,
+  0x06056231, 0x06056231, 0x06056431, 0x06056431, 0x06056631, 0x06056631,
+  0x06056731, 0x06056731, 0x06056831, 0x06056831, 0x06056C31, 0x06056C31,
+  0x06056D31, 0x06056D31, 0x06056E31, 0x06056E31, 0x06057031, 0x06057031,
+  0x06057231, 0x06057231, 0x06057531, 0x06057531, 0x07053A31, 0x07054231,
+  0x07054331, 0x07054431, 0x07054531, 0x07054631, 0x07054731, 0x07054831,
+  0x07054931, 0x07054A31, 0x07054B31, 0x07054C31, 0x07054D31, 0x07054E31,
+  0x07054F31, 0x07055031, 0x07055131, 0x07055231, 0x07055331, 0x07055431,
+  0x07055531, 0x07055631, 0x07055731, 0x07055931, 0x07056A31, 0x07056B31,
+  0x07057131, 0x07057631, 0x07057731, 0x07057831, 0x07057931, 0x07057A31,
+  0x00050031, 0x00050031, 0x00050031, 0x00050031, 0x05053032, 0x05053032,
+  0x05053032, 0x05053032, 0x05053132, 0x05053132, 0x05053132, 0x05053132,
+  0x05053232, 0x05053232, 0x05053232, 0x05053232, 0x05056132, 0x05056132,
+  0x05056132, 0x05056132, 0x05056332, 0x05056332, 0x05056332, 0x05056332,
+  0x05056532, 0x05056532, 0x05056532, 0x05056532, 0x05056932, 0x05056932,
+  0x05056932, 0x05056932, 0x05056F32, 0x05056F32, 0x05056F32, 0x05056F32,
+  0x05057332, 0x05057332, 0x05057332, 0x05057332, 0x05057432, 0x05057432,
+  0x05057432, 0x05057432, 0x06052032, 0x06052032, 0x06052532, 0x06052532,
+  0x06052D32, 0x06052D32, 0x06052E32, 0x06052E32, 0x06052F32, 0x06052F32,
+  0x06053332, 0x06053332, 0x06053432, 0x06053432, 0x06053532, 0x06053532,
+  0x06053632, 0x06053632, 0x06053732, 0x06053732, 0x06053832, 0x06053832,
+  0x06053932, 0x06053932, 0x06053D32, 0x06053D32, 0x06054132, 0x06054132,
+  0x06055F32, 0x06055F32, 0x06056232, 0x06056232, 0x06056432, 0x06056432,
+  0x06056632, 0x06056632, 0x06056732, 0x06056732, 0x06056832, 0x06056832,
+  0x06056C32, 0x06056C32, 0x06056D32, 0x06056D32, 0x06056E32, 0x06056E32,
+  0x06057032, 0x06057032, 0x06057232, 0x06057232, 0x06057532, 0x06057532,
+  0x07053A32, 0x07054232, 0x07054332, 0x07054432, 0x07054532, 0x07054632,
+  0x07054732, 0x07054832, 0x07054932, 0x07054A32, 0x07054B32, 0x07054C32,
+  0x07054D32, 0x07054E32, 0x07054F32, 0x07055032, 0x07055132, 0x07055232,
+  0x07055332, 0x07055432, 0x07055532, 0x07055632, 0x07055732, 0x07055932,
+  0x07056A32, 0x07056B32, 0x07057132, 0x07057632, 0x07057732, 0x07057832,
+  0x07057932, 0x07057A32, 0x00050032, 0x00050032, 0x00050032, 0x00050032,
+  0x05053061, 0x05053061, 0x05053061, 0x05053061, 0x05053161, 0x05053161,
+  0x05053161, 0x05053161, 0x05053261, 0x05053261, 0x05053261, 0x05053261,
+  0x05056161, 0x05056161, 0x05056161, 0x05056161, 0x05056361, 0x05056361,
+  0x05056361, 0x05056361, 0x05056561, 0x05056561, 0x05056561, 0x05056561,
+  0x05056961, 0x05056961, 0x05056961, 0x05056961, 0x05056F61, 0x05056F61,
+  0x05056F61, 0x05056F61, 0x05057361, 0x05057361, 0x05057361, 0x05057361,
+  0x05057461, 0x05057461, 0x05057461, 0x05057461, 0x06052061, 0x06052061,
+  0x06052561, 0x06052561, 0x06052D61, 0x06052D61, 0x06052E61, 0x06052E61,
+  0x06052F61, 0x06052F61, 0x06053361, 0x06053361, 0x06053461, 0x06053461,
+  0x06053561, 0x06053561, 0x06053661, 0x06053661, 0x06053761, 0x06053761,
+  0x06053861, 0x06053861, 0x06053961, 0x06053961, 0x06053D61, 0x06053D61,
+  0x06054161, 0x06054161, 0x06055F61, 0x06055F61, 0x06056261, 0x06056261,
+  0x06056461, 0x06056461, 0x06056661, 0x06056661, 0x06056761, 0x06056761,
+  0x06056861, 0x06056861, 0x06056C61, 0x06056C61, 0x06056D61, 0x06056D61,
+  0x06056E61, 0x06056E61, 0x06057061, 0x06057061, 0x06057261, 0x06057261,
+  0x06057561, 0x06057561, 0x07053A61, 0x07054261, 0x07054361, 0x07054461,
+  0x07054561, 0x07054661, 0x07054761, 0x07054861, 0x07054961, 0x07054A61,
+  0x07054B61, 0x07054C61, 0x07054D61, 0x07054E61, 0x07054F61, 0x07055061,
+  0x07055161, 0x07055261, 0x07055361, 0x07055461, 0x07055561, 0x07055661,
+  0x07055761, 0x07055961, 0x07056A61, 0x07056B61, 0x07057161, 0x07057661,
+  0x07057761, 0x07057861, 0x07057961, 0x07057A61, 0x00050061, 0x00050061,
+  0x00050061, 0x00050061, 0x05053063, 0x05053063, 0x05053063, 0x05053063,
+  0x05053163, 0x05053163, 0x05053163, 0x05053163, 0x05053263, 0x05053263,
+  0x05053263, 0x05053263, 0x05056163, 0x05056163, 0x05056163, 0x05056163,
+  0x05056363, 0x05056363, 0x05056363, 0x05056363, 0x05056563, 0x05056563,
+  0x05056563, 0x05056563, 0x05056963, 0x05056963, 0x05056963, 0x05056963,
+  0x05056F63, 0x05056F63, 0x05056F63, 0x05056F63, 0x05057363, 0x05057363,
+  0x05057363, 0x05057363, 0x05057463, 0x05057463, 0x05057463, 0x05057463,
+  0x06052063, 0x06052063, 0x06052563, 0x06052563, 0x06052D63, 0x06052D63,
+  0x06052E63, 0x06052E63, 0x06052F63, 0x06052F63, 0x06053363, 0x06053363,
+  0x06053463, 0x06053463, 0x06053563, 0x06053563, 0x06053663, 0x06053663,
+  0x06053763, 0x06053763, 0x06053863, 0x06053863, 0x06053963, 0x06053963,
+  0x06053D63, 0x06053D63, 0x06054163, 0x06054163, 0x06055F63, 0x06055F63,
+  0x06056263, 0x06056263, 0x06056463, 0x06056463, 0x06056663, 0x06056663,
+  0x06056763, 0x06056763, 0x06056863, 0x06056863, 0x06056C63, 0x06056C63,
+  0x06056D63, 0x06056D63, 0x06056E63, 0x06056E63, 0x06057063, 0x06057063,
+  0x06057263, 0x06057263, 0x06057563, 0x06057563, 0x07053A63, 0x07054263,
+  0x07054363, 0x07054463, 0x07054563, 0x07054663, 0x07054763, 0x07054863,
+  0x07054963, 0x07054A63, 0x07054B63, 0x07054C63, 0x07054D63, 0x07054E63,
+  0x07054F63, 0x07055063, 0x07055163, 0x07055263, 0x07055363, 0x07055463,
+  0x07055563, 0x07055663, 0x07055763, 0x07055963, 0x07056A63, 0x07056B63,
+  0x07057163, 0x07057663, 0x07057763, 0x07057863, 0x07057963, 0x07057A63,
+  0x00050063, 0x00050063, 0x00050063, 0x00050063, 0x05053065, 0x05053065,
+  0x05053065, 0x05053065, 0x05053165, 0x05053165, 0x05053165, 0x05053165,
+  0x05053265, 0x05053265, 0x05053265, 0x05053265, 0x05056165, 0x05056165,
+  0x05056165, 0x05056165, 0x05056365, 0x05056365, 0x05056365, 0x05056365,
+  0x05056565, 0x05056565, 0x05056565, 0x05056565, 0x05056965, 0x05056965,
+  0x05056965, 0x05056965, 0x05056F65, 0x05056F65, 0x05056F65, 0x05056F65,
+  0x05057365, 0x05057365, 0x05057365, 0x05057365, 0x05057465, 0x05057465,
+  0x05057465, 0x05057465, 0x06052065, 0x06052065, 0x06052565, 0x06052565,
+  0x06052D65, 0x06052D65, 0x06052E65, 0x06052E65, 0x06052F65, 0x06052F65,
+  0x06053365, 0x06053365, 0x06053465, 0x06053465, 0x06053565, 0x06053565,
+  0x06053665, 0x06053665, 0x06053765, 0x06053765, 0x06053865, 0x06053865,
+  0x06053965, 0x06053965, 0x06053D65, 0x06053D65, 0x06054165, 0x06054165,
+  0x06055F65, 0x06055F65, 0x06056265, 0x06056265, 0x06056465, 0x06056465,
+  0x06056665, 0x06056665, 0x06056765, 0x06056765, 0x06056865, 0x06056865,
+  0x06056C65, 0x06056C65, 0x06056D65, 0x06056D65, 0x06056E65, 0x06056E65,
+  0x06057065, 0x06057065, 0x06057265, 0x06057265, 0x06057565, 0x06057565,
+  0x07053A65, 0x07054265, 0x07054365, 0x07054465, 0x07054565, 0x07054665,
+  0x07054765, 0x07054865, 0x07054965, 0x07054A65, 0x07054B65, 0x07054C65,
+  0x07054D65, 0x07054E65, 0x07054F65, 0x07055065, 0x07055165, 0x07055265,
+  0x07055365, 0x07055465, 0x07055565, 0x07055665, 0x07055765, 0x07055965,
+  0x07056A65, 0x07056B65, 0x07057165, 0x07057665, 0x07057765, 0x07057865,
+  0x07057965, 0x07057A65, 0x00050065, 0x00050065, 0x00050065, 0x00050065,
+  0x05053069, 0x05053069, 0x05053069, 0x05053069, 0x05053169, 0x05053169,
+  0x05053169, 0x05053169, 0x05053269, 0x05053269, 0x05053269, 0x05053269,
+  0x05056169, 0x05056169, 0x05056169, 0x05056169, 0x05056369, 0x05056369,
+  0x05056369, 0x05056369, 0x05056569, 0x05056569, 0x05056569, 0x05056569,
+  0x05056969, 0x05056969, 0x05056969, 0x05056969, 0x05056F69, 0x05056F69,
+  0x05056F69, 0x05056F69, 0x05057369, 0x05057369, 0x05057369, 0x05057369,
+  0x05057469, 0x05057469, 0x05057469, 0x05057469, 0x06052069, 0x06052069,
+  0x06052569, 0x06052569, 0x06052D69, 0x06052D69, 0x06052E69, 0x06052E69,
+  0x06052F69, 0x06052F69, 0x06053369, 0x06053369, 0x06053469, 0x06053469,
+  0x06053569, 0x06053569, 0x06053669, 0x06053669, 0x06053769, 0x06053769,
+  0x06053869, 0x06053869, 0x06053969, 0x06053969, 0x06053D69, 0x06053D69,
+  0x06054169, 0x06054169, 0x06055F69, 0x06055F69, 0x06056269, 0x06056269,
+  0x06056469, 0x06056469, 0x06056669, 0x06056669, 0x06056769, 0x06056769,
+  0x06056869, 0x06056869, 0x06056C69, 0x06056C69, 0x06056D69, 0x06056D69,
+  0x06056E69, 0x06056E69, 0x06057069, 0x06057069, 0x06057269, 0x06057269,
+  0x06057569, 0x06057569, 0x07053A69, 0x07054269, 0x07054369, 0x07054469,
+  0x07054569, 0x07054669, 0x07054769, 0x07054869, 0x07054969, 0x07054A69,
+  0x07054B69, 0x07054C69, 0x07054D69, 0x07054E69, 0x07054F69, 0x07055069,
+  0x07055169, 0x07055269, 0x07055369, 0x07055469, 0x07055569, 0x07055669,
+  0x07055769, 0x07055969, 0x07056A69, 0x07056B69, 0x07057169, 0x07057669,
+  0x07057769, 0x07057869, 0x07057969, 0x07057A69, 0x00050069, 0x00050069,
+  0x00050069, 0x00050069, 0x0505306F, 0x0505306F, 0x0505306F, 0x0505306F,
+  0x0505316F, 0x0505316F, 0x0505316F, 0x0505316F, 0x0505326F, 0x0505326F,
+  0x0505326F, 0x0505326F, 0x0505616F, 0x0505616F, 0x0505616F, 0x0505616F,
+  0x0505636F, 0x0505636F, 0x0505636F, 0x0505636F, 0x0505656F, 0x0505656F,
+  0x0505656F, 0x0505656F, 0x0505696F, 0x0505696F, 0x0505696F, 0x0505696F,
+  0x05056F6F, 0x05056F6F, 0x05056F6F, 0x05056F6F, 0x0505736F, 0x0505736F,
+  0x0505736F, 0x0505736F, 0x0505746F, 0x0505746F, 0x0505746F, 0x0505746F,
+  0x0605206F, 0x0605206F, 0x0605256F, 0x0605256F, 0x06052D6F, 0x06052D6F,
+  0x06052E6F, 0x06052E6F, 0x06052F6F, 0x06052F6F, 0x0605336F, 0x0605336F,
+  0x0605346F, 0x0605346F, 0x0605356F, 0x0605356F, 0x0605366F, 0x0605366F,
+  0x0605376F, 0x0605376F, 0x0605386F, 0x0605386F, 0x0605396F, 0x0605396F,
+  0x06053D6F, 0x06053D6F, 0x0605416F, 0x0605416F, 0x06055F6F, 0x06055F6F,
+  0x0605626F, 0x0605626F, 0x0605646F, 0x0605646F, 0x0605666F, 0x0605666F,
+  0x0605676F, 0x0605676F, 0x0605686F, 0x0605686F, 0x06056C6F, 0x06056C6F,
+  0x06056D6F, 0x06056D6F, 0x06056E6F, 0x06056E6F, 0x0605706F, 0x0605706F,
+  0x0605726F, 0x0605726F, 0x0605756F, 0x0605756F, 0x07053A6F, 0x0705426F,
+  0x0705436F, 0x0705446F, 0x0705456F, 0x0705466F, 0x0705476F, 0x0705486F,
+  0x0705496F, 0x07054A6F, 0x07054B6F, 0x07054C6F, 0x07054D6F, 0x07054E6F,
+  0x07054F6F, 0x0705506F, 0x0705516F, 0x0705526F, 0x0705536F, 0x0705546F,
+  0x0705556F, 0x0705566F, 0x0705576F, 0x0705596F, 0x07056A6F, 0x07056B6F,
+  0x0705716F, 0x0705766F, 0x0705776F, 0x0705786F, 0x0705796F, 0x07057A6F,
+  0x0005006F, 0x0005006F, 0x0005006F, 0x0005006F, 0x05053073, 0x05053073,
+  0x05053073, 0x05053073, 0x05053173, 0x05053173, 0x05053173, 0x05053173,
+  0x05053273, 0x05053273, 0x05053273, 0x05053273, 0x05056173, 0x05056173,
+  0x05056173, 0x05056173, 0x05056373, 0x05056373, 0x05056373, 0x05056373,
+  0x05056573, 0x05056573, 0x05056573, 0x05056573, 0x05056973, 0x05056973,
+  0x05056973, 0x05056973, 0x05056F73, 0x05056F73, 0x05056F73, 0x05056F73,
+  0x05057373, 0x05057373, 0x05057373, 0x05057373, 0x05057473, 0x05057473,
+  0x05057473, 0x05057473, 0x06052073, 0x06052073, 0x06052573, 0x06052573,
+  0x06052D73, 0x06052D73, 0x06052E73, 0x06052E73, 0x06052F73, 0x06052F73,
+  0x06053373, 0x06053373, 0x06053473, 0x06053473, 0x06053573, 0x06053573,
+  0x06053673, 0x06053673, 0x06053773, 0x06053773, 0x06053873, 0x06053873,
+  0x06053973, 0x06053973, 0x06053D73, 0x06053D73, 0x06054173, 0x06054173,
+  0x06055F73, 0x06055F73, 0x06056273, 0x06056273, 0x06056473, 0x06056473,
+  0x06056673, 0x06056673, 0x06056773, 0x06056773, 0x06056873, 0x06056873,
+  0x06056C73, 0x06056C73, 0x06056D73, 0x06056D73, 0x06056E73, 0x06056E73,
+  0x06057073, 0x06057073, 0x06057273, 0x06057273, 0x06057573, 0x06057573,
+  0x07053A73, 0x07054273, 0x07054373, 0x07054473, 0x07054573, 0x07054673,
+  0x07054773, 0x07054873, 0x07054973, 0x07054A73, 0x07054B73, 0x07054C73,
+  0x07054D73, 0x07054E73, 0x07054F73, 0x07055073, 0x07055173, 0x07055273,
+  0x07055373, 0x07055473, 0x07055573, 0x07055673, 0x07055773, 0x07055973,
+  0x07056A73, 0x07056B73, 0x07057173, 0x07057673, 0x07057773, 0x07057873,
+  0x07057973, 0x07057A73, 0x00050073, 0x00050073, 0x00050073, 0x00050073,
+  0x05053074, 0x05053074, 0x05053074, 0x05053074, 0x05053174, 0x05053174,
+  0x05053174, 0x05053174, 0x05053274, 0x05053274, 0x05053274, 0x05053274,
+  0x05056174, 0x05056174, 0x05056174, 0x05056174, 0x05056374, 0x05056374,
+  0x05056374, 0x05056374, 0x05056574, 0x05056574, 0x05056574, 0x05056574,
+  0x05056974, 0x05056974, 0x05056974, 0x05056974, 0x05056F74, 0x05056F74,
+  0x05056F74, 0x05056F74, 0x05057374, 0x05057374, 0x05057374, 0x05057374,
+  0x05057474, 0x05057474, 0x05057474, 0x05057474, 0x06052074, 0x06052074,
+  0x06052574, 0x06052574, 0x06052D74, 0x06052D74, 0x06052E74, 0x06052E74,
+  0x06052F74, 0x06052F74, 0x06053374, 0x06053374, 0x06053474, 0x06053474,
+  0x06053574, 0x06053574, 0x06053674, 0x06053674, 0x06053774, 0x06053774,
+  0x06053874, 0x06053874, 0x06053974, 0x06053974, 0x06053D74, 0x06053D74,
+  0x06054174, 0x06054174, 0x06055F74, 0x06055F74, 0x06056274, 0x06056274,
+  0x06056474, 0x06056474, 0x06056674, 0x06056674, 0x06056774, 0x06056774,
+  0x06056874, 0x06056874, 0x06056C74, 0x06056C74, 0x06056D74, 0x06056D74,
+  0x06056E74, 0x06056E74, 0x06057074, 0x06057074, 0x06057274, 0x06057274,
+  0x06057574, 0x06057574, 0x07053A74, 0x07054274, 0x07054374, 0x07054474,
+  0x07054574, 0x07054674, 0x07054774, 0x07054874, 0x07054974, 0x07054A74,
+  0x07054B74, 0x07054C74, 0x07054D74, 0x07054E74, 0x07054F74, 0x07055074,
+  0x07055174, 0x07055274, 0x07055374, 0x07055474, 0x07055574, 0x07055674,
+  0x07055774, 0x07055974, 0x07056A74, 0x07056B74, 0x07057174, 0x07057674,
+  0x07057774, 0x07057874, 0x07057974, 0x07057A74, 0x00050074, 0x00050074,
+  0x00050074, 0x00050074, 0x05063020, 0x05063020, 0x05063120, 0x05063120,
+  0x05063220, 0x05063220, 0x05066120, 0x05066120, 0x05066320, 0x05066320,
+  0x05066520, 0x05066520, 0x05066920, 0x05066920, 0x05066F20, 0x05066F20,
+  0x05067320, 0x05067320, 0x05067420, 0x05067420, 0x06062020, 0x06062520,
+  0x06062D20, 0x06062E20, 0x06062F20, 0x06063320, 0x06063420, 0x06063520,
+  0x06063620, 0x06063720, 0x06063820, 0x06063920, 0x06063D20, 0x06064120,
+  0x06065F20, 0x06066220, 0x06066420, 0x06066620, 0x06066720, 0x06066820,
+  0x06066C20, 0x06066D20, 0x06066E20, 0x06067020, 0x06067220, 0x06067520,
+  0x00060020, 0x00060020, 0x00060020, 0x00060020, 0x00060020, 0x00060020,
+  0x00060020, 0x00060020, 0x00060020, 0x00060020, 0x00060020, 0x00060020,
+  0x00060020, 0x00060020, 0x00060020, 0x00060020, 0x00060020, 0x00060020,
+  0x05063025, 0x05063025, 0x05063125, 0x05063125, 0x05063225, 0x05063225,
+  0x05066125, 0x05066125, 0x05066325, 0x05066325, 0x05066525, 0x05066525,
+  0x05066925, 0x05066925, 0x05066F25, 0x05066F25, 0x05067325, 0x05067325,
+  0x05067425, 0x05067425, 0x06062025, 0x06062525, 0x06062D25, 0x06062E25,
+  0x06062F25, 0x06063325, 0x06063425, 0x06063525, 0x06063625, 0x06063725,
+  0x06063825, 0x06063925, 0x06063D25, 0x06064125, 0x06065F25, 0x06066225,
+  0x06066425, 0x06066625, 0x06066725, 0x06066825, 0x06066C25, 0x06066D25,
+  0x06066E25, 0x06067025, 0x06067225, 0x06067525, 0x00060025, 0x00060025,
+  0x00060025, 0x00060025, 0x00060025, 0x00060025, 0x00060025, 0x00060025,
+  0x00060025, 0x00060025, 0x00060025, 0x00060025, 0x00060025, 0x00060025,
+  0x00060025, 0x00060025, 0x00060025, 0x00060025, 0x0506302D, 0x0506302D,
+  0x0506312D, 0x0506312D, 0x0506322D, 0x0506322D, 0x0506612D, 0x0506612D,
+  0x0506632D, 0x0506632D, 0x0506652D, 0x0506652D, 0x0506692D, 0x0506692D,
+  0x05066F2D, 0x05066F2D, 0x0506732D, 0x0506732D, 0x0506742D, 0x0506742D,
+  0x0606202D, 0x0606252D, 0x06062D2D, 0x06062E2D, 0x06062F2D, 0x0606332D,
+  0x0606342D, 0x0606352D, 0x0606362D, 0x0606372D, 0x0606382D, 0x0606392D,
+  0x06063D2D, 0x0606412D, 0x06065F2D, 0x0606622D, 0x0606642D, 0x0606662D,
+  0x0606672D, 0x0606682D, 0x06066C2D, 0x06066D2D, 0x06066E2D, 0x0606702D,
+  0x0606722D, 0x0606752D, 0x0006002D, 0x0006002D, 0x0006002D, 0x0006002D,
+  0x0006002D, 0x0006002D, 0x0006002D, 0x0006002D, 0x0006002D, 0x0006002D,
+  0x0006002D, 0x0006002D, 0x0006002D, 0x0006002D, 0x0006002D, 0x0006002D,
+  0x0006002D, 0x0006002D, 0x0506302E, 0x0506302E, 0x0506312E, 0x0506312E,
+  0x0506322E, 0x0506322E, 0x0506612E, 0x0506612E, 0x0506632E, 0x0506632E,
+  0x0506652E, 0x0506652E, 0x0506692E, 0x0506692E, 0x05066F2E, 0x05066F2E,
+  0x0506732E, 0x0506732E, 0x0506742E, 0x0506742E, 0x0606202E, 0x0606252E,
+  0x06062D2E, 0x06062E2E, 0x06062F2E, 0x0606332E, 0x0606342E, 0x0606352E,
+  0x0606362E, 0x0606372E, 0x0606382E, 0x0606392E, 0x06063D2E, 0x0606412E,
+  0x06065F2E, 0x0606622E, 0x0606642E, 0x0606662E, 0x0606672E, 0x0606682E,
+  0x06066C2E, 0x06066D2E, 0x06066E2E, 0x0606702E, 0x0606722E, 0x0606752E,
+  0x0006002E, 0x0006002E, 0x0006002E, 0x0006002E, 0x0006002E, 0x0006002E,
+  0x0006002E, 0x0006002E, 0x0006002E, 0x0006002E, 0x0006002E, 0x0006002E,
+  0x0006002E, 0x0006002E, 0x0006002E, 0x0006002E, 0x0006002E, 0x0006002E,
+  0x0506302F, 0x0506302F, 0x0506312F, 0x0506312F, 0x0506322F, 0x0506322F,
+  0x0506612F, 0x0506612F, 0x0506632F, 0x0506632F, 0x0506652F, 0x0506652F,
+  0x0506692F, 0x0506692F, 0x05066F2F, 0x05066F2F, 0x0506732F, 0x0506732F,
+  0x0506742F, 0x0506742F, 0x0606202F, 0x0606252F, 0x06062D2F, 0x06062E2F,
+  0x06062F2F, 0x0606332F, 0x0606342F, 0x0606352F, 0x0606362F, 0x0606372F,
+  0x0606382F, 0x0606392F, 0x06063D2F, 0x0606412F, 0x06065F2F, 0x0606622F,
+  0x0606642F, 0x0606662F, 0x0606672F, 0x0606682F, 0x06066C2F, 0x06066D2F,
+  0x06066E2F, 0x0606702F, 0x0606722F, 0x0606752F, 0x0006002F, 0x0006002F,
+  0x0006002F, 0x0006002F, 0x0006002F, 0x0006002F, 0x0006002F, 0x0006002F,
+  0x0006002F, 0x0006002F, 0x0006002F, 0x0006002F, 0x0006002F, 0x0006002F,
+  0x0006002F, 0x0006002F, 0x0006002F, 0x0006002F, 0x05063033, 0x05063033,
+  0x05063133, 0x05063133, 0x05063233, 0x05063233, 0x05066133, 0x05066133,
+  0x05066333, 0x05066333, 0x05066533, 0x05066533, 0x05066933, 0x05066933,
+  0x05066F33, 0x05066F33, 0x05067333, 0x05067333, 0x05067433, 0x05067433,
+  0x06062033, 0x06062533, 0x06062D33, 0x06062E33, 0x06062F33, 0x06063333,
+  0x06063433, 0x06063533, 0x06063633, 0x06063733, 0x06063833, 0x06063933,
+  0x06063D33, 0x06064133, 0x06065F33, 0x06066233, 0x06066433, 0x06066633,
+  0x06066733, 0x06066833, 0x06066C33, 0x06066D33, 0x06066E33, 0x06067033,
+  0x06067233, 0x06067533, 0x00060033, 0x00060033, 0x00060033, 0x00060033,
+  0x00060033, 0x00060033, 0x00060033, 0x00060033, 0x00060033, 0x00060033,
+  0x00060033, 0x00060033, 0x00060033, 0x00060033, 0x00060033, 0x00060033,
+  0x00060033, 0x00060033, 0x05063034, 0x05063034, 0x05063134, 0x05063134,
+  0x05063234, 0x05063234, 0x05066134, 0x05066134, 0x05066334, 0x05066334,
+  0x05066534, 0x05066534, 0x05066934, 0x05066934, 0x05066F34, 0x05066F34,
+  0x05067334, 0x05067334, 0x05067434, 0x05067434, 0x06062034, 0x06062534,
+  0x06062D34, 0x06062E34, 0x06062F34, 0x06063334, 0x06063434, 0x06063534,
+  0x06063634, 0x06063734, 0x06063834, 0x06063934, 0x06063D34, 0x06064134,
+  0x06065F34, 0x06066234, 0x06066434, 0x06066634, 0x06066734, 0x06066834,
+  0x06066C34, 0x06066D34, 0x06066E34, 0x06067034, 0x06067234, 0x06067534,
+  0x00060034, 0x00060034, 0x00060034, 0x00060034, 0x00060034, 0x00060034,
+  0x00060034, 0x00060034, 0x00060034, 0x00060034, 0x00060034, 0x00060034,
+  0x00060034, 0x00060034, 0x00060034, 0x00060034, 0x00060034, 0x00060034,
+  0x05063035, 0x05063035, 0x05063135, 0x05063135, 0x05063235, 0x05063235,
+  0x05066135, 0x05066135, 0x05066335, 0x05066335, 0x05066535, 0x05066535,
+  0x05066935, 0x05066935, 0x05066F35, 0x05066F35, 0x05067335, 0x05067335,
+  0x05067435, 0x05067435, 0x06062035, 0x06062535, 0x06062D35, 0x06062E35,
+  0x06062F35, 0x06063335, 0x06063435, 0x06063535, 0x06063635, 0x06063735,
+  0x06063835, 0x06063935, 0x06063D35, 0x06064135, 0x06065F35, 0x06066235,
+  0x06066435, 0x06066635, 0x06066735, 0x06066835, 0x06066C35, 0x06066D35,
+  0x06066E35, 0x06067035, 0x06067235, 0x06067535, 0x00060035, 0x00060035,
+  0x00060035, 0x00060035, 0x00060035, 0x00060035, 0x00060035, 0x00060035,
+  0x00060035, 0x00060035, 0x00060035, 0x00060035, 0x00060035, 0x00060035,
+  0x00060035, 0x00060035, 0x00060035, 0x00060035, 0x05063036, 0x05063036,
+  0x05063136, 0x05063136, 0x05063236, 0x05063236, 0x05066136, 0x05066136,
+  0x05066336, 0x05066336, 0x05066536, 0x05066536, 0x05066936, 0x05066936,
+  0x05066F36, 0x05066F36, 0x05067336, 0x05067336, 0x05067436, 0x05067436,
+  0x06062036, 0x06062536, 0x06062D36, 0x06062E36, 0x06062F36, 0x06063336,
+  0x06063436, 0x06063536, 0x06063636, 0x06063736, 0x06063836, 0x06063936,
+  0x06063D36, 0x06064136, 0x06065F36, 0x06066236, 0x06066436, 0x06066636,
+  0x06066736, 0x06066836, 0x06066C36, 0x06066D36, 0x06066E36, 0x06067036,
+  0x06067236, 0x06067536, 0x00060036, 0x00060036, 0x00060036, 0x00060036,
+  0x00060036, 0x00060036, 0x00060036, 0x00060036, 0x00060036, 0x00060036,
+  0x00060036, 0x00060036, 0x00060036, 0x00060036, 0x00060036, 0x00060036,
+  0x00060036, 0x00060036, 0x05063037, 0x05063037, 0x05063137, 0x05063137,
+  0x05063237, 0x05063237, 0x05066137, 0x05066137, 0x05066337, 0x05066337,
+  0x05066537, 0x05066537, 0x05066937, 0x05066937, 0x05066F37, 0x05066F37,
+  0x05067337, 0x05067337, 0x05067437, 0x05067437, 0x06062037, 0x06062537,
+  0x06062D37, 0x06062E37, 0x06062F37, 0x06063337, 0x06063437, 0x06063537,
+  0x06063637, 0x06063737, 0x06063837, 0x06063937, 0x06063D37, 0x06064137,
+  0x06065F37, 0x06066237, 0x06066437, 0x06066637, 0x06066737, 0x06066837,
+  0x06066C37, 0x06066D37, 0x06066E37, 0x06067037, 0x06067237, 0x06067537,
+  0x00060037, 0x00060037, 0x00060037, 0x00060037, 0x00060037, 0x00060037,
+  0x00060037, 0x00060037, 0x00060037, 0x00060037, 0x00060037, 0x00060037,
+  0x00060037, 0x00060037, 0x00060037, 0x00060037, 0x00060037, 0x00060037,
+  0x05063038, 0x05063038, 0x05063138, 0x05063138, 0x05063238, 0x05063238,
+  0x05066138, 0x05066138, 0x05066338, 0x05066338, 0x05066538, 0x05066538,
+  0x05066938, 0x05066938, 0x05066F38, 0x05066F38, 0x05067338, 0x05067338,
+  0x05067438, 0x05067438, 0x06062038, 0x06062538, 0x06062D38, 0x06062E38,
+  0x06062F38, 0x06063338, 0x06063438, 0x06063538, 0x06063638, 0x06063738,
+  0x06063838, 0x06063938, 0x06063D38, 0x06064138, 0x06065F38, 0x06066238,
+  0x06066438, 0x06066638, 0x06066738, 0x06066838, 0x06066C38, 0x06066D38,
+  0x06066E38, 0x06067038, 0x06067238, 0x06067538, 0x00060038, 0x00060038,
+  0x00060038, 0x00060038, 0x00060038, 0x00060038, 0x00060038, 0x00060038,
+  0x00060038, 0x00060038, 0x00060038, 0x00060038, 0x00060038, 0x00060038,
+  0x00060038, 0x00060038, 0x00060038, 0x00060038, 0x05063039, 0x05063039,
+  0x05063139, 0x05063139, 0x05063239, 0x05063239, 0x05066139, 0x05066139,
+  0x05066339, 0x05066339, 0x05066539, 0x05066539, 0x05066939, 0x05066939,
+  0x05066F39, 0x05066F39, 0x05067339, 0x05067339, 0x05067439, 0x05067439,
+  0x06062039, 0x06062539, 0x06062D39, 0x06062E39, 0x06062F39, 0x06063339,
+  0x06063439, 0x06063539, 0x06063639, 0x06063739, 0x06063839, 0x06063939,
+  0x06063D39, 0x06064139, 0x06065F39, 0x06066239, 0x06066439, 0x06066639,
+  0x06066739, 0x06066839, 0x06066C39, 0x06066D39, 0x06066E39, 0x06067039,
+  0x06067239, 0x06067539, 0x00060039, 0x00060039, 0x00060039, 0x00060039,
+  0x00060039, 0x00060039, 0x00060039, 0x00060039, 0x00060039, 0x00060039,
+  0x00060039, 0x00060039, 0x00060039, 0x00060039, 0x00060039, 0x00060039,
+  0x00060039, 0x00060039, 0x0506303D, 0x0506303D, 0x0506313D, 0x0506313D,
+  0x0506323D, 0x0506323D, 0x0506613D, 0x0506613D, 0x0506633D, 0x0506633D,
+  0x0506653D, 0x0506653D, 0x0506693D, 0x0506693D, 0x05066F3D, 0x05066F3D,
+  0x0506733D, 0x0506733D, 0x0506743D, 0x0506743D, 0x0606203D, 0x0606253D,
+  0x06062D3D, 0x06062E3D, 0x06062F3D, 0x0606333D, 0x0606343D, 0x0606353D,
+  0x0606363D, 0x0606373D, 0x0606383D, 0x0606393D, 0x06063D3D, 0x0606413D,
+  0x06065F3D, 0x0606623D, 0x0606643D, 0x0606663D, 0x0606673D, 0x0606683D,
+  0x06066C3D, 0x06066D3D, 0x06066E3D, 0x0606703D, 0x0606723D, 0x0606753D,
+  0x0006003D, 0x0006003D, 0x0006003D, 0x0006003D, 0x0006003D, 0x0006003D,
+  0x0006003D, 0x0006003D, 0x0006003D, 0x0006003D, 0x0006003D, 0x0006003D,
+  0x0006003D, 0x0006003D, 0x0006003D, 0x0006003D, 0x0006003D, 0x0006003D,
+  0x05063041, 0x05063041, 0x05063141, 0x05063141, 0x05063241, 0x05063241,
+  0x05066141, 0x05066141, 0x05066341, 0x05066341, 0x05066541, 0x05066541,
+  0x05066941, 0x05066941, 0x05066F41, 0x05066F41, 0x05067341, 0x05067341,
+  0x05067441, 0x05067441, 0x06062041, 0x06062541, 0x06062D41, 0x06062E41,
+  0x06062F41, 0x06063341, 0x06063441, 0x06063541, 0x06063641, 0x06063741,
+  0x06063841, 0x06063941, 0x06063D41, 0x06064141, 0x06065F41, 0x06066241,
+  0x06066441, 0x06066641, 0x06066741, 0x06066841, 0x06066C41, 0x06066D41,
+  0x06066E41, 0x06067041, 0x06067241, 0x06067541, 0x00060041, 0x00060041,
+  0x00060041, 0x00060041, 0x00060041, 0x00060041, 0x00060041, 0x00060041,
+  0x00060041, 0x00060041, 0x00060041, 0x00060041, 0x00060041, 0x00060041,
+  0x00060041, 0x00060041, 0x00060041, 0x00060041, 0x0506305F, 0x0506305F,
+  0x0506315F, 0x0506315F, 0x0506325F, 0x0506325F, 0x0506615F, 0x0506615F,
+  0x0506635F, 0x0506635F, 0x0506655F, 0x0506655F, 0x0506695F, 0x0506695F,
+  0x05066F5F, 0x05066F5F, 0x0506735F, 0x0506735F, 0x0506745F, 0x0506745F,
+  0x0606205F, 0x0606255F, 0x06062D5F, 0x06062E5F, 0x06062F5F, 0x0606335F,
+  0x0606345F, 0x0606355F, 0x0606365F, 0x0606375F, 0x0606385F, 0x0606395F,
+  0x06063D5F, 0x0606415F, 0x06065F5F, 0x0606625F, 0x0606645F, 0x0606665F,
+  0x0606675F, 0x0606685F, 0x06066C5F, 0x06066D5F, 0x06066E5F, 0x0606705F,
+  0x0606725F, 0x0606755F, 0x0006005F, 0x0006005F, 0x0006005F, 0x0006005F,
+  0x0006005F, 0x0006005F, 0x0006005F, 0x0006005F, 0x0006005F, 0x0006005F,
+  0x0006005F, 0x0006005F, 0x0006005F, 0x0006005F, 0x0006005F, 0x0006005F,
+  0x0006005F, 0x0006005F, 0x05063062, 0x05063062, 0x05063162, 0x05063162,
+  0x05063262, 0x05063262, 0x05066162, 0x05066162, 0x05066362, 0x05066362,
+  0x05066562, 0x05066562, 0x05066962, 0x05066962, 0x05066F62, 0x05066F62,
+  0x05067362, 0x05067362, 0x05067462, 0x05067462, 0x06062062, 0x06062562,
+  0x06062D62, 0x06062E62, 0x06062F62, 0x06063362, 0x06063462, 0x06063562,
+  0x06063662, 0x06063762, 0x06063862, 0x06063962, 0x06063D62, 0x06064162,
+  0x06065F62, 0x06066262, 0x06066462, 0x06066662, 0x06066762, 0x06066862,
+  0x06066C62, 0x06066D62, 0x06066E62, 0x06067062, 0x06067262, 0x06067562,
+  0x00060062, 0x00060062, 0x00060062, 0x00060062, 0x00060062, 0x00060062,
+  0x00060062, 0x00060062, 0x00060062, 0x00060062, 0x00060062, 0x00060062,
+  0x00060062, 0x00060062, 0x00060062, 0x00060062, 0x00060062, 0x00060062,
+  0x05063064, 0x05063064, 0x05063164, 0x05063164, 0x05063264, 0x05063264,
+  0x05066164, 0x05066164, 0x05066364, 0x05066364, 0x05066564, 0x05066564,
+  0x05066964, 0x05066964, 0x05066F64, 0x05066F64, 0x05067364, 0x05067364,
+  0x05067464, 0x05067464, 0x06062064, 0x06062564, 0x06062D64, 0x06062E64,
+  0x06062F64, 0x06063364, 0x06063464, 0x06063564, 0x06063664, 0x06063764,
+  0x06063864, 0x06063964, 0x06063D64, 0x06064164, 0x06065F64, 0x06066264,
+  0x06066464, 0x06066664, 0x06066764, 0x06066864, 0x06066C64, 0x06066D64,
+  0x06066E64, 0x06067064, 0x06067264, 0x06067564, 0x00060064, 0x00060064,
+  0x00060064, 0x00060064, 0x00060064, 0x00060064, 0x00060064, 0x00060064,
+  0x00060064, 0x00060064, 0x00060064, 0x00060064, 0x00060064, 0x00060064,
+  0x00060064, 0x00060064, 0x00060064, 0x00060064, 0x05063066, 0x05063066,
+  0x05063166, 0x05063166, 0x05063266, 0x05063266, 0x05066166, 0x05066166,
+  0x05066366, 0x05066366, 0x05066566, 0x05066566, 0x05066966, 0x05066966,
+  0x05066F66, 0x05066F66, 0x05067366, 0x05067366, 0x05067466, 0x05067466,
+  0x06062066, 0x06062566, 0x06062D66, 0x06062E66, 0x06062F66, 0x06063366,
+  0x06063466, 0x06063566, 0x06063666, 0x06063766, 0x06063866, 0x06063966,
+  0x06063D66, 0x06064166, 0x06065F66, 0x06066266, 0x06066466, 0x06066666,
+  0x06066766, 0x06066866, 0x06066C66, 0x06066D66, 0x06066E66, 0x06067066,
+  0x06067266, 0x06067566, 0x00060066, 0x00060066, 0x00060066, 0x00060066,
+  0x00060066, 0x00060066, 0x00060066, 0x00060066, 0x00060066, 0x00060066,
+  0x00060066, 0x00060066, 0x00060066, 0x00060066, 0x00060066, 0x00060066,
+  0x00060066, 0x00060066, 0x05063067, 0x05063067, 0x05063167, 0x05063167,
+  0x05063267, 0x05063267, 0x05066167, 0x05066167, 0x05066367, 0x05066367,
+  0x05066567, 0x05066567, 0x05066967, 0x05066967, 0x05066F67, 0x05066F67,
+  0x05067367, 0x05067367, 0x05067467, 0x05067467, 0x06062067, 0x06062567,
+  0x06062D67, 0x06062E67, 0x06062F67, 0x06063367, 0x06063467, 0x06063567,
+  0x06063667, 0x06063767, 0x06063867, 0x06063967, 0x06063D67, 0x06064167,
+  0x06065F67, 0x06066267, 0x06066467, 0x06066667, 0x06066767, 0x06066867,
+  0x06066C67, 0x06066D67, 0x06066E67, 0x06067067, 0x06067267, 0x06067567,
+  0x00060067, 0x00060067, 0x00060067, 0x00060067, 0x00060067, 0x00060067,
+  0x00060067, 0x00060067, 0x00060067, 0x00060067, 0x00060067, 0x00060067,
+  0x00060067, 0x00060067, 0x00060067, 0x00060067, 0x00060067, 0x00060067,
+  0x05063068, 0x05063068, 0x05063168, 0x05063168, 0x05063268, 0x05063268,
+  0x05066168, 0x05066168, 0x05066368, 0x05066368, 0x05066568, 0x05066568,
+  0x05066968, 0x05066968, 0x05066F68, 0x05066F68, 0x05067368, 0x05067368,
+  0x05067468, 0x05067468, 0x06062068, 0x06062568, 0x06062D68, 0x06062E68,
+  0x06062F68, 0x06063368, 0x06063468, 0x06063568, 0x06063668, 0x06063768,
+  0x06063868, 0x06063968, 0x06063D68, 0x06064168, 0x06065F68, 0x06066268,
+  0x06066468, 0x06066668, 0x06066768, 0x06066868, 0x06066C68, 0x06066D68,
+  0x06066E68, 0x06067068, 0x06067268, 0x06067568, 0x00060068, 0x00060068,
+  0x00060068, 0x00060068, 0x00060068, 0x00060068, 0x00060068, 0x00060068,
+  0x00060068, 0x00060068, 0x00060068, 0x00060068, 0x00060068, 0x00060068,
+  0x00060068, 0x00060068, 0x00060068, 0x00060068, 0x0506306C, 0x0506306C,
+  0x0506316C, 0x0506316C, 0x0506326C, 0x0506326C, 0x0506616C, 0x0506616C,
+  0x0506636C, 0x0506636C, 0x0506656C, 0x0506656C, 0x0506696C, 0x0506696C,
+  0x05066F6C, 0x05066F6C, 0x0506736C, 0x0506736C, 0x0506746C, 0x0506746C,
+  0x0606206C, 0x0606256C, 0x06062D6C, 0x06062E6C, 0x06062F6C, 0x0606336C,
+  0x0606346C, 0x0606356C, 0x0606366C, 0x0606376C, 0x0606386C, 0x0606396C,
+  0x06063D6C, 0x0606416C, 0x06065F6C, 0x0606626C, 0x0606646C, 0x0606666C,
+  0x0606676C, 0x0606686C, 0x06066C6C, 0x06066D6C, 0x06066E6C, 0x0606706C,
+  0x0606726C, 0x0606756C, 0x0006006C, 0x0006006C, 0x0006006C, 0x0006006C,
+  0x0006006C, 0x0006006C, 0x0006006C, 0x0006006C, 0x0006006C, 0x0006006C,
+  0x0006006C, 0x0006006C, 0x0006006C, 0x0006006C, 0x0006006C, 0x0006006C,
+  0x0006006C, 0x0006006C, 0x0506306D, 0x0506306D, 0x0506316D, 0x0506316D,
+  0x0506326D, 0x0506326D, 0x0506616D, 0x0506616D, 0x0506636D, 0x0506636D,
+  0x0506656D, 0x0506656D, 0x0506696D, 0x0506696D, 0x05066F6D, 0x05066F6D,
+  0x0506736D, 0x0506736D, 0x0506746D, 0x0506746D, 0x0606206D, 0x0606256D,
+  0x06062D6D, 0x06062E6D, 0x06062F6D, 0x0606336D, 0x0606346D, 0x0606356D,
+  0x0606366D, 0x0606376D, 0x0606386D, 0x0606396D, 0x06063D6D, 0x0606416D,
+  0x06065F6D, 0x0606626D, 0x0606646D, 0x0606666D, 0x0606676D, 0x0606686D,
+  0x06066C6D, 0x06066D6D, 0x06066E6D, 0x0606706D, 0x0606726D, 0x0606756D,
+  0x0006006D, 0x0006006D, 0x0006006D, 0x0006006D, 0x0006006D, 0x0006006D,
+  0x0006006D, 0x0006006D, 0x0006006D, 0x0006006D, 0x0006006D, 0x0006006D,
+  0x0006006D, 0x0006006D, 0x0006006D, 0x0006006D, 0x0006006D, 0x0006006D,
+  0x0506306E, 0x0506306E, 0x0506316E, 0x0506316E, 0x0506326E, 0x0506326E,
+  0x0506616E, 0x0506616E, 0x0506636E, 0x0506636E, 0x0506656E, 0x0506656E,
+  0x0506696E, 0x0506696E, 0x05066F6E, 0x05066F6E, 0x0506736E, 0x0506736E,
+  0x0506746E, 0x0506746E, 0x0606206E, 0x0606256E, 0x06062D6E, 0x06062E6E,
+  0x06062F6E, 0x0606336E, 0x0606346E, 0x0606356E, 0x0606366E, 0x0606376E,
+  0x0606386E, 0x0606396E, 0x06063D6E, 0x0606416E, 0x06065F6E, 0x0606626E,
+  0x0606646E, 0x0606666E, 0x0606676E, 0x0606686E, 0x06066C6E, 0x06066D6E,
+  0x06066E6E, 0x0606706E, 0x0606726E, 0x0606756E, 0x0006006E, 0x0006006E,
+  0x0006006E, 0x0006006E, 0x0006006E, 0x0006006E, 0x0006006E, 0x0006006E,
+  0x0006006E, 0x0006006E, 0x0006006E, 0x0006006E, 0x0006006E, 0x0006006E,
+  0x0006006E, 0x0006006E, 0x0006006E, 0x0006006E, 0x05063070, 0x05063070,
+  0x05063170, 0x05063170, 0x05063270, 0x05063270, 0x05066170, 0x05066170,
+  0x05066370, 0x05066370, 0x05066570, 0x05066570, 0x05066970, 0x05066970,
+  0x05066F70, 0x05066F70, 0x05067370, 0x05067370, 0x05067470, 0x05067470,
+  0x06062070, 0x06062570, 0x06062D70, 0x06062E70, 0x06062F70, 0x06063370,
+  0x06063470, 0x06063570, 0x06063670, 0x06063770, 0x06063870, 0x06063970,
+  0x06063D70, 0x06064170, 0x06065F70, 0x06066270, 0x06066470, 0x06066670,
+  0x06066770, 0x06066870, 0x06066C70, 0x06066D70, 0x06066E70, 0x06067070,
+  0x06067270, 0x06067570, 0x00060070, 0x00060070, 0x00060070, 0x00060070,
+  0x00060070, 0x00060070, 0x00060070, 0x00060070, 0x00060070, 0x00060070,
+  0x00060070, 0x00060070, 0x00060070, 0x00060070, 0x00060070, 0x00060070,
+  0x00060070, 0x00060070, 0x05063072, 0x05063072, 0x05063172, 0x05063172,
+  0x05063272, 0x05063272, 0x05066172, 0x05066172, 0x05066372, 0x05066372,
+  0x05066572, 0x05066572, 0x05066972, 0x05066972, 0x05066F72, 0x05066F72,
+  0x05067372, 0x05067372, 0x05067472, 0x05067472, 0x06062072, 0x06062572,
+  0x06062D72, 0x06062E72, 0x06062F72, 0x06063372, 0x06063472, 0x06063572,
+  0x06063672, 0x06063772, 0x06063872, 0x06063972, 0x06063D72, 0x06064172,
+  0x06065F72, 0x06066272, 0x06066472, 0x06066672, 0x06066772, 0x06066872,
+  0x06066C72, 0x06066D72, 0x06066E72, 0x06067072, 0x06067272, 0x06067572,
+  0x00060072, 0x00060072, 0x00060072, 0x00060072, 0x00060072, 0x00060072,
+  0x00060072, 0x00060072, 0x00060072, 0x00060072, 0x00060072, 0x00060072,
+  0x00060072, 0x00060072, 0x00060072, 0x00060072, 0x00060072, 0x00060072,
+  0x05063075, 0x05063075, 0x05063175, 0x05063175, 0x05063275, 0x05063275,
+  0x05066175, 0x05066175, 0x05066375, 0x05066375, 0x05066575, 0x05066575,
+  0x05066975, 0x05066975, 0x05066F75, 0x05066F75, 0x05067375, 0x05067375,
+  0x05067475, 0x05067475, 0x06062075, 0x06062575, 0x06062D75, 0x06062E75,
+  0x06062F75, 0x06063375, 0x06063475, 0x06063575, 0x06063675, 0x06063775,
+  0x06063875, 0x06063975, 0x06063D75, 0x06064175, 0x06065F75, 0x06066275,
+  0x06066475, 0x06066675, 0x06066775, 0x06066875, 0x06066C75, 0x06066D75,
+  0x06066E75, 0x06067075, 0x06067275, 0x06067575, 0x00060075, 0x00060075,
+  0x00060075, 0x00060075, 0x00060075, 0x00060075, 0x00060075, 0x00060075,
+  0x00060075, 0x00060075, 0x00060075, 0x00060075, 0x00060075, 0x00060075,
+  0x00060075, 0x00060075, 0x00060075, 0x00060075, 0x0507303A, 0x0507313A,
+  0x0507323A, 0x0507613A, 0x0507633A, 0x0507653A, 0x0507693A, 0x05076F3A,
+  0x0507733A, 0x0507743A, 0x0007003A, 0x0007003A, 0x0007003A, 0x0007003A,
+  0x0007003A, 0x0007003A, 0x0007003A, 0x0007003A, 0x0007003A, 0x0007003A,
+  0x0007003A, 0x0007003A, 0x0007003A, 0x0007003A, 0x0007003A, 0x0007003A,
+  0x0007003A, 0x0007003A, 0x0007003A, 0x0007003A, 0x0007003A, 0x0007003A,
+  0x05073042, 0x05073142, 0x05073242, 0x05076142, 0x05076342, 0x05076542,
+  0x05076942, 0x05076F42, 0x05077342, 0x05077442, 0x00070042, 0x00070042,
+  0x00070042, 0x00070042, 0x00070042, 0x00070042, 0x00070042, 0x00070042,
+  0x00070042, 0x00070042, 0x00070042, 0x00070042, 0x00070042, 0x00070042,
+  0x00070042, 0x00070042, 0x00070042, 0x00070042, 0x00070042, 0x00070042,
+  0x00070042, 0x00070042, 0x05073043, 0x05073143, 0x05073243, 0x05076143,
+  0x05076343, 0x05076543, 0x05076943, 0x05076F43, 0x05077343, 0x05077443,
+  0x00070043, 0x00070043, 0x00070043, 0x00070043, 0x00070043, 0x00070043,
+  0x00070043, 0x00070043, 0x00070043, 0x00070043, 0x00070043, 0x00070043,
+  0x00070043, 0x00070043, 0x00070043, 0x00070043, 0x00070043, 0x00070043,
+  0x00070043, 0x00070043, 0x00070043, 0x00070043, 0x05073044, 0x05073144,
+  0x05073244, 0x05076144, 0x05076344, 0x05076544, 0x05076944, 0x05076F44,
+  0x05077344, 0x05077444, 0x00070044, 0x00070044, 0x00070044, 0x00070044,
+  0x00070044, 0x00070044, 0x00070044, 0x00070044, 0x00070044, 0x00070044,
+  0x00070044, 0x00070044, 0x00070044, 0x00070044, 0x00070044, 0x00070044,
+  0x00070044, 0x00070044, 0x00070044, 0x00070044, 0x00070044, 0x00070044,
+  0x05073045, 0x05073145, 0x05073245, 0x05076145, 0x05076345, 0x05076545,
+  0x05076945, 0x05076F45, 0x05077345, 0x05077445, 0x00070045, 0x00070045,
+  0x00070045, 0x00070045, 0x00070045, 0x00070045, 0x00070045, 0x00070045,
+  0x00070045, 0x00070045, 0x00070045, 0x00070045, 0x00070045, 0x00070045,
+  0x00070045, 0x00070045, 0x00070045, 0x00070045, 0x00070045, 0x00070045,
+  0x00070045, 0x00070045, 0x05073046, 0x05073146, 0x05073246, 0x05076146,
+  0x05076346, 0x05076546, 0x05076946, 0x05076F46, 0x05077346, 0x05077446,
+  0x00070046, 0x00070046, 0x00070046, 0x00070046, 0x00070046, 0x00070046,
+  0x00070046, 0x00070046, 0x00070046, 0x00070046, 0x00070046, 0x00070046,
+  0x00070046, 0x00070046, 0x00070046, 0x00070046, 0x00070046, 0x00070046,
+  0x00070046, 0x00070046, 0x00070046, 0x00070046, 0x05073047, 0x05073147,
+  0x05073247, 0x05076147, 0x05076347, 0x05076547, 0x05076947, 0x05076F47,
+  0x05077347, 0x05077447, 0x00070047, 0x00070047, 0x00070047, 0x00070047,
+  0x00070047, 0x00070047, 0x00070047, 0x00070047, 0x00070047, 0x00070047,
+  0x00070047, 0x00070047, 0x00070047, 0x00070047, 0x00070047, 0x00070047,
+  0x00070047, 0x00070047, 0x00070047, 0x00070047, 0x00070047, 0x00070047,
+  0x05073048, 0x05073148, 0x05073248, 0x05076148, 0x05076348, 0x05076548,
+  0x05076948, 0x05076F48, 0x05077348, 0x05077448, 0x00070048, 0x00070048,
+  0x00070048, 0x00070048, 0x00070048, 0x00070048, 0x00070048, 0x00070048,
+  0x00070048, 0x00070048, 0x00070048, 0x00070048, 0x00070048, 0x00070048,
+  0x00070048, 0x00070048, 0x00070048, 0x00070048, 0x00070048, 0x00070048,
+  0x00070048, 0x00070048, 0x05073049, 0x05073149, 0x05073249, 0x05076149,
+  0x05076349, 0x05076549, 0x05076949, 0x05076F49, 0x05077349, 0x05077449,
+  0x00070049, 0x00070049, 0x00070049, 0x00070049, 0x00070049, 0x00070049,
+  0x00070049, 0x00070049, 0x00070049, 0x00070049, 0x00070049, 0x00070049,
+  0x00070049, 0x00070049, 0x00070049, 0x00070049, 0x00070049, 0x00070049,
+  0x00070049, 0x00070049, 0x00070049, 0x00070049, 0x0507304A, 0x0507314A,
+  0x0507324A, 0x0507614A, 0x0507634A, 0x0507654A, 0x0507694A, 0x05076F4A,
+  0x0507734A, 0x0507744A, 0x0007004A, 0x0007004A, 0x0007004A, 0x0007004A,
+  0x0007004A, 0x0007004A, 0x0007004A, 0x0007004A, 0x0007004A, 0x0007004A,
+  0x0007004A, 0x0007004A, 0x0007004A, 0x0007004A, 0x0007004A, 0x0007004A,
+  0x0007004A, 0x0007004A, 0x0007004A, 0x0007004A, 0x0007004A, 0x0007004A,
+  0x0507304B, 0x0507314B, 0x0507324B, 0x0507614B, 0x0507634B, 0x0507654B,
+  0x0507694B, 0x05076F4B, 0x0507734B, 0x0507744B, 0x0007004B, 0x0007004B,
+  0x0007004B, 0x0007004B, 0x0007004B, 0x0007004B, 0x0007004B, 0x0007004B,
+  0x0007004B, 0x0007004B, 0x0007004B, 0x0007004B, 0x0007004B, 0x0007004B,
+  0x0007004B, 0x0007004B, 0x0007004B, 0x0007004B, 0x0007004B, 0x0007004B,
+  0x0007004B, 0x0007004B, 0x0507304C, 0x0507314C, 0x0507324C, 0x0507614C,
+  0x0507634C, 0x0507654C, 0x0507694C, 0x05076F4C, 0x0507734C, 0x0507744C,
+  0x0007004C, 0x0007004C, 0x0007004C, 0x0007004C, 0x0007004C, 0x0007004C,
+  0x0007004C, 0x0007004C, 0x0007004C, 0x0007004C, 0x0007004C, 0x0007004C,
+  0x0007004C, 0x0007004C, 0x0007004C, 0x0007004C, 0x0007004C, 0x0007004C,
+  0x0007004C, 0x0007004C, 0x0007004C, 0x0007004C, 0x0507304D, 0x0507314D,
+  0x0507324D, 0x0507614D, 0x0507634D, 0x0507654D, 0x0507694D, 0x05076F4D,
+  0x0507734D, 0x0507744D, 0x0007004D, 0x0007004D, 0x0007004D, 0x0007004D,
+  0x0007004D, 0x0007004D, 0x0007004D, 0x0007004D, 0x0007004D, 0x0007004D,
+  0x0007004D, 0x0007004D, 0x0007004D, 0x0007004D, 0x0007004D, 0x0007004D,
+  0x0007004D, 0x0007004D, 0x0007004D, 0x0007004D, 0x0007004D, 0x0007004D,
+  0x0507304E, 0x0507314E, 0x0507324E, 0x0507614E, 0x0507634E, 0x0507654E,
+  0x0507694E, 0x05076F4E, 0x0507734E, 0x0507744E, 0x0007004E, 0x0007004E,
+  0x0007004E, 0x0007004E, 0x0007004E, 0x0007004E, 0x0007004E, 0x0007004E,
+  0x0007004E, 0x0007004E, 0x0007004E, 0x0007004E, 0x0007004E, 0x0007004E,
+  0x0007004E, 0x0007004E, 0x0007004E, 0x0007004E, 0x0007004E, 0x0007004E,
+  0x0007004E, 0x0007004E, 0x0507304F, 0x0507314F, 0x0507324F, 0x0507614F,
+  0x0507634F, 0x0507654F, 0x0507694F, 0x05076F4F, 0x0507734F, 0x0507744F,
+  0x0007004F, 0x0007004F, 0x0007004F, 0x0007004F, 0x0007004F, 0x0007004F,
+  0x0007004F, 0x0007004F, 0x0007004F, 0x0007004F, 0x0007004F, 0x0007004F,
+  0x0007004F, 0x0007004F, 0x0007004F, 0x0007004F, 0x0007004F, 0x0007004F,
+  0x0007004F, 0x0007004F, 0x0007004F, 0x0007004F, 0x05073050, 0x05073150,
+  0x05073250, 0x05076150, 0x05076350, 0x05076550, 0x05076950, 0x05076F50,
+  0x05077350, 0x05077450, 0x00070050, 0x00070050, 0x00070050, 0x00070050,
+  0x00070050, 0x00070050, 0x00070050, 0x00070050, 0x00070050, 0x00070050,
+  0x00070050, 0x00070050, 0x00070050, 0x00070050, 0x00070050, 0x00070050,
+  0x00070050, 0x00070050, 0x00070050, 0x00070050, 0x00070050, 0x00070050,
+  0x05073051, 0x05073151, 0x05073251, 0x05076151, 0x05076351, 0x05076551,
+  0x05076951, 0x05076F51, 0x05077351, 0x05077451, 0x00070051, 0x00070051,
+  0x00070051, 0x00070051, 0x00070051, 0x00070051, 0x00070051, 0x00070051,
+  0x00070051, 0x00070051, 0x00070051, 0x00070051, 0x00070051, 0x00070051,
+  0x00070051, 0x00070051, 0x00070051, 0x00070051, 0x00070051, 0x00070051,
+  0x00070051, 0x00070051, 0x05073052, 0x05073152, 0x05073252, 0x05076152,
+  0x05076352, 0x05076552, 0x05076952, 0x05076F52, 0x05077352, 0x05077452,
+  0x00070052, 0x00070052, 0x00070052, 0x00070052, 0x00070052, 0x00070052,
+  0x00070052, 0x00070052, 0x00070052, 0x00070052, 0x00070052, 0x00070052,
+  0x00070052, 0x00070052, 0x00070052, 0x00070052, 0x00070052, 0x00070052,
+  0x00070052, 0x00070052, 0x00070052, 0x00070052, 0x05073053, 0x05073153,
+  0x05073253, 0x05076153, 0x05076353, 0x05076553, 0x05076953, 0x05076F53,
+  0x05077353, 0x05077453, 0x00070053, 0x00070053, 0x00070053, 0x00070053,
+  0x00070053, 0x00070053, 0x00070053, 0x00070053, 0x00070053, 0x00070053,
+  0x00070053, 0x00070053, 0x00070053, 0x00070053, 0x00070053, 0x00070053,
+  0x00070053, 0x00070053, 0x00070053, 0x00070053, 0x00070053, 0x00070053,
+  0x05073054, 0x05073154, 0x05073254, 0x05076154, 0x05076354, 0x05076554,
+  0x05076954, 0x05076F54, 0x05077354, 0x05077454, 0x00070054, 0x00070054,
+  0x00070054, 0x00070054, 0x00070054, 0x00070054, 0x00070054, 0x00070054,
+  0x00070054, 0x00070054, 0x00070054, 0x00070054, 0x00070054, 0x00070054,
+  0x00070054, 0x00070054, 0x00070054, 0x00070054, 0x00070054, 0x00070054,
+  0x00070054, 0x00070054, 0x05073055, 0x05073155, 0x05073255, 0x05076155,
+  0x05076355, 0x05076555, 0x05076955, 0x05076F55, 0x05077355, 0x05077455,
+  0x00070055, 0x00070055, 0x00070055, 0x00070055, 0x00070055, 0x00070055,
+  0x00070055, 0x00070055, 0x00070055, 0x00070055, 0x00070055, 0x00070055,
+  0x00070055, 0x00070055, 0x00070055, 0x00070055, 0x00070055, 0x00070055,
+  0x00070055, 0x00070055, 0x00070055, 0x00070055, 0x05073056, 0x05073156,
+  0x05073256, 0x05076156, 0x05076356, 0x05076556, 0x05076956, 0x05076F56,
+  0x05077356, 0x05077456, 0x00070056, 0x00070056, 0x00070056, 0x00070056,
+  0x00070056, 0x00070056, 0x00070056, 0x00070056, 0x00070056, 0x00070056,
+  0x00070056, 0x00070056, 0x00070056, 0x00070056, 0x00070056, 0x00070056,
+  0x00070056, 0x00070056, 0x00070056, 0x00070056, 0x00070056, 0x00070056,
+  0x05073057, 0x05073157, 0x05073257, 0x05076157, 0x05076357, 0x05076557,
+  0x05076957, 0x05076F57, 0x05077357, 0x05077457, 0x00070057, 0x00070057,
+  0x00070057, 0x00070057, 0x00070057, 0x00070057, 0x00070057, 0x00070057,
+  0x00070057, 0x00070057, 0x00070057, 0x00070057, 0x00070057, 0x00070057,
+  0x00070057, 0x00070057, 0x00070057, 0x00070057, 0x00070057, 0x00070057,
+  0x00070057, 0x00070057, 0x05073059, 0x05073159, 0x05073259, 0x05076159,
+  0x05076359, 0x05076559, 0x05076959, 0x05076F59, 0x05077359, 0x05077459,
+  0x00070059, 0x00070059, 0x00070059, 0x00070059, 0x00070059, 0x00070059,
+  0x00070059, 0x00070059, 0x00070059, 0x00070059, 0x00070059, 0x00070059,
+  0x00070059, 0x00070059, 0x00070059, 0x00070059, 0x00070059, 0x00070059,
+  0x00070059, 0x00070059, 0x00070059, 0x00070059, 0x0507306A, 0x0507316A,
+  0x0507326A, 0x0507616A, 0x0507636A, 0x0507656A, 0x0507696A, 0x05076F6A,
+  0x0507736A, 0x0507746A, 0x0007006A, 0x0007006A, 0x0007006A, 0x0007006A,
+  0x0007006A, 0x0007006A, 0x0007006A, 0x0007006A, 0x0007006A, 0x0007006A,
+  0x0007006A, 0x0007006A, 0x0007006A, 0x0007006A, 0x0007006A, 0x0007006A,
+  0x0007006A, 0x0007006A, 0x0007006A, 0x0007006A, 0x0007006A, 0x0007006A,
+  0x0507306B, 0x0507316B, 0x0507326B, 0x0507616B, 0x0507636B, 0x0507656B,
+  0x0507696B, 0x05076F6B, 0x0507736B, 0x0507746B, 0x0007006B, 0x0007006B,
+  0x0007006B, 0x0007006B, 0x0007006B, 0x0007006B, 0x0007006B, 0x0007006B,
+  0x0007006B, 0x0007006B, 0x0007006B, 0x0007006B, 0x0007006B, 0x0007006B,
+  0x0007006B, 0x0007006B, 0x0007006B, 0x0007006B, 0x0007006B, 0x0007006B,
+  0x0007006B, 0x0007006B, 0x05073071, 0x05073171, 0x05073271, 0x05076171,
+  0x05076371, 0x05076571, 0x05076971, 0x05076F71, 0x05077371, 0x05077471,
+  0x00070071, 0x00070071, 0x00070071, 0x00070071, 0x00070071, 0x00070071,
+  0x00070071, 0x00070071, 0x00070071, 0x00070071, 0x00070071, 0x00070071,
+  0x00070071, 0x00070071, 0x00070071, 0x00070071, 0x00070071, 0x00070071,
+  0x00070071, 0x00070071, 0x00070071, 0x00070071, 0x05073076, 0x05073176,
+  0x05073276, 0x05076176, 0x05076376, 0x05076576, 0x05076976, 0x05076F76,
+  0x05077376, 0x05077476, 0x00070076, 0x00070076, 0x00070076, 0x00070076,
+  0x00070076, 0x00070076, 0x00070076, 0x00070076, 0x00070076, 0x00070076,
+  0x00070076, 0x00070076, 0x00070076, 0x00070076, 0x00070076, 0x00070076,
+  0x00070076, 0x00070076, 0x00070076, 0x00070076, 0x00070076, 0x00070076,
+  0x05073077, 0x05073177, 0x05073277, 0x05076177, 0x05076377, 0x05076577,
+  0x05076977, 0x05076F77, 0x05077377, 0x05077477, 0x00070077, 0x00070077,
+  0x00070077, 0x00070077, 0x00070077, 0x00070077, 0x00070077, 0x00070077,
+  0x00070077, 0x00070077, 0x00070077, 0x00070077, 0x00070077, 0x00070077,
+  0x00070077, 0x00070077, 0x00070077, 0x00070077, 0x00070077, 0x00070077,
+  0x00070077, 0x00070077, 0x05073078, 0x05073178, 0x05073278, 0x05076178,
+  0x05076378, 0x05076578, 0x05076978, 0x05076F78, 0x05077378, 0x05077478,
+  0x00070078, 0x00070078, 0x00070078, 0x00070078, 0x00070078, 0x00070078,
+  0x00070078, 0x00070078, 0x00070078, 0x00070078, 0x00070078, 0x00070078,
+  0x00070078, 0x00070078, 0x00070078, 0x00070078, 0x00070078, 0x00070078,
+  0x00070078, 0x00070078, 0x00070078, 0x00070078, 0x05073079, 0x05073179,
+  0x05073279, 0x05076179, 0x05076379, 0x05076579, 0x05076979, 0x05076F79,
+  0x05077379, 0x05077479, 0x00070079, 0x00070079, 0x00070079, 0x00070079,
+  0x00070079, 0x00070079, 0x00070079, 0x00070079, 0x00070079, 0x00070079,
+  0x00070079, 0x00070079, 0x00070079, 0x00070079, 0x00070079, 0x00070079,
+  0x00070079, 0x00070079, 0x00070079, 0x00070079, 0x00070079, 0x00070079,
+  0x0507307A, 0x0507317A, 0x0507327A, 0x0507617A, 0x0507637A, 0x0507657A,
+  0x0507697A, 0x05076F7A, 0x0507737A, 0x0507747A, 0x0007007A, 0x0007007A,
+  0x0007007A, 0x0007007A, 0x0007007A, 0x0007007A, 0x0007007A, 0x0007007A,
+  0x0007007A, 0x0007007A, 0x0007007A, 0x0007007A, 0x0007007A, 0x0007007A,
+  0x0007007A, 0x0007007A, 0x0007007A, 0x0007007A, 0x0007007A, 0x0007007A,
+  0x0007007A, 0x0007007A, 0x00080026, 0x00080026, 0x00080026, 0x00080026,
+  0x00080026, 0x00080026, 0x00080026, 0x00080026, 0x00080026, 0x00080026,
+  0x00080026, 0x00080026, 0x00080026, 0x00080026, 0x00080026, 0x00080026,
+  0x0008002A, 0x0008002A, 0x0008002A, 0x0008002A, 0x0008002A, 0x0008002A,
+  0x0008002A, 0x0008002A, 0x0008002A, 0x0008002A, 0x0008002A, 0x0008002A,
+  0x0008002A, 0x0008002A, 0x0008002A, 0x0008002A, 0x0008002C, 0x0008002C,
+  0x0008002C, 0x0008002C, 0x0008002C, 0x0008002C, 0x0008002C, 0x0008002C,
+  0x0008002C, 0x0008002C, 0x0008002C, 0x0008002C, 0x0008002C, 0x0008002C,
+  0x0008002C, 0x0008002C, 0x0008003B, 0x0008003B, 0x0008003B, 0x0008003B,
+  0x0008003B, 0x0008003B, 0x0008003B, 0x0008003B, 0x0008003B, 0x0008003B,
+  0x0008003B, 0x0008003B, 0x0008003B, 0x0008003B, 0x0008003B, 0x0008003B,
+  0x00080058, 0x00080058, 0x00080058, 0x00080058, 0x00080058, 0x00080058,
+  0x00080058, 0x00080058, 0x00080058, 0x00080058, 0x00080058, 0x00080058,
+  0x00080058, 0x00080058, 0x00080058, 0x00080058, 0x0008005A, 0x0008005A,
+  0x0008005A, 0x0008005A, 0x0008005A, 0x0008005A, 0x0008005A, 0x0008005A,
+  0x0008005A, 0x0008005A, 0x0008005A, 0x0008005A, 0x0008005A, 0x0008005A,
+  0x0008005A, 0x0008005A, 0x000A0021, 0x000A0021, 0x000A0021, 0x000A0021,
+  0x000A0022, 0x000A0022, 0x000A0022, 0x000A0022, 0x000A0028, 0x000A0028,
+  0x000A0028, 0x000A0028, 0x000A0029, 0x000A0029, 0x000A0029, 0x000A0029,
+  0x000A003F, 0x000A003F, 0x000A003F, 0x000A003F, 0x000B0027, 0x000B0027,
+  0x000B002B, 0x000B002B, 0x000B007C, 0x000B007C, 0x000C0023, 0x000C003E,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000,
 };
 
 typedef struct
@@ -794,6 +794,13 @@ http_test_hpack (vlib_main_t *vm)
     "\x96\xD0\x7A\xBE\x94\x10\x54\xD4\x44\xA8\x20\x05\x95\x04\x0B\x81\x66"
     "\xE0\x82\xA6\x2D\x1B\xFF",
     HTTP2_ERROR_INTERNAL_ERROR);
+  /* EOS symbol inside string */
+  N_TEST ("\x84\xFF\xFF\xFF\xFF", HTTP2_ERROR_COMPRESSION_ERROR);
+  N_TEST ("\x85\x1F\xFF\xFF\xFF\xFF", HTTP2_ERROR_COMPRESSION_ERROR);
+  /* padding longer than 7 bits */
+  N_TEST ("\x82\x1F\xFF", HTTP2_ERROR_COMPRESSION_ERROR);
+  /* padding not corresponding to EOS prefix */
+  N_TEST ("\x81\x18", HTTP2_ERROR_COMPRESSION_ERROR);
 #undef N_TEST
 
   vlib_cli_output (vm, "hpack_encode_string");
@@ -832,6 +839,71 @@ http_test_hpack (vlib_main_t *vm)
   TEST ("[XZ]", "\x4[XZ]");
 #undef TEST
 
+  vlib_cli_output (vm, "hpack huffman roundtrip");
+
+  u8 *expected = 0;
+  u32 i, j;
+
+  /* long strings mixing short (multi-symbol lookup) and long codes */
+  for (i = 0; i < 8; i++)
+    {
+      vec_reset_length (expected);
+      for (j = 0; j < 1024 + i; j++)
+	{
+	  if (j % 97 == 0)
+	    vec_add1 (expected, (u8) (j * 7 + i));
+	  else
+	    vec_add1 (expected, "0123456789abcdefghijklmnopqrstuvwxyz-/.:"
+				"ABCDEFGHIJ=; %"[(j + i) % 54]);
+	}
+      vec_validate_init_empty (input, vec_len (expected) * 4 + 16, 0);
+      p = _hpack_encode_string (input, expected, vec_len (expected));
+      vec_set_len (input, p - input);
+      pos = input;
+      vec_validate_init_empty (buf, vec_len (expected) - 1, 0);
+      bp = buf;
+      blen = vec_len (buf);
+      rv = _hpack_decode_string (&pos, vec_end (input), &bp, &blen);
+      HTTP_TEST ((rv == HTTP2_ERROR_NO_ERROR && blen == 0 &&
+		  pos == vec_end (input) &&
+		  !memcmp (buf, expected, vec_len (expected))),
+		 "%u bytes string roundtrip (huffman %u)", vec_len (expected),
+		 input[0] >> 7);
+      vec_free (input);
+      vec_free (buf);
+    }
+  vec_free (expected);
+
+  vlib_cli_output (vm, "hpack_static_table_lookup_name");
+
+  static u8 (*_hpack_static_table_lookup_name) (const u8 *name,
+						uword name_len);
+  _hpack_static_table_lookup_name =
+    vlib_get_plugin_symbol ("http_plugin.so", "hpack_static_table_lookup_name");
+
+#define TEST(n, e)                                                            \
+  HTTP_TEST ((_hpack_static_table_lookup_name ((u8 *) n, sizeof (n) - 1) ==   \
+	      e),                                                             \
+	     "'%s' static table index should be %u", n, e);
+
+  TEST (":authority", 1);
+  TEST (":method", 2);
+  TEST (":path", 4);
+  TEST (":status", 8);
+  TEST ("accept-encoding", 16);
+  TEST ("age", 21);
+  TEST ("content-type", 31);
+  TEST ("etag", 34);
+  TEST ("te", 0);
+  TEST ("via", 60);
+  TEST ("www-authenticate", 61);
+  TEST ("x", 0);
+  TEST ("vie", 0);
+  TEST ("Age", 0);
+  TEST ("custom-key", 0);
+  TEST ("www-authenticatf", 0);
+#undef TEST
+
   vlib_cli_output (vm, "hpack_decode_header");
 
   static http2_error_t (*_hpack_decode_header) (
@@ -1300,6 +1372,245 @@ http_test_h2_frame (vlib_main_t *vm)
   return 0;
 }
 
+static int
+http_test_parser (vlib_main_t *vm)
+{
+  static int (*_http1_parse_request) (u8 * rx_buf,
+				      http_field_line_t * *headers,
+				      u32 * msg_len);
+  u8 *buf = 0, *p;
+  http_field_line_t *headers = 0;
+  u32 msg_len, i, offset;
+  int rv;
+
+  _http1_parse_request =
+    vlib_get_plugin_symbol ("http_plugin.so", "http1_parse_request");
+
+  vlib_cli_output (vm, "http_scan_byte");
+
+  /* check all positions to hit both vector and scalar code path */
+  vec_validate_init_empty (buf, 99, 'a');
+  for (i = 0; i < vec_len (buf); i++)
+    {
+      buf[i] = ':';
+      if (http_scan_byte (buf, vec_end (buf), ':') != buf + i ||
+	  http_scan_byte (buf, buf + i, ':') != buf + i)
+	break;
+      buf[i] = 0x80 | ':';
+      if (http_scan_byte (buf, vec_end (buf), ':') != vec_end (buf))
+	break;
+      buf[i] = 'a';
+    }
+  HTTP_TEST ((i == vec_len (buf)), "byte found at all positions (failed %u)",
+	     i);
+
+  vlib_cli_output (vm, "http_scan_ctl");
+
+  for (i = 0; i < vec_len (buf); i++)
+    {
+      buf[i] = '\t';
+      if (http_scan_ctl (buf, vec_end (buf)) != vec_end (buf))
+	break;
+      buf[i] = 0x7f;
+      if (http_scan_ctl (buf, vec_end (buf)) != vec_end (buf))
+	break;
+      buf[i] = 0xe0;
+      if (http_scan_ctl (buf, vec_end (buf)) != vec_end (buf))
+	break;
+      buf[i] = '\r';
+      if (http_scan_ctl (buf, vec_end (buf)) != buf + i)
+	break;
+      buf[i] = 0;
+      if (http_scan_ctl (buf, vec_end (buf)) != buf + i)
+	break;
+      buf[i] = 'a';
+    }
+  HTTP_TEST ((i == vec_len (buf)),
+	     "control char found at all positions (failed %u)", i);
+
+  vlib_cli_output (vm, "http_scan_crlf");
+
+  buf[40] = '\r';
+  buf[60] = '\r';
+  buf[61] = '\n';
+  p = http_scan_crlf (buf, vec_end (buf));
+  HTTP_TEST ((p == buf + 60), "CR without LF skipped, CRLF found at %d",
+	     (int) (p - buf));
+  p = http_scan_crlf (buf, buf + 61);
+  HTTP_TEST ((p == 0), "CRLF split by end not found");
+  vec_free (buf);
+
+  vlib_cli_output (vm, "http1_parse_request");
+
+  buf = format (0, "GET /index.html?a=1 HTTP/1.1\r\n"
+		   "Host: example.com\r\n"
+		   "User-Agent: \tvpp \t\r\n"
+		   "\r\n");
+  rv = _http1_parse_request (buf, &headers, &msg_len);
+  HTTP_TEST ((rv == 0 && msg_len == vec_len (buf) && vec_len (headers) == 2),
+	     "GET request parsed, msg_len %u headers %u", msg_len,
+	     vec_len (headers));
+  HTTP_TEST ((headers[1].value_len == 3), "trailing whitespace trimmed");
+  vec_free (buf);
+
+  /* three pipelined requests in one buffer */
+  buf = format (0, "GET /a HTTP/1.1\r\nHost: example.com\r\n\r\n"
+		   "POST /b HTTP/1.1\r\nContent-Length: 5\r\n\r\nhello"
+		   "GET /c HTTP/1.1\r\n\r\n");
+  offset = 0;
+  for (i = 0; i < 3; i++)
+    {
+      u8 *req = 0;
+      vec_add (req, buf + offset, vec_len (buf) - offset);
+      rv = _http1_parse_request (req, &headers, &msg_len);
+      vec_free (req);
+      HTTP_TEST ((rv == 0), "pipelined request %u parsed", i);
+      offset += msg_len;
+    }
+  HTTP_TEST ((offset == vec_len (buf)), "pipelined requests consumed %u/%u",
+	     offset, vec_len (buf));
+  vec_free (buf);
+
+  buf = format (0, "GET / HTTP/1.1\r\nHost example.com\r\n\r\n");
+  rv = _http1_parse_request (buf, &headers, &msg_len);
+  HTTP_TEST ((rv == HTTP_STATUS_BAD_REQUEST), "missing colon rejected");
+  vec_free (buf);
+
+  buf = format (0, "GET / HTTP/1.1\r\nHo st: example.com\r\n\r\n");
+  rv = _http1_parse_request (buf, &headers, &msg_len);
+  HTTP_TEST ((rv == HTTP_STATUS_BAD_REQUEST),
+	     "invalid character in field name rejected");
+  vec_free (buf);
+
+  buf = format (0, "GET / HTTP/1.1\r\nHost: exa\nmple.com\r\n\r\n");
+  rv = _http1_parse_request (buf, &headers, &msg_len);
+  HTTP_TEST ((rv == HTTP_STATUS_BAD_REQUEST),
+	     "invalid character in field value rejected");
+  vec_free (buf);
+
+  buf = format (0, "GET / HTTP/1.1\r\nHost: example.com\rX\r\n\r\n");
+  rv = _http1_parse_request (buf, &headers, &msg_len);
+  HTTP_TEST ((rv == HTTP_STATUS_BAD_REQUEST), "CR without LF rejected");
+  vec_free (buf);
+
+  buf = format (0, "GET / HTTP/1.1\r\nHost: example.com");
+  rv = _http1_parse_request (buf, &headers, &msg_len);
+  HTTP_TEST ((rv == HTTP_STATUS_BAD_REQUEST), "incomplete header rejected");
+  vec_free (buf);
+
+  vec_free (headers);
+  return 0;
+}
+
+static int
+http_test_parser_bench (vlib_main_t *vm, unformat_input_t *input)
+{
+  static int (*_http1_parse_request) (u8 * rx_buf,
+				      http_field_line_t * *headers,
+				      u32 * msg_len);
+  u8 *buf = 0, **reqs = 0, *p, *end;
+  http_field_line_t *headers = 0;
+  u32 n_iterations = 1000000, n_pipelined = 1, msg_len, i, j, offset;
+  u64 n_bytes = 0, n_found = 0, t0, t1;
+  f64 dt;
+
+  while (unformat_check_input (input) != UNFORMAT_END_OF_INPUT)
+    {
+      if (unformat (input, "iterations %u", &n_iterations))
+	;
+      else if (unformat (input, "pipelined %u", &n_pipelined))
+	;
+      else
+	break;
+    }
+  if (n_pipelined == 0)
+    n_pipelined = 1;
+
+  _http1_parse_request =
+    vlib_get_plugin_symbol ("http_plugin.so", "http1_parse_request");
+
+  for (i = 0; i < n_pipelined; i++)
+    buf = format (
+      buf,
+      "GET /api/v1/items/%u?fields=name,price HTTP/1.1\r\n"
+      "Host: www.example.com\r\n"
+      "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:128.0) Gecko/20100101 "
+      "Firefox/128.0\r\n"
+      "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;"
+      "q=0.8\r\n"
+      "Accept-Language: en-US,en;q=0.5\r\n"
+      "Accept-Encoding: gzip, deflate, br\r\n"
+      "Connection: keep-alive\r\n"
+      "Cookie: session=0123456789abcdef0123456789abcdef\r\n"
+      "\r\n",
+      i);
+
+  /* rx state machine drains parsed request, so next one starts at offset 0
+   * of rx buffer, prepare buffer for each pipelined request upfront */
+  for (offset = 0, i = 0; i < n_pipelined; i++)
+    {
+      u8 *req = 0;
+      vec_add (req, buf + offset, vec_len (buf) - offset);
+      if (_http1_parse_request (req, &headers, &msg_len))
+	{
+	  vlib_cli_output (vm, "parse failed");
+	  vec_free (req);
+	  goto done;
+	}
+      vec_add1 (reqs, req);
+      offset += msg_len;
+    }
+
+  vlib_cli_output (vm, "%u requests (%u bytes each), %u headers",
+		   n_iterations * n_pipelined, vec_len (buf) / n_pipelined,
+		   vec_len (headers));
+
+  t0 = clib_cpu_time_now ();
+  for (i = 0; i < n_iterations; i++)
+    {
+      for (j = 0; j < n_pipelined; j++)
+	{
+	  _http1_parse_request (reqs[j], &headers, &msg_len);
+	  n_bytes += msg_len;
+	}
+    }
+  t1 = clib_cpu_time_now ();
+
+  dt = (f64) (t1 - t0) / vm->clib_time.clocks_per_second;
+  vlib_cli_output (vm, "parse: %.2f clocks/request, %.2f clocks/byte, "
+		   "%.0f requests/s",
+		   (f64) (t1 - t0) / (n_iterations * n_pipelined),
+		   (f64) (t1 - t0) / n_bytes,
+		   (n_iterations * n_pipelined) / dt);
+
+  /* delimiter scanning alone, vector vs. byte-by-byte */
+  end = vec_end (buf);
+  t0 = clib_cpu_time_now ();
+  for (i = 0; i < n_iterations; i++)
+    for (p = buf; (p = http_scan_byte (p, end, '\n')) != end; p++)
+      n_found++;
+  t1 = clib_cpu_time_now ();
+  vlib_cli_output (vm, "scan (vector): %.2f clocks/byte",
+		   (f64) (t1 - t0) / ((u64) n_iterations * vec_len (buf)));
+
+  t0 = clib_cpu_time_now ();
+  for (i = 0; i < n_iterations; i++)
+    for (p = buf; p < end; p++)
+      n_found -= *(volatile u8 *) p == '\n';
+  t1 = clib_cpu_time_now ();
+  vlib_cli_output (vm, "scan (scalar): %.2f clocks/byte",
+		   (f64) (t1 - t0) / ((u64) n_iterations * vec_len (buf)));
+  ASSERT (n_found == 0);
+
+done:
+  vec_free (buf);
+  for (i = 0; i < vec_len (reqs); i++)
+    vec_free (reqs[i]);
+  vec_free (reqs);
+  vec_free (headers);
+  return 0;
+}
+
 static clib_error_t *
 test_http_command_fn (vlib_main_t *vm, unformat_input_t *input,
 		      vlib_cli_command_t *cmd)
@@ -1321,6 +1632,10 @@ test_http_command_fn (vlib_main_t *vm, unformat_input_t *input,
 	res = http_test_hpack (vm);
       else if (unformat (input, "h2-frame"))
 	res = http_test_h2_frame (vm);
+      else if (unformat (input, "parser-bench"))
+	res = http_test_parser_bench (vm, input);
+      else if (unformat (input, "parser"))
+	res = http_test_parser (vm);
       else if (unformat (input, "all"))
 	{
 	  if ((res = http_test_parse_authority (vm)))
@@ -1337,6 +1652,8 @@ test_http_command_fn (vlib_main_t *vm, unformat_input_t *input,
 	    goto done;
 	  if ((res = http_test_h2_frame (vm)))
 	    goto done;
+	  if ((res = http_test_parser (vm)))
+	    goto done;
 	}
       else
 	break;
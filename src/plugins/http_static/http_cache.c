@@ -18,6 +18,8 @@
 #include <vppinfra/unix.h>
 #include <vlib/vlib.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <vppinfra/time_range.h>
 
 static void
@@ -35,63 +37,57 @@ hss_cache_unlock (hss_cache_t *hc)
 /** \brief Sanity-check the forward and reverse LRU lists
  */
 static inline void
-lru_validate (hss_cache_t *hc)
+lru_validate (hss_cache_t *hc, hss_cache_lru_t *lru)
 {
 #if CLIB_DEBUG > 0
-  f64 last_timestamp;
-  u32 index;
+  u32 index, prev_index;
+  u64 size = 0;
   int i;
   hss_cache_entry_t *ce;
 
-  last_timestamp = 1e70;
-  for (i = 1, index = hc->first_index; index != ~0;)
+  prev_index = ~0;
+  for (i = 1, index = lru->first_index; index != ~0;)
     {
       ce = pool_elt_at_index (hc->cache_pool, index);
-      /* Timestamps should be smaller (older) as we walk the fwd list */
-      if (ce->last_used > last_timestamp)
+      /* Back link should point to the entry we came from */
+      if (ce->prev_index != prev_index)
 	{
-	  clib_warning ("%d[%d]: last used %.6f, last_timestamp %.6f", index,
-			i, ce->last_used, last_timestamp);
+	  clib_warning ("%d[%d]: prev index %d, expected %d", index, i,
+			ce->prev_index, prev_index);
 	}
+      if (&hc->lru[ce->lru_type] != lru)
+	clib_warning ("%d[%d]: on wrong lru list", index, i);
+      size += ce->data_len;
+      prev_index = index;
       index = ce->next_index;
-      last_timestamp = ce->last_used;
       i++;
     }
 
-  last_timestamp = 0.0;
-  for (i = 1, index = hc->last_index; index != ~0;)
-    {
-      ce = pool_elt_at_index (hc->cache_pool, index);
-      /* Timestamps should be larger (newer) as we walk the rev list */
-      if (ce->last_used < last_timestamp)
-	{
-	  clib_warning ("%d[%d]: last used %.6f, last_timestamp %.6f", index,
-			i, ce->last_used, last_timestamp);
-	}
-      index = ce->prev_index;
-      last_timestamp = ce->last_used;
-      i++;
-    }
+  if (prev_index != lru->last_index)
+    clib_warning ("last index %d, expected %d", lru->last_index, prev_index);
+  if (size != lru->size)
+    clib_warning ("lru size %lld, expected %lld", lru->size, size);
 #endif
 }
 
-/** \brief Remove a data cache entry from the LRU lists
+/** \brief Remove a data cache entry from its LRU list
  */
 static inline void
 lru_remove (hss_cache_t *hc, hss_cache_entry_t *ce)
 {
+  hss_cache_lru_t *lru = &hc->lru[ce->lru_type];
   hss_cache_entry_t *next_ep, *prev_ep;
   u32 ce_index;
 
-  lru_validate (hc);
+  lru_validate (hc, lru);
 
   ce_index = ce - hc->cache_pool;
 
   /* Deal with list heads */
-  if (ce_index == hc->first_index)
-    hc->first_index = ce->next_index;
-  if (ce_index == hc->last_index)
-    hc->last_index = ce->prev_index;
+  if (ce_index == lru->first_index)
+    lru->first_index = ce->next_index;
+  if (ce_index == lru->last_index)
+    lru->last_index = ce->prev_index;
 
   /* Fix next->prev */
   if (ce->next_index != ~0)
@@ -105,18 +101,22 @@ lru_remove (hss_cache_t *hc, hss_cache_entry_t *ce)
       prev_ep = pool_elt_at_index (hc->cache_pool, ce->prev_index);
       prev_ep->next_index = ce->next_index;
     }
-  lru_validate (hc);
+  lru->size -= ce->data_len;
+  lru_validate (hc, lru);
 }
 
-/** \brief Add an entry to the LRU lists, tag w/ supplied timestamp
+/** \brief Add an entry to the head of given LRU list, tag w/ supplied
+ *  timestamp
  */
 static inline void
-lru_add (hss_cache_t *hc, hss_cache_entry_t *ce, f64 now)
+lru_add (hss_cache_t *hc, hss_cache_entry_t *ce, hss_cache_lru_type_t type,
+	 f64 now)
 {
+  hss_cache_lru_t *lru = &hc->lru[type];
   hss_cache_entry_t *next_ce;
   u32 ce_index;
 
-  lru_validate (hc);
+  lru_validate (hc, lru);
 
   ce_index = ce - hc->cache_pool;
 
@@ -124,38 +124,55 @@ lru_add (hss_cache_t *hc, hss_cache_entry_t *ce, f64 now)
    * Re-add at the head of the forward LRU list,
    * tail of the reverse LRU list
    */
-  if (hc->first_index != ~0)
+  if (lru->first_index != ~0)
     {
-      next_ce = pool_elt_at_index (hc->cache_pool, hc->first_index);
+      next_ce = pool_elt_at_index (hc->cache_pool, lru->first_index);
       next_ce->prev_index = ce_index;
     }
 
   ce->prev_index = ~0;
 
   /* ep now the new head of the LRU forward list */
-  ce->next_index = hc->first_index;
-  hc->first_index = ce_index;
+  ce->next_index = lru->first_index;
+  lru->first_index = ce_index;
 
   /* single session case: also the tail of the reverse LRU list */
-  if (hc->last_index == ~0)
-    hc->last_index = ce_index;
+  if (lru->last_index == ~0)
+    lru->last_index = ce_index;
   ce->last_used = now;
+  ce->lru_type = type;
+  lru->size += ce->data_len;
 
-  lru_validate (hc);
+  lru_validate (hc, lru);
 }
 
-/** \brief Remove and re-add a cache entry from/to the LRU lists
+/** \brief Move a cache entry to the head of the protected segment,
+ *  demote least recently used protected entries if segment is full
  */
 static inline void
 lru_update (hss_cache_t *hc, hss_cache_entry_t *ep, f64 now)
 {
+  hss_cache_lru_t *protected = &hc->lru[HSS_CACHE_LRU_PROTECTED];
+  hss_cache_entry_t *ce;
+  u64 protected_limit;
+
   lru_remove (hc, ep);
-  lru_add (hc, ep, now);
+  lru_add (hc, ep, HSS_CACHE_LRU_PROTECTED, now);
+
+  protected_limit = (hc->cache_limit * HSS_CACHE_PROTECTED_PCT) / 100;
+  while (protected->size > protected_limit &&
+	 protected->last_index != ep - hc->cache_pool)
+    {
+      ce = pool_elt_at_index (hc->cache_pool, protected->last_index);
+      lru_remove (hc, ce);
+      /* keep original timestamp, entry is just less valuable now */
+      lru_add (hc, ce, HSS_CACHE_LRU_PROBATION, ce->last_used);
+    }
 }
 
 static void
 hss_cache_attach_entry (hss_cache_t *hc, u32 ce_index, u8 **data,
-			u64 *data_len, u8 **last_modified)
+			u64 *data_len, u8 **last_modified, u8 **etag)
 {
   hss_cache_entry_t *ce;
 
@@ -163,8 +180,9 @@ hss_cache_attach_entry (hss_cache_t *hc, u32 ce_index, u8 **data,
   ce = pool_elt_at_index (hc->cache_pool, ce_index);
   ce->inuse++;
   *data = ce->data;
-  *data_len = vec_len (ce->data);
+  *data_len = ce->data_len;
   *last_modified = ce->last_modified;
+  *etag = ce->etag;
 
   /* Update the cache entry, mark it in-use */
   lru_update (hc, ce, vlib_time_now (vlib_get_main ()));
@@ -173,6 +191,8 @@ hss_cache_attach_entry (hss_cache_t *hc, u32 ce_index, u8 **data,
     clib_warning ("index %d refcnt now %d", ce_index, ce->inuse);
 }
 
+static void hss_cache_entry_free (hss_cache_t *hc, hss_cache_entry_t *ce);
+
 /** \brief Detach cache entry from session
  */
 void
@@ -188,6 +208,9 @@ hss_cache_detach_entry (hss_cache_t *hc, u32 ce_index)
   if (hc->debug_level > 1)
     clib_warning ("index %d refcnt now %d", ce_index, ce->inuse);
 
+  if (!ce->inuse && ce->is_stale)
+    hss_cache_entry_free (hc, ce);
+
   hss_cache_unlock (hc);
 }
 
@@ -210,17 +233,79 @@ hss_cache_lookup (hss_cache_t *hc, u8 *path)
   return kv.value;
 }
 
+/**
+ * Check that a mapped file did not change since it was mapped. Reading
+ * pages past the end of a truncated file raises SIGBUS, so if the file
+ * shrank, the mapping is replaced with anonymous memory for sessions that
+ * still use the entry. The entry is removed from the lookup table and the
+ * file mapped again on next lookup.
+ *
+ * Called with the cache lock held, so the file is checked at most once
+ * per revalidate interval, not on every hit.
+ */
+static int
+hss_cache_entry_validate (hss_cache_t *hc, hss_cache_entry_t *ce)
+{
+  BVT (clib_bihash_kv) kv;
+  struct stat dm;
+  f64 now;
+  int rv;
+
+  if (!ce->is_mmap)
+    return 0;
+
+  now = vlib_time_now (vlib_get_main ());
+  if (now - ce->last_validated < hc->revalidate_interval)
+    return 0;
+  ce->last_validated = now;
+
+  rv = stat ((char *) ce->filename, &dm);
+  if (!rv && dm.st_size == ce->data_len && dm.st_mtime == ce->mtime)
+    return 0;
+
+  if (hc->debug_level > 0)
+    clib_warning ("'%s' changed, dropping cached mapping", ce->filename);
+
+  if (rv < 0 || dm.st_size < ce->data_len)
+    {
+      if (mmap (ce->data, ce->data_len, PROT_READ,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1,
+		0) == MAP_FAILED)
+	clib_unix_warning ("remap '%s'", ce->filename);
+    }
+
+  kv.key = (u64) (ce->filename);
+  BV (clib_bihash_add_del) (&hc->name_to_data, &kv, 0 /* is_add */);
+  ce->is_stale = 1;
+
+  if (!ce->inuse)
+    hss_cache_entry_free (hc, ce);
+
+  return -1;
+}
+
 u32
 hss_cache_lookup_and_attach (hss_cache_t *hc, u8 *path, u8 **data,
-			     u64 *data_len, u8 **last_modified)
+			     u64 *data_len, u8 **last_modified, u8 **etag)
 {
   u32 ce_index;
   /* Make sure nobody removes the entry while we look it up */
   hss_cache_lock (hc);
 
   ce_index = hss_cache_lookup (hc, path);
+  if (ce_index != ~0 &&
+      hss_cache_entry_validate (hc, pool_elt_at_index (hc->cache_pool,
+							ce_index)))
+    ce_index = ~0;
+
   if (ce_index != ~0)
-    hss_cache_attach_entry (hc, ce_index, data, data_len, last_modified);
+    {
+      hss_cache_attach_entry (hc, ce_index, data, data_len, last_modified,
+			      etag);
+      hc->cache_hits++;
+    }
+  else
+    hc->cache_misses++;
 
   hss_cache_unlock (hc);
 
@@ -228,59 +313,105 @@ hss_cache_lookup_and_attach (hss_cache_t *hc, u8 *path, u8 **data,
 }
 
 static void
-hss_cache_do_evictions (hss_cache_t *hc)
+hss_cache_entry_free (hss_cache_t *hc, hss_cache_entry_t *ce)
 {
   BVT (clib_bihash_kv) kv;
-  hss_cache_entry_t *ce;
-  u32 free_index;
-
-  free_index = hc->last_index;
 
-  while (free_index != ~0)
+  /* Stale entries were already removed from lookup table and a new entry
+   * may be using the same name */
+  if (!ce->is_stale)
     {
-      /* pick the LRU */
-      ce = pool_elt_at_index (hc->cache_pool, free_index);
-      /* Which could be in use... */
-      if (ce->inuse)
-	{
-	  if (hc->debug_level > 1)
-	    clib_warning ("index %d in use refcnt %d", free_index, ce->inuse);
-	}
-      free_index = ce->prev_index;
       kv.key = (u64) (ce->filename);
       kv.value = ~0ULL;
-      if (BV (clib_bihash_add_del) (&hc->name_to_data, &kv, 0 /* is_add */) <
-	  0)
+      if (BV (clib_bihash_add_del) (&hc->name_to_data, &kv,
+				    0 /* is_add */) < 0)
 	{
-	  clib_warning ("LRU delete '%s' FAILED!", ce->filename);
+	  clib_warning ("BUG: delete '%s' FAILED!", ce->filename);
 	}
       else if (hc->debug_level > 1)
-	clib_warning ("LRU delete '%s' ok", ce->filename);
+	clib_warning ("delete '%s' ok", ce->filename);
+    }
 
-      lru_remove (hc, ce);
-      hc->cache_size -= vec_len (ce->data);
-      hc->cache_evictions++;
-      vec_free (ce->filename);
-      vec_free (ce->data);
-      vec_free (ce->last_modified);
-
-      if (hc->debug_level > 1)
-	clib_warning ("pool put index %d", ce - hc->cache_pool);
-
-      pool_put (hc->cache_pool, ce);
-      if (hc->cache_size < hc->cache_limit)
-	break;
+  lru_remove (hc, ce);
+  hc->cache_size -= ce->data_len;
+  hc->cache_evictions++;
+  if (ce->is_mmap)
+    munmap (ce->data, ce->data_len);
+  else
+    vec_free (ce->data);
+  vec_free (ce->filename);
+  vec_free (ce->last_modified);
+  vec_free (ce->etag);
+
+  if (hc->debug_level > 1)
+    clib_warning ("pool put index %d", ce - hc->cache_pool);
+
+  pool_put (hc->cache_pool, ce);
+}
+
+static void
+hss_cache_do_evictions (hss_cache_t *hc)
+{
+  hss_cache_entry_t *ce;
+  u32 free_index;
+  int i;
+
+  /* probation segment first, then protected */
+  for (i = 0; i < HSS_CACHE_N_LRU; i++)
+    {
+      free_index = hc->lru[i].last_index;
+
+      while (free_index != ~0)
+	{
+	  /* pick the LRU */
+	  ce = pool_elt_at_index (hc->cache_pool, free_index);
+	  free_index = ce->prev_index;
+	  /* Which could be in use... */
+	  if (ce->inuse)
+	    {
+	      if (hc->debug_level > 1)
+		clib_warning ("index %d in use refcnt %d",
+			      ce - hc->cache_pool, ce->inuse);
+	      continue;
+	    }
+
+	  hss_cache_entry_free (hc, ce);
+	  if (hc->cache_size < hc->cache_limit)
+	    return;
+	}
     }
 }
 
+static clib_error_t *
+hss_cache_map_file (u8 *path, u64 size, u8 **data)
+{
+  void *addr;
+  int fd;
+
+  fd = open ((char *) path, O_RDONLY);
+  if (fd < 0)
+    return clib_error_return_unix (0, "open '%s'", path);
+
+  /* Pages are shared with page cache, populate them now so data path
+   * doesn't take page faults */
+  addr = mmap (0, size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+  close (fd);
+  if (addr == MAP_FAILED)
+    return clib_error_return_unix (0, "mmap '%s'", path);
+
+  *data = addr;
+  return 0;
+}
+
 u32
 hss_cache_add_and_attach (hss_cache_t *hc, u8 *path, u8 **data, u64 *data_len,
-			  u8 **last_modified)
+			  u8 **last_modified, u8 **etag)
 {
   BVT (clib_bihash_kv) kv;
   hss_cache_entry_t *ce;
   clib_error_t *error;
-  u8 *file_data;
+  u8 *file_data = 0, is_mmap = 0;
+  u64 file_len;
   u32 ce_index;
   struct stat dm;
 
@@ -290,12 +421,30 @@ hss_cache_add_and_attach (hss_cache_t *hc, u8 *path, u8 **data, u64 *data_len,
   if (hc->cache_size > hc->cache_limit)
     hss_cache_do_evictions (hc);
 
-  /* Read the file */
-  error = clib_file_contents ((char *) path, &file_data);
+  if (stat ((char *) path, &dm) < 0)
+    {
+      clib_warning ("Error reading '%s'", path);
+      hss_cache_unlock (hc);
+      return ~0;
+    }
+
+  /* Map or read the file */
+  if (hc->mmap_thresh && dm.st_size >= hc->mmap_thresh)
+    {
+      error = hss_cache_map_file (path, dm.st_size, &file_data);
+      file_len = dm.st_size;
+      is_mmap = 1;
+    }
+  else
+    {
+      error = clib_file_contents ((char *) path, &file_data);
+      file_len = vec_len (file_data);
+    }
   if (error)
     {
       clib_warning ("Error reading '%s'", path);
       clib_error_report (error);
+      hss_cache_unlock (hc);
       return ~0;
     }
 
@@ -303,20 +452,23 @@ hss_cache_add_and_attach (hss_cache_t *hc, u8 *path, u8 **data, u64 *data_len,
   pool_get_zero (hc->cache_pool, ce);
   ce->filename = vec_dup (path);
   ce->data = file_data;
-  if (stat ((char *) path, &dm) == 0)
-    {
-      ce->last_modified =
-	format (0, "%U GMT", format_clib_timebase_time, (f64) dm.st_mtime);
-    }
+  ce->data_len = file_len;
+  ce->is_mmap = is_mmap;
+  ce->mtime = dm.st_mtime;
+  ce->last_validated = vlib_time_now (vlib_get_main ());
+  ce->last_modified =
+    format (0, "%U GMT", format_clib_timebase_time, (f64) dm.st_mtime);
+  ce->etag = format (0, "\"%lx-%lx\"", (u64) dm.st_mtime, file_len);
 
   /* Attach cache entry without additional lock */
   ce->inuse++;
-  *data = file_data;
-  *data_len = vec_len (file_data);
+  *data = ce->data;
+  *data_len = ce->data_len;
   *last_modified = ce->last_modified;
-  lru_add (hc, ce, vlib_time_now (vlib_get_main ()));
+  *etag = ce->etag;
+  lru_add (hc, ce, HSS_CACHE_LRU_PROBATION, vlib_time_now (vlib_get_main ()));
 
-  hc->cache_size += vec_len (ce->data);
+  hc->cache_size += ce->data_len;
   ce_index = ce - hc->cache_pool;
 
   if (hc->debug_level > 1)
@@ -345,41 +497,26 @@ hss_cache_clear (hss_cache_t *hc)
 {
   u32 free_index, busy_items = 0;
   hss_cache_entry_t *ce;
-  BVT (clib_bihash_kv) kv;
+  int i;
 
   hss_cache_lock (hc);
 
-  /* Walk the LRU list to find active entries */
-  free_index = hc->last_index;
-  while (free_index != ~0)
+  /* Walk the LRU lists to find active entries */
+  for (i = 0; i < HSS_CACHE_N_LRU; i++)
     {
-      ce = pool_elt_at_index (hc->cache_pool, free_index);
-      free_index = ce->prev_index;
-      /* Which could be in use... */
-      if (ce->inuse)
-	{
-	  busy_items++;
-	  free_index = ce->next_index;
-	  continue;
-	}
-      kv.key = (u64) (ce->filename);
-      kv.value = ~0ULL;
-      if (BV (clib_bihash_add_del) (&hc->name_to_data, &kv, 0 /* is_add */) <
-	  0)
+      free_index = hc->lru[i].last_index;
+      while (free_index != ~0)
 	{
-	  clib_warning ("BUG: cache clear delete '%s' FAILED!", ce->filename);
+	  ce = pool_elt_at_index (hc->cache_pool, free_index);
+	  free_index = ce->prev_index;
+	  /* Which could be in use... */
+	  if (ce->inuse)
+	    {
+	      busy_items++;
+	      continue;
+	    }
+	  hss_cache_entry_free (hc, ce);
 	}
-
-      lru_remove (hc, ce);
-      hc->cache_size -= vec_len (ce->data);
-      hc->cache_evictions++;
-      vec_free (ce->filename);
-      vec_free (ce->data);
-      vec_free (ce->last_modified);
-      if (hc->debug_level > 1)
-	clib_warning ("pool put index %d", ce - hc->cache_pool);
-      pool_put (hc->cache_pool, ce);
-      free_index = hc->last_index;
     }
 
   hss_cache_unlock (hc);
@@ -388,16 +525,22 @@ hss_cache_clear (hss_cache_t *hc)
 }
 
 void
-hss_cache_init (hss_cache_t *hc, uword cache_size, u8 debug_level)
+hss_cache_init (hss_cache_t *hc, uword cache_size, uword mmap_thresh,
+		f64 revalidate_interval, u8 debug_level)
 {
+  int i;
+
   clib_spinlock_init (&hc->cache_lock);
 
   /* Init path-to-cache hash table */
   BV (clib_bihash_init) (&hc->name_to_data, "http cache", 128, 32 << 20);
 
   hc->cache_limit = cache_size;
+  hc->mmap_thresh = mmap_thresh;
+  hc->revalidate_interval = revalidate_interval;
   hc->debug_level = debug_level;
-  hc->first_index = hc->last_index = ~0;
+  for (i = 0; i < HSS_CACHE_N_LRU; i++)
+    hc->lru[i].first_index = hc->lru[i].last_index = ~0;
 }
 
 /** \brief format a file cache entry
@@ -411,11 +554,13 @@ format_hss_cache_entry (u8 *s, va_list *args)
   /* Header */
   if (ep == 0)
     {
-      s = format (s, "%40s%12s%20s", "File", "Size", "Age");
+      s = format (s, "%40s%12s%20s%12s", "File", "Size", "Age", "Segment");
       return s;
     }
-  s = format (s, "%40s%12lld%20.2f", ep->filename, vec_len (ep->data),
-	      now - ep->last_used);
+  s = format (s, "%40s%12lld%20.2f%12s", ep->filename, ep->data_len,
+	      now - ep->last_used,
+	      ep->lru_type == HSS_CACHE_LRU_PROTECTED ? "protected" :
+							"probation");
   return s;
 }
 
@@ -428,11 +573,17 @@ format_hss_cache (u8 *s, va_list *args)
   vlib_main_t *vm;
   u32 index;
   f64 now;
+  int i;
 
   if (verbose == 0)
     {
       s = format (s, "cache size %lld bytes, limit %lld bytes, evictions %lld",
 		  hc->cache_size, hc->cache_limit, hc->cache_evictions);
+      s = format (s, "\nhits %lld, misses %lld, protected %lld bytes, "
+		  "probation %lld bytes",
+		  hc->cache_hits, hc->cache_misses,
+		  hc->lru[HSS_CACHE_LRU_PROTECTED].size,
+		  hc->lru[HSS_CACHE_LRU_PROBATION].size);
       return s;
     }
 
@@ -441,11 +592,14 @@ format_hss_cache (u8 *s, va_list *args)
 
   s = format (s, "%U\n", format_hss_cache_entry, 0 /* header */, now);
 
-  for (index = hc->first_index; index != ~0;)
+  for (i = HSS_CACHE_N_LRU - 1; i >= 0; i--)
     {
-      ce = pool_elt_at_index (hc->cache_pool, index);
-      index = ce->next_index;
-      s = format (s, "%U\n", format_hss_cache_entry, ce, now);
+      for (index = hc->lru[i].first_index; index != ~0;)
+	{
+	  ce = pool_elt_at_index (hc->cache_pool, index);
+	  index = ce->next_index;
+	  s = format (s, "%U\n", format_hss_cache_entry, ce, now);
+	}
     }
 
   s = format (s, "%40s%12lld", "Total Size", hc->cache_size);
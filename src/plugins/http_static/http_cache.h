@@ -18,6 +18,18 @@
 
 #include <vppinfra/bihash_vec8_8.h>
 
+/** Segmented LRU lists, new entries start in probation segment and are
+ *  promoted to protected segment on first hit */
+typedef enum hss_cache_lru_type_
+{
+  HSS_CACHE_LRU_PROBATION,
+  HSS_CACHE_LRU_PROTECTED,
+  HSS_CACHE_N_LRU,
+} hss_cache_lru_type_t;
+
+/** Share of cache limit reserved for protected segment, in percent */
+#define HSS_CACHE_PROTECTED_PCT 80
+
 typedef struct hss_cache_entry_
 {
   /** Name of the file */
@@ -25,8 +37,16 @@ typedef struct hss_cache_entry_
   /** Last modified date, format:
    *  <day-name>, <day> <month> <year> <hour>:<minute>:<second> GMT  */
   u8 *last_modified;
-  /** Contents of the file, as a u8 * vector */
+  /** Entity tag, quoted string derived from mtime and size */
+  u8 *etag;
+  /** Contents of the file, u8 * vector or mmap-ed region */
   u8 *data;
+  /** Length of the file contents */
+  u64 data_len;
+  /** File modification time when the entry was created */
+  u64 mtime;
+  /** Last time the file was checked for changes */
+  f64 last_validated;
   /** Last time the cache entry was used */
   f64 last_used;
   /** Cache LRU links */
@@ -34,8 +54,24 @@ typedef struct hss_cache_entry_
   u32 prev_index;
   /** Reference count, so we don't recycle while referenced */
   int inuse;
+  /** LRU segment the entry belongs to */
+  u8 lru_type;
+  /** Data mapped from file instead of read to heap */
+  u8 is_mmap;
+  /** File changed, entry removed from lookup table and freed when no
+   *  longer in use */
+  u8 is_stale;
 } hss_cache_entry_t;
 
+typedef struct hss_cache_lru_
+{
+  /** LRU listheads */
+  u32 first_index;
+  u32 last_index;
+  /** Bytes held by entries on the list */
+  u64 size;
+} hss_cache_lru_t;
+
 typedef struct hss_cache_
 {
   /** Unified file data cache pool */
@@ -50,23 +86,32 @@ typedef struct hss_cache_
   u64 cache_size;
   /** Max cache size in bytes */
   u64 cache_limit;
+  /** Files of at least this size are mmap-ed, zero to disable */
+  u64 mmap_thresh;
+  /** Min time between checks of a mmap-ed file for changes */
+  f64 revalidate_interval;
   /** Number of cache evictions */
   u64 cache_evictions;
+  /** Number of lookups found in cache */
+  u64 cache_hits;
+  /** Number of lookups not found in cache */
+  u64 cache_misses;
 
-  /** Cache LRU listheads */
-  u32 first_index;
-  u32 last_index;
+  /** Segmented LRU lists */
+  hss_cache_lru_t lru[HSS_CACHE_N_LRU];
 
   u8 debug_level;
 } hss_cache_t;
 
 u32 hss_cache_lookup_and_attach (hss_cache_t *hc, u8 *path, u8 **data,
-				 u64 *data_len, u8 **last_modified);
+				 u64 *data_len, u8 **last_modified,
+				 u8 **etag);
 u32 hss_cache_add_and_attach (hss_cache_t *hc, u8 *path, u8 **data,
-			      u64 *data_len, u8 **last_modified);
+			      u64 *data_len, u8 **last_modified, u8 **etag);
 void hss_cache_detach_entry (hss_cache_t *hc, u32 ce_index);
 u32 hss_cache_clear (hss_cache_t *hc);
-void hss_cache_init (hss_cache_t *hc, uword cache_size, u8 debug_level);
+void hss_cache_init (hss_cache_t *hc, uword cache_size, uword mmap_thresh,
+		     f64 revalidate_interval, u8 debug_level);
 
 u8 *format_hss_cache (u8 *s, va_list *args);
 
@@ -26,6 +26,7 @@
 #define HSS_DEFAULT_MAX_AGE 600
 #define HSS_DEFAULT_MAX_BODY_SIZE     8192
 #define HSS_DEFAULT_KEEPALIVE_TIMEOUT 60
+#define HSS_DEFAULT_CACHE_REVALIDATE  1.0
 
 /** @file http_static.h
  * Static http server definitions
@@ -58,6 +59,8 @@ typedef struct
   http_headers_ctx_t resp_headers;
   /** Response header buffer */
   u8 *headers_buf;
+  /** Request headers */
+  http_header_table_t req_headers;
 } hss_session_t;
 
 typedef struct hss_session_handle_
@@ -160,6 +163,10 @@ typedef struct
   u8 enable_url_handlers;
   /** Max cache size before LRU occurs */
   u64 cache_size;
+  /** Files of at least this size are mmap-ed into cache */
+  u64 cache_mmap_thresh;
+  /** Min time between checks of mmap-ed files for changes (in seconds) */
+  f64 cache_revalidate;
   /** How long a response is considered fresh (in seconds) */
   u32 max_age;
   /** Maximum size of a request body (in bytes) **/
@@ -20,6 +20,7 @@
 #include <unistd.h>
 
 #include <http/http_content_types.h>
+#include <http/http_header_names.h>
 
 /** @file static_server.c
  *  Static http server, sufficient to serve .html / .css / .js content.
@@ -428,6 +429,69 @@ try_index_file (hss_main_t *hsm, hss_session_t *hs, u8 *path)
   return HTTP_STATUS_MOVED;
 }
 
+/** \brief Check if any entity tag in If-None-Match matches ours
+ */
+static int
+hss_etag_match (const http_token_t *if_none_match, u8 *etag)
+{
+  if (if_none_match->len == 1 && if_none_match->base[0] == '*')
+    return 1;
+
+  /* weak comparison, W/ prefix doesn't matter (RFC9110 section 13.1.2) */
+  return http_token_contains (if_none_match->base, if_none_match->len,
+			      (const char *) etag, vec_len (etag));
+}
+
+/** \brief Parse single byte range (RFC9110 section 14.1.2)
+ *
+ *  @return 0 if range is satisfiable, 1 if not, -1 if range should be
+ *  ignored (syntax not supported) and whole representation sent
+ */
+static int
+hss_parse_range (const http_token_t *range, u64 data_len, u64 *first,
+		 u64 *last)
+{
+  unformat_input_t input;
+  u64 a, b;
+  int rv = -1;
+
+  if (range->len <= 6 || memcmp (range->base, "bytes=", 6))
+    return -1;
+
+  /* multiple ranges not supported, send everything */
+  if (http_token_contains (range->base, range->len, http_token_lit (",")))
+    return -1;
+
+  unformat_init_string (&input, range->base + 6, range->len - 6);
+  if (unformat (&input, "%lu-%lu%_", &a, &b) &&
+      unformat_check_input (&input) == UNFORMAT_END_OF_INPUT)
+    {
+      if (b < a)
+	goto done;
+      rv = a >= data_len;
+      *first = a;
+      *last = clib_min (b, data_len - 1);
+    }
+  else if (unformat (&input, "%lu-%_", &a) &&
+	   unformat_check_input (&input) == UNFORMAT_END_OF_INPUT)
+    {
+      rv = a >= data_len;
+      *first = a;
+      *last = data_len - 1;
+    }
+  else if (unformat (&input, "-%lu%_", &b) &&
+	   unformat_check_input (&input) == UNFORMAT_END_OF_INPUT)
+    {
+      rv = b == 0 || data_len == 0;
+      *first = data_len - clib_min (b, data_len);
+      *last = data_len - 1;
+    }
+
+done:
+  unformat_free (&input);
+  return rv;
+}
+
 static int
 try_file_handler (hss_main_t *hsm, hss_session_t *hs, http_req_method_t rt,
 		  u8 *target)
@@ -436,7 +500,10 @@ try_file_handler (hss_main_t *hsm, hss_session_t *hs, http_req_method_t rt,
   u8 *path, *sanitized_path;
   u32 ce_index;
   http_content_type_t type;
-  u8 *last_modified;
+  u8 *last_modified, *etag, *content_range = 0;
+  const http_token_t *header;
+  u64 first, last;
+  int rv;
 
   /* Feature not enabled */
   if (!hsm->www_root)
@@ -461,8 +528,9 @@ try_file_handler (hss_main_t *hsm, hss_session_t *hs, http_req_method_t rt,
 
   hs->data_offset = 0;
 
-  ce_index = hss_cache_lookup_and_attach (&hsm->cache, path, &hs->data,
-					  &hs->data_len, &last_modified);
+  ce_index =
+    hss_cache_lookup_and_attach (&hsm->cache, path, &hs->data, &hs->data_len,
+				 &last_modified, &etag);
   if (ce_index == ~0)
     {
       if (!file_path_is_valid (path))
@@ -481,8 +549,9 @@ try_file_handler (hss_main_t *hsm, hss_session_t *hs, http_req_method_t rt,
 	  sc = try_index_file (hsm, hs, path);
 	  goto done;
 	}
-      ce_index = hss_cache_add_and_attach (&hsm->cache, path, &hs->data,
-					   &hs->data_len, &last_modified);
+      ce_index =
+	hss_cache_add_and_attach (&hsm->cache, path, &hs->data, &hs->data_len,
+				  &last_modified, &etag);
       if (ce_index == ~0)
 	{
 	  sc = HTTP_STATUS_INTERNAL_ERROR;
@@ -490,13 +559,46 @@ try_file_handler (hss_main_t *hsm, hss_session_t *hs, http_req_method_t rt,
 	}
     }
 
+  vec_free (hs->path);
   hs->path = path;
   hs->cache_pool_index = ce_index;
 
+  /* Conditional request, client has up to date copy */
+  header = http_get_header (
+    &hs->req_headers, http_header_name_token (HTTP_HEADER_IF_NONE_MATCH));
+  if (header && hss_etag_match (header, etag))
+    {
+      sc = HTTP_STATUS_NOT_MODIFIED;
+      hs->data_len = 0;
+    }
+  else if ((header = http_get_header (
+	      &hs->req_headers, http_header_name_token (HTTP_HEADER_RANGE))))
+    {
+      rv = hss_parse_range (header, hs->data_len, &first, &last);
+      if (rv == 0)
+	{
+	  sc = HTTP_STATUS_PARTIAL_CONTENT;
+	  content_range =
+	    format (0, "bytes %lu-%lu/%lu", first, last, hs->data_len);
+	  /* data is still owned by cache entry, just send part of it */
+	  hs->data += first;
+	  hs->data_len = last - first + 1;
+	}
+      else if (rv == 1)
+	{
+	  sc = HTTP_STATUS_RANGE_NOT_SATISFIABLE;
+	  content_range = format (0, "bytes */%lu", hs->data_len);
+	  hs->data_len = 0;
+	}
+    }
+
   /* Set following headers only for happy path:
    * Content-Type
    * Cache-Control max-age
    * Last-Modified
+   * ETag
+   * Accept-Ranges
+   * Content-Range
    */
   type = content_type_from_request (target);
   if (hss_add_header (hs, HTTP_HEADER_CONTENT_TYPE,
@@ -505,15 +607,23 @@ try_file_handler (hss_main_t *hsm, hss_session_t *hs, http_req_method_t rt,
 		      (const char *) hsm->max_age_formatted,
 		      vec_len (hsm->max_age_formatted)) ||
       hss_add_header (hs, HTTP_HEADER_LAST_MODIFIED,
-		      (const char *) last_modified, vec_len (last_modified)))
+		      (const char *) last_modified, vec_len (last_modified)) ||
+      hss_add_header (hs, HTTP_HEADER_ETAG, (const char *) etag,
+		      vec_len (etag)) ||
+      hss_add_header (hs, HTTP_HEADER_ACCEPT_RANGES,
+		      http_token_lit ("bytes")) ||
+      (content_range &&
+       hss_add_header (hs, HTTP_HEADER_CONTENT_RANGE,
+		       (const char *) content_range, vec_len (content_range))))
     {
       sc = HTTP_STATUS_INTERNAL_ERROR;
     }
+  vec_free (content_range);
 
 done:
   vec_free (sanitized_path);
   start_send_data (hs, sc);
-  if (!hs->data_len)
+  if (!hs->data_len && sc != HTTP_STATUS_NOT_MODIFIED)
     hss_session_disconnect_transport (hs);
 
   return 0;
@@ -550,8 +660,15 @@ hss_ts_rx_callback (session_t *ts)
     vec_free (hs->data);
   hs->data = 0;
   hs->data_len = 0;
+  /* previous response on persistent connection no longer needs it */
+  if (hs->cache_pool_index != ~0)
+    {
+      hss_cache_detach_entry (&hsm->cache, hs->cache_pool_index);
+      hs->cache_pool_index = ~0;
+    }
   http_init_headers_ctx (&hs->resp_headers, hs->headers_buf,
 			 vec_len (hs->headers_buf));
+  http_reset_header_table (&hs->req_headers);
 
   /* Read the http message header */
   rv = svm_fifo_dequeue (ts->rx_fifo, sizeof (msg), (u8 *) &msg);
@@ -597,6 +714,16 @@ hss_ts_rx_callback (session_t *ts)
 	}
     }
 
+  /* Read request headers */
+  if (msg.data.headers_len)
+    {
+      http_init_header_table_buf (&hs->req_headers, msg);
+      rv = svm_fifo_peek (ts->rx_fifo, msg.data.headers_offset,
+			  msg.data.headers_len, hs->req_headers.buf);
+      ASSERT (rv == msg.data.headers_len);
+      http_build_header_table (&hs->req_headers, msg);
+    }
+
   /* Read request body for POST requests */
   if (msg.data.body_len && msg.method_type == HTTP_REQ_POST)
     {
@@ -757,6 +884,7 @@ hss_ts_cleanup (session_t *s, session_cleanup_ntf_t ntf)
   hs->free_data = 0;
   vec_free (hs->headers_buf);
   vec_free (hs->path);
+  http_free_header_table (&hs->req_headers);
 
   hss_session_free (hs);
 }
@@ -907,7 +1035,8 @@ hss_create (vlib_main_t *vm)
     }
 
   if (hsm->www_root)
-    hss_cache_init (&hsm->cache, hsm->cache_size, hsm->debug_level);
+    hss_cache_init (&hsm->cache, hsm->cache_size, hsm->cache_mmap_thresh,
+		    hsm->cache_revalidate, hsm->debug_level);
 
   if (hsm->enable_url_handlers)
     hss_url_handlers_init (hsm);
@@ -934,6 +1063,7 @@ hss_create_command_fn (vlib_main_t *vm, unformat_input_t *input,
   hsm->private_segment_size = 0;
   hsm->fifo_size = 0;
   hsm->cache_size = 10 << 20;
+  hsm->cache_revalidate = HSS_DEFAULT_CACHE_REVALIDATE;
   hsm->max_age = HSS_DEFAULT_MAX_AGE;
   hsm->max_body_size = HSS_DEFAULT_MAX_BODY_SIZE;
   hsm->keepalive_timeout = HSS_DEFAULT_KEEPALIVE_TIMEOUT;
@@ -957,6 +1087,12 @@ hss_create_command_fn (vlib_main_t *vm, unformat_input_t *input,
       else if (unformat (line_input, "cache-size %U", unformat_memory_size,
 			 &hsm->cache_size))
 	;
+      else if (unformat (line_input, "cache-mmap-thresh %U",
+			 unformat_memory_size, &hsm->cache_mmap_thresh))
+	;
+      else if (unformat (line_input, "cache-revalidate %f",
+			 &hsm->cache_revalidate))
+	;
       else if (unformat (line_input, "uri %s", &hsm->uri))
 	;
       else if (unformat (line_input, "debug %d", &hsm->debug_level))
@@ -1031,7 +1167,8 @@ done:
  * @cliend
  * @cliexcmd{http static server www-root <path> [prealloc-fios <nn>]
  *   [private-segment-size <nnMG>] [fifo-size <nbytes>] [uri <uri>]
- *   [keepalive-timeout <nn>]}
+ *   [keepalive-timeout <nn>] [cache-size <nnMG>]
+ *   [cache-mmap-thresh <nnMG>] [cache-revalidate <secs>]}
 ?*/
 VLIB_CLI_COMMAND (hss_create_command, static) = {
   .path = "http static server",
@@ -1039,7 +1176,9 @@ VLIB_CLI_COMMAND (hss_create_command, static) = {
     "http static server www-root <path> [prealloc-fifos <nn>]\n"
     "[private-segment-size <nnMG>] [fifo-size <nbytes>] [max-age <nseconds>]\n"
     "[uri <uri>] [ptr-thresh <nn>] [url-handlers] [debug [nn]]\n"
-    "[keepalive-timeout <nn>] [max-body-size <nn>]\n",
+    "[keepalive-timeout <nn>] [max-body-size <nn>]\n"
+    "[cache-size <nnMG>] [cache-mmap-thresh <nnMG>]\n"
+    "[cache-revalidate <secs>]\n",
   .function = hss_create_command_fn,
 };
 
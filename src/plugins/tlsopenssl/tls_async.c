@@ -423,6 +423,8 @@ vpp_openssl_is_inflight (tls_ctx_t *ctx)
 
   for (i = SSL_ASYNC_EVT_INIT; i < SSL_ASYNC_EVT_MAX; i++)
     {
+      if (!oc->evt_alloc_flag[i])
+	continue;
       eidx = oc->evt_index[i];
       event = openssl_evt_get (eidx);
 
@@ -510,6 +512,15 @@ openssl_async_polling ()
     }
 }
 
+void
+openssl_async_polling_register (void (*polling) (void))
+{
+  openssl_async_t *om = &openssl_async_main;
+
+  om->polling = polling;
+  om->start_polling = 1;
+}
+
 void
 openssl_async_node_enable_disable (u8 is_en)
 {
@@ -519,7 +530,11 @@ openssl_async_node_enable_disable (u8 is_en)
 
   foreach_vlib_main ()
     {
-      if (have_workers && this_vlib_main->thread_index)
+      /* Poll on all threads that handle sessions. That is the workers, or
+       * only the main thread if there are no workers. Async jobs, and pka
+       * completions, are only resumed by this node, so without workers
+       * nothing would run them if main was skipped */
+      if (!have_workers || this_vlib_main->thread_index)
 	{
 	  vlib_node_set_state (this_vlib_main, tls_async_process_node.index,
 			       state);
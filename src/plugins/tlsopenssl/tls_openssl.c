@@ -29,6 +29,12 @@
 #include <tlsopenssl/tls_bios.h>
 #include <openssl/x509_vfy.h>
 #include <openssl/x509v3.h>
+#include <openssl/rand.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#else
+#include <openssl/hmac.h>
+#endif
 
 #define MAX_CRYPTO_LEN 64
 
@@ -73,16 +79,17 @@ openssl_ctx_free (tls_ctx_t * ctx)
 
       SSL_free (oc->ssl);
       vec_free (ctx->srv_hostname);
+      vec_free (oc->sess_cache_key);
       SSL_CTX_free (oc->client_ssl_ctx);
 
       if (openssl_main.async)
 	{
-	  openssl_evt_free (oc->evt_index[SSL_ASYNC_EVT_INIT],
-			    ctx->c_thread_index);
-	  openssl_evt_free (oc->evt_index[SSL_ASYNC_EVT_RD],
-			    ctx->c_thread_index);
-	  openssl_evt_free (oc->evt_index[SSL_ASYNC_EVT_WR],
-			    ctx->c_thread_index);
+	  int i;
+
+	  /* Events are only allocated once a connection goes async */
+	  for (i = SSL_ASYNC_EVT_INIT; i < SSL_ASYNC_EVT_MAX; i++)
+	    if (oc->evt_alloc_flag[i])
+	      openssl_evt_free (oc->evt_index[i], ctx->c_thread_index);
 	}
     }
 
@@ -120,6 +127,7 @@ openssl_ctx_attach (u32 thread_index, void *ctx_ptr)
   sh = (*oc)->ctx.tls_session_handle;
   BIO_set_data ((*oc)->rbio, uword_to_pointer (sh, void *));
   BIO_set_data ((*oc)->wbio, uword_to_pointer (sh, void *));
+  SSL_set_app_data ((*oc)->ssl, *oc);
 
   return ((*oc)->openssl_ctx_index);
 }
@@ -393,6 +401,10 @@ openssl_ctx_handshake_rx (tls_ctx_t *ctx, session_t *tls_session)
 	}
     }
   ctx->flags |= TLS_CONN_F_HS_DONE;
+  if (SSL_session_reused (oc->ssl))
+    openssl_main.resume_stats[ctx->c_thread_index].n_resumed_handshakes += 1;
+  else
+    openssl_main.resume_stats[ctx->c_thread_index].n_full_handshakes += 1;
   TLS_DBG (1, "Handshake for %u complete. TLS cipher is %s",
 	   oc->openssl_ctx_index, SSL_get_cipher (oc->ssl));
   return rv;
@@ -740,6 +752,256 @@ openssl_client_init_verify (SSL *ssl, const char *srv_hostname,
   return 0;
 }
 
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+typedef EVP_MAC_CTX openssl_ticket_hmac_ctx_t;
+
+static int
+openssl_ticket_key_init_hmac (EVP_MAC_CTX *hctx, openssl_ticket_key_t *key)
+{
+  OSSL_PARAM params[3];
+
+  params[0] = OSSL_PARAM_construct_octet_string (
+    OSSL_MAC_PARAM_KEY, key->hmac_key, sizeof (key->hmac_key));
+  params[1] =
+    OSSL_PARAM_construct_utf8_string (OSSL_MAC_PARAM_DIGEST, "sha256", 0);
+  params[2] = OSSL_PARAM_construct_end ();
+
+  return EVP_MAC_CTX_set_params (hctx, params) == 1 ? 0 : -1;
+}
+#else
+typedef HMAC_CTX openssl_ticket_hmac_ctx_t;
+
+static int
+openssl_ticket_key_init_hmac (HMAC_CTX *hctx, openssl_ticket_key_t *key)
+{
+  return HMAC_Init_ex (hctx, key->hmac_key, sizeof (key->hmac_key),
+		       EVP_sha256 (), NULL) == 1 ?
+	   0 :
+	   -1;
+}
+#endif
+
+static int
+openssl_ticket_key_generate (openssl_ticket_key_t *key)
+{
+  if (RAND_bytes (key->name, sizeof (key->name)) != 1 ||
+      RAND_bytes (key->aes_key, sizeof (key->aes_key)) != 1 ||
+      RAND_bytes (key->hmac_key, sizeof (key->hmac_key)) != 1)
+    return -1;
+  return 0;
+}
+
+/**
+ * Publish new set of ticket keys with a fresh current key. Older keys are
+ * shifted down and still accepted, but tickets issued with them are
+ * renewed. Keys are never modified after being published, workers may
+ * be reading the old set until they finish their current loop.
+ */
+static void
+openssl_ticket_key_rotate (void)
+{
+  openssl_main_t *om = &openssl_main;
+  openssl_ticket_keys_t *keys, *old;
+
+  keys = clib_mem_alloc (sizeof (*keys));
+  if (openssl_ticket_key_generate (&keys->keys[0]))
+    {
+      clib_warning ("failed to generate session ticket key");
+      clib_mem_free (keys);
+      return;
+    }
+
+  old = om->ticket_keys;
+  clib_memcpy_fast (&keys->keys[1], &old->keys[0],
+		    (OPENSSL_N_TICKET_KEYS - 1) * sizeof (keys->keys[0]));
+  __atomic_store_n (&om->ticket_keys, keys, __ATOMIC_RELEASE);
+  om->n_ticket_key_rotations += 1;
+
+  vlib_worker_wait_one_loop ();
+  clib_memset (old, 0, sizeof (*old));
+  clib_mem_free (old);
+}
+
+static int
+openssl_ticket_key_cb (SSL *ssl, unsigned char *key_name, unsigned char *iv,
+		       EVP_CIPHER_CTX *cctx, openssl_ticket_hmac_ctx_t *hctx,
+		       int enc)
+{
+  openssl_main_t *om = &openssl_main;
+  const EVP_CIPHER *cipher = EVP_aes_256_cbc ();
+  openssl_ticket_keys_t *keys;
+  openssl_ticket_key_t *key;
+  u32 i;
+
+  keys = __atomic_load_n (&om->ticket_keys, __ATOMIC_ACQUIRE);
+
+  if (enc)
+    {
+      key = &keys->keys[0];
+      clib_memcpy_fast (key_name, key->name, OPENSSL_TICKET_KEY_NAME_LEN);
+      if (RAND_bytes (iv, EVP_CIPHER_iv_length (cipher)) != 1)
+	return -1;
+      if (EVP_EncryptInit_ex (cctx, cipher, NULL, key->aes_key, iv) != 1 ||
+	  openssl_ticket_key_init_hmac (hctx, key))
+	return -1;
+      return 1;
+    }
+
+  for (i = 0; i < OPENSSL_N_TICKET_KEYS; i++)
+    if (!memcmp (key_name, keys->keys[i].name, OPENSSL_TICKET_KEY_NAME_LEN))
+      break;
+
+  /* Unknown or expired key, fall back to full handshake */
+  if (i == OPENSSL_N_TICKET_KEYS)
+    return 0;
+
+  key = &keys->keys[i];
+  if (EVP_DecryptInit_ex (cctx, cipher, NULL, key->aes_key, iv) != 1 ||
+      openssl_ticket_key_init_hmac (hctx, key))
+    return -1;
+
+  /* Ask for ticket renewal if not issued with current key. TLS 1.3
+   * clients use tickets only once, and without renewal no new ticket is
+   * sent after a resumed handshake, so always renew those */
+  return (i == 0 && SSL_version (ssl) < TLS1_3_VERSION) ? 1 : 2;
+}
+
+static void
+openssl_listen_ctx_init_resumption (SSL_CTX *ssl_ctx)
+{
+  openssl_main_t *om = &openssl_main;
+  static const u8 sid_ctx[] = "vpp-tls";
+
+  if (om->no_session_resumption)
+    {
+      SSL_CTX_set_session_cache_mode (ssl_ctx, SSL_SESS_CACHE_OFF);
+      SSL_CTX_set_options (ssl_ctx, SSL_OP_NO_TICKET);
+      SSL_CTX_set_num_tickets (ssl_ctx, 0);
+      return;
+    }
+
+  SSL_CTX_set_session_cache_mode (ssl_ctx, SSL_SESS_CACHE_SERVER);
+  SSL_CTX_set_session_id_context (ssl_ctx, sid_ctx, sizeof (sid_ctx) - 1);
+  SSL_CTX_sess_set_cache_size (ssl_ctx, om->session_cache_size);
+  if (om->session_timeout)
+    SSL_CTX_set_timeout (ssl_ctx, om->session_timeout);
+
+  /* Stateless tickets encrypted with keys shared by all workers */
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  SSL_CTX_set_tlsext_ticket_key_evp_cb (ssl_ctx, openssl_ticket_key_cb);
+#else
+  SSL_CTX_set_tlsext_ticket_key_cb (ssl_ctx, openssl_ticket_key_cb);
+#endif
+}
+
+static int
+openssl_client_sess_new_cb (SSL *ssl, SSL_SESSION *sess)
+{
+  openssl_main_t *om = &openssl_main;
+  openssl_ctx_t *oc = SSL_get_app_data (ssl);
+  u32 thread_index;
+  uword *p;
+
+  if (!oc)
+    return 0;
+
+  thread_index = oc->ctx.c_thread_index;
+  p = hash_get_mem (om->client_sessions[thread_index], oc->sess_cache_key);
+  if (p)
+    {
+      SSL_SESSION_free ((SSL_SESSION *) p[0]);
+      p[0] = pointer_to_uword (sess);
+    }
+  else if (hash_elts (om->client_sessions[thread_index]) >=
+	   om->session_cache_size)
+    return 0;
+  else
+    /* Hash keeps pointer to key, so it needs its own copy */
+    hash_set_mem (om->client_sessions[thread_index],
+		  vec_dup (oc->sess_cache_key), sess);
+
+  /* Keep the reference */
+  return 1;
+}
+
+static void
+openssl_client_sess_del (uword *h, u8 *cache_key)
+{
+  hash_pair_t *hp;
+  u8 *key;
+
+  hp = hash_get_pair_mem (h, cache_key);
+  if (!hp)
+    return;
+  key = uword_to_pointer (hp->key, u8 *);
+  SSL_SESSION_free (uword_to_pointer (hp->value[0], SSL_SESSION *));
+  hash_unset_mem (h, cache_key);
+  vec_free (key);
+}
+
+/**
+ * Client session cache key. Sessions are only valid for the server they
+ * were negotiated with, so the key has the full connection tuple, the app
+ * worker and the server name.
+ */
+static u8 *
+openssl_client_sess_cache_key (openssl_ctx_t *oc, transport_connection_t *tc)
+{
+  openssl_client_sess_key_t k = {};
+  u8 *key = 0;
+
+  k.app_wrk_index = oc->ctx.parent_app_wrk_index;
+  k.fib_index = tc->fib_index;
+  k.rmt_ip = tc->rmt_ip;
+  k.rmt_port = tc->rmt_port;
+  k.is_ip4 = tc->is_ip4;
+  k.tls_type = oc->ctx.tls_type;
+
+  vec_add (key, (u8 *) &k, sizeof (k));
+  vec_append (key, oc->ctx.srv_hostname);
+  return key;
+}
+
+/**
+ * Resume session if we have one for the peer. Sessions are cached per
+ * thread and keyed by app worker, peer endpoint and server name.
+ */
+static void
+openssl_client_init_resumption (openssl_ctx_t *oc)
+{
+  openssl_main_t *om = &openssl_main;
+  u32 thread_index = oc->ctx.c_thread_index;
+  transport_connection_t *tc;
+  SSL_SESSION *sess;
+  session_t *ts;
+  uword *p;
+
+  ts = session_get_from_handle (oc->ctx.tls_session_handle);
+  tc = session_get_transport (ts);
+  oc->sess_cache_key = openssl_client_sess_cache_key (oc, tc);
+
+  SSL_CTX_set_session_cache_mode (oc->client_ssl_ctx,
+				  SSL_SESS_CACHE_CLIENT |
+				    SSL_SESS_CACHE_NO_INTERNAL_STORE);
+  SSL_CTX_sess_set_new_cb (oc->client_ssl_ctx, openssl_client_sess_new_cb);
+  SSL_set_app_data (oc->ssl, oc);
+
+  p = hash_get_mem (om->client_sessions[thread_index], oc->sess_cache_key);
+  if (!p)
+    return;
+
+  sess = (SSL_SESSION *) p[0];
+  if (SSL_SESSION_is_resumable (sess) &&
+      time (0) < SSL_SESSION_get_time (sess) + SSL_SESSION_get_timeout (sess))
+    {
+      SSL_set_session (oc->ssl, sess);
+      return;
+    }
+
+  openssl_client_sess_del (om->client_sessions[thread_index],
+			   oc->sess_cache_key);
+}
+
 static int
 openssl_ctx_init_client (tls_ctx_t * ctx)
 {
@@ -787,6 +1049,9 @@ openssl_ctx_init_client (tls_ctx_t * ctx)
       return -1;
     }
 
+  if (!om->no_session_resumption)
+    openssl_client_init_resumption (oc);
+
   if (ctx->tls_type == TRANSPORT_PROTO_TLS)
     {
       oc->rbio = BIO_new_tls (ctx->tls_session_handle);
@@ -897,6 +1162,7 @@ openssl_start_listen (tls_ctx_t * lctx)
 #endif
   SSL_CTX_set_options (ssl_ctx, flags);
   SSL_CTX_set_ecdh_auto (ssl_ctx, 1);
+  openssl_listen_ctx_init_resumption (ssl_ctx);
 
   rv = SSL_CTX_set_cipher_list (ssl_ctx, (const char *) om->ciphers);
   if (rv != 1)
@@ -984,6 +1250,9 @@ openssl_start_listen (tls_ctx_t * lctx)
       clib_warning ("unable to parse pkey");
       goto err;
     }
+  /* offload private key operations to the pka thread pool */
+  if (openssl_pka_is_enabled ())
+    pkey = openssl_pka_wrap_key (pkey);
   rv = SSL_CTX_use_PrivateKey (ssl_ctx, pkey);
   if (rv != 1)
     {
@@ -1245,10 +1514,13 @@ tls_openssl_init (vlib_main_t * vm)
   vec_validate (om->ctx_pool, num_threads - 1);
   vec_validate (om->rx_bufs, num_threads - 1);
   vec_validate (om->tx_bufs, num_threads - 1);
+  vec_validate (om->client_sessions, num_threads - 1);
+  vec_validate (om->resume_stats, num_threads - 1);
   for (i = 0; i < num_threads; i++)
     {
       vec_validate (om->rx_bufs[i], DTLSO_MAX_DGRAM);
       vec_validate (om->tx_bufs[i], DTLSO_MAX_DGRAM);
+      om->client_sessions[i] = hash_create_vec (0, sizeof (u8), sizeof (uword));
     }
   tls_register_engine (&openssl_engine, CRYPTO_ENGINE_OPENSSL);
 
@@ -1258,6 +1530,14 @@ tls_openssl_init (vlib_main_t * vm)
   tls_openssl_set_ciphers
     ("ALL:!ADH:!LOW:!EXP:!MD5:!RC4-SHA:!DES-CBC3-SHA:@STRENGTH");
 
+  /* session resumption defaults */
+  om->session_cache_size = OPENSSL_SESSION_CACHE_SIZE_DEFAULT;
+  om->ticket_key_lifetime = OPENSSL_TICKET_KEY_LIFETIME_DEFAULT;
+  om->ticket_keys = clib_mem_alloc (sizeof (*om->ticket_keys));
+  for (i = 0; i < OPENSSL_N_TICKET_KEYS; i++)
+    if (openssl_ticket_key_generate (&om->ticket_keys->keys[i]))
+      return clib_error_return (0, "failed to generate ticket keys");
+
   if (tls_init_ca_chain ())
     {
       clib_warning ("failed to initialize TLS CA chain");
@@ -1280,6 +1560,7 @@ tls_openssl_set_command_fn (vlib_main_t * vm, unformat_input_t * input,
   char *engine_alg = NULL;
   char *ciphers = NULL;
   u8 engine_name_set = 0;
+  u32 pka_threads = 0;
   int i, async = 0;
 
   /* By present, it is not allowed to configure engine again after running */
@@ -1309,11 +1590,30 @@ tls_openssl_set_command_fn (vlib_main_t * vm, unformat_input_t * input,
 	{
 	  tls_openssl_set_ciphers (ciphers);
 	}
+      else if (unformat (input, "pka-threads %u", &pka_threads))
+	;
       else
 	return clib_error_return (0, "failed: unknown input `%U'",
 				  format_unformat_error, input);
     }
 
+  if (pka_threads)
+    {
+      session_enable_disable_args_t args = { .is_en = 1,
+					     .rt_engine_type =
+					       RT_BACKEND_ENGINE_RULE_TABLE };
+      if (engine_name_set)
+	return clib_error_return (0, "pka-threads and engine are mutually "
+				  "exclusive");
+      vnet_session_enable_disable (vm, &args);
+      if (openssl_pka_enable (pka_threads))
+	return clib_error_return (0, "failed to enable pka offload");
+      vlib_cli_output (vm, "Offloading private key operations to %u threads",
+		       pka_threads);
+      om->async = 1;
+      return 0;
+    }
+
   /* reset parameters if engine is not configured */
   if (!engine_name_set)
     {
@@ -1345,10 +1645,13 @@ tls_openssl_set_command_fn (vlib_main_t * vm, unformat_input_t * input,
 VLIB_CLI_COMMAND (tls_openssl_set_command, static) =
 {
   .path = "tls openssl set",
-  .short_help = "tls openssl set [engine <engine name>] [alg [algorithm] [async]",
+  .short_help = "tls openssl set [engine <engine name>] [alg [algorithm] "
+		"[async] [pka-threads <n>]",
   .function = tls_openssl_set_command_fn,
 };
 
+extern vlib_node_registration_t openssl_ticket_key_process_node;
+
 static clib_error_t *
 tls_openssl_set_tls_fn (vlib_main_t *vm, unformat_input_t *input,
 			vlib_cli_command_t *cmd)
@@ -1373,6 +1676,19 @@ tls_openssl_set_tls_fn (vlib_main_t *vm, unformat_input_t *input,
 	{
 	  clib_warning ("Using TLS max-pipelines of %d", om->max_pipelines);
 	}
+      else if (unformat (input, "session-cache-size %u",
+			 &om->session_cache_size))
+	;
+      else if (unformat (input, "session-timeout %u", &om->session_timeout))
+	;
+      else if (unformat (input, "ticket-key-lifetime %f",
+			 &om->ticket_key_lifetime))
+	vlib_process_signal_event (vm, openssl_ticket_key_process_node.index,
+				   0, 0);
+      else if (unformat (input, "no-session-resumption"))
+	om->no_session_resumption = 1;
+      else if (unformat (input, "session-resumption"))
+	om->no_session_resumption = 0;
       else
 	return clib_error_return (0, "failed: unknown input `%U'",
 				  format_unformat_error, input);
@@ -1384,10 +1700,79 @@ tls_openssl_set_tls_fn (vlib_main_t *vm, unformat_input_t *input,
 VLIB_CLI_COMMAND (tls_openssl_set_tls, static) = {
   .path = "tls openssl set-tls",
   .short_help = "tls openssl set-tls [record-size <size>] [record-split-size "
-		"<size>] [max-pipelines <size>]",
+		"<size>] [max-pipelines <size>] [session-cache-size <n>] "
+		"[session-timeout <secs>] [ticket-key-lifetime <secs>] "
+		"[[no-]session-resumption]",
   .function = tls_openssl_set_tls_fn,
 };
 
+static clib_error_t *
+show_tls_openssl_resumption_fn (vlib_main_t *vm, unformat_input_t *input,
+				vlib_cli_command_t *cmd)
+{
+  openssl_main_t *om = &openssl_main;
+  openssl_resume_stats_t *rs;
+  u32 i;
+
+  vlib_cli_output (vm, "session resumption: %s",
+		   om->no_session_resumption ? "disabled" : "enabled");
+  vlib_cli_output (vm, "session cache size: %u timeout: %u%s",
+		   om->session_cache_size, om->session_timeout,
+		   om->session_timeout ? "s" : " (default)");
+  vlib_cli_output (vm, "ticket key lifetime: %.2fs rotations: %u",
+		   om->ticket_key_lifetime, om->n_ticket_key_rotations);
+
+  vec_foreach_index (i, om->resume_stats)
+    {
+      rs = &om->resume_stats[i];
+      vlib_cli_output (vm,
+		       "thread %u: full handshakes %lu resumed %lu "
+		       "client sessions cached %u",
+		       i, rs->n_full_handshakes, rs->n_resumed_handshakes,
+		       hash_elts (om->client_sessions[i]));
+    }
+
+  return 0;
+}
+
+VLIB_CLI_COMMAND (show_tls_openssl_resumption, static) = {
+  .path = "show tls openssl resumption",
+  .short_help = "show tls openssl resumption",
+  .function = show_tls_openssl_resumption_fn,
+};
+
+static uword
+openssl_ticket_key_process (vlib_main_t *vm, vlib_node_runtime_t *rt,
+			    vlib_frame_t *f)
+{
+  openssl_main_t *om = &openssl_main;
+  uword event_type, *event_data = 0;
+
+  while (1)
+    {
+      if (om->ticket_key_lifetime > 0)
+	vlib_process_wait_for_event_or_clock (vm, om->ticket_key_lifetime);
+      else
+	vlib_process_wait_for_event (vm);
+
+      event_type = vlib_process_get_events (vm, &event_data);
+
+      /* Timer expired, otherwise lifetime changed and timer is reset */
+      if (event_type == ~0)
+	openssl_ticket_key_rotate ();
+
+      vec_reset_length (event_data);
+    }
+
+  return 0;
+}
+
+VLIB_REGISTER_NODE (openssl_ticket_key_process_node) = {
+  .function = openssl_ticket_key_process,
+  .type = VLIB_NODE_TYPE_PROCESS,
+  .name = "tls-openssl-ticket-key-process",
+};
+
 VLIB_PLUGIN_REGISTER () = {
     .version = VPP_BUILD_VER,
     .description = "Transport Layer Security (TLS) Engine, OpenSSL Based",
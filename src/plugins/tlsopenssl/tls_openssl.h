@@ -44,6 +44,7 @@ typedef struct tls_ctx_openssl_
   u32 total_async_write;
   BIO *rbio;
   BIO *wbio;
+  u8 *sess_cache_key;		/**< client session cache key */
 } openssl_ctx_t;
 
 typedef struct tls_listen_ctx_opensl_
@@ -55,6 +56,40 @@ typedef struct tls_listen_ctx_opensl_
   EVP_PKEY *pkey;
 } openssl_listen_ctx_t;
 
+#define OPENSSL_TICKET_KEY_NAME_LEN	    16
+#define OPENSSL_N_TICKET_KEYS		    3
+#define OPENSSL_TICKET_KEY_LIFETIME_DEFAULT 3600.0
+#define OPENSSL_SESSION_CACHE_SIZE_DEFAULT  (20 << 10)
+
+typedef struct openssl_ticket_key_
+{
+  u8 name[OPENSSL_TICKET_KEY_NAME_LEN];
+  u8 aes_key[32];
+  u8 hmac_key[32];
+} openssl_ticket_key_t;
+
+/** Ticket keys, current first. Immutable once published */
+typedef struct openssl_ticket_keys_
+{
+  openssl_ticket_key_t keys[OPENSSL_N_TICKET_KEYS];
+} openssl_ticket_keys_t;
+
+typedef struct openssl_client_sess_key_
+{
+  u32 app_wrk_index;
+  u32 fib_index;
+  ip46_address_t rmt_ip;
+  u16 rmt_port;
+  u8 is_ip4;
+  u8 tls_type;
+} openssl_client_sess_key_t;
+
+typedef struct openssl_resume_stats_
+{
+  u64 n_full_handshakes;
+  u64 n_resumed_handshakes;
+} openssl_resume_stats_t;
+
 typedef struct openssl_main_
 {
   openssl_ctx_t ***ctx_pool;
@@ -73,6 +108,24 @@ typedef struct openssl_main_
   u32 record_size;
   u32 record_split_size;
   u32 max_pipelines;
+
+  /*
+   * Session resumption
+   */
+
+  /** Session tickets keys, shared by all listeners. Only the main thread
+   *  replaces them, workers load the pointer once per ticket, so no
+   *  locking is needed */
+  openssl_ticket_keys_t *ticket_keys;
+  u32 n_ticket_key_rotations;
+  f64 ticket_key_lifetime;
+  u32 session_cache_size;
+  u32 session_timeout;
+  u8 no_session_resumption;
+
+  /** Per thread client sessions, to resume connections to same peers */
+  uword **client_sessions;
+  openssl_resume_stats_t *resume_stats;
 } openssl_main_t;
 
 typedef int openssl_resume_handler (void *event, void *session);
@@ -88,6 +141,11 @@ int openssl_evt_free (int event_idx, u8 thread_index);
 void openssl_polling_start (ENGINE * engine);
 int openssl_engine_register (char *engine, char *alg, int async);
 void openssl_async_node_enable_disable (u8 is_en);
+void openssl_async_polling_register (void (*polling) (void));
+int openssl_pka_enable (u32 n_threads);
+u8 openssl_pka_is_enabled (void);
+EVP_PKEY *openssl_pka_wrap_key (EVP_PKEY *pkey);
+void openssl_pka_polling (void);
 clib_error_t *tls_openssl_api_init (vlib_main_t * vm);
 int tls_openssl_set_ciphers (char *ciphers);
 int vpp_openssl_is_inflight (tls_ctx_t * ctx);
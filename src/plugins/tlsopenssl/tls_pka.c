@@ -0,0 +1,736 @@
+/*
+ * Copyright (c) 2026 Cisco and/or its affiliates.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Private key operation offload
+ *
+ * Listener keys are wrapped with rsa/ec methods that, when called from an
+ * openssl async job, hand the private key operation to a pool of non
+ * dataplane threads and pause the job. Once an operation completes, the
+ * pool thread adds the request to the owning worker's lock protected list
+ * of completions. Pool threads are not vlib threads, so they do not use
+ * any vlib or session layer messaging. The worker drains the list from
+ * the tls-async-process node, which polls while offload is enabled, and
+ * invokes the job's wait ctx callback. That queues the ssl async event
+ * which is subsequently resumed by the same node, like for hardware
+ * engines.
+ */
+
+#include <vnet/session/session.h>
+#include <tlsopenssl/tls_openssl.h>
+#include <openssl/async.h>
+#include <openssl/rsa.h>
+#include <openssl/ec.h>
+#include <pthread.h>
+
+#if defined(HAVE_OPENSSL_ASYNC) && OPENSSL_VERSION_NUMBER >= 0x30000000L
+#define OPENSSL_PKA_SUPPORTED 1
+#endif
+
+typedef enum openssl_pka_op_
+{
+  OPENSSL_PKA_OP_RSA_PRIV_ENC,
+  OPENSSL_PKA_OP_RSA_PRIV_DEC,
+  OPENSSL_PKA_OP_ECDSA_SIGN,
+} openssl_pka_op_t;
+
+typedef struct openssl_pka_req_
+{
+  struct openssl_pka_req_ *next;
+  openssl_pka_op_t op;
+  u32 thread_index;
+  ASYNC_WAIT_CTX *wait_ctx;
+  u64 submit_time;
+  union
+  {
+    RSA *rsa;
+    EC_KEY *ec_key;
+  };
+  int padding;
+  int type;
+  u32 in_len;
+  unsigned int out_len;
+  int rv;
+  /** Set by the owning worker only, once the pool thread is done */
+  u8 done;
+  /** Set by the owning worker if the ssl is freed while op in flight */
+  u8 cancelled;
+  /** Input followed by output. Not using ssl owned buffers as those
+   *  could be freed while a pool thread still works on the request */
+  u8 data[0];
+} openssl_pka_req_t;
+
+typedef struct openssl_pka_worker_
+{
+  CLIB_CACHE_LINE_ALIGN_MARK (cacheline0);
+
+  /** Completed requests, pushed by pool threads */
+  clib_spinlock_t done_lock;
+  openssl_pka_req_t *done_head;
+  openssl_pka_req_t *done_tail;
+
+  /*
+   * Worker only data
+   */
+  u32 n_inflight;
+  u64 last_poll;
+
+  /** Stats */
+  u64 n_offloaded;
+  u64 n_completed;
+  u64 n_cancelled;
+  u64 n_sync;
+  u64 op_clocks;
+  u64 op_clocks_max;
+  u64 n_loops;
+  u64 loop_clocks;
+  u64 loop_clocks_max;
+} openssl_pka_worker_t;
+
+typedef struct openssl_pka_main_
+{
+  /** Pending requests, consumed by pool threads */
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  openssl_pka_req_t *head;
+  openssl_pka_req_t *tail;
+  u32 queue_depth;
+  u32 max_queue_depth;
+
+  pthread_t *threads;
+  u64 *thread_n_ops;
+  openssl_pka_worker_t *workers;
+
+  RSA_METHOD *rsa_meth;
+  EC_KEY_METHOD *ec_meth;
+  int (*rsa_priv_enc) (int flen, const unsigned char *from, unsigned char *to,
+		       RSA *rsa, int padding);
+  int (*rsa_priv_dec) (int flen, const unsigned char *from, unsigned char *to,
+		       RSA *rsa, int padding);
+  int (*ec_sign) (int type, const unsigned char *dgst, int dlen,
+		  unsigned char *sig, unsigned int *siglen,
+		  const BIGNUM *kinv, const BIGNUM *r, EC_KEY *eckey);
+
+  u8 is_enabled;
+} openssl_pka_main_t;
+
+static openssl_pka_main_t openssl_pka_main;
+
+#ifdef OPENSSL_PKA_SUPPORTED
+
+static inline openssl_pka_worker_t *
+openssl_pka_worker_get (u32 thread_index)
+{
+  return vec_elt_at_index (openssl_pka_main.workers, thread_index);
+}
+
+static openssl_pka_req_t *
+openssl_pka_req_alloc (openssl_pka_op_t op, u32 in_len, u32 out_len)
+{
+  openssl_pka_req_t *req;
+
+  req = clib_mem_alloc (sizeof (*req) + in_len + out_len);
+  clib_memset (req, 0, sizeof (*req));
+  req->op = op;
+  req->in_len = in_len;
+  req->out_len = out_len;
+  return req;
+}
+
+static void
+openssl_pka_req_free (openssl_pka_req_t *req)
+{
+  if (req->op == OPENSSL_PKA_OP_ECDSA_SIGN)
+    EC_KEY_free (req->ec_key);
+  else
+    RSA_free (req->rsa);
+  clib_mem_free (req);
+}
+
+static inline u8 *
+openssl_pka_req_in (openssl_pka_req_t *req)
+{
+  return req->data;
+}
+
+static inline u8 *
+openssl_pka_req_out (openssl_pka_req_t *req)
+{
+  return req->data + req->in_len;
+}
+
+/*
+ * Pool threads
+ */
+
+/**
+ * Hand completed request back to owning worker. Called from pool threads,
+ * the worker picks it up on its next tls-async-process poll
+ */
+static void
+openssl_pka_complete (openssl_pka_req_t *req)
+{
+  openssl_pka_worker_t *wrk;
+
+  wrk = openssl_pka_worker_get (req->thread_index);
+  req->next = 0;
+
+  clib_spinlock_lock (&wrk->done_lock);
+  if (wrk->done_tail)
+    wrk->done_tail->next = req;
+  else
+    wrk->done_head = req;
+  wrk->done_tail = req;
+  clib_spinlock_unlock (&wrk->done_lock);
+}
+
+static void
+openssl_pka_do_op (openssl_pka_req_t *req)
+{
+  openssl_pka_main_t *pm = &openssl_pka_main;
+  u8 *in = openssl_pka_req_in (req), *out = openssl_pka_req_out (req);
+
+  switch (req->op)
+    {
+    case OPENSSL_PKA_OP_RSA_PRIV_ENC:
+      req->rv =
+	pm->rsa_priv_enc (req->in_len, in, out, req->rsa, req->padding);
+      break;
+    case OPENSSL_PKA_OP_RSA_PRIV_DEC:
+      req->rv =
+	pm->rsa_priv_dec (req->in_len, in, out, req->rsa, req->padding);
+      break;
+    case OPENSSL_PKA_OP_ECDSA_SIGN:
+      req->rv = pm->ec_sign (req->type, in, req->in_len, out, &req->out_len,
+			     NULL, NULL, req->ec_key);
+      break;
+    default:
+      req->rv = -1;
+      break;
+    }
+}
+
+static void *
+openssl_pka_thread_fn (void *arg)
+{
+  openssl_pka_main_t *pm = &openssl_pka_main;
+  uword index = pointer_to_uword (arg);
+  openssl_pka_req_t *req;
+
+  while (1)
+    {
+      pthread_mutex_lock (&pm->lock);
+      while (!pm->head)
+	pthread_cond_wait (&pm->cond, &pm->lock);
+      req = pm->head;
+      pm->head = req->next;
+      if (!pm->head)
+	pm->tail = 0;
+      pm->queue_depth -= 1;
+      pthread_mutex_unlock (&pm->lock);
+
+      openssl_pka_do_op (req);
+      pm->thread_n_ops[index] += 1;
+      openssl_pka_complete (req);
+    }
+
+  return 0;
+}
+
+static void
+openssl_pka_submit (openssl_pka_req_t *req)
+{
+  openssl_pka_main_t *pm = &openssl_pka_main;
+
+  req->next = 0;
+  pthread_mutex_lock (&pm->lock);
+  if (pm->tail)
+    pm->tail->next = req;
+  else
+    pm->head = req;
+  pm->tail = req;
+  pm->queue_depth += 1;
+  pm->max_queue_depth = clib_max (pm->max_queue_depth, pm->queue_depth);
+  pthread_cond_signal (&pm->cond);
+  pthread_mutex_unlock (&pm->lock);
+}
+
+/*
+ * Workers
+ */
+
+static void
+openssl_pka_drain (openssl_pka_worker_t *wrk)
+{
+  openssl_pka_req_t *req, *next;
+  ASYNC_callback_fn cb;
+  u64 now, clocks;
+  void *cb_arg;
+
+  /* Unlocked peek, a completion missed here is seen on the next poll */
+  if (!__atomic_load_n (&wrk->done_head, __ATOMIC_RELAXED))
+    return;
+
+  clib_spinlock_lock (&wrk->done_lock);
+  req = wrk->done_head;
+  wrk->done_head = wrk->done_tail = 0;
+  clib_spinlock_unlock (&wrk->done_lock);
+
+  now = clib_cpu_time_now ();
+
+  while (req)
+    {
+      next = req->next;
+      clocks = now - req->submit_time;
+      wrk->op_clocks += clocks;
+      wrk->op_clocks_max = clib_max (wrk->op_clocks_max, clocks);
+      wrk->n_completed += 1;
+      wrk->n_inflight -= 1;
+
+      if (req->cancelled)
+	{
+	  wrk->n_cancelled += 1;
+	  openssl_pka_req_free (req);
+	}
+      else
+	{
+	  /* Job resumes once the async event is handled. The request is
+	   * freed by the paused job, or on wait ctx cleanup */
+	  req->done = 1;
+	  if (ASYNC_WAIT_CTX_get_callback (req->wait_ctx, &cb, &cb_arg) && cb)
+	    cb (cb_arg);
+	}
+      req = next;
+    }
+}
+
+void
+openssl_pka_polling (void)
+{
+  openssl_pka_worker_t *wrk;
+  u64 now, clocks;
+
+  wrk = openssl_pka_worker_get (vlib_get_thread_index ());
+  now = clib_cpu_time_now ();
+
+  /* Track dispatch loop latency while ops are in flight */
+  if (wrk->last_poll)
+    {
+      clocks = now - wrk->last_poll;
+      wrk->loop_clocks += clocks;
+      wrk->loop_clocks_max = clib_max (wrk->loop_clocks_max, clocks);
+      wrk->n_loops += 1;
+    }
+
+  openssl_pka_drain (wrk);
+
+  wrk->last_poll = wrk->n_inflight ? now : 0;
+}
+
+static void
+openssl_pka_wait_ctx_cleanup (ASYNC_WAIT_CTX *ctx, const void *key,
+			      OSSL_ASYNC_FD fd, void *custom_data)
+{
+  openssl_pka_req_t *req = (openssl_pka_req_t *) custom_data;
+
+  /* Ssl freed with job paused. If pool thread still owns the request,
+   * let the worker free it on completion */
+  if (req->done)
+    openssl_pka_req_free (req);
+  else
+    req->cancelled = 1;
+}
+
+/**
+ * Offload request and pause current async job until it completes
+ */
+static int
+openssl_pka_submit_and_wait (openssl_pka_req_t *req, ASYNC_JOB *job)
+{
+  openssl_pka_main_t *pm = &openssl_pka_main;
+  openssl_pka_worker_t *wrk;
+  ASYNC_WAIT_CTX *wait_ctx;
+  int rv;
+
+  wait_ctx = ASYNC_get_wait_ctx (job);
+  req->wait_ctx = wait_ctx;
+  req->thread_index = vlib_get_thread_index ();
+  req->submit_time = clib_cpu_time_now ();
+
+  /* No real fd, only used to be notified if the wait ctx is freed */
+  if (!ASYNC_WAIT_CTX_set_wait_fd (wait_ctx, pm, OSSL_BAD_ASYNC_FD, req,
+				   openssl_pka_wait_ctx_cleanup))
+    return -2;
+
+  wrk = openssl_pka_worker_get (req->thread_index);
+  wrk->n_offloaded += 1;
+  wrk->n_inflight += 1;
+  /* Start measuring loop latency */
+  if (!wrk->last_poll)
+    wrk->last_poll = req->submit_time;
+
+  openssl_pka_submit (req);
+
+  /* Job might be resumed before the op completes, e.g., on new rx data */
+  while (!req->done)
+    ASYNC_pause_job ();
+
+  ASYNC_WAIT_CTX_clear_fd (wait_ctx, pm);
+  rv = req->rv;
+
+  return rv;
+}
+
+static int
+openssl_pka_rsa_op (openssl_pka_op_t op, int flen, const unsigned char *from,
+		    unsigned char *to, RSA *rsa, int padding)
+{
+  openssl_pka_main_t *pm = &openssl_pka_main;
+  openssl_pka_req_t *req;
+  ASYNC_JOB *job;
+  int rv, len;
+
+  job = ASYNC_get_current_job ();
+  len = RSA_size (rsa);
+  if (!job || flen < 0 || flen > len)
+    goto sync;
+
+  req = openssl_pka_req_alloc (op, flen, len);
+  clib_memcpy_fast (openssl_pka_req_in (req), from, flen);
+  req->rsa = rsa;
+  req->padding = padding;
+  RSA_up_ref (rsa);
+
+  rv = openssl_pka_submit_and_wait (req, job);
+  if (rv == -2)
+    {
+      openssl_pka_req_free (req);
+      goto sync;
+    }
+  if (rv > 0)
+    clib_memcpy_fast (to, openssl_pka_req_out (req), rv);
+  openssl_pka_req_free (req);
+
+  return rv;
+
+sync:
+
+  openssl_pka_worker_get (vlib_get_thread_index ())->n_sync += 1;
+  if (op == OPENSSL_PKA_OP_RSA_PRIV_ENC)
+    return pm->rsa_priv_enc (flen, from, to, rsa, padding);
+  return pm->rsa_priv_dec (flen, from, to, rsa, padding);
+}
+
+static int
+openssl_pka_rsa_priv_enc (int flen, const unsigned char *from,
+			  unsigned char *to, RSA *rsa, int padding)
+{
+  return openssl_pka_rsa_op (OPENSSL_PKA_OP_RSA_PRIV_ENC, flen, from, to, rsa,
+			     padding);
+}
+
+static int
+openssl_pka_rsa_priv_dec (int flen, const unsigned char *from,
+			  unsigned char *to, RSA *rsa, int padding)
+{
+  return openssl_pka_rsa_op (OPENSSL_PKA_OP_RSA_PRIV_DEC, flen, from, to, rsa,
+			     padding);
+}
+
+static int
+openssl_pka_ec_sign (int type, const unsigned char *dgst, int dlen,
+		     unsigned char *sig, unsigned int *siglen,
+		     const BIGNUM *kinv, const BIGNUM *r, EC_KEY *eckey)
+{
+  openssl_pka_main_t *pm = &openssl_pka_main;
+  openssl_pka_req_t *req;
+  ASYNC_JOB *job;
+  int rv;
+
+  job = ASYNC_get_current_job ();
+  if (!job || kinv || r || dlen < 0)
+    goto sync;
+
+  req = openssl_pka_req_alloc (OPENSSL_PKA_OP_ECDSA_SIGN, dlen,
+			       ECDSA_size (eckey));
+  clib_memcpy_fast (openssl_pka_req_in (req), dgst, dlen);
+  req->ec_key = eckey;
+  req->type = type;
+  EC_KEY_up_ref (eckey);
+
+  rv = openssl_pka_submit_and_wait (req, job);
+  if (rv == -2)
+    {
+      openssl_pka_req_free (req);
+      goto sync;
+    }
+  if (rv == 1)
+    {
+      clib_memcpy_fast (sig, openssl_pka_req_out (req), req->out_len);
+      *siglen = req->out_len;
+    }
+  openssl_pka_req_free (req);
+
+  return rv;
+
+sync:
+
+  openssl_pka_worker_get (vlib_get_thread_index ())->n_sync += 1;
+  return pm->ec_sign (type, dgst, dlen, sig, siglen, kinv, r, eckey);
+}
+
+EVP_PKEY *
+openssl_pka_wrap_key (EVP_PKEY *pkey)
+{
+  openssl_pka_main_t *pm = &openssl_pka_main;
+  EVP_PKEY *wrapped;
+  EC_KEY *ec_key;
+  RSA *rsa;
+
+  /* Keys with non-default methods are handled by openssl's legacy code
+   * paths, which call into the methods below */
+  switch (EVP_PKEY_base_id (pkey))
+    {
+    case EVP_PKEY_RSA:
+      rsa = EVP_PKEY_get1_RSA (pkey);
+      if (!rsa)
+	return pkey;
+      wrapped = EVP_PKEY_new ();
+      if (!wrapped || !RSA_set_method (rsa, pm->rsa_meth) ||
+	  !EVP_PKEY_assign_RSA (wrapped, rsa))
+	{
+	  RSA_free (rsa);
+	  EVP_PKEY_free (wrapped);
+	  return pkey;
+	}
+      break;
+    case EVP_PKEY_EC:
+      ec_key = EVP_PKEY_get1_EC_KEY (pkey);
+      if (!ec_key)
+	return pkey;
+      wrapped = EVP_PKEY_new ();
+      if (!wrapped || !EC_KEY_set_method (ec_key, pm->ec_meth) ||
+	  !EVP_PKEY_assign_EC_KEY (wrapped, ec_key))
+	{
+	  EC_KEY_free (ec_key);
+	  EVP_PKEY_free (wrapped);
+	  return pkey;
+	}
+      break;
+    default:
+      /* Not offloaded, e.g., ed25519 */
+      return pkey;
+    }
+
+  EVP_PKEY_free (pkey);
+  return wrapped;
+}
+
+static int
+openssl_pka_methods_init (void)
+{
+  openssl_pka_main_t *pm = &openssl_pka_main;
+  int (*sign_setup) (EC_KEY *eckey, BN_CTX *ctx_in, BIGNUM **kinvp,
+		     BIGNUM **rp);
+  ECDSA_SIG *(*sign_sig) (const unsigned char *dgst, int dgst_len,
+			  const BIGNUM *in_kinv, const BIGNUM *in_r,
+			  EC_KEY *eckey);
+
+  pm->rsa_priv_enc = RSA_meth_get_priv_enc (RSA_PKCS1_OpenSSL ());
+  pm->rsa_priv_dec = RSA_meth_get_priv_dec (RSA_PKCS1_OpenSSL ());
+  pm->rsa_meth = RSA_meth_dup (RSA_PKCS1_OpenSSL ());
+  if (!pm->rsa_meth)
+    return -1;
+  RSA_meth_set1_name (pm->rsa_meth, "vpp tls pka rsa");
+  RSA_meth_set_priv_enc (pm->rsa_meth, openssl_pka_rsa_priv_enc);
+  RSA_meth_set_priv_dec (pm->rsa_meth, openssl_pka_rsa_priv_dec);
+
+  pm->ec_meth = EC_KEY_METHOD_new (EC_KEY_OpenSSL ());
+  if (!pm->ec_meth)
+    return -1;
+  EC_KEY_METHOD_get_sign (pm->ec_meth, &pm->ec_sign, &sign_setup, &sign_sig);
+  EC_KEY_METHOD_set_sign (pm->ec_meth, openssl_pka_ec_sign, sign_setup,
+			  sign_sig);
+
+  return 0;
+}
+
+int
+openssl_pka_enable (u32 n_threads)
+{
+  vlib_thread_main_t *vtm = vlib_get_thread_main ();
+  openssl_pka_main_t *pm = &openssl_pka_main;
+  openssl_pka_worker_t *wrk;
+  int pthread_setname_np (pthread_t __target_thread, const char *__name);
+  u8 *name = 0;
+  uword i;
+  int rv;
+
+  if (pm->is_enabled)
+    return -1;
+
+  if (openssl_pka_methods_init ())
+    {
+      clib_warning ("failed to init pka methods");
+      return -1;
+    }
+
+  vec_validate (pm->workers, vtm->n_threads);
+  vec_foreach (wrk, pm->workers)
+    clib_spinlock_init (&wrk->done_lock);
+
+  pthread_mutex_init (&pm->lock, NULL);
+  pthread_cond_init (&pm->cond, NULL);
+
+  vec_validate (pm->threads, n_threads - 1);
+  vec_validate (pm->thread_n_ops, n_threads - 1);
+  for (i = 0; i < n_threads; i++)
+    {
+      rv = pthread_create (&pm->threads[i], NULL, openssl_pka_thread_fn,
+			   uword_to_pointer (i, void *));
+      if (rv)
+	{
+	  clib_unix_warning ("pthread_create returned %d", rv);
+	  return -1;
+	}
+      name = format (name, "vpp_tls_pka%u%c", i, 0);
+      pthread_setname_np (pm->threads[i], (char *) name);
+      vec_reset_length (name);
+    }
+  vec_free (name);
+
+  openssl_async_polling_register (openssl_pka_polling);
+  openssl_async_node_enable_disable (1);
+  pm->is_enabled = 1;
+
+  return 0;
+}
+
+#else /* OPENSSL_PKA_SUPPORTED */
+
+EVP_PKEY *
+openssl_pka_wrap_key (EVP_PKEY *pkey)
+{
+  return pkey;
+}
+
+int
+openssl_pka_enable (u32 n_threads)
+{
+  clib_warning ("pka offload requires openssl 3.0 or newer with async");
+  return -1;
+}
+
+#endif /* OPENSSL_PKA_SUPPORTED */
+
+u8
+openssl_pka_is_enabled (void)
+{
+  return openssl_pka_main.is_enabled;
+}
+
+static clib_error_t *
+show_tls_openssl_pka_fn (vlib_main_t *vm, unformat_input_t *input,
+			 vlib_cli_command_t *cmd)
+{
+  openssl_pka_main_t *pm = &openssl_pka_main;
+  f64 us_per_clock = vm->clib_time.seconds_per_clock * 1e6;
+  openssl_pka_worker_t *wrk;
+  u32 i;
+
+  if (!pm->is_enabled)
+    {
+      vlib_cli_output (vm, "pka offload not enabled");
+      return 0;
+    }
+
+  vlib_cli_output (vm, "pool threads: %u queue depth: %u max: %u",
+		   vec_len (pm->threads), pm->queue_depth,
+		   pm->max_queue_depth);
+  vec_foreach_index (i, pm->thread_n_ops)
+    vlib_cli_output (vm, "  pool thread %u: ops %lu", i, pm->thread_n_ops[i]);
+
+  vec_foreach_index (i, pm->workers)
+    {
+      wrk = &pm->workers[i];
+      if (!wrk->n_offloaded && !wrk->n_sync)
+	continue;
+      vlib_cli_output (vm,
+		       "thread %u: offloaded %lu completed %lu cancelled %lu "
+		       "sync %lu inflight %u",
+		       i, wrk->n_offloaded, wrk->n_completed, wrk->n_cancelled,
+		       wrk->n_sync, wrk->n_inflight);
+      vlib_cli_output (vm, "  op latency avg %.2fus max %.2fus",
+		       wrk->n_completed ? (f64) wrk->op_clocks /
+					    wrk->n_completed * us_per_clock :
+					  0,
+		       wrk->op_clocks_max * us_per_clock);
+      vlib_cli_output (vm, "  loop latency avg %.2fus max %.2fus loops %lu",
+		       wrk->n_loops ? (f64) wrk->loop_clocks / wrk->n_loops *
+					us_per_clock :
+				      0,
+		       wrk->loop_clocks_max * us_per_clock, wrk->n_loops);
+    }
+
+  return 0;
+}
+
+VLIB_CLI_COMMAND (show_tls_openssl_pka, static) = {
+  .path = "show tls openssl pka",
+  .short_help = "show tls openssl pka",
+  .function = show_tls_openssl_pka_fn,
+};
+
+static void
+openssl_pka_clear_stats_rpc (void *arg)
+{
+  openssl_pka_worker_t *wrk;
+
+  wrk = vec_elt_at_index (openssl_pka_main.workers, vlib_get_thread_index ());
+  wrk->n_offloaded = wrk->n_completed = wrk->n_cancelled = wrk->n_sync = 0;
+  wrk->op_clocks = wrk->op_clocks_max = 0;
+  wrk->n_loops = wrk->loop_clocks = wrk->loop_clocks_max = 0;
+}
+
+static clib_error_t *
+clear_tls_openssl_pka_fn (vlib_main_t *vm, unformat_input_t *input,
+			  vlib_cli_command_t *cmd)
+{
+  openssl_pka_main_t *pm = &openssl_pka_main;
+  u32 i;
+
+  if (!pm->is_enabled)
+    return 0;
+
+  pm->max_queue_depth = pm->queue_depth;
+  vec_foreach_index (i, pm->workers)
+    session_send_rpc_evt_to_thread (i, openssl_pka_clear_stats_rpc, 0);
+
+  return 0;
+}
+
+VLIB_CLI_COMMAND (clear_tls_openssl_pka, static) = {
+  .path = "clear tls openssl pka",
+  .short_help = "clear tls openssl pka",
+  .function = clear_tls_openssl_pka_fn,
+};
+
+/*
+ * fd.io coding-style-patch-verification: ON
+ *
+ * Local Variables:
+ * eval: (c-set-style "gnu")
+ * End:
+ */
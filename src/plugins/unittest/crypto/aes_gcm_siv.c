@@ -0,0 +1,100 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright(c) 2025 Cisco Systems, Inc.
+ */
+
+/* Test vectors published in RFC 8452, Appendix C */
+
+#include <vppinfra/clib.h>
+#include <vnet/crypto/crypto.h>
+#include <unittest/crypto/crypto.h>
+
+UNITTEST_REGISTER_CRYPTO_TEST (aes_gcm_siv128_tc0) = {
+  .name = "128-GCM-SIV RFC8452 TC0",
+  .alg = VNET_CRYPTO_ALG_AES_128_GCM_SIV,
+  .key = TEST_DATA_STR (
+    "\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .iv = TEST_DATA_STR ("\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .tag = TEST_DATA_STR (
+    "\xdc\x20\xe2\xd8\x3f\x25\x70\x5b\xb4\x9e\x43\x9e\xca\x56\xde\x25"),
+};
+
+UNITTEST_REGISTER_CRYPTO_TEST (aes_gcm_siv128_tc1) = {
+  .name = "128-GCM-SIV RFC8452 TC1",
+  .alg = VNET_CRYPTO_ALG_AES_128_GCM_SIV,
+  .key = TEST_DATA_STR (
+    "\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .iv = TEST_DATA_STR ("\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .plaintext = TEST_DATA_STR ("\x01\x00\x00\x00\x00\x00\x00\x00"),
+  .ciphertext = TEST_DATA_STR ("\xb5\xd8\x39\x33\x0a\xc7\xb7\x86"),
+  .tag = TEST_DATA_STR (
+    "\x57\x87\x82\xff\xf6\x01\x3b\x81\x5b\x28\x7c\x22\x49\x3a\x36\x4c"),
+};
+
+UNITTEST_REGISTER_CRYPTO_TEST (aes_gcm_siv128_tc2) = {
+  .name = "128-GCM-SIV RFC8452 TC2",
+  .alg = VNET_CRYPTO_ALG_AES_128_GCM_SIV,
+  .key = TEST_DATA_STR (
+    "\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .iv = TEST_DATA_STR ("\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .aad = TEST_DATA_STR ("\x01"),
+  .plaintext = TEST_DATA_STR ("\x02\x00\x00\x00\x00\x00\x00\x00"),
+  .ciphertext = TEST_DATA_STR ("\x1e\x6d\xab\xa3\x56\x69\xf4\x27"),
+  .tag = TEST_DATA_STR (
+    "\x3b\x0a\x1a\x25\x60\x96\x9c\xdf\x79\x0d\x99\x75\x9a\xbd\x15\x08"),
+};
+
+UNITTEST_REGISTER_CRYPTO_TEST (aes_gcm_siv128_tc3) = {
+  .name = "128-GCM-SIV RFC8452 TC3",
+  .alg = VNET_CRYPTO_ALG_AES_128_GCM_SIV,
+  .key = TEST_DATA_STR (
+    "\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .iv = TEST_DATA_STR ("\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .aad = TEST_DATA_STR ("\x01"),
+  .plaintext = TEST_DATA_STR (
+    "\x02\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .ciphertext = TEST_DATA_STR (
+    "\x62\x00\x48\xef\x3c\x1e\x73\xe5\x7e\x02\xbb\x85\x62\xc4\x16\xa3"
+    "\x19\xe7\x3e\x4c\xaa\xc8\xe9\x6a\x1e\xcb\x29\x33\x14\x5a\x1d\x71"),
+  .tag = TEST_DATA_STR (
+    "\xe6\xaf\x6a\x7f\x87\x28\x7d\xa0\x59\xa7\x16\x84\xed\x34\x98\xe1"),
+};
+
+UNITTEST_REGISTER_CRYPTO_TEST (aes_gcm_siv256_tc0) = {
+  .name = "256-GCM-SIV RFC8452 TC0",
+  .alg = VNET_CRYPTO_ALG_AES_256_GCM_SIV,
+  .key = TEST_DATA_STR (
+    "\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .iv = TEST_DATA_STR ("\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .tag = TEST_DATA_STR (
+    "\x07\xf5\xf4\x16\x9b\xbf\x55\xa8\x40\x0c\xd4\x7e\xa6\xfd\x40\x0f"),
+};
+
+UNITTEST_REGISTER_CRYPTO_TEST (aes_gcm_siv256_tc1) = {
+  .name = "256-GCM-SIV RFC8452 TC1",
+  .alg = VNET_CRYPTO_ALG_AES_256_GCM_SIV,
+  .key = TEST_DATA_STR (
+    "\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .iv = TEST_DATA_STR ("\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .plaintext = TEST_DATA_STR ("\x01\x00\x00\x00\x00\x00\x00\x00"),
+  .ciphertext = TEST_DATA_STR ("\xc2\xef\x32\x8e\x5c\x71\xc8\x3b"),
+  .tag = TEST_DATA_STR (
+    "\x84\x31\x22\x13\x0f\x73\x64\xb7\x61\xe0\xb9\x74\x27\xe3\xdf\x28"),
+};
+
+UNITTEST_REGISTER_CRYPTO_TEST (aes_gcm_siv256_tc2) = {
+  .name = "256-GCM-SIV RFC8452 TC2",
+  .alg = VNET_CRYPTO_ALG_AES_256_GCM_SIV,
+  .key = TEST_DATA_STR (
+    "\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .iv = TEST_DATA_STR ("\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .plaintext = TEST_DATA_STR (
+    "\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"),
+  .ciphertext = TEST_DATA_STR (
+    "\x9a\xab\x2a\xeb\x3f\xaa\x0a\x34\xae\xa8\xe2\xb1"),
+  .tag = TEST_DATA_STR (
+    "\x8c\xa5\x0d\xa9\xae\x65\x59\xe4\x8f\xd1\x0f\x6e\x5c\x9c\xa1\x7e"),
+};
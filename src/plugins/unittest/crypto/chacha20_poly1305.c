@@ -144,3 +144,32 @@ UNITTEST_REGISTER_CRYPTO_TEST (chacha20_poly1305_tc3) = {
   .ciphertext = TEST_DATA (tc3_ciphertext),
 };
 
+
+UNITTEST_REGISTER_CRYPTO_TEST (chacha20_poly1305_tc1_chain) = {
+  .name = "CHACHA20-POLY1305 TC1 [chained]",
+  .alg = VNET_CRYPTO_ALG_CHACHA20_POLY1305,
+  .key = TEST_DATA (tc1_key),
+  .iv = TEST_DATA (tc1_iv),
+  .aad = TEST_DATA (tc1_aad),
+  .tag = TEST_DATA (tc1_tag),
+  .is_chained = 1,
+  .pt_chunks = {
+    TEST_DATA_CHUNK (tc1_plaintext, 0, 40),
+    TEST_DATA_CHUNK (tc1_plaintext, 40, 40),
+    TEST_DATA_CHUNK (tc1_plaintext, 80, 34),
+  },
+  .ct_chunks = {
+    TEST_DATA_CHUNK (tc1_ciphertext, 0, 40),
+    TEST_DATA_CHUNK (tc1_ciphertext, 40, 40),
+    TEST_DATA_CHUNK (tc1_ciphertext, 80, 34),
+  },
+};
+
+UNITTEST_REGISTER_CRYPTO_TEST (chacha20_poly1305_inc_1024) = {
+  .name = "CHACHA20-POLY1305 (incr 1024 B)",
+  .alg = VNET_CRYPTO_ALG_CHACHA20_POLY1305,
+  .plaintext_incremental = 1024,
+  .key.length = 32,
+  .aad.length = 12,
+  .tag.length = 16,
+};
@@ -50,10 +50,15 @@ typedef struct
 
   /* perf */
   vnet_crypto_alg_t alg;
+  u32 engine_index;
   u32 warmup_rounds;
   u32 rounds;
-  u32 buffer_size;
+  u32 *buffer_sizes;
+  u32 *batch_sizes;
   u32 n_buffers;
+  u32 n_chunks;
+  u8 handler_types;
+  u8 csv;
 
   unittest_crypto_test_registration_t *test_registrations;
 } crypto_test_main_t;
@@ -647,13 +647,6 @@ test_crypto_static (vlib_main_t * vm, crypto_test_main_t * tm,
   return 0;
 }
 
-static u32
-test_crypto_get_key_sz (vnet_crypto_alg_t alg)
-{
-  vnet_crypto_main_t *cm = &crypto_main;
-  return cm->algs[alg].key_length;
-}
-
 static clib_error_t *
 test_crypto (vlib_main_t * vm, crypto_test_main_t * tm)
 {
@@ -809,168 +802,493 @@ done:
   return err;
 }
 
-static clib_error_t *
-test_crypto_perf (vlib_main_t * vm, crypto_test_main_t * tm)
+static const struct
+{
+  vnet_crypto_alg_t crypto_alg;
+  vnet_crypto_alg_t integ_alg;
+} test_crypto_perf_key_algs[VNET_CRYPTO_N_ALGS] = {
+#define _(n, s, k, t, a)                                                      \
+  [VNET_CRYPTO_ALG_##n##_TAG##t##_AAD##a] = {                                 \
+    .crypto_alg = VNET_CRYPTO_ALG_##n,                                        \
+  },
+  foreach_crypto_aead_async_alg
+#undef _
+#define _(c, h, s, k, d)                                                      \
+  [VNET_CRYPTO_ALG_##c##_##h##_TAG##d] = {                                    \
+    .crypto_alg = VNET_CRYPTO_ALG_##c,                                        \
+    .integ_alg = VNET_CRYPTO_ALG_HMAC_##h,                                    \
+  },
+  foreach_crypto_link_async_alg
+#undef _
+};
+
+static char *test_crypto_perf_handler_type_names[] = {
+#define _(n, s) [VNET_CRYPTO_HANDLER_TYPE_##n] = s,
+  foreach_crypto_handler_type
+#undef _
+};
+
+typedef struct
+{
+  u32 *buffer_indices;
+  u32 n_buffers;
+  u32 buffer_size;
+  u32 key_index;
+  u32 *key_indices;
+  u8 n_op_types;
+  vnet_crypto_op_id_t op_ids[2];
+  vnet_crypto_op_t *ops[2];
+  vnet_crypto_op_t *chained_ops[2];
+  vnet_crypto_op_t **op_ptrs[2];
+  vnet_crypto_op_t **chained_op_ptrs[2];
+  vnet_crypto_op_chunk_t *chunks;
+} test_crypto_perf_ctx_t;
+
+static u32
+test_crypto_perf_key_add (vlib_main_t *vm, vnet_crypto_alg_t alg,
+			  u32 **key_indices)
 {
   vnet_crypto_main_t *cm = &crypto_main;
-  clib_error_t *err = 0;
-  u32 n_buffers, n_alloc = 0, warmup_rounds, rounds;
-  u32 *buffer_indices = 0;
-  vnet_crypto_op_t *ops1 = 0, *ops2 = 0, *op1, *op2;
-  vnet_crypto_alg_data_t *ad = cm->algs + tm->alg;
-  vnet_crypto_key_index_t key_index = ~0;
+  vnet_crypto_alg_data_t *ad = cm->algs + alg;
+  vnet_crypto_alg_t crypto_alg = test_crypto_perf_key_algs[alg].crypto_alg;
+  vnet_crypto_alg_t integ_alg = test_crypto_perf_key_algs[alg].integ_alg;
+  u32 ki, crypto_ki, integ_ki;
   u8 key[64];
-  int buffer_size = vlib_buffer_get_default_data_size (vm);
-  u64 seed = clib_cpu_time_now ();
-  u64 t0[5], t1[5], t2[5], n_bytes = 0;
-  int i, j;
 
-  if (tm->buffer_size > buffer_size)
-    return clib_error_return (0, "buffer size must be <= %u", buffer_size);
+  /* async aead algs use key of the base alg */
+  if (crypto_alg && !integ_alg)
+    return test_crypto_perf_key_add (vm, crypto_alg, key_indices);
 
-  rounds = tm->rounds ? tm->rounds : 100;
-  n_buffers = tm->n_buffers ? tm->n_buffers : 256;
-  buffer_size = tm->buffer_size ? tm->buffer_size : 2048;
-  warmup_rounds = tm->warmup_rounds ? tm->warmup_rounds : 100;
+  if (integ_alg)
+    {
+      crypto_ki = test_crypto_perf_key_add (vm, crypto_alg, key_indices);
+      integ_ki = test_crypto_perf_key_add (vm, integ_alg, key_indices);
+      if (crypto_ki == ~0 || integ_ki == ~0)
+	return ~0;
+      ki = vnet_crypto_key_add_linked (vm, crypto_ki, integ_ki);
+    }
+  else
+    {
+      for (int i = 0; i < sizeof (key); i++)
+	key[i] = i;
+      ki = vnet_crypto_key_add (vm, alg, key,
+				ad->variable_key_length ? 32 : ad->key_length);
+    }
 
-  if (buffer_size > vlib_buffer_get_default_data_size (vm))
-    return clib_error_return (0, "buffer size too big");
+  if (ki != ~0)
+    vec_add1 (key_indices[0], ki);
+  return ki;
+}
 
-  vec_validate_aligned (buffer_indices, n_buffers - 1, CLIB_CACHE_LINE_BYTES);
-  vec_validate_aligned (ops1, n_buffers - 1, CLIB_CACHE_LINE_BYTES);
-  vec_validate_aligned (ops2, n_buffers - 1, CLIB_CACHE_LINE_BYTES);
+static void
+test_crypto_perf_ctx_free (vlib_main_t *vm, test_crypto_perf_ctx_t *ctx)
+{
+  if (ctx->n_buffers)
+    vlib_buffer_free (vm, ctx->buffer_indices, ctx->n_buffers);
 
-  n_alloc = vlib_buffer_alloc (vm, buffer_indices, n_buffers);
-  if (n_alloc != n_buffers)
+  /* linked keys are deleted before the keys they refer to */
+  for (int i = vec_len (ctx->key_indices) - 1; i >= 0; i--)
+    vnet_crypto_key_del (vm, ctx->key_indices[i]);
+
+  for (int i = 0; i < ARRAY_LEN (ctx->ops); i++)
     {
-      if (n_alloc)
-	vlib_buffer_free (vm, buffer_indices, n_alloc);
-      err = clib_error_return (0, "buffer alloc failure");
-      goto done;
+      vec_free (ctx->ops[i]);
+      vec_free (ctx->chained_ops[i]);
+      vec_free (ctx->op_ptrs[i]);
+      vec_free (ctx->chained_op_ptrs[i]);
     }
+  vec_free (ctx->chunks);
+  vec_free (ctx->key_indices);
+  vec_free (ctx->buffer_indices);
+  clib_memset (ctx, 0, sizeof (*ctx));
+}
 
-  vlib_cli_output (vm, "%U: n_buffers %u buffer-size %u rounds %u "
-		   "warmup-rounds %u",
-		   format_vnet_crypto_alg, tm->alg, n_buffers, buffer_size,
-		   rounds, warmup_rounds);
-  vlib_cli_output (vm, "   cpu-freq %.2f GHz",
-		   (f64) vm->clib_time.clocks_per_second * 1e-9);
+static clib_error_t *
+test_crypto_perf_ctx_init (vlib_main_t *vm, crypto_test_main_t *tm,
+			   test_crypto_perf_ctx_t *ctx, vnet_crypto_alg_t alg,
+			   u32 n_buffers, u32 buffer_size)
+{
+  vnet_crypto_main_t *cm = &crypto_main;
+  vnet_crypto_alg_data_t *ad = cm->algs + alg;
+  u32 n_chunks = clib_max (1, clib_min (tm->n_chunks, buffer_size));
+  u64 seed = clib_cpu_time_now ();
+  u32 n_alloc;
 
-  vnet_crypto_op_type_t ot = 0;
+  for (int i = 0; i < VNET_CRYPTO_OP_N_TYPES; i++)
+    if (ad->op_by_type[i])
+      ctx->op_ids[ctx->n_op_types++] = ad->op_by_type[i];
 
-  for (i = 0; i < sizeof (key); i++)
-    key[i] = i;
+  if (ad->op_by_type[VNET_CRYPTO_OP_TYPE_HASH] == 0)
+    {
+      ctx->key_index = test_crypto_perf_key_add (vm, alg, &ctx->key_indices);
+      if (ctx->key_index == ~0)
+	return clib_error_return (0, "failed to add %U key",
+				  format_vnet_crypto_alg, alg);
+    }
+  else
+    ctx->key_index = ~0;
 
-  key_index = vnet_crypto_key_add (vm, tm->alg, key,
-				   test_crypto_get_key_sz (tm->alg));
+  vec_validate_aligned (ctx->buffer_indices, n_buffers - 1,
+			CLIB_CACHE_LINE_BYTES);
+  n_alloc = vlib_buffer_alloc (vm, ctx->buffer_indices, n_buffers);
+  if (n_alloc != n_buffers)
+    {
+      if (n_alloc)
+	vlib_buffer_free (vm, ctx->buffer_indices, n_alloc);
+      return clib_error_return (0, "buffer alloc failure");
+    }
+  ctx->n_buffers = n_buffers;
+  ctx->buffer_size = buffer_size;
 
-  for (i = 0; i < VNET_CRYPTO_OP_N_TYPES; i++)
+  for (int t = 0; t < ctx->n_op_types; t++)
     {
-      vnet_crypto_op_id_t id = ad->op_by_type[i];
-      if (id == 0)
-	continue;
-      ot = i;
-      break;
+      vec_validate_aligned (ctx->ops[t], n_buffers - 1, CLIB_CACHE_LINE_BYTES);
+      vec_validate_aligned (ctx->chained_ops[t], n_buffers - 1,
+			    CLIB_CACHE_LINE_BYTES);
+      vec_validate (ctx->op_ptrs[t], n_buffers - 1);
+      vec_validate (ctx->chained_op_ptrs[t], n_buffers - 1);
     }
 
-  for (i = 0; i < n_buffers; i++)
+  for (u32 i = 0; i < n_buffers; i++)
     {
-      vlib_buffer_t *b = vlib_get_buffer (vm, buffer_indices[i]);
-      op1 = ops1 + i;
-      op2 = ops2 + i;
+      vlib_buffer_t *b = vlib_get_buffer (vm, ctx->buffer_indices[i]);
+
+      b->current_data = 0;
+      b->current_length = buffer_size;
 
-      switch (ot)
+      for (int j = -VLIB_BUFFER_PRE_DATA_SIZE; j < (int) buffer_size; j += 8)
+	*(u64 *) (b->data + j) = 1 + random_u64 (&seed);
+
+      for (int t = 0; t < ctx->n_op_types; t++)
 	{
-	case VNET_CRYPTO_OP_TYPE_ENCRYPT:
-	case VNET_CRYPTO_OP_TYPE_DECRYPT:
-	  vnet_crypto_op_init (op1,
-			       ad->op_by_type[VNET_CRYPTO_OP_TYPE_ENCRYPT]);
-	  vnet_crypto_op_init (op2,
-			       ad->op_by_type[VNET_CRYPTO_OP_TYPE_DECRYPT]);
-	  op1->src = op2->src = op1->dst = op2->dst = b->data;
-	  op1->key_index = op2->key_index = key_index;
-	  op1->iv = op2->iv = b->data - 64;
-
-	  if (ad->is_aead)
+	  vnet_crypto_op_t *op = ctx->ops[t] + i;
+	  vnet_crypto_op_t *cop = ctx->chained_ops[t] + i;
+
+	  vnet_crypto_op_init (op, ctx->op_ids[t]);
+	  op->key_index = ctx->key_index;
+	  op->src = op->dst = b->data;
+	  op->len = buffer_size;
+	  op->iv = b->data - 64;
+	  if (ad->op_by_type[VNET_CRYPTO_OP_TYPE_HMAC] ||
+	      ad->op_by_type[VNET_CRYPTO_OP_TYPE_HASH])
+	    {
+	      op->digest = b->data - 32;
+	      op->digest_len = 0;
+	    }
+	  else
 	    {
-	      op1->tag = op2->tag = b->data - 32;
-	      op1->aad = op2->aad = b->data - VLIB_BUFFER_PRE_DATA_SIZE;
-	      op1->aad_len = op2->aad_len = 64;
-	      op1->tag_len = op2->tag_len = 16;
+	      op->tag = b->data - 32;
+	      op->tag_len = 16;
+	      op->aad = b->data - VLIB_BUFFER_PRE_DATA_SIZE;
+	      op->aad_len = 64;
 	    }
 
-	  n_bytes += op1->len = op2->len = buffer_size;
-	  break;
-	case VNET_CRYPTO_OP_TYPE_HMAC:
-	  vnet_crypto_op_init (op1, ad->op_by_type[VNET_CRYPTO_OP_TYPE_HMAC]);
-	  op1->src = b->data;
-	  op1->key_index = key_index;
-	  op1->iv = 0;
-	  op1->digest = b->data - VLIB_BUFFER_PRE_DATA_SIZE;
-	  op1->digest_len = 0;
-	  n_bytes += op1->len = buffer_size;
-	  break;
-	default:
-	  return 0;
+	  /* same buffer data split into chunks */
+	  cop[0] = op[0];
+	  cop->flags |= VNET_CRYPTO_OP_FLAG_CHAINED_BUFFERS;
+	  cop->chunk_index = vec_len (ctx->chunks);
+	  cop->n_chunks = n_chunks;
+	  if (t == 0)
+	    for (u32 j = 0, off = 0; j < n_chunks; j++)
+	      {
+		u32 len = (buffer_size - off) / (n_chunks - j);
+		vnet_crypto_op_chunk_t ch = { .src = b->data + off,
+					      .dst = b->data + off,
+					      .len = len };
+		vec_add1 (ctx->chunks, ch);
+		off += len;
+	      }
+	  else
+	    cop->chunk_index = ctx->chained_ops[0][i].chunk_index;
+
+	  ctx->op_ptrs[t][i] = op;
+	  ctx->chained_op_ptrs[t][i] = cop;
 	}
+    }
 
-      for (j = -VLIB_BUFFER_PRE_DATA_SIZE; j < buffer_size; j += 8)
-	*(u64 *) (b->data + j) = 1 + random_u64 (&seed);
+  return 0;
+}
+
+static u64
+test_crypto_perf_sync_pass (vlib_main_t *vm, vnet_crypto_engine_t *ce,
+			    test_crypto_perf_ctx_t *ctx, int t,
+			    vnet_crypto_handler_type_t ht, u32 batch,
+			    u32 *n_fail)
+{
+  vnet_crypto_op_id_t id = ctx->op_ids[t];
+  vnet_crypto_op_t **ops;
+  u64 t0, t1;
+
+  if (ht == VNET_CRYPTO_HANDLER_TYPE_CHAINED)
+    {
+      vnet_crypto_chained_op_fn_t *fn = ce->ops[id].handlers[ht];
+      ops = ctx->chained_op_ptrs[t];
+      t0 = clib_cpu_time_now ();
+      for (u32 i = 0; i < ctx->n_buffers; i += batch)
+	fn (vm, ops + i, ctx->chunks, clib_min (batch, ctx->n_buffers - i));
+      t1 = clib_cpu_time_now ();
     }
+  else
+    {
+      vnet_crypto_simple_op_fn_t *fn = ce->ops[id].handlers[ht];
+      ops = ctx->op_ptrs[t];
+      t0 = clib_cpu_time_now ();
+      for (u32 i = 0; i < ctx->n_buffers; i += batch)
+	fn (vm, ops + i, clib_min (batch, ctx->n_buffers - i));
+      t1 = clib_cpu_time_now ();
+    }
+
+  for (u32 i = 0; i < ctx->n_buffers; i++)
+    if (ops[i]->status != VNET_CRYPTO_OP_STATUS_COMPLETED)
+      n_fail[0]++;
+
+  return t1 - t0;
+}
+
+static u64
+test_crypto_perf_async_pass (vlib_main_t *vm, vnet_crypto_engine_t *ce,
+			     test_crypto_perf_ctx_t *ctx, int t, u32 batch,
+			     u32 *n_fail, clib_error_t **err)
+{
+  vnet_crypto_op_id_t id = ctx->op_ids[t];
+  vnet_crypto_frame_enq_fn_t *enq_fn =
+    ce->ops[id].handlers[VNET_CRYPTO_HANDLER_TYPE_ASYNC];
+  vnet_crypto_async_frame_t *f = 0, *cf;
+  u32 n_enq = 0, n_deq = 0, n_idle = 0, n_elts, thread_index;
+  u64 t0 = clib_cpu_time_now ();
 
-  for (i = 0; i < 5; i++)
+  batch = clib_min (batch, VNET_CRYPTO_FRAME_SIZE);
+
+  while (n_deq < ctx->n_buffers)
     {
-      for (j = 0; j < warmup_rounds; j++)
+      if (f == 0 && n_enq < ctx->n_buffers &&
+	  (f = vnet_crypto_async_get_frame (vm, id)))
+	for (u32 i = n_enq; i < clib_min (n_enq + batch, ctx->n_buffers); i++)
+	  {
+	    vnet_crypto_op_t *op = ctx->ops[t] + i;
+	    vnet_crypto_async_add_to_frame (
+	      vm, f, op->key_index, op->len, 0, 0, 0, ctx->buffer_indices[i],
+	      0, op->iv, op->tag, op->aad, 0);
+	  }
+
+      if (f)
 	{
-	  vnet_crypto_process_ops (vm, ops1, n_buffers);
-	  if (ot != VNET_CRYPTO_OP_TYPE_HMAC)
-	    vnet_crypto_process_ops (vm, ops2, n_buffers);
+	  f->state = VNET_CRYPTO_FRAME_STATE_PENDING;
+	  f->enqueue_thread_index = vm->thread_index;
+	  if (enq_fn (vm, f) == 0)
+	    {
+	      n_enq += f->n_elts;
+	      f = 0;
+	    }
 	}
 
-      t0[i] = clib_cpu_time_now ();
-      for (j = 0; j < rounds; j++)
-	vnet_crypto_process_ops (vm, ops1, n_buffers);
-      t1[i] = clib_cpu_time_now ();
-
-      if (ot != VNET_CRYPTO_OP_TYPE_HMAC)
+      if ((cf = ce->dequeue_handler (vm, &n_elts, &thread_index)))
 	{
-	  for (j = 0; j < rounds; j++)
-	    vnet_crypto_process_ops (vm, ops2, n_buffers);
-	  t2[i] = clib_cpu_time_now ();
+	  /* element status is only valid if frame is not successful */
+	  if (cf->state != VNET_CRYPTO_FRAME_STATE_SUCCESS)
+	    for (u32 i = 0; i < cf->n_elts; i++)
+	      if (cf->elts[i].status != VNET_CRYPTO_OP_STATUS_COMPLETED)
+		n_fail[0]++;
+	  n_deq += cf->n_elts;
+	  vnet_crypto_async_free_frame (vm, cf);
+	  n_idle = 0;
+	}
+      else if (++n_idle > 1 << 20)
+	{
+	  if (f)
+	    vnet_crypto_async_free_frame (vm, f);
+	  *err = clib_error_return (0,
+				    "%s: timeout waiting for async frames "
+				    "(crypto offloaded to other threads?)",
+				    ce->name);
+	  break;
 	}
     }
 
-  for (i = 0; i < 5; i++)
+  return clib_cpu_time_now () - t0;
+}
+
+static clib_error_t *
+test_crypto_perf_one (vlib_main_t *vm, crypto_test_main_t *tm,
+		      test_crypto_perf_ctx_t *ctx, vnet_crypto_alg_t alg,
+		      u32 engine_index, vnet_crypto_handler_type_t ht,
+		      u32 batch)
+{
+  vnet_crypto_main_t *cm = &crypto_main;
+  vnet_crypto_engine_t *ce = vec_elt_at_index (cm->engines, engine_index);
+  f64 clocks_per_second = vm->clib_time.clocks_per_second;
+  u64 best[2] = { ~0ULL, ~0ULL };
+  u32 n_fail[2] = {};
+  clib_error_t *err = 0;
+
+  /* alternate op types (encrypt / decrypt) on each pass so in-place
+   * decrypt always sees valid ciphertext and tag */
+  for (int s = 0; s < 5 + 1 && !err; s++)
     {
-      f64 tpb1 = (f64) (t1[i] - t0[i]) / (n_bytes * rounds);
-      f64 gbps1 = vm->clib_time.clocks_per_second * 1e-9 * 8 / tpb1;
-      f64 tpb2, gbps2;
+      u32 n_rounds = s == 0 ? tm->warmup_rounds : tm->rounds;
+      u64 ticks[2] = {};
+      u32 fail[2] = {};
+
+      for (u32 r = 0; r < n_rounds && !err; r++)
+	for (int t = 0; t < ctx->n_op_types && !err; t++)
+	  if (ht == VNET_CRYPTO_HANDLER_TYPE_ASYNC)
+	    ticks[t] +=
+	      test_crypto_perf_async_pass (vm, ce, ctx, t, batch, fail + t,
+					   &err);
+	  else
+	    ticks[t] +=
+	      test_crypto_perf_sync_pass (vm, ce, ctx, t, ht, batch, fail + t);
+
+      /* first sample is warmup */
+      if (s == 0)
+	continue;
 
-      if (ot != VNET_CRYPTO_OP_TYPE_HMAC)
+      for (int t = 0; t < ctx->n_op_types; t++)
 	{
-	  tpb2 = (f64) (t2[i] - t1[i]) / (n_bytes * rounds);
-	  gbps2 = vm->clib_time.clocks_per_second * 1e-9 * 8 / tpb2;
-	  vlib_cli_output (vm, "%-2u: encrypt %.03f ticks/byte, %.02f Gbps; "
-			   "decrypt %.03f ticks/byte, %.02f Gbps",
-			   i + 1, tpb1, gbps1, tpb2, gbps2);
+	  best[t] = clib_min (best[t], ticks[t]);
+	  n_fail[t] += fail[t];
 	}
-      else
+    }
+
+  if (err)
+    return err;
+
+  for (int t = 0; t < ctx->n_op_types; t++)
+    {
+      u64 n_ops = (u64) ctx->n_buffers * tm->rounds;
+      f64 n_bytes = (f64) n_ops * ctx->buffer_size;
+      f64 seconds = best[t] / clocks_per_second;
+      f64 tpb = best[t] / n_bytes;
+      f64 ops_per_sec = n_ops / seconds;
+      f64 gbps = n_bytes * 8 / seconds * 1e-9;
+      vnet_crypto_op_type_t ot = cm->opt_data[ctx->op_ids[t]].type;
+      char *fmt = tm->csv ? "%s,%U,%U,%s,%u,%u,%.3f,%.0f,%.2f,%u" :
+			    "%-12s %-28U %-8U %-8s %6u %6u %10.3f %12.0f "
+			    "%8.2f %6u";
+
+      vlib_cli_output (vm, fmt, ce->name, format_vnet_crypto_alg, alg,
+		       format_vnet_crypto_op_type, ot,
+		       test_crypto_perf_handler_type_names[ht],
+		       ctx->buffer_size, batch, tpb, ops_per_sec, gbps,
+		       n_fail[t]);
+    }
+
+  return 0;
+}
+
+static clib_error_t *
+test_crypto_perf (vlib_main_t * vm, crypto_test_main_t * tm)
+{
+  vnet_crypto_main_t *cm = &crypto_main;
+  clib_error_t *err = 0;
+  u32 data_size = vlib_buffer_get_default_data_size (vm);
+  u32 n_buffers, max_batch = 0;
+  test_crypto_perf_ctx_t _ctx = {}, *ctx = &_ctx;
+  vnet_crypto_alg_t first_alg = 1, last_alg = VNET_CRYPTO_N_ALGS - 1;
+  u32 *buffer_size, *batch;
+
+  if (tm->rounds == 0)
+    tm->rounds = 100;
+  if (tm->warmup_rounds == 0)
+    tm->warmup_rounds = 100;
+  if (tm->handler_types == 0)
+    tm->handler_types = 1 << VNET_CRYPTO_HANDLER_TYPE_SIMPLE;
+  if (tm->n_chunks == 0)
+    tm->n_chunks = 3;
+  if (vec_len (tm->buffer_sizes) == 0)
+    vec_add1 (tm->buffer_sizes, 2048);
+  if (vec_len (tm->batch_sizes) == 0)
+    vec_add1 (tm->batch_sizes, VLIB_FRAME_SIZE);
+
+  vec_foreach (buffer_size, tm->buffer_sizes)
+    if (*buffer_size == 0 || *buffer_size > data_size)
+      return clib_error_return (0, "buffer size must be between 1 and %u",
+				data_size);
+
+  vec_foreach (batch, tm->batch_sizes)
+    {
+      if (*batch == 0)
+	return clib_error_return (0, "batch size must be > 0");
+      max_batch = clib_max (max_batch, *batch);
+    }
+
+  n_buffers = clib_max (tm->n_buffers ? tm->n_buffers : 256, max_batch);
+
+  if (tm->alg != ~0)
+    first_alg = last_alg = tm->alg;
+
+  if (tm->csv)
+    vlib_cli_output (vm, "engine,alg,op,handler,buffer_size,batch_size,"
+			 "ticks_per_byte,ops_per_sec,gbps,failed");
+  else
+    {
+      vlib_cli_output (vm,
+		       "n_buffers %u rounds %u warmup-rounds %u "
+		       "cpu-freq %.2f GHz",
+		       n_buffers, tm->rounds, tm->warmup_rounds,
+		       (f64) vm->clib_time.clocks_per_second * 1e-9);
+      vlib_cli_output (vm, "%-12s %-28s %-8s %-8s %6s %6s %10s %12s %8s %6s",
+		       "engine", "alg", "op", "handler", "size", "batch",
+		       "ticks/byte", "ops/sec", "Gbps", "failed");
+    }
+
+  for (vnet_crypto_alg_t alg = first_alg; alg <= last_alg; alg++)
+    {
+      vnet_crypto_alg_data_t *ad = cm->algs + alg;
+      vnet_crypto_engine_t *ce;
+
+      vec_foreach (buffer_size, tm->buffer_sizes)
 	{
-	  vlib_cli_output (vm, "%-2u: hash %.03f ticks/byte, %.02f Gbps\n",
-			   i + 1, tpb1, gbps1);
+	  int ctx_ready = 0;
+
+	  vec_foreach (ce, cm->engines)
+	    {
+	      u32 ei = ce - cm->engines;
+
+	      if (tm->engine_index != ~0 && tm->engine_index != ei)
+		continue;
+
+	      for (vnet_crypto_handler_type_t ht = 0;
+		   ht < VNET_CRYPTO_HANDLER_N_TYPES; ht++)
+		{
+		  int supported = (tm->handler_types & (1 << ht)) != 0;
+
+		  for (int t = 0; t < VNET_CRYPTO_OP_N_TYPES; t++)
+		    if (ad->op_by_type[t] &&
+			ce->ops[ad->op_by_type[t]].handlers[ht] == 0)
+		      supported = 0;
+
+		  if (ht == VNET_CRYPTO_HANDLER_TYPE_ASYNC &&
+		      ce->dequeue_handler == 0)
+		    supported = 0;
+
+		  if (!supported)
+		    continue;
+
+		  if (!ctx_ready)
+		    {
+		      err = test_crypto_perf_ctx_init (vm, tm, ctx, alg,
+						       n_buffers, *buffer_size);
+		      if (err)
+			goto done;
+		      ctx_ready = 1;
+		    }
+
+		  vec_foreach (batch, tm->batch_sizes)
+		    if ((err = test_crypto_perf_one (vm, tm, ctx, alg, ei, ht,
+						     *batch)))
+		      goto done;
+		}
+	    }
+
+	  test_crypto_perf_ctx_free (vm, ctx);
 	}
     }
 
 done:
-  if (n_alloc)
-    vlib_buffer_free (vm, buffer_indices, n_alloc);
-
-  if (key_index != ~0)
-    vnet_crypto_key_del (vm, key_index);
-
-  vec_free (buffer_indices);
-  vec_free (ops1);
-  vec_free (ops2);
+  test_crypto_perf_ctx_free (vm, ctx);
+  vec_free (tm->buffer_sizes);
+  vec_free (tm->batch_sizes);
   return err;
 }
 
@@ -979,13 +1297,18 @@ test_crypto_command_fn (vlib_main_t * vm,
 			unformat_input_t * input, vlib_cli_command_t * cmd)
 {
   crypto_test_main_t *tm = &crypto_test_main;
+  vnet_crypto_main_t *cm = &crypto_main;
   unittest_crypto_test_registration_t *tr;
   int is_perf = 0;
+  u8 *s = 0;
+  uword *p;
+  u32 val;
 
   tr = tm->test_registrations;
   memset (tm, 0, sizeof (crypto_test_main_t));
   tm->test_registrations = tr;
   tm->alg = ~0;
+  tm->engine_index = ~0;
 
   while (unformat_check_input (input) != UNFORMAT_END_OF_INPUT)
     {
@@ -993,17 +1316,40 @@ test_crypto_command_fn (vlib_main_t * vm,
 	tm->verbose = 1;
       else if (unformat (input, "detail"))
 	tm->verbose = 2;
+      else if (unformat (input, "perf all"))
+	is_perf = 1;
       else
 	if (unformat (input, "perf %U", unformat_vnet_crypto_alg, &tm->alg))
 	is_perf = 1;
+      else if (unformat (input, "engine %s", &s))
+	{
+	  vec_add1 (s, 0);
+	  p = hash_get_mem (cm->engine_index_by_name, s);
+	  vec_free (s);
+	  if (!p)
+	    return clib_error_return (0, "unknown engine");
+	  tm->engine_index = p[0];
+	}
       else if (unformat (input, "buffers %u", &tm->n_buffers))
 	;
       else if (unformat (input, "rounds %u", &tm->rounds))
 	;
       else if (unformat (input, "warmup-rounds %u", &tm->warmup_rounds))
 	;
-      else if (unformat (input, "buffer-size %u", &tm->buffer_size))
+      else if (unformat (input, "buffer-size %u", &val))
+	vec_add1 (tm->buffer_sizes, val);
+      else if (unformat (input, "batch-size %u", &val))
+	vec_add1 (tm->batch_sizes, val);
+      else if (unformat (input, "chunks %u", &tm->n_chunks))
 	;
+      else if (unformat (input, "simple"))
+	tm->handler_types |= 1 << VNET_CRYPTO_HANDLER_TYPE_SIMPLE;
+      else if (unformat (input, "chained"))
+	tm->handler_types |= 1 << VNET_CRYPTO_HANDLER_TYPE_CHAINED;
+      else if (unformat (input, "async"))
+	tm->handler_types |= 1 << VNET_CRYPTO_HANDLER_TYPE_ASYNC;
+      else if (unformat (input, "csv"))
+	tm->csv = 1;
       else
 	return clib_error_return (0, "unknown input '%U'",
 				  format_unformat_error, input);
@@ -1018,7 +1364,10 @@ test_crypto_command_fn (vlib_main_t * vm,
 VLIB_CLI_COMMAND (test_crypto_command, static) =
 {
   .path = "test crypto",
-  .short_help = "test crypto",
+  .short_help = "test crypto [verbose|detail] | test crypto perf <alg>|all "
+		"[engine <name>] [simple] [chained] [async] "
+		"[buffer-size <n>]... [batch-size <n>]... [chunks <n>] "
+		"[buffers <n>] [rounds <n>] [warmup-rounds <n>] [csv]",
   .function = test_crypto_command_fn,
 };
 
@@ -16,6 +16,11 @@
 #include <vnet/ipsec/ipsec.h>
 #include <vnet/ipsec/ipsec_sa.h>
 #include <vnet/ipsec/ipsec_output.h>
+#include <vnet/ipsec/ipsec_tun.h>
+#include <vnet/ipip/ipip.h>
+#include <vnet/fib/fib_table.h>
+#include <vnet/adj/adj_nbr.h>
+#include <pthread.h>
 
 static clib_error_t *
 test_ipsec_command_fn (vlib_main_t *vm, unformat_input_t *input,
@@ -57,8 +62,7 @@ test_ipsec_command_fn (vlib_main_t *vm, unformat_input_t *input,
 	  irt->seq64 = seq_num;
 
 	  /* clear the window */
-	  uword_bitmap_clear (irt->replay_window,
-			      irt->anti_replay_window_size / uword_bits);
+	  ipsec_sa_anti_replay_window_reset (irt, false /* seen */);
 	}
 
       ipsec_sa_unlock (sa_index);
@@ -72,6 +76,186 @@ test_ipsec_command_fn (vlib_main_t *vm, unformat_input_t *input,
   return (NULL);
 }
 
+typedef struct
+{
+  ipsec_sa_inb_rt_t *irt;
+  u8 *n_accepted_by_seq;
+  u32 n_packets;
+  u32 n_threads;
+  volatile u32 thread_barrier;
+  u64 n_accepted;
+  u64 n_lost;
+} test_ipsec_ar_main_t;
+
+static test_ipsec_ar_main_t test_ipsec_ar_main;
+
+static ipsec_sa_inb_rt_t *
+test_ipsec_ar_irt_alloc (u32 window_size, int is_multi_worker)
+{
+  ipsec_sa_inb_rt_t *irt;
+  u32 sz = sizeof (ipsec_sa_inb_rt_t);
+
+  sz += is_multi_worker ?
+	  ipsec_sa_anti_replay_mt_n_slots (window_size) * sizeof (u64) :
+	  window_size / 8;
+
+  irt = clib_mem_alloc_aligned (sz, CLIB_CACHE_LINE_BYTES);
+  *irt = (ipsec_sa_inb_rt_t){
+    .use_anti_replay = 1,
+    .is_multi_worker = is_multi_worker,
+    .anti_replay_window_size = window_size,
+  };
+  ipsec_sa_anti_replay_window_reset (irt, true /* seen */);
+
+  return irt;
+}
+
+/* same sequence of checks esp-decrypt does, returns 1 if accepted */
+static_always_inline int
+test_ipsec_ar_one (ipsec_sa_inb_rt_t *irt, u32 seq, u64 *n_lost)
+{
+  u32 hi_seq;
+
+  if (ipsec_sa_anti_replay_and_sn_advance (irt, seq, ~0, false, &hi_seq))
+    return 0;
+  if (ipsec_sa_anti_replay_and_sn_advance (irt, seq, hi_seq, true, NULL))
+    return 0;
+
+  if (irt->is_multi_worker)
+    return !ipsec_sa_anti_replay_mt_advance (irt, seq, hi_seq, n_lost);
+
+  *n_lost += ipsec_sa_anti_replay_advance (irt, 0, seq, hi_seq);
+  return 1;
+}
+
+/* every sequence number is offered twice, by two different threads
+ * when there are more than one */
+static void *
+test_ipsec_ar_thread_fn (void *arg)
+{
+  test_ipsec_ar_main_t *tm = &test_ipsec_ar_main;
+  u32 thread = pointer_to_uword (arg);
+  u64 n_accepted = 0, n_lost = 0, lost;
+
+  while (tm->thread_barrier)
+    CLIB_PAUSE ();
+
+  for (u32 i = 0; i < tm->n_packets; i++)
+    for (u32 dup = 0; dup < 2; dup++)
+      if ((i + dup) % tm->n_threads == thread)
+	{
+	  lost = 0;
+	  if (test_ipsec_ar_one (tm->irt, i + 1, &lost))
+	    {
+	      n_accepted++;
+	      clib_atomic_fetch_add_relax (tm->n_accepted_by_seq + i, 1);
+	    }
+	  n_lost += lost;
+	}
+
+  clib_atomic_fetch_add_relax (&tm->n_accepted, n_accepted);
+  clib_atomic_fetch_add_relax (&tm->n_lost, n_lost);
+  return 0;
+}
+
+static clib_error_t *
+test_ipsec_anti_replay_command_fn (vlib_main_t *vm, unformat_input_t *input,
+				   vlib_cli_command_t *cmd)
+{
+  test_ipsec_ar_main_t *tm = &test_ipsec_ar_main;
+  u32 window_size = 1024, n_packets = 1 << 20, n_threads = 2;
+  pthread_t *handles = 0;
+  clib_error_t *err = 0;
+  u64 t0, t1, n_lost = 0;
+  f64 single, multi;
+  u32 n_dup = 0;
+
+  while (unformat_check_input (input) != UNFORMAT_END_OF_INPUT)
+    {
+      if (unformat (input, "window %u", &window_size))
+	;
+      else if (unformat (input, "packets %u", &n_packets))
+	;
+      else if (unformat (input, "threads %u", &n_threads))
+	;
+      else
+	return clib_error_return (0, "unknown input `%U'",
+				  format_unformat_error, input);
+    }
+
+  if (window_size < 64 || !is_pow2 (window_size) || n_threads == 0 ||
+      n_packets == 0)
+    return clib_error_return (0, "invalid window, threads or packets");
+
+  /* baseline, single worker window */
+  tm->irt = test_ipsec_ar_irt_alloc (window_size, 0);
+  t0 = clib_cpu_time_now ();
+  for (u32 i = 0; i < n_packets; i++)
+    for (u32 dup = 0; dup < 2; dup++)
+      test_ipsec_ar_one (tm->irt, i + 1, &n_lost);
+  t1 = clib_cpu_time_now ();
+  single = (f64) (t1 - t0) / (2 * n_packets);
+  clib_mem_free (tm->irt);
+
+  /* multi-worker window updated from n_threads threads */
+  tm->irt = test_ipsec_ar_irt_alloc (window_size, 1);
+  tm->n_packets = n_packets;
+  tm->n_threads = n_threads;
+  tm->n_accepted = tm->n_lost = 0;
+  vec_validate_init_empty (tm->n_accepted_by_seq, n_packets - 1, 0);
+  vec_validate (handles, n_threads - 1);
+  tm->thread_barrier = 1;
+
+  for (u32 i = 0; i < n_threads; i++)
+    if (pthread_create (handles + i, NULL, test_ipsec_ar_thread_fn,
+			uword_to_pointer (i, void *)))
+      {
+	err = clib_error_return_unix (0, "pthread_create");
+	n_threads = i;
+	break;
+      }
+
+  t0 = clib_cpu_time_now ();
+  tm->thread_barrier = 0;
+  for (u32 i = 0; i < n_threads; i++)
+    pthread_join (handles[i], NULL);
+  t1 = clib_cpu_time_now ();
+  multi = (f64) (t1 - t0) / (2 * n_packets);
+
+  if (err)
+    goto done;
+
+  for (u32 i = 0; i < n_packets; i++)
+    n_dup += tm->n_accepted_by_seq[i] > 1;
+
+  vlib_cli_output (vm, "window %u packets %u (each sent twice)", window_size,
+		   n_packets);
+  vlib_cli_output (vm, "  single-worker: %.2f clocks/packet", single);
+  vlib_cli_output (vm,
+		   "  multi-worker:  %.2f clocks/packet (%u threads), "
+		   "accepted %lu lost %lu",
+		   multi, n_threads, tm->n_accepted, tm->n_lost);
+
+  if (n_dup)
+    err = clib_error_return (0, "%u sequence numbers accepted twice", n_dup);
+  else if (n_threads == 1 && tm->n_accepted != n_packets)
+    err = clib_error_return (0, "%lu of %u sequence numbers accepted",
+			     tm->n_accepted, n_packets);
+
+done:
+  clib_mem_free (tm->irt);
+  vec_free (tm->n_accepted_by_seq);
+  vec_free (handles);
+  return err;
+}
+
+VLIB_CLI_COMMAND (test_ipsec_anti_replay_command, static) = {
+  .path = "test ipsec anti-replay",
+  .short_help = "test ipsec anti-replay [window <n>] [packets <n>] "
+		"[threads <n>]",
+  .function = test_ipsec_anti_replay_command_fn,
+};
+
 static clib_error_t *
 test_ipsec_spd_outbound_perf_command_fn (vlib_main_t *vm,
 					 unformat_input_t *input,
@@ -380,6 +564,626 @@ VLIB_CLI_COMMAND (test_ipsec_spd_perf_command, static) = {
   .function = test_ipsec_spd_outbound_perf_command_fn,
 };
 
+#define TEST_IPSEC_SPD_CLS_BURST_MAX 256
+
+/* low order bits of random_u32 () are not very random */
+static u32
+test_ipsec_spd_cls_rand (u32 *seed)
+{
+  return random_u32 (seed) >> 8;
+}
+
+static void
+test_ipsec_spd_cls_random_range (u32 *seed, u32 base, u32 base_bits,
+				 u32 max_bits, u32 *start, u32 *stop)
+{
+  u32 len = 1 << (test_ipsec_spd_cls_rand (seed) % (max_bits + 1));
+  u32 off = test_ipsec_spd_cls_rand (seed) & pow2_mask (base_bits);
+
+  *start = base + off;
+  *stop = base + clib_min ((u64) off + len - 1, pow2_mask (base_bits));
+}
+
+static u32
+test_ipsec_spd_cls_random_in (u32 *seed, u32 start, u32 stop)
+{
+  return start + test_ipsec_spd_cls_rand (seed) % ((u64) stop - start + 1);
+}
+
+static u32
+test_ipsec_spd_cls_lookup_n (ipsec_spd_t *spd, ipsec_fp_5tuple_t *tuples,
+			     u32 *result, u32 n, u32 burst, int use_cls)
+{
+  ipsec_policy_t *policies[TEST_IPSEC_SPD_CLS_BURST_MAX];
+  u32 ids[TEST_IPSEC_SPD_CLS_BURST_MAX];
+  u32 n_matched = 0;
+
+  for (u32 i = 0; i < n; i += burst)
+    {
+      u32 n_burst = clib_min (n - i, burst);
+
+      if (use_cls)
+	n_matched += ipsec_spd_cls_out_ip4_policy_match_n (
+	  spd->fp_spd.cls[IPSEC_SPD_POLICY_IP4_OUTBOUND], tuples + i,
+	  policies, ids, n_burst);
+      else
+	n_matched += ipsec_fp_out_ip4_policy_match_n (
+	  &spd->fp_spd, tuples + i, policies, ids, n_burst);
+
+      for (u32 j = 0; j < n_burst; j++)
+	result[i + j] = policies[j] ? ids[j] : ~0;
+    }
+
+  return n_matched;
+}
+
+static clib_error_t *
+test_ipsec_spd_classifier_command_fn (vlib_main_t *vm,
+				      unformat_input_t *input,
+				      vlib_cli_command_t *cmd)
+{
+  ipsec_main_t *im = &ipsec_main;
+  u32 n_policies = 10000, n_packets = 10000, n_rounds = 10, burst = 32;
+  u32 seed = random_default_seed (), spd_id = 0x7fffffff, stat_index;
+  u32 *ref = 0, *res = 0, *policy_indices = 0, *prio = 0;
+  u32 n_fp_mismatch = 0, n_cls_mismatch = 0, n_matched = 0, n_masks;
+  ipsec_fp_5tuple_t *tuples = 0;
+  ipsec_policy_t *p_vec = 0, *p;
+  clib_error_t *err = 0;
+  u64 t0, t1, t_compile;
+  f64 t_fp, t_cls;
+  ipsec_spd_t *spd;
+  uword *pp;
+  int rv;
+
+  while (unformat_check_input (input) != UNFORMAT_END_OF_INPUT)
+    {
+      if (unformat (input, "policies %u", &n_policies))
+	;
+      else if (unformat (input, "packets %u", &n_packets))
+	;
+      else if (unformat (input, "rounds %u", &n_rounds))
+	;
+      else if (unformat (input, "burst %u", &burst))
+	;
+      else if (unformat (input, "seed %u", &seed))
+	;
+      else
+	return clib_error_return (0, "unknown input `%U'",
+				  format_unformat_error, input);
+    }
+
+  if (!im->fp_spd_ipv4_out_is_enabled)
+    return clib_error_return (0, "ipv4-outbound-spd-fast-path is not on");
+
+  if (n_policies == 0 || n_packets == 0 || n_rounds == 0 || burst == 0)
+    return clib_error_return (0, "invalid policies, packets, rounds or burst");
+
+  burst = clib_min (burst, TEST_IPSEC_SPD_CLS_BURST_MAX);
+
+  if ((rv = ipsec_add_del_spd (vm, spd_id, 1)))
+    return clib_error_return (0, "create spd failure (%d)", rv);
+
+  pp = hash_get (im->spd_index_by_spd_id, spd_id);
+  spd = pool_elt_at_index (im->spds, pp[0]);
+
+  /* unique priorities, so that all lookup methods agree on the result */
+  vec_validate (prio, n_policies - 1);
+  for (u32 i = 0; i < n_policies; i++)
+    prio[i] = i + 1;
+  for (u32 i = n_policies - 1; i > 0; i--)
+    {
+      u32 j = test_ipsec_spd_cls_rand (&seed) % (i + 1), tmp = prio[i];
+      prio[i] = prio[j];
+      prio[j] = tmp;
+    }
+
+  /* random overlapping ranges of mixed sizes, so that the fast path hash
+   * ends up with many distinct mask types */
+  vec_validate (p_vec, n_policies - 1);
+  vec_validate (policy_indices, n_policies - 1);
+  for (u32 i = 0; i < n_policies; i++)
+    {
+      u32 r = test_ipsec_spd_cls_rand (&seed) % 3, start, stop;
+
+      p = p_vec + i;
+      clib_memset (p, 0, sizeof (*p));
+      p->id = spd_id;
+      p->type = IPSEC_SPD_POLICY_IP4_OUTBOUND;
+      p->priority = prio[i];
+      p->policy = i & 1 ? IPSEC_POLICY_ACTION_BYPASS :
+			  IPSEC_POLICY_ACTION_DISCARD;
+
+      test_ipsec_spd_cls_random_range (&seed, 0x0a000000, 24, 16, &start,
+				       &stop);
+      p->laddr.start.ip4.as_u32 = clib_host_to_net_u32 (start);
+      p->laddr.stop.ip4.as_u32 = clib_host_to_net_u32 (stop);
+      test_ipsec_spd_cls_random_range (&seed, 0x14000000, 24, 16, &start,
+				       &stop);
+      p->raddr.start.ip4.as_u32 = clib_host_to_net_u32 (start);
+      p->raddr.stop.ip4.as_u32 = clib_host_to_net_u32 (stop);
+
+      if (r == 0)
+	{
+	  p->protocol = IPSEC_POLICY_PROTOCOL_ANY;
+	  p->lport.stop = p->rport.stop = 0xffff;
+	}
+      else
+	{
+	  p->protocol = r == 1 ? IP_PROTOCOL_UDP : IP_PROTOCOL_TCP;
+	  test_ipsec_spd_cls_random_range (&seed, 0, 16, 12, &start, &stop);
+	  p->lport.start = start;
+	  p->lport.stop = stop;
+	  test_ipsec_spd_cls_random_range (&seed, 0, 16, 12, &start, &stop);
+	  p->rport.start = start;
+	  p->rport.stop = stop;
+	}
+
+      if ((rv = ipsec_add_del_policy (vm, p, 1, &stat_index)))
+	{
+	  err = clib_error_return (0, "add policy %u failure (%d)", i, rv);
+	  n_policies = i;
+	  goto done;
+	}
+      policy_indices[i] = stat_index;
+    }
+
+  /* most packets hit a random policy, the rest is random traffic */
+  vec_validate (tuples, n_packets - 1);
+  for (u32 i = 0; i < n_packets; i++)
+    {
+      u32 la, ra, lp, rp;
+      u8 pr;
+
+      if (test_ipsec_spd_cls_rand (&seed) % 4)
+	{
+	  p = p_vec + test_ipsec_spd_cls_rand (&seed) % n_policies;
+	  la = test_ipsec_spd_cls_random_in (
+	    &seed, clib_net_to_host_u32 (p->laddr.start.ip4.as_u32),
+	    clib_net_to_host_u32 (p->laddr.stop.ip4.as_u32));
+	  ra = test_ipsec_spd_cls_random_in (
+	    &seed, clib_net_to_host_u32 (p->raddr.start.ip4.as_u32),
+	    clib_net_to_host_u32 (p->raddr.stop.ip4.as_u32));
+	  lp = test_ipsec_spd_cls_random_in (&seed, p->lport.start,
+					     p->lport.stop);
+	  rp = test_ipsec_spd_cls_random_in (&seed, p->rport.start,
+					     p->rport.stop);
+	  pr = p->protocol == IPSEC_POLICY_PROTOCOL_ANY ? IP_PROTOCOL_ICMP :
+							  p->protocol;
+	}
+      else
+	{
+	  la = 0x0a000000 | (test_ipsec_spd_cls_rand (&seed) & 0xffffff);
+	  ra = 0x14000000 | (test_ipsec_spd_cls_rand (&seed) & 0xffffff);
+	  lp = test_ipsec_spd_cls_rand (&seed) & 0xffff;
+	  rp = test_ipsec_spd_cls_rand (&seed) & 0xffff;
+	  pr = test_ipsec_spd_cls_rand (&seed) & 1 ? IP_PROTOCOL_UDP :
+						     IP_PROTOCOL_TCP;
+	}
+
+      ipsec_fp_5tuple_from_ip4_range (tuples + i, la, ra, lp, rp, pr);
+    }
+
+  /* reference result, highest priority matching policy */
+  vec_validate_init_empty (ref, n_packets - 1, ~0);
+  for (u32 i = 0; i < n_packets; i++)
+    {
+      i32 best = 0;
+      for (u32 j = 0; j < n_policies; j++)
+	{
+	  p = pool_elt_at_index (im->policies, policy_indices[j]);
+	  if (p->priority > best &&
+	      single_rule_out_match_5tuple (p, tuples + i))
+	    {
+	      best = p->priority;
+	      ref[i] = policy_indices[j];
+	    }
+	}
+      n_matched += ref[i] != ~0;
+    }
+
+  vec_validate (res, n_packets - 1);
+
+  /* fast path hash tables */
+  t0 = clib_cpu_time_now ();
+  for (u32 r = 0; r < n_rounds; r++)
+    test_ipsec_spd_cls_lookup_n (spd, tuples, res, n_packets, burst, 0);
+  t1 = clib_cpu_time_now ();
+  t_fp = (f64) (t1 - t0) / ((u64) n_rounds * n_packets);
+  for (u32 i = 0; i < n_packets; i++)
+    n_fp_mismatch += res[i] != ref[i];
+
+  /* compiled classifier */
+  t0 = clib_cpu_time_now ();
+  rv = ipsec_spd_classifier_enable_disable (spd_id, 1);
+  t_compile = clib_cpu_time_now () - t0;
+  if (rv)
+    {
+      err = clib_error_return (0, "classifier compile failure (%d)", rv);
+      goto done;
+    }
+
+  t0 = clib_cpu_time_now ();
+  for (u32 r = 0; r < n_rounds; r++)
+    test_ipsec_spd_cls_lookup_n (spd, tuples, res, n_packets, burst, 1);
+  t1 = clib_cpu_time_now ();
+  t_cls = (f64) (t1 - t0) / ((u64) n_rounds * n_packets);
+  for (u32 i = 0; i < n_packets; i++)
+    n_cls_mismatch += res[i] != ref[i];
+
+  n_masks = vec_len (spd->fp_spd.fp_mask_ids[IPSEC_SPD_POLICY_IP4_OUTBOUND]);
+  vlib_cli_output (vm, "%u policies, %u packets (%u matching), burst %u",
+		   n_policies, n_packets, n_matched, burst);
+  vlib_cli_output (vm,
+		   "  fast path:  %.2f clocks/packet, %u mask types, "
+		   "%u mismatches",
+		   t_fp, n_masks, n_fp_mismatch);
+  vlib_cli_output (vm, "  classifier: %.2f clocks/packet, %u mismatches",
+		   t_cls, n_cls_mismatch);
+  vlib_cli_output (vm, "  compile: %.3f ms",
+		   (f64) t_compile * 1e3 / vm->clib_time.clocks_per_second);
+  vlib_cli_output (vm, "  %U", format_ipsec_spd_classifier, spd);
+
+  if (n_cls_mismatch)
+    err = clib_error_return (0, "classifier returned %u wrong results",
+			     n_cls_mismatch);
+
+done:
+  ipsec_spd_classifier_enable_disable (spd_id, 0);
+  for (u32 i = 0; i < n_policies; i++)
+    ipsec_add_del_policy (vm, p_vec + i, 0, &stat_index);
+  ipsec_add_del_spd (vm, spd_id, 0);
+
+  vec_free (p_vec);
+  vec_free (prio);
+  vec_free (policy_indices);
+  vec_free (tuples);
+  vec_free (ref);
+  vec_free (res);
+  return err;
+}
+
+VLIB_CLI_COMMAND (test_ipsec_spd_classifier_command, static) = {
+  .path = "test ipsec spd classifier",
+  .short_help = "test ipsec spd classifier [policies <n>] [packets <n>] "
+		"[rounds <n>] [burst <n>] [seed <n>]",
+  .function = test_ipsec_spd_classifier_command_fn,
+};
+
+/* SA ids of a tunnel's outbound SA, the inbound one follows */
+#define TEST_IPSEC_REKEY_SA_ID(i, gen) (0x40000000 + ((i) << 2) + ((gen) << 1))
+
+/* SPI of the inbound SA, the same for both generations with reuse_spi */
+static u32
+test_ipsec_rekey_spi_in (u32 i, u32 gen, int reuse_spi)
+{
+  return TEST_IPSEC_REKEY_SA_ID (i, reuse_spi ? 0 : gen) + 1;
+}
+
+static int
+test_ipsec_rekey_add_sas (u32 i, u32 gen, int reuse_spi)
+{
+  ipsec_key_t key;
+  tunnel_t tun = { 0 };
+  u32 id = TEST_IPSEC_REKEY_SA_ID (i, gen);
+  u8 data[16];
+  int rv;
+
+  for (int j = 0; j < sizeof (data); j++)
+    data[j] = i + gen + j;
+  ipsec_mk_key (&key, data, sizeof (data));
+
+  rv = ipsec_sa_add_and_lock (id, id, IPSEC_PROTOCOL_ESP,
+			      IPSEC_CRYPTO_ALG_AES_GCM_128, &key,
+			      IPSEC_INTEG_ALG_NONE, &key, IPSEC_SA_FLAG_NONE,
+			      0, IPSEC_UDP_PORT_NONE, IPSEC_UDP_PORT_NONE, 0,
+			      &tun, NULL);
+  if (rv)
+    return rv;
+
+  rv = ipsec_sa_add_and_lock (
+    id + 1, test_ipsec_rekey_spi_in (i, gen, reuse_spi), IPSEC_PROTOCOL_ESP,
+    IPSEC_CRYPTO_ALG_AES_GCM_128, &key,
+    IPSEC_INTEG_ALG_NONE, &key,
+    IPSEC_SA_FLAG_IS_INBOUND | IPSEC_SA_FLAG_USE_ANTI_REPLAY, 0,
+    IPSEC_UDP_PORT_NONE, IPSEC_UDP_PORT_NONE, 0, &tun, NULL);
+  if (rv)
+    ipsec_sa_unlock_id (id);
+
+  return rv;
+}
+
+static u64
+test_ipsec_rekey_sa_packets (u32 id)
+{
+  ipsec_main_t *im = &ipsec_main;
+  vlib_counter_t count;
+  uword *p;
+
+  p = hash_get (im->sa_index_by_sa_id, id);
+  if (!p)
+    return 0;
+
+  vlib_get_combined_counter (&ipsec_sa_counters, p[0], &count);
+  return count.packets;
+}
+
+/*
+ * Rekey protected tunnels make-before-break: add the new SAs, protect with
+ * the new outbound and both inbound SAs, delete the old outbound SA, then
+ * drop the old inbound one. The command is mp-safe so the workers keep
+ * forwarding whatever traffic is sent to the tunnels' routes while the SAs
+ * are replaced.
+ */
+static clib_error_t *
+test_ipsec_rekey_command_fn (vlib_main_t *vm, unformat_input_t *input,
+			     vlib_cli_command_t *cmd)
+{
+  ipsec_main_t *im = &ipsec_main;
+  vnet_main_t *vnm = vnet_get_main ();
+  ipsec_ctl_op_stats_t st0[IPSEC_CTL_N_OPS];
+  ip46_address_t src = {}, dst = {}, route = {}, zero = {};
+  u32 n_tunnels = 10000, n_rounds = 2, *sw_if_indices = 0, *sas_in;
+  u32 i, round, gen = 0, n_wrong = 0, n_rx_wrong = 0, n_late_barrier = 0;
+  int reuse_spi = 0;
+  u64 n_packets = 0;
+  clib_error_t *err = 0;
+  f64 t0, dt;
+  int rv;
+
+  src.ip4.as_u32 = clib_host_to_net_u32 (0xc0000201);
+  dst.ip4.as_u32 = clib_host_to_net_u32 (0xc6120001);
+  route.ip4.as_u32 = clib_host_to_net_u32 (0x10000001);
+
+  while (unformat_check_input (input) != UNFORMAT_END_OF_INPUT)
+    {
+      if (unformat (input, "tunnels %u", &n_tunnels))
+	;
+      else if (unformat (input, "rounds %u", &n_rounds))
+	;
+      else if (unformat (input, "reuse-spi"))
+	reuse_spi = 1;
+      else if (unformat (input, "src %U", unformat_ip4_address, &src.ip4))
+	;
+      else if (unformat (input, "dst %U", unformat_ip4_address, &dst.ip4))
+	;
+      else if (unformat (input, "route %U", unformat_ip4_address,
+			 &route.ip4))
+	;
+      else
+	return clib_error_return (0, "unknown input `%U'",
+				  format_unformat_error, input);
+    }
+
+  if (n_tunnels == 0 || n_tunnels >= (1 << 28))
+    return clib_error_return (0, "invalid number of tunnels");
+
+  /* tunnels and routes are not mp-safe */
+  vlib_worker_thread_barrier_sync (vm);
+  t0 = vlib_time_now (vm);
+
+  for (i = 0; i < n_tunnels; i++)
+    {
+      ip46_address_t d = dst;
+      fib_prefix_t pfx = {
+	.fp_proto = FIB_PROTOCOL_IP4,
+	.fp_len = 32,
+	.fp_addr = route,
+      };
+      u32 sw_if_index;
+
+      d.ip4.as_u32 = clib_host_to_net_u32 (
+	clib_net_to_host_u32 (dst.ip4.as_u32) + i);
+      pfx.fp_addr.ip4.as_u32 = clib_host_to_net_u32 (
+	clib_net_to_host_u32 (route.ip4.as_u32) + i);
+
+      rv = ipip_add_tunnel (IPIP_TRANSPORT_IP4, ~0, &src, &d, 0,
+			    TUNNEL_ENCAP_DECAP_FLAG_NONE, IP_DSCP_CS0,
+			    TUNNEL_MODE_P2P, &sw_if_index);
+      if (rv)
+	{
+	  err = clib_error_return (0, "tunnel %u create failed: %d", i, rv);
+	  break;
+	}
+      vec_add1 (sw_if_indices, sw_if_index);
+      vnet_sw_interface_set_flags (vnm, sw_if_index,
+				   VNET_SW_INTERFACE_FLAG_ADMIN_UP);
+
+      if ((rv = test_ipsec_rekey_add_sas (i, gen, reuse_spi)))
+	{
+	  err = clib_error_return (0, "tunnel %u SA add failed: %d", i, rv);
+	  break;
+	}
+
+      sas_in = 0;
+      vec_add1 (sas_in, TEST_IPSEC_REKEY_SA_ID (i, gen) + 1);
+      rv = ipsec_tun_protect_update (sw_if_index, NULL,
+				     TEST_IPSEC_REKEY_SA_ID (i, gen), sas_in);
+      if (rv)
+	{
+	  err = clib_error_return (0, "tunnel %u protect failed: %d", i, rv);
+	  break;
+	}
+
+      fib_table_entry_path_add (0, &pfx, FIB_SOURCE_CLI, FIB_ENTRY_FLAG_NONE,
+				DPO_PROTO_IP4, &zero, sw_if_index, ~0, 1,
+				NULL, FIB_ROUTE_PATH_FLAG_NONE);
+    }
+
+  vlib_worker_thread_barrier_release (vm);
+
+  if (err)
+    goto done;
+
+  vlib_cli_output (vm, "%u tunnels created in %.2fs, routes %U/32 onwards",
+		   n_tunnels, vlib_time_now (vm) - t0, format_ip4_address,
+		   &route.ip4);
+
+  for (round = 0; round < n_rounds && !err; round++)
+    {
+      u32 n_barrier = 0;
+      f64 barrier_time = 0;
+
+      clib_memcpy (st0, im->ctl_op_stats, sizeof (st0));
+      t0 = vlib_time_now (vm);
+
+      for (i = 0; i < n_tunnels; i++)
+	{
+	  u32 old = TEST_IPSEC_REKEY_SA_ID (i, gen);
+	  u32 new = TEST_IPSEC_REKEY_SA_ID (i, gen ^ 1);
+
+	  if ((rv = test_ipsec_rekey_add_sas (i, gen ^ 1, reuse_spi)))
+	    {
+	      err = clib_error_return (0, "tunnel %u SA add failed: %d", i,
+				       rv);
+	      break;
+	    }
+
+	  if (reuse_spi)
+	    {
+	      /* an SPI is accepted for one SA only, so the new inbound SA
+	       * replaces the old one in the same update */
+	      sas_in = 0;
+	      vec_add1 (sas_in, new + 1);
+	      rv = ipsec_tun_protect_update (sw_if_indices[i], NULL, new,
+					     sas_in);
+	      if (!rv)
+		{
+		  n_packets += test_ipsec_rekey_sa_packets (old);
+		  ipsec_sa_unlock_id (old);
+		  ipsec_sa_unlock_id (old + 1);
+		}
+	    }
+	  else
+	    {
+	      /* make: send with the new SA, accept both */
+	      sas_in = 0;
+	      vec_add1 (sas_in, old + 1);
+	      vec_add1 (sas_in, new + 1);
+	      rv = ipsec_tun_protect_update (sw_if_indices[i], NULL, new,
+					     sas_in);
+	      if (!rv)
+		{
+		  n_packets += test_ipsec_rekey_sa_packets (old);
+		  ipsec_sa_unlock_id (old);
+
+		  /* break: stop accepting the old SA */
+		  sas_in = 0;
+		  vec_add1 (sas_in, new + 1);
+		  rv = ipsec_tun_protect_update (sw_if_indices[i], NULL, new,
+						 sas_in);
+		  ipsec_sa_unlock_id (old + 1);
+		}
+	    }
+	  if (rv)
+	    {
+	      err = clib_error_return (0, "tunnel %u protect failed: %d", i,
+				       rv);
+	      break;
+	    }
+	}
+      dt = vlib_time_now (vm) - t0;
+      gen ^= 1;
+
+      for (int op = 0; op < IPSEC_CTL_N_OPS; op++)
+	{
+	  n_barrier += im->ctl_op_stats[op].n_barrier - st0[op].n_barrier;
+	  barrier_time +=
+	    im->ctl_op_stats[op].barrier_time - st0[op].barrier_time;
+	}
+      vlib_cli_output (vm,
+		       "round %u: %u rekeys in %.2fs (%.0f/s), barrier "
+		       "taken %u times for %.3fms",
+		       round, i, dt, i / dt, n_barrier, barrier_time * 1e3);
+
+      /* once the pools have grown a rekey reuses what the last one freed */
+      if (round)
+	n_late_barrier += n_barrier;
+    }
+
+  /* every adjacency must now send with the current SA and the RX DB must
+   * map the current inbound SPI to the current inbound SA */
+  for (i = 0; i < vec_len (sw_if_indices) && !err; i++)
+    {
+      ipsec4_tunnel_kv_t key;
+      clib_bihash_kv_8_16_t res;
+      ip4_address_t d;
+      adj_index_t ai;
+      index_t sai;
+      uword *p;
+
+      ai = adj_nbr_find (FIB_PROTOCOL_IP4, VNET_LINK_IP4, &zero,
+			 sw_if_indices[i]);
+      p = hash_get (im->sa_index_by_sa_id, TEST_IPSEC_REKEY_SA_ID (i, gen));
+      sai = ADJ_INDEX_INVALID != ai ? ipsec_tun_protect_get_sa_out (ai) :
+				      INDEX_INVALID;
+      if (!p || sai != p[0])
+	n_wrong++;
+
+      d.as_u32 =
+	clib_host_to_net_u32 (clib_net_to_host_u32 (dst.ip4.as_u32) + i);
+      ipsec4_tunnel_mk_key (
+	&key, &d,
+	clib_host_to_net_u32 (test_ipsec_rekey_spi_in (i, gen, reuse_spi)));
+      p = hash_get (im->sa_index_by_sa_id,
+		    TEST_IPSEC_REKEY_SA_ID (i, gen) + 1);
+      if (!p ||
+	  clib_bihash_search_8_16 (&im->tun4_protect_by_key,
+				   (clib_bihash_kv_8_16_t *) &key, &res) ||
+	  ((ipsec4_tunnel_kv_t *) &res)->value.sa_index != p[0])
+	n_rx_wrong++;
+    }
+
+  for (i = 0; i < vec_len (sw_if_indices); i++)
+    n_packets +=
+      test_ipsec_rekey_sa_packets (TEST_IPSEC_REKEY_SA_ID (i, gen));
+  vlib_cli_output (vm, "%lu packets encrypted across the rekeys", n_packets);
+
+  if (!err && n_wrong)
+    err = clib_error_return (0, "%u adjacencies not using the current SA",
+			     n_wrong);
+  if (!err && n_rx_wrong)
+    err = clib_error_return (0, "%u tunnels not accepting the current SA",
+			     n_rx_wrong);
+  if (!err && n_late_barrier && vlib_num_workers ())
+    err = clib_error_return (0, "rekeys stopped the workers %u times",
+			     n_late_barrier);
+
+done:
+  vlib_worker_thread_barrier_sync (vm);
+  for (i = 0; i < vec_len (sw_if_indices); i++)
+    {
+      fib_prefix_t pfx = {
+	.fp_proto = FIB_PROTOCOL_IP4,
+	.fp_len = 32,
+      };
+
+      pfx.fp_addr.ip4.as_u32 = clib_host_to_net_u32 (
+	clib_net_to_host_u32 (route.ip4.as_u32) + i);
+      fib_table_entry_delete (0, &pfx, FIB_SOURCE_CLI);
+      ipsec_tun_protect_del (sw_if_indices[i], NULL);
+      /* after a failure some tunnels may be a generation ahead */
+      for (u32 g = 0; g < 2; g++)
+	{
+	  ipsec_sa_unlock_id (TEST_IPSEC_REKEY_SA_ID (i, g));
+	  ipsec_sa_unlock_id (TEST_IPSEC_REKEY_SA_ID (i, g) + 1);
+	}
+      ipip_del_tunnel (sw_if_indices[i]);
+    }
+  vlib_worker_thread_barrier_release (vm);
+
+  vec_free (sw_if_indices);
+  return err;
+}
+
+VLIB_CLI_COMMAND (test_ipsec_rekey_command, static) = {
+  .path = "test ipsec rekey",
+  .short_help = "test ipsec rekey [tunnels <n>] [rounds <n>] [reuse-spi] "
+		"[src <ip4>] [dst <ip4>] [route <ip4>]",
+  .function = test_ipsec_rekey_command_fn,
+  .is_mp_safe = 1,
+};
+
 VLIB_CLI_COMMAND (test_ipsec_command, static) = {
   .path = "test ipsec",
   .short_help = "test ipsec sa <ID> seq-num <VALUE>",
@@ -734,6 +734,70 @@ segment_manager_test_prealloc_hdrs (vlib_main_t * vm,
   return 0;
 }
 
+static int
+segment_manager_test_prealloc_chunks (vlib_main_t *vm,
+				      unformat_input_t *input)
+{
+  u32 fifo_size = size_4KB, prealloc_chunks, sm_index, fs_index;
+  u64 options[APP_OPTIONS_N_OPTIONS];
+  uword app_seg_size = size_2MB * 2;
+  segment_manager_t *sm;
+  fifo_segment_t *fs;
+  int rv;
+
+  memset (&options, 0, sizeof (options));
+
+  vnet_app_attach_args_t attach_args = {
+    .api_client_index = ~0,
+    .options = options,
+    .namespace_id = 0,
+    .session_cb_vft = &placeholder_session_cbs,
+    .name = format (0, "segment_manager_test_prealloc_chunks"),
+  };
+
+  prealloc_chunks = 16;
+
+  /* Out of range numa node must be rejected */
+  attach_args.options[APP_OPTIONS_SEGMENT_SIZE] = app_seg_size;
+  attach_args.options[APP_OPTIONS_FLAGS] =
+    APP_OPTIONS_FLAGS_IS_BUILTIN | APP_OPTIONS_FLAGS_NUMA_BIND_SEGMENTS;
+  attach_args.options[APP_OPTIONS_NUMA_NODE] = CLIB_MAX_NUMAS;
+  attach_args.options[APP_OPTIONS_RX_FIFO_SIZE] = fifo_size;
+  attach_args.options[APP_OPTIONS_TX_FIFO_SIZE] = fifo_size;
+  attach_args.options[APP_OPTIONS_PREALLOC_CHUNKS] = prealloc_chunks;
+
+  rv = vnet_application_attach (&attach_args);
+  SEG_MGR_TEST ((rv != 0), "attach with invalid numa node should fail");
+
+  attach_args.options[APP_OPTIONS_NUMA_NODE] = 0;
+  rv = vnet_application_attach (&attach_args);
+  vec_free (attach_args.name);
+
+  SEG_MGR_TEST ((rv == 0), "vnet_application_attach %d", rv);
+
+  segment_manager_parse_segment_handle (attach_args.segment_handle, &sm_index,
+					&fs_index);
+  sm = segment_manager_get (sm_index);
+
+  SEG_MGR_TEST ((sm != 0), "seg manager is valid", sm);
+
+  /* rx and tx fifos have the same size so each slice holds twice the
+   * number of preallocated chunks */
+  fs = segment_manager_get_segment (sm, fs_index);
+  SEG_MGR_TEST (fifo_segment_num_free_chunks (fs, fifo_size) ==
+		  2 * prealloc_chunks * fs->n_slices,
+		"free chunks should be %u",
+		2 * prealloc_chunks * fs->n_slices);
+
+  vnet_app_detach_args_t detach_args = {
+    .app_index = attach_args.app_index,
+    .api_client_index = ~0,
+  };
+  rv = vnet_application_detach (&detach_args);
+  SEG_MGR_TEST ((rv == 0), "vnet_application_detach %d", rv);
+  return 0;
+}
+
 static clib_error_t *
 segment_manager_test (vlib_main_t * vm,
 		      unformat_input_t * input, vlib_cli_command_t * cmd_arg)
@@ -755,6 +819,8 @@ segment_manager_test (vlib_main_t * vm,
 	res = segment_manager_test_fifo_balanced_alloc (vm, input);
       else if (unformat (input, "prealloc_hdrs"))
 	res = segment_manager_test_prealloc_hdrs (vm, input);
+      else if (unformat (input, "prealloc_chunks"))
+	res = segment_manager_test_prealloc_chunks (vm, input);
 
       else if (unformat (input, "all"))
 	{
@@ -766,6 +832,8 @@ segment_manager_test (vlib_main_t * vm,
 	    goto done;
 	  if ((res = segment_manager_test_prealloc_hdrs (vm, input)))
 	    goto done;
+	  if ((res = segment_manager_test_prealloc_chunks (vm, input)))
+	    goto done;
 	}
       else
 	break;
@@ -781,7 +849,8 @@ VLIB_CLI_COMMAND (tcp_test_command, static) =
 {
   .path = "test segment-manager",
   .short_help = "test segment manager [pressure_levels_1]"
-                "[pressure_level_2][alloc][fifo_ops][prealloc_hdrs][all]",
+                "[pressure_level_2][alloc][fifo_ops][prealloc_hdrs]"
+                "[prealloc_chunks][all]",
   .function = segment_manager_test,
 };
 
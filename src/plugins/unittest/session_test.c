@@ -2668,6 +2668,132 @@ session_test_ext_cfg (vlib_main_t *vm, unformat_input_t *input)
   return 0;
 }
 
+static void
+session_test_lookup_key_to_tc (session_lookup_key4_t *key,
+			       transport_connection_t *tc)
+{
+  clib_memset (tc, 0, sizeof (*tc));
+  tc->lcl_ip.ip4 = key->lcl;
+  tc->rmt_ip.ip4 = key->rmt;
+  tc->lcl_port = key->lcl_port;
+  tc->rmt_port = key->rmt_port;
+  tc->fib_index = key->fib_index;
+  tc->proto = TRANSPORT_PROTO_TCP;
+  tc->is_ip4 = 1;
+}
+
+static int
+session_test_lookup_speed (vlib_main_t *vm, unformat_input_t *input)
+{
+  u32 i, j, n_sessions = 1 << 16, n_iterations = 10, seed = 0xdeadbeef;
+  session_lookup_key4_t *keys = 0, tmp_key;
+  u64 *handles = 0, *expected = 0, tmp_handle;
+  u64 n_scalar_hits = 0, n_batch_hits = 0;
+  f64 start, scalar_time, batch_time;
+  transport_connection_t tc;
+  u32 n_errors = 0;
+
+  while (unformat_check_input (input) != UNFORMAT_END_OF_INPUT)
+    {
+      if (unformat (input, "sessions %u", &n_sessions))
+	;
+      else if (unformat (input, "iterations %u", &n_iterations))
+	;
+      else
+	{
+	  vlib_cli_output (vm, "parse error: '%U'", format_unformat_error,
+			   input);
+	  return -1;
+	}
+    }
+
+  SESSION_TEST (n_sessions > 0 && n_iterations > 0,
+		"sessions and iterations should be non-zero");
+
+  vec_validate (keys, n_sessions - 1);
+  vec_validate (expected, n_sessions - 1);
+  vec_validate (handles, n_sessions - 1);
+
+  for (i = 0; i < n_sessions; i++)
+    {
+      keys[i].lcl.as_u32 = clib_host_to_net_u32 (0x0a000001);
+      keys[i].rmt.as_u32 = clib_host_to_net_u32 (0x0b000000 + (i >> 16));
+      keys[i].lcl_port = clib_host_to_net_u16 (1234);
+      keys[i].rmt_port = clib_host_to_net_u16 (i & 0xffff);
+      keys[i].fib_index = 0;
+      expected[i] = session_make_handle (i, 0);
+
+      session_test_lookup_key_to_tc (&keys[i], &tc);
+      n_errors += session_lookup_add_connection (&tc, expected[i]) != 0;
+    }
+  SESSION_TEST (n_errors == 0, "all %u connections should be added",
+		n_sessions);
+
+  /* Shuffle keys so consecutive lookups do not share buckets */
+  for (i = n_sessions - 1; i > 0; i--)
+    {
+      j = random_u32 (&seed) % (i + 1);
+      tmp_key = keys[i];
+      keys[i] = keys[j];
+      keys[j] = tmp_key;
+      tmp_handle = expected[i];
+      expected[i] = expected[j];
+      expected[j] = tmp_handle;
+    }
+
+  start = vlib_time_now (vm);
+  for (i = 0; i < n_iterations; i++)
+    {
+      for (j = 0; j < n_sessions; j++)
+	session_lookup_handles4_n (&keys[j], 1, TRANSPORT_PROTO_TCP,
+				   &handles[j]);
+      for (j = 0; j < n_sessions; j++)
+	n_scalar_hits += handles[j] == expected[j];
+    }
+  scalar_time = vlib_time_now (vm) - start;
+
+  start = vlib_time_now (vm);
+  for (i = 0; i < n_iterations; i++)
+    {
+      session_lookup_handles4_n (keys, n_sessions, TRANSPORT_PROTO_TCP,
+				 handles);
+      for (j = 0; j < n_sessions; j++)
+	n_batch_hits += handles[j] == expected[j];
+    }
+  batch_time = vlib_time_now (vm) - start;
+
+  SESSION_TEST (n_scalar_hits == (u64) n_sessions * n_iterations,
+		"all single key lookups should hit: %lu", n_scalar_hits);
+  SESSION_TEST (n_batch_hits == (u64) n_sessions * n_iterations,
+		"all batched lookups should hit: %lu", n_batch_hits);
+
+  vlib_cli_output (vm, "%u sessions, %u iterations", n_sessions,
+		   n_iterations);
+  vlib_cli_output (vm, "  single key: %.2f Mlookups/s",
+		   n_scalar_hits / scalar_time / 1e6);
+  vlib_cli_output (vm, "  batched:    %.2f Mlookups/s",
+		   n_batch_hits / batch_time / 1e6);
+
+  for (i = 0; i < n_sessions; i++)
+    {
+      session_test_lookup_key_to_tc (&keys[i], &tc);
+      n_errors += session_lookup_del_connection (&tc) != 0;
+    }
+  SESSION_TEST (n_errors == 0, "all %u connections should be deleted",
+		n_sessions);
+
+  session_lookup_handles4_n (keys, n_sessions, TRANSPORT_PROTO_TCP, handles);
+  for (i = 0; i < n_sessions; i++)
+    n_errors += handles[i] != SESSION_INVALID_HANDLE;
+  SESSION_TEST (n_errors == 0, "lookups after delete should miss");
+
+  vec_free (keys);
+  vec_free (expected);
+  vec_free (handles);
+
+  return 0;
+}
+
 static clib_error_t *
 session_test (vlib_main_t * vm,
 	      unformat_input_t * input, vlib_cli_command_t * cmd_arg)
@@ -2700,6 +2826,8 @@ session_test (vlib_main_t * vm,
 	res = session_test_sdl (vm, input);
       else if (unformat (input, "ext-cfg"))
 	res = session_test_ext_cfg (vm, input);
+      else if (unformat (input, "lookup-speed"))
+	res = session_test_lookup_speed (vm, input);
       else if (unformat (input, "all"))
 	{
 	  if ((res = session_test_basic (vm, input)))
@@ -2722,6 +2850,8 @@ session_test (vlib_main_t * vm,
 	    goto done;
 	  if ((res = session_test_ext_cfg (vm, input)))
 	    goto done;
+	  if ((res = session_test_lookup_speed (vm, input)))
+	    goto done;
 	  if ((res = session_test_enable_disable (vm, input)))
 	    goto done;
 	}
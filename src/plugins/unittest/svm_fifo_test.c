@@ -1906,6 +1906,106 @@ sfifo_test_fifo_shrink (vlib_main_t * vm, unformat_input_t * input)
   return 0;
 }
 
+static int
+sfifo_test_fifo_compact (vlib_main_t *vm, unformat_input_t *input)
+{
+  int __clib_unused verbose = 0, fifo_size = 4096, rv, i = 0;
+  fifo_segment_main_t _fsm = { 0 }, *fsm = &_fsm;
+  u8 *test_data = 0, *data_buf = 0;
+  uword fl_bytes;
+  fifo_segment_t *fs;
+  u32 n_left;
+  svm_fifo_t *f;
+
+  while (unformat_check_input (input) != UNFORMAT_END_OF_INPUT)
+    {
+      if (unformat (input, "verbose"))
+	verbose = 1;
+      else
+	{
+	  vlib_cli_output (vm, "parse error: '%U'", format_unformat_error,
+			   input);
+	  return -1;
+	}
+    }
+
+  /*
+   * Grow fifo to multiple chunks
+   */
+  fs = fifo_segment_prepare (fsm, "fifo-compact", 0);
+  f = fifo_prepare (fs, fifo_size);
+
+  fifo_size = 256 << 10;
+  svm_fifo_set_size (f, fifo_size);
+  validate_test_and_buf_vecs (&test_data, &data_buf, fifo_size);
+
+  rv = svm_fifo_enqueue (f, fifo_size, test_data);
+  SFIFO_TEST (rv == fifo_size, "enq should succeed %u", rv);
+  SFIFO_TEST (svm_fifo_n_chunks (f) > 1, "should have multiple chunks");
+
+  rv = svm_fifo_compact (f, 4096);
+  SFIFO_TEST (rv == 0, "full fifo should not be compacted %u", rv);
+
+  /*
+   * Dequeue all but a few bytes and compact
+   */
+  n_left = 1000;
+  rv = svm_fifo_dequeue (f, fifo_size - n_left, data_buf);
+  SFIFO_TEST (rv == fifo_size - n_left, "deq should succeed %u", rv);
+
+  fl_bytes = fifo_segment_fl_chunk_bytes (fs);
+  rv = svm_fifo_compact (f, 4096);
+  SFIFO_TEST (rv > 0, "compact should release bytes %u", rv);
+  SFIFO_TEST (svm_fifo_n_chunks (f) == 1, "should have 1 chunk has %u",
+	      svm_fifo_n_chunks (f));
+  SFIFO_TEST (svm_fifo_is_sane (f), "fifo should be sane");
+  SFIFO_TEST (fifo_segment_fl_chunk_bytes (fs) >= fl_bytes + rv,
+	      "released chunks should be on freelist");
+  SFIFO_TEST (svm_fifo_max_dequeue (f) == n_left, "max deq should be %u",
+	      n_left);
+
+  rv = svm_fifo_compact (f, 4096);
+  SFIFO_TEST (rv == 0, "compacted fifo should not be compacted %u", rv);
+
+  rv = svm_fifo_dequeue (f, n_left, data_buf + fifo_size - n_left);
+  SFIFO_TEST (rv == n_left, "deq should succeed %u", rv);
+  rv = compare_data (data_buf, test_data, 0, fifo_size, (u32 *) &i);
+  SFIFO_TEST (!rv, "data should be intact [%d] %u expected %u", i,
+	      data_buf[i], test_data[i]);
+
+  /*
+   * Fifo should grow again after compaction
+   */
+  memset (data_buf, 0, vec_len (data_buf));
+  rv = svm_fifo_enqueue (f, fifo_size, test_data);
+  SFIFO_TEST (rv == fifo_size, "enq should succeed %u", rv);
+  SFIFO_TEST (svm_fifo_is_sane (f), "fifo should be sane");
+  rv = svm_fifo_dequeue (f, fifo_size, data_buf);
+  SFIFO_TEST (rv == fifo_size, "deq should succeed %u", rv);
+  rv = compare_data (data_buf, test_data, 0, fifo_size, (u32 *) &i);
+  SFIFO_TEST (!rv, "data should be intact [%d] %u expected %u", i,
+	      data_buf[i], test_data[i]);
+
+  /*
+   * Fifos with ooo data are not compacted
+   */
+  rv = svm_fifo_enqueue_with_offset (f, 1000, 1000, test_data);
+  SFIFO_TEST (!rv, "ooo enq should succeed %d", rv);
+  rv = svm_fifo_compact (f, 4096);
+  SFIFO_TEST (rv == 0, "fifo with ooo data should not be compacted %u", rv);
+
+  /*
+   * Cleanup
+   */
+
+  ft_fifo_free (fs, f);
+  ft_fifo_segment_free (fsm, fs);
+  vec_free (test_data);
+  vec_free (data_buf);
+
+  return 0;
+}
+
 static int
 sfifo_test_fifo_indirect (vlib_main_t * vm, unformat_input_t * input)
 {
@@ -2767,6 +2867,8 @@ svm_fifo_test (vlib_main_t * vm, unformat_input_t * input,
 	res = sfifo_test_fifo_grow (vm, input);
       else if (unformat (input, "shrink"))
 	res = sfifo_test_fifo_shrink (vm, input);
+      else if (unformat (input, "compact"))
+	res = sfifo_test_fifo_compact (vm, input);
       else if (unformat (input, "indirect"))
 	res = sfifo_test_fifo_indirect (vm, input);
       else if (unformat (input, "zero"))
@@ -2832,6 +2934,9 @@ svm_fifo_test (vlib_main_t * vm, unformat_input_t * input,
 	  if ((res = sfifo_test_fifo_shrink (vm, input)))
 	    goto done;
 
+	  if ((res = sfifo_test_fifo_compact (vm, input)))
+	    goto done;
+
 	  if ((res = sfifo_test_fifo_indirect (vm, input)))
 	    goto done;
 
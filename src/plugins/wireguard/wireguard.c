@@ -36,6 +36,15 @@ wg_set_async_mode (u32 is_enabled)
     wg_op_mode_unset_ASYNC ();
 }
 
+void
+wg_set_multi_worker_mode (u32 is_enabled)
+{
+  if (is_enabled)
+    wg_op_mode_set_MULTI_WORKER ();
+  else
+    wg_op_mode_unset_MULTI_WORKER ();
+}
+
 static void
 wireguard_register_post_node (vlib_main_t *vm)
 
@@ -83,6 +92,8 @@ wg_init (vlib_main_t * vm)
   vec_validate_aligned (wmp->per_thread_data, tm->n_vlib_mains,
 			CLIB_CACHE_LINE_BYTES);
 
+  wg_index_table_init (&wmp->index_table);
+
   wg_timer_wheel_init ();
   wireguard_register_post_node (vm);
   wmp->op_mode_flags = 0;
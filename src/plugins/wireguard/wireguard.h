@@ -34,6 +34,9 @@ typedef struct wg_per_thread_data_t_
   vnet_crypto_op_t *chained_crypto_ops;
   vnet_crypto_op_chunk_t *chunks;
   vnet_crypto_async_frame_t **async_frames;
+  /* messages queued while a send batch is open, indexed by is_ip4 */
+  u32 *send_bis[2];
+  u8 send_batch_open;
   u8 data[WG_DEFAULT_DATA_SIZE];
 } wg_per_thread_data_t;
 
@@ -74,7 +77,9 @@ extern wg_main_t wg_main;
 /**
  * Wireguard operation mode
  **/
-#define foreach_wg_op_mode_flags _ (0, ASYNC, "async")
+#define foreach_wg_op_mode_flags                                              \
+  _ (0, ASYNC, "async")                                                       \
+  _ (1, MULTI_WORKER, "multi-worker")
 
 /**
  * Helper function to set/unset and check op modes
@@ -119,6 +124,7 @@ STATIC_ASSERT (sizeof (wg_post_data_t) <=
 #define WG_START_EVENT	1
 void wg_feature_init (wg_main_t * wmp);
 void wg_set_async_mode (u32 is_enabled);
+void wg_set_multi_worker_mode (u32 is_enabled);
 
 void wg_secure_zero_memory (void *v, size_t n);
 
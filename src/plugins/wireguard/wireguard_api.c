@@ -407,6 +407,19 @@ vl_api_wg_set_async_mode_t_handler (vl_api_wg_set_async_mode_t *mp)
   REPLY_MACRO (VL_API_WG_SET_ASYNC_MODE_REPLY);
 }
 
+static void
+vl_api_wg_set_multi_worker_mode_t_handler (
+  vl_api_wg_set_multi_worker_mode_t *mp)
+{
+  wg_main_t *wmp = &wg_main;
+  vl_api_wg_set_multi_worker_mode_reply_t *rmp;
+  int rv = 0;
+
+  wg_set_multi_worker_mode (mp->enable);
+
+  REPLY_MACRO (VL_API_WG_SET_MULTI_WORKER_MODE_REPLY);
+}
+
 /* set tup the API message handling tables */
 #include <wireguard/wireguard.api.c>
 static clib_error_t *
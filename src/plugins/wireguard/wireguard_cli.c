@@ -385,6 +385,39 @@ VLIB_CLI_COMMAND (wg_set_async_mode_command, static) = {
   .function = wg_set_async_mode_command_fn,
 };
 
+static clib_error_t *
+wg_set_multi_worker_mode_command_fn (vlib_main_t *vm, unformat_input_t *input,
+				     vlib_cli_command_t *cmd)
+{
+  unformat_input_t _line_input, *line_input = &_line_input;
+  int enable = 0;
+
+  if (!unformat_user (input, unformat_line_input, line_input))
+    return 0;
+
+  while (unformat_check_input (line_input) != UNFORMAT_END_OF_INPUT)
+    {
+      if (unformat (line_input, "on"))
+	enable = 1;
+      else if (unformat (line_input, "off"))
+	enable = 0;
+      else
+	return (clib_error_return (0, "unknown input '%U'",
+				   format_unformat_error, line_input));
+    }
+
+  wg_set_multi_worker_mode (enable);
+
+  unformat_free (line_input);
+  return (NULL);
+}
+
+VLIB_CLI_COMMAND (wg_set_multi_worker_mode_command, static) = {
+  .path = "set wireguard multi-worker mode",
+  .short_help = "set wireguard multi-worker mode on|off",
+  .function = wg_set_multi_worker_mode_command_fn,
+};
+
 static clib_error_t *
 wg_show_mode_command_fn (vlib_main_t *vm, unformat_input_t *input,
 			 vlib_cli_command_t *cmd)
@@ -406,6 +439,266 @@ VLIB_CLI_COMMAND (wg_show_modemode_command, static) = {
   .function = wg_show_mode_command_fn,
 };
 
+/*
+ * Performance test: two noise peers handshaking with each other in memory,
+ * then exchanging data over the session, using the noise layer and the
+ * crypto ops the way the wireguard nodes do.
+ */
+typedef struct
+{
+  /* remote[i] is the peer as seen from local[i] */
+  noise_remote_t remote[2];
+  u32 local[2];
+  u32 n_indexes;
+} wg_perf_test_t;
+
+static wg_perf_test_t wg_perf_test;
+
+static noise_remote_t *
+wg_perf_remote_get (const uint8_t public[NOISE_PUBLIC_KEY_LEN])
+{
+  wg_perf_test_t *pt = &wg_perf_test;
+
+  for (int i = 0; i < 2; i++)
+    if (!clib_memcmp (pt->remote[i].r_public, public, NOISE_PUBLIC_KEY_LEN))
+      return &pt->remote[i];
+
+  return NULL;
+}
+
+static uint32_t
+wg_perf_index_set (vlib_main_t *vm, noise_remote_t *r)
+{
+  return ++wg_perf_test.n_indexes;
+}
+
+static void
+wg_perf_index_drop (vlib_main_t *vm, uint32_t key)
+{
+}
+
+static clib_error_t *
+wg_perf_handshakes (vlib_main_t *vm, wg_perf_test_t *pt, u32 n_handshakes,
+		    u32 batch)
+{
+  noise_remote_t *ri = &pt->remote[0], *rr;
+  noise_local_t *lr = noise_local_get (pt->local[1]);
+  u8 ue[NOISE_PUBLIC_KEY_LEN];
+  u8 es[NOISE_PUBLIC_KEY_LEN + NOISE_AUTHTAG_LEN];
+  u8 ets[NOISE_TIMESTAMP_LEN + NOISE_AUTHTAG_LEN];
+  u8 en[NOISE_AUTHTAG_LEN];
+  u32 s_idx, r_idx;
+  f64 t0, t1;
+
+  t0 = vlib_time_now (vm);
+
+  for (u32 i = 0; i < n_handshakes; i++)
+    {
+      if (!noise_create_initiation (vm, ri, &s_idx, ue, es, ets))
+	return clib_error_return (0, "create initiation failed");
+
+      /* back to back initiations of one peer would be taken as a replay
+       * or a flood */
+      pt->remote[1].r_last_init = 0;
+      clib_memset (pt->remote[1].r_timestamp, 0, NOISE_TIMESTAMP_LEN);
+
+      if (!noise_consume_initiation (vm, lr, &rr, s_idx, ue, es, ets))
+	return clib_error_return (0, "consume initiation failed");
+      if (!noise_create_response (vm, rr, &s_idx, &r_idx, ue, en))
+	return clib_error_return (0, "create response failed");
+      if (!noise_consume_response (vm, ri, s_idx, r_idx, ue, en))
+	return clib_error_return (0, "consume response failed");
+      if (!noise_remote_begin_session (vm, rr) ||
+	  !noise_remote_begin_session (vm, ri))
+	return clib_error_return (0, "begin session failed");
+
+      if ((i + 1) % batch == 0)
+	noise_keypairs_reclaim (vm);
+    }
+
+  noise_keypairs_reclaim (vm);
+  t1 = vlib_time_now (vm) - t0;
+
+  vlib_cli_output (vm, "handshakes: %u in %.3fs, %.0f/s, %.2f us each",
+		   n_handshakes, t1, n_handshakes / t1,
+		   t1 * 1e6 / n_handshakes);
+  return 0;
+}
+
+static clib_error_t *
+wg_perf_data (vlib_main_t *vm, wg_perf_test_t *pt, u32 n_packets, u32 size,
+	      u32 batch)
+{
+  noise_keypair_t *kp_tx = pt->remote[0].r_current;
+  noise_keypair_t *kp_rx = pt->remote[1].r_next;
+  vnet_crypto_op_t *ops = 0, *op;
+  u32 stride = round_pow2 (size + NOISE_AUTHTAG_LEN, CLIB_CACHE_LINE_BYTES);
+  u8 *data = 0, *plain = 0, *ivs = 0;
+  clib_error_t *err = 0;
+  u64 nonce, n_fail = 0, recv = 0;
+  u32 n, j;
+  f64 t0, t1;
+
+  if (!kp_tx || !kp_rx)
+    return clib_error_return (0, "no session");
+
+  vec_validate_aligned (data, batch * stride - 1, CLIB_CACHE_LINE_BYTES);
+  vec_validate_aligned (plain, batch * stride - 1, CLIB_CACHE_LINE_BYTES);
+  vec_validate (ivs, batch * 12 - 1);
+  vec_validate (ops, batch - 1);
+  for (j = 0; j < vec_len (data); j++)
+    data[j] = j;
+
+  /* encrypt, taking nonces from the per-thread block of the keypair */
+  t0 = vlib_time_now (vm);
+  for (n = 0; n < n_packets; n += batch)
+    {
+      for (j = 0; j < batch; j++)
+	{
+	  op = ops + j;
+	  nonce = noise_counter_send (&kp_tx->kp_ctr, vm->thread_index);
+	  clib_memset (ivs + j * 12, 0, 4);
+	  clib_memcpy (ivs + j * 12 + 4, &nonce, sizeof (nonce));
+
+	  vnet_crypto_op_init (op, VNET_CRYPTO_OP_CHACHA20_POLY1305_ENC);
+	  op->key_index = kp_tx->kp_send_index;
+	  op->src = op->dst = data + j * stride;
+	  op->len = size;
+	  op->tag = data + j * stride + size;
+	  op->tag_len = NOISE_AUTHTAG_LEN;
+	  op->iv = ivs + j * 12;
+	  op->aad = NULL;
+	  op->aad_len = 0;
+	}
+      vnet_crypto_process_ops (vm, ops, batch);
+    }
+  t1 = vlib_time_now (vm) - t0;
+
+  vec_foreach (op, ops)
+    n_fail += op->status != VNET_CRYPTO_OP_STATUS_COMPLETED;
+  vlib_cli_output (vm, "encrypt: %u packets of %u bytes, %.2f Gbps, %.2f Mpps",
+		   n, size, (f64) n * size * 8 / t1 * 1e-9, n / t1 * 1e-6);
+
+  /* decrypt the last batch over and over, running the replay window on a
+   * fresh counter for every packet */
+  t0 = vlib_time_now (vm);
+  for (n = 0; n < n_packets; n += batch)
+    {
+      for (j = 0; j < batch; j++)
+	{
+	  op = ops + j;
+	  vnet_crypto_op_init (op, VNET_CRYPTO_OP_CHACHA20_POLY1305_DEC);
+	  op->flags |= VNET_CRYPTO_OP_FLAG_HMAC_CHECK;
+	  op->key_index = kp_rx->kp_recv_index;
+	  op->src = data + j * stride;
+	  op->dst = plain + j * stride;
+	  op->len = size;
+	  op->tag = data + j * stride + size;
+	  op->tag_len = NOISE_AUTHTAG_LEN;
+	  op->iv = ivs + j * 12;
+	  op->aad = NULL;
+	  op->aad_len = 0;
+	}
+      vnet_crypto_process_ops (vm, ops, batch);
+
+      for (j = 0; j < batch; j++)
+	n_fail += !noise_counter_recv (&kp_rx->kp_ctr, recv++);
+    }
+  t1 = vlib_time_now (vm) - t0;
+
+  vec_foreach (op, ops)
+    n_fail += op->status != VNET_CRYPTO_OP_STATUS_COMPLETED;
+  vlib_cli_output (vm, "decrypt: %u packets of %u bytes, %.2f Gbps, %.2f Mpps",
+		   n, size, (f64) n * size * 8 / t1 * 1e-9, n / t1 * 1e-6);
+
+  if (n_fail)
+    err = clib_error_return (0, "%lu operations failed", n_fail);
+
+  vec_free (data);
+  vec_free (plain);
+  vec_free (ivs);
+  vec_free (ops);
+  return err;
+}
+
+static clib_error_t *
+wg_perf_test_command_fn (vlib_main_t *vm, unformat_input_t *input,
+			 vlib_cli_command_t *cmd)
+{
+  wg_perf_test_t *pt = &wg_perf_test;
+  struct noise_upcall upcall = {
+    .u_remote_get = wg_perf_remote_get,
+    .u_index_set = wg_perf_index_set,
+    .u_index_drop = wg_perf_index_drop,
+  };
+  u32 n_handshakes = 1000, n_packets = 1 << 20, size = 1420, batch = 64;
+  u8 private[NOISE_PUBLIC_KEY_LEN];
+  clib_error_t *err = 0;
+  noise_local_t *l;
+  int i;
+
+  while (unformat_check_input (input) != UNFORMAT_END_OF_INPUT)
+    {
+      if (unformat (input, "handshakes %u", &n_handshakes))
+	;
+      else if (unformat (input, "packets %u", &n_packets))
+	;
+      else if (unformat (input, "size %u", &size))
+	;
+      else if (unformat (input, "batch %u", &batch))
+	;
+      else
+	return clib_error_return (0, "unknown input '%U'",
+				  format_unformat_error, input);
+    }
+
+  if (batch == 0 || batch > VLIB_FRAME_SIZE)
+    return clib_error_return (0, "batch must be 1 to %u", VLIB_FRAME_SIZE);
+  if (n_handshakes == 0)
+    return clib_error_return (0, "at least one handshake is needed");
+
+  for (i = 0; i < 2; i++)
+    {
+      pool_get (noise_local_pool, l);
+      noise_local_init (l, &upcall);
+      curve25519_gen_secret (private);
+      if (!noise_local_set_private (l, private))
+	{
+	  pool_put (noise_local_pool, l);
+	  if (i)
+	    pool_put_index (noise_local_pool, pt->local[0]);
+	  return clib_error_return (0, "key generation failed");
+	}
+      pt->local[i] = l - noise_local_pool;
+    }
+
+  for (i = 0; i < 2; i++)
+    noise_remote_init (vm, &pt->remote[i], INDEX_INVALID,
+		       noise_local_get (pt->local[!i])->l_public,
+		       pt->local[i]);
+
+  err = wg_perf_handshakes (vm, pt, n_handshakes, batch);
+  if (!err && n_packets)
+    err = wg_perf_data (vm, pt, n_packets, size, batch);
+
+  for (i = 0; i < 2; i++)
+    {
+      noise_remote_clear (vm, &pt->remote[i]);
+      clib_rwlock_free (&pt->remote[i].r_keypair_lock);
+      pool_put_index (noise_local_pool, pt->local[i]);
+    }
+  wg_secure_zero_memory (private, sizeof (private));
+
+  return err;
+}
+
+VLIB_CLI_COMMAND (wg_perf_test_command, static) = {
+  .path = "test wireguard perf",
+  .short_help = "test wireguard perf [handshakes <n>] [packets <n>] "
+		"[size <n>] [batch <n>]",
+  .function = wg_perf_test_command_fn,
+};
+
 
 /*
  * fd.io coding-style-patch-verification: ON
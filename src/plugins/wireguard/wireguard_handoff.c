@@ -89,12 +89,17 @@ wg_handoff (vlib_main_t * vm,
       else if (mode == WG_HANDOFF_INP_DATA)
 	{
 	  message_data_t *data = vlib_buffer_get_current (b[0]);
-	  u32 *entry =
+	  peeri =
 	    wg_index_table_lookup (&wmp->index_table, data->receiver_index);
-	  peeri = *entry;
-	  peer = wg_peer_get (peeri);
-
-	  ti[0] = peer->input_thread_index;
+	  if (PREDICT_FALSE (peeri == INDEX_INVALID))
+	    /* the keypair went away since wg-input looked it up, the
+	     * main thread drops it */
+	    ti[0] = 0;
+	  else
+	    {
+	      peer = wg_peer_get (peeri);
+	      ti[0] = peer->input_thread_index;
+	    }
 	}
       else
 	{
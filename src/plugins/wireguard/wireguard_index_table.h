@@ -18,16 +18,40 @@
 
 #include <vlib/vlib.h>
 #include <vppinfra/types.h>
+#include <vnet/dpo/dpo.h>
+#include <vppinfra/bihash_8_8.h>
 
+/*
+ * Receiver index to peer index.
+ * Looked up by the workers for every packet and updated by the main
+ * thread on every handshake, so it is a bihash, which needs no worker
+ * barrier to add or remove entries.
+ */
 typedef struct
 {
-  uword *hash;
+  clib_bihash_8_8_t hash;
 } wg_index_table_t;
 
+#define WG_INDEX_TABLE_N_BUCKETS (64 << 10)
+#define WG_INDEX_TABLE_MEMORY_SIZE (64 << 20)
+
+void wg_index_table_init (wg_index_table_t *table);
 u32 wg_index_table_add (vlib_main_t *vm, wg_index_table_t *table,
 			u32 peer_pool_idx, u32 rnd_seed);
 void wg_index_table_del (vlib_main_t *vm, wg_index_table_t *table, u32 key);
-u32 *wg_index_table_lookup (const wg_index_table_t * table, u32 key);
+
+/* returns the peer index or INDEX_INVALID */
+static_always_inline index_t
+wg_index_table_lookup (const wg_index_table_t *table, u32 key)
+{
+  clib_bihash_kv_8_8_t kv = { .key = key };
+
+  if (clib_bihash_search_inline_8_8 ((clib_bihash_8_8_t *) &table->hash,
+				     &kv))
+    return INDEX_INVALID;
+
+  return kv.value;
+}
 
 #endif //__included_wg_index_table_h__
 
@@ -131,58 +131,52 @@ is_ip4_header (u8 *data)
   return (data[0] >> 4) == 0x4;
 }
 
-static wg_input_error_t
-wg_handshake_process (vlib_main_t *vm, wg_main_t *wmp, vlib_buffer_t *b,
-		      u32 node_idx, u8 is_ip4)
+/* state carried from MAC validation of a handshake message to its
+ * processing */
+typedef struct
 {
-  ASSERT (vm->thread_index == 0);
+  wg_if_t *wg_if;
+  message_macs_t *macs;
+  ip46_address_t src_ip;
+  u16 udp_src_port;
+  bool packet_needs_cookie;
+} wg_handshake_ctx_t;
 
+static wg_input_error_t
+wg_handshake_validate (vlib_main_t *vm, vlib_buffer_t *b, u8 is_ip4,
+		       wg_handshake_ctx_t *ctx)
+{
   enum cookie_mac_state mac_state;
-  bool packet_needs_cookie;
   bool under_load;
   index_t *wg_ifs;
   wg_if_t *wg_if;
-  wg_peer_t *peer = NULL;
 
   void *current_b_data = vlib_buffer_get_current (b);
 
-  ip46_address_t src_ip;
   if (is_ip4)
     {
       ip4_header_t *iph4 =
 	current_b_data - sizeof (udp_header_t) - sizeof (ip4_header_t);
-      ip46_address_set_ip4 (&src_ip, &iph4->src_address);
+      ip46_address_set_ip4 (&ctx->src_ip, &iph4->src_address);
     }
   else
     {
       ip6_header_t *iph6 =
 	current_b_data - sizeof (udp_header_t) - sizeof (ip6_header_t);
-      ip46_address_set_ip6 (&src_ip, &iph6->src_address);
+      ip46_address_set_ip6 (&ctx->src_ip, &iph6->src_address);
     }
 
   udp_header_t *uhd = current_b_data - sizeof (udp_header_t);
   u16 udp_src_port = clib_host_to_net_u16 (uhd->src_port);
   u16 udp_dst_port = clib_host_to_net_u16 (uhd->dst_port);
 
+  ctx->udp_src_port = udp_src_port;
+
   message_header_t *header = current_b_data;
 
+  /* cookie replies carry no MACs */
   if (PREDICT_FALSE (header->type == MESSAGE_HANDSHAKE_COOKIE))
-    {
-      message_handshake_cookie_t *packet =
-	(message_handshake_cookie_t *) current_b_data;
-      u32 *entry =
-	wg_index_table_lookup (&wmp->index_table, packet->receiver_index);
-      if (entry)
-	peer = wg_peer_get (*entry);
-      else
-	return WG_INPUT_ERROR_PEER;
-
-      if (!cookie_maker_consume_payload (
-	    vm, &peer->cookie_maker, packet->nonce, packet->encrypted_cookie))
-	return WG_INPUT_ERROR_COOKIE_DECRYPTION;
-
-      return WG_INPUT_ERROR_NONE;
-    }
+    return WG_INPUT_ERROR_NONE;
 
   u32 len = (header->type == MESSAGE_HANDSHAKE_INITIATION ?
 	     sizeof (message_handshake_initiation_t) :
@@ -205,7 +199,7 @@ wg_handshake_process (vlib_main_t *vm, wg_main_t *wmp, vlib_buffer_t *b,
       under_load = wg_if_is_under_load (vm, wg_if);
       mac_state = cookie_checker_validate_macs (
 	vm, &wg_if->cookie_checker, macs, current_b_data, len, under_load,
-	&src_ip, udp_src_port);
+	&ctx->src_ip, udp_src_port);
       if (mac_state == INVALID_MAC)
 	{
 	  wg_if_dec_handshake_num (wg_if);
@@ -220,14 +214,54 @@ wg_handshake_process (vlib_main_t *vm, wg_main_t *wmp, vlib_buffer_t *b,
 
   if ((under_load && mac_state == VALID_MAC_WITH_COOKIE)
       || (!under_load && mac_state == VALID_MAC_BUT_NO_COOKIE))
-    packet_needs_cookie = false;
+    ctx->packet_needs_cookie = false;
   else if (under_load && mac_state == VALID_MAC_BUT_NO_COOKIE)
-    packet_needs_cookie = true;
+    ctx->packet_needs_cookie = true;
   else if (mac_state == VALID_MAC_WITH_COOKIE_BUT_RATELIMITED)
     return WG_INPUT_ERROR_HANDSHAKE_RATELIMITED;
   else
     return WG_INPUT_ERROR_HANDSHAKE_MAC;
 
+  ctx->wg_if = wg_if;
+  ctx->macs = macs;
+
+  return WG_INPUT_ERROR_NONE;
+}
+
+static wg_input_error_t
+wg_handshake_consume (vlib_main_t *vm, wg_main_t *wmp, vlib_buffer_t *b,
+		      u32 node_idx, const wg_handshake_ctx_t *ctx)
+{
+  ASSERT (vm->thread_index == 0);
+
+  wg_if_t *wg_if = ctx->wg_if;
+  message_macs_t *macs = ctx->macs;
+  bool packet_needs_cookie = ctx->packet_needs_cookie;
+  ip46_address_t src_ip = ctx->src_ip;
+  u16 udp_src_port = ctx->udp_src_port;
+  wg_peer_t *peer = NULL;
+
+  void *current_b_data = vlib_buffer_get_current (b);
+  message_header_t *header = current_b_data;
+
+  if (PREDICT_FALSE (header->type == MESSAGE_HANDSHAKE_COOKIE))
+    {
+      message_handshake_cookie_t *packet =
+	(message_handshake_cookie_t *) current_b_data;
+      index_t peeri =
+	wg_index_table_lookup (&wmp->index_table, packet->receiver_index);
+      if (peeri != INDEX_INVALID)
+	peer = wg_peer_get (peeri);
+      else
+	return WG_INPUT_ERROR_PEER;
+
+      if (!cookie_maker_consume_payload (
+	    vm, &peer->cookie_maker, packet->nonce, packet->encrypted_cookie))
+	return WG_INPUT_ERROR_COOKIE_DECRYPTION;
+
+      return WG_INPUT_ERROR_NONE;
+    }
+
   switch (header->type)
     {
     case MESSAGE_HANDSHAKE_INITIATION:
@@ -283,13 +317,11 @@ wg_handshake_process (vlib_main_t *vm, wg_main_t *wmp, vlib_buffer_t *b,
 	    return WG_INPUT_ERROR_NONE;
 	  }
 
-	index_t peeri = INDEX_INVALID;
-	u32 *entry =
+	index_t peeri =
 	  wg_index_table_lookup (&wmp->index_table, resp->receiver_index);
 
-	if (PREDICT_TRUE (entry != NULL))
+	if (PREDICT_TRUE (peeri != INDEX_INVALID))
 	  {
-	    peeri = *entry;
 	    peer = wg_peer_get (peeri);
 	    if (wg_peer_is_dead (peer))
 	      return WG_INPUT_ERROR_PEER;
@@ -333,6 +365,46 @@ wg_handshake_process (vlib_main_t *vm, wg_main_t *wmp, vlib_buffer_t *b,
   return WG_INPUT_ERROR_NONE;
 }
 
+/*
+ * Process the handshake messages of one frame as a batch. MACs of all of
+ * them are checked before any of the Curve25519 work is done, so a flood
+ * of bogus or cookie-less initiations is dropped cheaply. The messages
+ * sent in reply go out in one frame per address family and keypairs
+ * replaced by the new sessions are reclaimed once for the whole batch.
+ */
+static void
+wg_handshake_process_batch (vlib_main_t *vm, wg_main_t *wmp,
+			    vlib_node_runtime_t *node, vlib_buffer_t **bufs,
+			    u16 *nexts, u32 n_hs, u8 is_ip4)
+{
+  wg_handshake_ctx_t ctx[VLIB_FRAME_SIZE];
+  wg_input_error_t err[VLIB_FRAME_SIZE];
+  u32 i;
+
+  ASSERT (vm->thread_index == 0);
+
+  for (i = 0; i < n_hs; i++)
+    err[i] = wg_handshake_validate (vm, bufs[i], is_ip4, &ctx[i]);
+
+  wg_send_batch_open (vm);
+
+  for (i = 0; i < n_hs; i++)
+    {
+      if (err[i] == WG_INPUT_ERROR_NONE)
+	err[i] =
+	  wg_handshake_consume (vm, wmp, bufs[i], node->node_index, &ctx[i]);
+
+      if (err[i] != WG_INPUT_ERROR_NONE)
+	{
+	  nexts[i] = WG_INPUT_NEXT_ERROR;
+	  bufs[i]->error = node->errors[err[i]];
+	}
+    }
+
+  wg_send_batch_close (vm);
+  noise_keypairs_reclaim (vm);
+}
+
 static_always_inline int
 wg_input_post_process (vlib_main_t *vm, vlib_buffer_t *b, u16 *next,
 		       wg_peer_t *peer, message_data_t *data,
@@ -636,10 +708,10 @@ wg_input_process (vlib_main_t *vm, wg_per_thread_data_t *ptd,
       clib_rwlock_writer_lock (&r->r_keypair_lock);
       if (kp == r->r_next && kp->kp_local_index == r_idx)
 	{
-	  noise_remote_keypair_free (vm, r, &r->r_previous);
-	  r->r_previous = r->r_current;
-	  r->r_current = r->r_next;
-	  r->r_next = NULL;
+	  noise_remote_keypair_retire (vm, r, r->r_previous);
+	  clib_atomic_store_rel_n (&r->r_previous, r->r_current);
+	  clib_atomic_store_rel_n (&r->r_current, r->r_next);
+	  clib_atomic_store_rel_n (&r->r_next, NULL);
 
 	  ret = SC_CONN_RESET;
 	  clib_rwlock_writer_unlock (&r->r_keypair_lock);
@@ -707,8 +779,11 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
   u32 other_bi[VLIB_FRAME_SIZE]; /* buffer index for drop or handoff */
   u16 other_nexts[VLIB_FRAME_SIZE], *other_next = other_nexts, n_other = 0;
   u16 data_nexts[VLIB_FRAME_SIZE], *data_next = data_nexts, n_data = 0;
+  vlib_buffer_t *hs_bufs[VLIB_FRAME_SIZE];
+  u16 hs_nexts[VLIB_FRAME_SIZE], hs_other[VLIB_FRAME_SIZE], n_hs = 0;
   u16 n_async = 0;
   const u8 is_async = wg_op_mode_is_set_ASYNC ();
+  const u8 is_multi_worker = wg_op_mode_is_set_MULTI_WORKER ();
   vnet_crypto_async_frame_t *async_frame = NULL;
 
   vlib_get_buffers (vm, from, bufs, n_left_from);
@@ -720,11 +795,10 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
   f64 time = clib_time_now (&vm->clib_time) + vm->time_offset;
 
   wg_peer_t *peer = NULL;
-  u32 *last_peer_time_idx = NULL;
+  index_t last_peer_time_idx = INDEX_INVALID;
   u32 last_rec_idx = ~0;
 
   bool is_keepalive = false;
-  u32 *peer_idx = NULL;
   index_t peeri = INDEX_INVALID;
 
   while (n_left_from > 0)
@@ -751,16 +825,13 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 	  u8 *iv_data = b[0]->pre_data;
 	  u32 buf_idx = from[b - bufs];
 	  u32 n_bufs;
-	  peer_idx = wg_index_table_lookup (&wmp->index_table,
-					    data->receiver_index);
 
 	  if (data->receiver_index != last_rec_idx)
 	    {
-	      peer_idx = wg_index_table_lookup (&wmp->index_table,
-						data->receiver_index);
-	      if (PREDICT_TRUE (peer_idx != NULL))
+	      peeri = wg_index_table_lookup (&wmp->index_table,
+					     data->receiver_index);
+	      if (PREDICT_TRUE (peeri != INDEX_INVALID))
 		{
-		  peeri = *peer_idx;
 		  peer = wg_peer_get (peeri);
 		  last_rec_idx = data->receiver_index;
 		}
@@ -771,7 +842,7 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 		}
 	    }
 
-	  if (PREDICT_FALSE (!peer_idx))
+	  if (PREDICT_FALSE (peeri == INDEX_INVALID))
 	    {
 	      other_next[n_other] = WG_INPUT_NEXT_ERROR;
 	      b[0]->error = node->errors[WG_INPUT_ERROR_PEER];
@@ -780,7 +851,10 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 	      goto out;
 	    }
 
-	  if (PREDICT_FALSE (~0 == peer->input_thread_index))
+	  /* in multi-worker mode the packets of a peer are decrypted by
+	   * whichever worker received them */
+	  if (PREDICT_FALSE (~0 == peer->input_thread_index) &&
+	      !is_multi_worker)
 	    {
 	      /* this is the first packet to use this peer, claim the peer
 	       * for this thread.
@@ -789,7 +863,8 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 					wg_peer_assign_thread (thread_index));
 	    }
 
-	  if (PREDICT_TRUE (thread_index != peer->input_thread_index))
+	  if (PREDICT_TRUE (thread_index != peer->input_thread_index) &&
+	      !is_multi_worker)
 	    {
 	      other_next[n_other] = WG_INPUT_NEXT_HANDOFF_DATA;
 	      other_bi[n_other] = buf_idx;
@@ -857,7 +932,7 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 
 	  if (PREDICT_FALSE (state_cr == SC_FAILED))
 	    {
-	      wg_peer_update_flags (*peer_idx, WG_PEER_ESTABLISHED, false);
+	      wg_peer_update_flags (peeri, WG_PEER_ESTABLISHED, false);
 	      other_next[n_other] = WG_INPUT_NEXT_ERROR;
 	      b[0]->error = node->errors[WG_INPUT_ERROR_DECRYPTION];
 	      other_bi[n_other] = buf_idx;
@@ -899,20 +974,13 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 	      goto next;
 	    }
 
-	  wg_input_error_t ret =
-	    wg_handshake_process (vm, wmp, b[0], node->node_index, is_ip4);
-	  if (ret != WG_INPUT_ERROR_NONE)
-	    {
-	      other_next[n_other] = WG_INPUT_NEXT_ERROR;
-	      b[0]->error = node->errors[ret];
-	      other_bi[n_other] = from[b - bufs];
-	      n_other += 1;
-	    }
-	  else
-	    {
-	      other_bi[n_other] = from[b - bufs];
-	      n_other += 1;
-	    }
+	  /* processed as a batch once the whole frame is seen */
+	  hs_bufs[n_hs] = b[0];
+	  hs_nexts[n_hs] = WG_INPUT_NEXT_PUNT;
+	  hs_other[n_hs] = n_other;
+	  n_hs += 1;
+	  other_bi[n_other] = from[b - bufs];
+	  n_other += 1;
 	}
 
     out:
@@ -923,7 +991,7 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 	  t->type = header_type;
 	  t->current_length = b[0]->current_length;
 	  t->is_keepalive = is_keepalive;
-	  t->peer = peer_idx ? peeri : INDEX_INVALID;
+	  t->peer = peeri;
 	}
 
     next:
@@ -931,6 +999,14 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
       b += 1;
     }
 
+  if (n_hs)
+    {
+      wg_handshake_process_batch (vm, wmp, node, hs_bufs, hs_nexts, n_hs,
+				  is_ip4);
+      for (u32 i = 0; i < n_hs; i++)
+	other_nexts[hs_other[i]] = hs_nexts[i];
+    }
+
   /* decrypt packets */
   wg_input_process_ops (vm, node, ptd->crypto_ops, data_bufs, data_nexts,
 			drop_next);
@@ -941,12 +1017,11 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
   b = data_bufs;
   n_left_from = n_data;
   last_rec_idx = ~0;
-  last_peer_time_idx = NULL;
+  last_peer_time_idx = INDEX_INVALID;
 
   while (n_left_from > 0)
     {
       bool is_keepalive = false;
-      u32 *peer_idx = NULL;
 
       if (PREDICT_FALSE (data_next[0] == WG_INPUT_NEXT_PUNT))
 	{
@@ -970,11 +1045,10 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 
       if (data->receiver_index != last_rec_idx)
 	{
-	  peer_idx =
+	  peeri =
 	    wg_index_table_lookup (&wmp->index_table, data->receiver_index);
-	  if (PREDICT_TRUE (peer_idx != NULL))
+	  if (PREDICT_TRUE (peeri != INDEX_INVALID))
 	    {
-	      peeri = *peer_idx;
 	      peer = wg_peer_get (peeri);
 	      last_rec_idx = data->receiver_index;
 	    }
@@ -997,7 +1071,7 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 	  goto trace;
 	}
 
-      if (PREDICT_FALSE (peer_idx && (last_peer_time_idx != peer_idx)))
+      if (PREDICT_FALSE (last_peer_time_idx != peeri))
 	{
 	  if (PREDICT_FALSE (
 		!ip46_address_is_equal (&peer->dst.addr, &out_src_ip) ||
@@ -1006,8 +1080,8 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 					     out_udp_src_port);
 	  wg_timers_any_authenticated_packet_received_opt (peer, time);
 	  wg_timers_any_authenticated_packet_traversal (peer);
-	  wg_peer_update_flags (*peer_idx, WG_PEER_ESTABLISHED, true);
-	  last_peer_time_idx = peer_idx;
+	  wg_peer_update_flags (peeri, WG_PEER_ESTABLISHED, true);
+	  last_peer_time_idx = peeri;
 	}
 
       vlib_increment_combined_counter (im->combined_sw_if_counters +
@@ -1023,7 +1097,7 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 	  t->type = header_type;
 	  t->current_length = b[0]->current_length;
 	  t->is_keepalive = is_keepalive;
-	  t->peer = peer_idx ? peeri : INDEX_INVALID;
+	  t->peer = peeri;
 	}
 
       b += 1;
@@ -1068,6 +1142,10 @@ wg_input_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
   if (n_data)
     vlib_buffer_enqueue_to_next (vm, node, data_bi, data_nexts, n_data);
 
+  /* keypairs replaced when the main thread confirmed a session */
+  if (thread_index == 0)
+    noise_keypairs_reclaim (vm);
+
   return frame->n_vectors;
 }
 
@@ -1083,8 +1161,7 @@ wg_input_post (vlib_main_t *vm, vlib_node_runtime_t *node, vlib_frame_t *frame,
   u32 *from = vlib_frame_vector_args (frame);
   u32 n_left = frame->n_vectors;
   wg_peer_t *peer = NULL;
-  u32 *peer_idx = NULL;
-  u32 *last_peer_time_idx = NULL;
+  index_t last_peer_time_idx = INDEX_INVALID;
   index_t peeri = INDEX_INVALID;
   u32 last_rec_idx = ~0;
   f64 time = clib_time_now (&vm->clib_time) + vm->time_offset;
@@ -1116,12 +1193,11 @@ wg_input_post (vlib_main_t *vm, vlib_node_runtime_t *node, vlib_frame_t *frame,
 
       if (data->receiver_index != last_rec_idx)
 	{
-	  peer_idx =
+	  peeri =
 	    wg_index_table_lookup (&wmp->index_table, data->receiver_index);
 
-	  if (PREDICT_TRUE (peer_idx != NULL))
+	  if (PREDICT_TRUE (peeri != INDEX_INVALID))
 	    {
-	      peeri = *peer_idx;
 	      peer = wg_peer_get (peeri);
 	      last_rec_idx = data->receiver_index;
 	    }
@@ -1144,7 +1220,7 @@ wg_input_post (vlib_main_t *vm, vlib_node_runtime_t *node, vlib_frame_t *frame,
 	  goto trace;
 	}
 
-      if (PREDICT_FALSE (peer_idx && (last_peer_time_idx != peer_idx)))
+      if (PREDICT_FALSE (last_peer_time_idx != peeri))
 	{
 	  if (PREDICT_FALSE (
 		!ip46_address_is_equal (&peer->dst.addr, &out_src_ip) ||
@@ -1153,8 +1229,8 @@ wg_input_post (vlib_main_t *vm, vlib_node_runtime_t *node, vlib_frame_t *frame,
 					     out_udp_src_port);
 	  wg_timers_any_authenticated_packet_received_opt (peer, time);
 	  wg_timers_any_authenticated_packet_traversal (peer);
-	  wg_peer_update_flags (*peer_idx, WG_PEER_ESTABLISHED, true);
-	  last_peer_time_idx = peer_idx;
+	  wg_peer_update_flags (peeri, WG_PEER_ESTABLISHED, true);
+	  last_peer_time_idx = peeri;
 	}
 
       vlib_increment_combined_counter (im->combined_sw_if_counters +
@@ -1169,7 +1245,7 @@ wg_input_post (vlib_main_t *vm, vlib_node_runtime_t *node, vlib_frame_t *frame,
 	  wg_input_post_trace_t *t =
 	    vlib_add_trace (vm, node, b[0], sizeof (*t));
 	  t->next = next[0];
-	  t->peer = peer_idx ? peeri : INDEX_INVALID;
+	  t->peer = peeri;
 	}
 
       b += 1;
@@ -29,17 +29,21 @@
 
 noise_local_t *noise_local_pool;
 
+/* keypairs waiting for the workers to stop using them */
+static noise_keypair_t **noise_retired_keypairs;
+
+/* Handshakes are all processed on the main thread, so they share one key
+ * for their AEAD steps instead of adding and deleting one per message */
+static u32 noise_handshake_key_index = ~0;
+
 /* Private functions */
 static noise_keypair_t *noise_remote_keypair_allocate (noise_remote_t *);
-static void noise_remote_keypair_free (vlib_main_t * vm, noise_remote_t *,
-				       noise_keypair_t **);
+static void noise_keypair_free (vlib_main_t *vm, noise_keypair_t *kp);
 static uint32_t noise_remote_handshake_index_get (vlib_main_t *vm,
 						  noise_remote_t *);
 static void noise_remote_handshake_index_drop (vlib_main_t *vm,
 					       noise_remote_t *);
-
-static uint64_t noise_counter_send (noise_counter_t *);
-bool noise_counter_recv (noise_counter_t *, uint64_t);
+static u32 noise_handshake_key (vlib_main_t *vm);
 
 static void noise_kdf (uint8_t *, uint8_t *, uint8_t *, const uint8_t *,
 		       size_t, size_t, size_t, size_t,
@@ -123,14 +127,11 @@ noise_create_initiation (vlib_main_t * vm, noise_remote_t * r,
 {
   noise_handshake_t *hs = &r->r_handshake;
   noise_local_t *l = noise_local_get (r->r_local_idx);
-  uint8_t _key[NOISE_SYMMETRIC_KEY_LEN] = { 0 };
   uint32_t key_idx;
   uint8_t *key;
   int ret = false;
 
-  key_idx =
-    vnet_crypto_key_add (vm, VNET_CRYPTO_ALG_CHACHA20_POLY1305, _key,
-			 NOISE_SYMMETRIC_KEY_LEN);
+  key_idx = noise_handshake_key (vm);
   key = vnet_crypto_get_key (key_idx)->data;
 
   noise_param_init (hs->hs_ck, hs->hs_hash, r->r_public);
@@ -165,7 +166,6 @@ noise_create_initiation (vlib_main_t * vm, noise_remote_t * r,
   ret = true;
 error:
   wg_secure_zero_memory (key, NOISE_SYMMETRIC_KEY_LEN);
-  vnet_crypto_key_del (vm, key_idx);
   return ret;
 }
 
@@ -180,16 +180,13 @@ noise_consume_initiation (vlib_main_t * vm, noise_local_t * l,
 {
   noise_remote_t *r;
   noise_handshake_t hs;
-  uint8_t _key[NOISE_SYMMETRIC_KEY_LEN] = { 0 };
   uint8_t r_public[NOISE_PUBLIC_KEY_LEN] = { 0 };
   uint8_t timestamp[NOISE_TIMESTAMP_LEN] = { 0 };
   u32 key_idx;
   uint8_t *key;
   int ret = false;
 
-  key_idx =
-    vnet_crypto_key_add (vm, VNET_CRYPTO_ALG_CHACHA20_POLY1305, _key,
-			 NOISE_SYMMETRIC_KEY_LEN);
+  key_idx = noise_handshake_key (vm);
   key = vnet_crypto_get_key (key_idx)->data;
 
   noise_param_init (hs.hs_ck, hs.hs_hash, l->l_public);
@@ -250,7 +247,6 @@ noise_consume_initiation (vlib_main_t * vm, noise_local_t * l,
 
 error:
   wg_secure_zero_memory (key, NOISE_SYMMETRIC_KEY_LEN);
-  vnet_crypto_key_del (vm, key_idx);
   wg_secure_zero_memory (&hs, sizeof (hs));
   return ret;
 }
@@ -261,15 +257,12 @@ noise_create_response (vlib_main_t * vm, noise_remote_t * r, uint32_t * s_idx,
 		       uint8_t en[0 + NOISE_AUTHTAG_LEN])
 {
   noise_handshake_t *hs = &r->r_handshake;
-  uint8_t _key[NOISE_SYMMETRIC_KEY_LEN] = { 0 };
   uint8_t e[NOISE_PUBLIC_KEY_LEN] = { 0 };
   uint32_t key_idx;
   uint8_t *key;
   int ret = false;
 
-  key_idx =
-    vnet_crypto_key_add (vm, VNET_CRYPTO_ALG_CHACHA20_POLY1305, _key,
-			 NOISE_SYMMETRIC_KEY_LEN);
+  key_idx = noise_handshake_key (vm);
   key = vnet_crypto_get_key (key_idx)->data;
 
   if (hs->hs_state != CONSUMED_INITIATION)
@@ -304,7 +297,6 @@ noise_create_response (vlib_main_t * vm, noise_remote_t * r, uint32_t * s_idx,
   ret = true;
 error:
   wg_secure_zero_memory (key, NOISE_SYMMETRIC_KEY_LEN);
-  vnet_crypto_key_del (vm, key_idx);
   wg_secure_zero_memory (e, NOISE_PUBLIC_KEY_LEN);
   return ret;
 }
@@ -316,15 +308,12 @@ noise_consume_response (vlib_main_t * vm, noise_remote_t * r, uint32_t s_idx,
 {
   noise_local_t *l = noise_local_get (r->r_local_idx);
   noise_handshake_t hs;
-  uint8_t _key[NOISE_SYMMETRIC_KEY_LEN] = { 0 };
   uint8_t preshared_key[NOISE_PUBLIC_KEY_LEN] = { 0 };
   uint32_t key_idx;
   uint8_t *key;
   int ret = false;
 
-  key_idx =
-    vnet_crypto_key_add (vm, VNET_CRYPTO_ALG_CHACHA20_POLY1305, _key,
-			 NOISE_SYMMETRIC_KEY_LEN);
+  key_idx = noise_handshake_key (vm);
   key = vnet_crypto_get_key (key_idx)->data;
 
   hs = r->r_handshake;
@@ -367,7 +356,6 @@ noise_consume_response (vlib_main_t * vm, noise_remote_t * r, uint32_t s_idx,
 error:
   wg_secure_zero_memory (&hs, sizeof (hs));
   wg_secure_zero_memory (key, NOISE_SYMMETRIC_KEY_LEN);
-  vnet_crypto_key_del (vm, key_idx);
   return ret;
 }
 
@@ -375,7 +363,7 @@ bool
 noise_remote_begin_session (vlib_main_t * vm, noise_remote_t * r)
 {
   noise_handshake_t *hs = &r->r_handshake;
-  noise_keypair_t kp, *next, *current, *previous;
+  noise_keypair_t kp, *new, *next, *current, *previous;
 
   uint8_t key_send[NOISE_SYMMETRIC_KEY_LEN];
   uint8_t key_recv[NOISE_SYMMETRIC_KEY_LEN];
@@ -411,11 +399,16 @@ noise_remote_begin_session (vlib_main_t * vm, noise_remote_t * r)
   kp.kp_remote_index = hs->hs_remote_index;
   kp.kp_birthdate = vlib_time_now (vm);
   clib_memset (&kp.kp_ctr, 0, sizeof (kp.kp_ctr));
+  vec_validate_aligned (kp.kp_ctr.c_send_blocks, vlib_get_n_threads () - 1,
+			CLIB_CACHE_LINE_BYTES);
 
-  /* Now we need to add_new_keypair */
+  new = noise_remote_keypair_allocate (r);
+  *new = kp;
+
+  /* Now we need to add_new_keypair. The workers read the keypair pointers
+   * without a lock, so the new keypair is published with a release store
+   * and the ones it replaces are retired rather than freed */
   clib_rwlock_writer_lock (&r->r_keypair_lock);
-  /* Activate barrier to synchronization keys between threads */
-  vlib_worker_thread_barrier_sync (vm);
   next = r->r_next;
   current = r->r_current;
   previous = r->r_previous;
@@ -424,30 +417,27 @@ noise_remote_begin_session (vlib_main_t * vm, noise_remote_t * r)
     {
       if (next != NULL)
 	{
-	  r->r_next = NULL;
-	  r->r_previous = next;
-	  noise_remote_keypair_free (vm, r, &current);
+	  clib_atomic_store_rel_n (&r->r_next, NULL);
+	  clib_atomic_store_rel_n (&r->r_previous, next);
+	  noise_remote_keypair_retire (vm, r, current);
 	}
       else
 	{
-	  r->r_previous = current;
+	  clib_atomic_store_rel_n (&r->r_previous, current);
 	}
 
-      noise_remote_keypair_free (vm, r, &previous);
+      noise_remote_keypair_retire (vm, r, previous);
 
-      r->r_current = noise_remote_keypair_allocate (r);
-      *r->r_current = kp;
+      clib_atomic_store_rel_n (&r->r_current, new);
     }
   else
     {
-      noise_remote_keypair_free (vm, r, &next);
-      r->r_previous = NULL;
-      noise_remote_keypair_free (vm, r, &previous);
+      noise_remote_keypair_retire (vm, r, next);
+      clib_atomic_store_rel_n (&r->r_previous, NULL);
+      noise_remote_keypair_retire (vm, r, previous);
 
-      r->r_next = noise_remote_keypair_allocate (r);
-      *r->r_next = kp;
+      clib_atomic_store_rel_n (&r->r_next, new);
     }
-  vlib_worker_thread_barrier_release (vm);
   clib_rwlock_writer_unlock (&r->r_keypair_lock);
 
   wg_secure_zero_memory (&r->r_handshake, sizeof (r->r_handshake));
@@ -463,13 +453,15 @@ noise_remote_clear (vlib_main_t * vm, noise_remote_t * r)
   wg_secure_zero_memory (&r->r_handshake, sizeof (r->r_handshake));
 
   clib_rwlock_writer_lock (&r->r_keypair_lock);
-  noise_remote_keypair_free (vm, r, &r->r_next);
-  noise_remote_keypair_free (vm, r, &r->r_current);
-  noise_remote_keypair_free (vm, r, &r->r_previous);
-  r->r_next = NULL;
-  r->r_current = NULL;
-  r->r_previous = NULL;
+  noise_remote_keypair_retire (vm, r, r->r_next);
+  noise_remote_keypair_retire (vm, r, r->r_current);
+  noise_remote_keypair_retire (vm, r, r->r_previous);
+  clib_atomic_store_rel_n (&r->r_next, NULL);
+  clib_atomic_store_rel_n (&r->r_current, NULL);
+  clib_atomic_store_rel_n (&r->r_previous, NULL);
   clib_rwlock_writer_unlock (&r->r_keypair_lock);
+
+  noise_keypairs_reclaim (vm);
 }
 
 void
@@ -522,7 +514,8 @@ noise_remote_encrypt (vlib_main_t * vm, noise_remote_t * r, uint32_t * r_idx,
   if (!kp->kp_valid ||
       wg_birthdate_has_expired (kp->kp_birthdate, REJECT_AFTER_TIME) ||
       kp->kp_ctr.c_recv >= REJECT_AFTER_MESSAGES ||
-      ((*nonce = noise_counter_send (&kp->kp_ctr)) > REJECT_AFTER_MESSAGES))
+      ((*nonce = noise_counter_send (&kp->kp_ctr, vm->thread_index)) >
+       REJECT_AFTER_MESSAGES))
     goto error;
 
   /* We encrypt into the same buffer, so the caller must ensure that buf
@@ -552,6 +545,51 @@ error:
   return ret;
 }
 
+static void
+noise_keypair_retire_thread_fn (noise_keypair_t **kp)
+{
+  vec_add1 (noise_retired_keypairs, *kp);
+  noise_keypairs_reclaim (vlib_get_main ());
+}
+
+void
+noise_remote_keypair_retire (vlib_main_t *vm, noise_remote_t *r,
+			     noise_keypair_t *kp)
+{
+  noise_local_t *local = noise_local_get (r->r_local_idx);
+  struct noise_upcall *u = &local->l_upcall;
+
+  if (kp == NULL)
+    return;
+
+  u->u_index_drop (vm, kp->kp_local_index);
+
+  if (vm->thread_index)
+    vlib_rpc_call_main_thread (noise_keypair_retire_thread_fn, (u8 *) &kp,
+			       sizeof (kp));
+  else
+    vec_add1 (noise_retired_keypairs, kp);
+}
+
+void
+noise_keypairs_reclaim (vlib_main_t *vm)
+{
+  noise_keypair_t **kp;
+
+  ASSERT (vm->thread_index == 0);
+
+  if (vec_len (noise_retired_keypairs) == 0)
+    return;
+
+  /* a worker that loaded the pointer before it was replaced is done with
+   * the keypair once it completes its current loop */
+  vlib_worker_wait_one_loop ();
+
+  vec_foreach (kp, noise_retired_keypairs)
+    noise_keypair_free (vm, *kp);
+  vec_reset_length (noise_retired_keypairs);
+}
+
 /* Private functions - these should not be called outside this file under any
  * circumstances. */
 static noise_keypair_t *
@@ -562,6 +600,30 @@ noise_remote_keypair_allocate (noise_remote_t * r)
   return kp;
 }
 
+static void
+noise_keypair_free (vlib_main_t *vm, noise_keypair_t *kp)
+{
+  vnet_crypto_key_del (vm, kp->kp_send_index);
+  vnet_crypto_key_del (vm, kp->kp_recv_index);
+  vec_free (kp->kp_ctr.c_send_blocks);
+  clib_mem_free (kp);
+}
+
+static u32
+noise_handshake_key (vlib_main_t *vm)
+{
+  u8 zero[NOISE_SYMMETRIC_KEY_LEN] = { 0 };
+
+  ASSERT (vm->thread_index == 0);
+
+  if (noise_handshake_key_index == ~0)
+    noise_handshake_key_index =
+      vnet_crypto_key_add (vm, VNET_CRYPTO_ALG_CHACHA20_POLY1305, zero,
+			   NOISE_SYMMETRIC_KEY_LEN);
+
+  return noise_handshake_key_index;
+}
+
 static uint32_t
 noise_remote_handshake_index_get (vlib_main_t *vm, noise_remote_t *r)
 {
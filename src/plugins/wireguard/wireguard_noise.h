@@ -36,9 +36,25 @@
 /* Constants for the counter */
 #define COUNTER_BITS_TOTAL	8192
 #define COUNTER_BITS		(sizeof(unsigned long) * 8)
-#define COUNTER_NUM		(COUNTER_BITS_TOTAL / COUNTER_BITS)
 #define COUNTER_WINDOW_SIZE	(COUNTER_BITS_TOTAL - COUNTER_BITS)
 
+/* The receive window is a ring of 64-bit slots, each holding the bitmap
+ * of one block of 32 counters in the low half and the block number in the
+ * high half, so setting a bit and recycling a slot for a newer block is a
+ * single compare-and-swap and packets of one keypair can be accepted on
+ * several threads at once. The ring covers twice the window, so a block
+ * is never recycled while it is inside the window. */
+#define COUNTER_BLOCK_BITS	32
+#define COUNTER_NUM		(2 * COUNTER_BITS_TOTAL / COUNTER_BLOCK_BITS)
+
+/* Nonces are reserved from the send counter in blocks of this size by each
+ * thread encrypting with the keypair. A thread that sends little holds on
+ * to its block while the others move the counter on, so the rest of the
+ * block is dropped once it is this far behind, before the receiver's
+ * window slides past it. */
+#define COUNTER_SEND_BLOCK	64
+#define COUNTER_SEND_STALE	(COUNTER_WINDOW_SIZE / 2)
+
 /* Constants for the keypair */
 #define REKEY_AFTER_MESSAGES	(1ull << 60)
 #define REJECT_AFTER_MESSAGES	(UINT64_MAX - COUNTER_WINDOW_SIZE - 1)
@@ -76,11 +92,20 @@ typedef struct noise_handshake
   uint8_t hs_ck[NOISE_HASH_LEN];
 } noise_handshake_t;
 
+typedef struct noise_counter_block
+{
+  CLIB_CACHE_LINE_ALIGN_MARK (cacheline0);
+  uint64_t cb_next;
+  uint64_t cb_end;
+} noise_counter_block_t;
+
 typedef struct noise_counter
 {
   uint64_t c_send;
   uint64_t c_recv;
-  unsigned long c_backtrack[COUNTER_NUM];
+  /* per-thread nonce blocks */
+  noise_counter_block_t *c_send_blocks;
+  uint64_t c_backtrack[COUNTER_NUM];
 } noise_counter_t;
 
 typedef struct noise_keypair
@@ -137,11 +162,21 @@ noise_local_get (uint32_t locali)
 }
 
 static_always_inline uint64_t
-noise_counter_send (noise_counter_t *ctr)
+noise_counter_send (noise_counter_t *ctr, u32 thread_index)
 {
-  uint64_t ret;
-  ret = ctr->c_send++;
-  return ret;
+  noise_counter_block_t *cb =
+    vec_elt_at_index (ctr->c_send_blocks, thread_index);
+
+  if (PREDICT_FALSE (cb->cb_next == cb->cb_end ||
+		     clib_atomic_load_relax_n (&ctr->c_send) - cb->cb_next >
+		       COUNTER_SEND_STALE))
+    {
+      cb->cb_next =
+	clib_atomic_fetch_add_relax (&ctr->c_send, COUNTER_SEND_BLOCK);
+      cb->cb_end = cb->cb_next + COUNTER_SEND_BLOCK;
+    }
+
+  return cb->cb_next++;
 }
 
 void noise_local_init (noise_local_t *, struct noise_upcall *);
@@ -217,61 +252,63 @@ wg_get_active_keypair (noise_remote_t *r, uint32_t r_idx)
     }
 }
 
-inline bool
+/* number of blocks blk is ahead of the block held in the slot */
+static_always_inline i32
+noise_counter_block_diff (u32 blk, u64 slot)
+{
+  return (i32) (blk - (u32) (slot >> 32));
+}
+
+static_always_inline bool
 noise_counter_recv (noise_counter_t *ctr, uint64_t recv)
 {
-  uint64_t i, top, index_recv, index_ctr;
-  unsigned long bit;
-  bool ret = false;
+  u64 blk = recv / COUNTER_BLOCK_BITS;
+  u64 *slot = ctr->c_backtrack + (blk & (COUNTER_NUM - 1));
+  u64 bit = 1ULL << (recv % COUNTER_BLOCK_BITS);
+  u64 old, new, cur;
+  i32 diff;
+
+  cur = __atomic_load_n (&ctr->c_recv, __ATOMIC_RELAXED);
 
   /* Check that the recv counter is valid */
-  if (ctr->c_recv >= REJECT_AFTER_MESSAGES || recv >= REJECT_AFTER_MESSAGES)
-    goto error;
+  if (cur >= REJECT_AFTER_MESSAGES || recv >= REJECT_AFTER_MESSAGES)
+    return false;
 
   /* If the packet is out of the window, invalid */
-  if (recv + COUNTER_WINDOW_SIZE < ctr->c_recv)
-    goto error;
-
-  /* If the new counter is ahead of the current counter, we'll need to
-   * zero out the bitmap that has previously been used */
-  index_recv = recv / COUNTER_BITS;
-  index_ctr = ctr->c_recv / COUNTER_BITS;
+  if (recv + COUNTER_WINDOW_SIZE < cur)
+    return false;
 
-  if (recv > ctr->c_recv)
+  /* Test and set the bit, taking over the slot if it still holds an
+   * older block, which has left the window by now */
+  old = __atomic_load_n (slot, __ATOMIC_RELAXED);
+  do
     {
-      top = clib_min (index_recv - index_ctr, COUNTER_NUM);
-      for (i = 1; i <= top; i++)
-	ctr->c_backtrack[(i + index_ctr) & (COUNTER_NUM - 1)] = 0;
-      ctr->c_recv = recv;
+      diff = noise_counter_block_diff ((u32) blk, old);
+      if (diff < 0 || (diff == 0 && (old & bit)))
+	return false;
+      new = diff ? (u64) (u32) blk << 32 | bit : old | bit;
     }
+  while (!__atomic_compare_exchange_n (slot, &old, new, 0, __ATOMIC_RELAXED,
+				       __ATOMIC_RELAXED));
 
-  index_recv %= COUNTER_NUM;
-  bit = 1ul << (recv % COUNTER_BITS);
-
-  if (ctr->c_backtrack[index_recv] & bit)
-    goto error;
+  while (recv > cur &&
+	 !__atomic_compare_exchange_n (&ctr->c_recv, &cur, recv, 0,
+				       __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    ;
 
-  ctr->c_backtrack[index_recv] |= bit;
-
-  ret = true;
-error:
-  return ret;
+  return true;
 }
 
-static_always_inline void
-noise_remote_keypair_free (vlib_main_t *vm, noise_remote_t *r,
-			   noise_keypair_t **kp)
-{
-  noise_local_t *local = noise_local_get (r->r_local_idx);
-  struct noise_upcall *u = &local->l_upcall;
-  if (*kp)
-    {
-      u->u_index_drop (vm, (*kp)->kp_local_index);
-      vnet_crypto_key_del (vm, (*kp)->kp_send_index);
-      vnet_crypto_key_del (vm, (*kp)->kp_recv_index);
-      clib_mem_free (*kp);
-    }
-}
+/*
+ * The workers use the keypairs without a lock, so a keypair replaced by a
+ * new session is only retired: its index is dropped at once, but the
+ * keypair and its keys are freed by noise_keypairs_reclaim () on the main
+ * thread, after the workers have finished the frame they may be using it
+ * in. Retiring from a worker hands the keypair over to the main thread.
+ */
+void noise_remote_keypair_retire (vlib_main_t *vm, noise_remote_t *r,
+				  noise_keypair_t *kp);
+void noise_keypairs_reclaim (vlib_main_t *vm);
 
 #endif /* __included_wg_noise_h__ */
 
@@ -292,7 +292,8 @@ wg_output_tun_process (vlib_main_t *vm, wg_per_thread_data_t *ptd,
       wg_birthdate_has_expired_opt (kp->kp_birthdate, REJECT_AFTER_TIME,
 				    time) ||
       kp->kp_ctr.c_recv >= REJECT_AFTER_MESSAGES ||
-      ((*nonce = noise_counter_send (&kp->kp_ctr)) > REJECT_AFTER_MESSAGES))
+      ((*nonce = noise_counter_send (&kp->kp_ctr, vm->thread_index)) >
+       REJECT_AFTER_MESSAGES))
     goto error;
 
   /* We encrypt into the same buffer, so the caller must ensure that buf
@@ -352,7 +353,8 @@ wg_add_to_async_frame (vlib_main_t *vm, wg_per_thread_data_t *ptd,
       wg_birthdate_has_expired_opt (kp->kp_birthdate, REJECT_AFTER_TIME,
 				    time) ||
       kp->kp_ctr.c_recv >= REJECT_AFTER_MESSAGES ||
-      ((*nonce = noise_counter_send (&kp->kp_ctr)) > REJECT_AFTER_MESSAGES))
+      ((*nonce = noise_counter_send (&kp->kp_ctr, vm->thread_index)) >
+       REJECT_AFTER_MESSAGES))
     goto error;
 
   /* We encrypt into the same buffer, so the caller must ensure that buf
@@ -440,6 +442,7 @@ wg_output_tun_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
   u16 n_sync = 0;
   const u16 drop_next = WG_OUTPUT_NEXT_ERROR;
   const u8 is_async = wg_op_mode_is_set_ASYNC ();
+  const u8 is_multi_worker = wg_op_mode_is_set_MULTI_WORKER ();
   vnet_crypto_async_frame_t *async_frame = NULL;
   u16 n_async = 0;
   u16 noop_nexts[VLIB_FRAME_SIZE], *noop_next = noop_nexts, n_noop = 0;
@@ -502,7 +505,10 @@ wg_output_tun_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 	  b[0]->error = node->errors[WG_OUTPUT_ERROR_PEER];
 	  goto out;
 	}
-      if (PREDICT_FALSE (~0 == peer->output_thread_index))
+      /* in multi-worker mode a peer is encrypted for on every worker,
+       * each one taking nonces from its own block of the send counter */
+      if (PREDICT_FALSE (~0 == peer->output_thread_index) &&
+	  !is_multi_worker)
 	{
 	  /* this is the first packet to use this peer, claim the peer
 	   * for this thread.
@@ -511,7 +517,8 @@ wg_output_tun_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 				    wg_peer_assign_thread (thread_index));
 	}
 
-      if (PREDICT_FALSE (thread_index != peer->output_thread_index))
+      if (PREDICT_FALSE (thread_index != peer->output_thread_index) &&
+	  !is_multi_worker)
 	{
 	  noop_next[0] = WG_OUTPUT_NEXT_HANDOFF;
 	  err = WG_OUTPUT_NEXT_HANDOFF;
@@ -24,10 +24,18 @@
 static int
 ip46_enqueue_packet (vlib_main_t *vm, u32 bi0, int is_ip4)
 {
+  wg_per_thread_data_t *ptd =
+    vec_elt_at_index (wg_main.per_thread_data, vm->thread_index);
   vlib_frame_t *f = 0;
   u32 lookup_node_index =
     is_ip4 ? ip4_lookup_node.index : ip6_lookup_node.index;
 
+  if (ptd->send_batch_open)
+    {
+      vec_add1 (ptd->send_bis[is_ip4], bi0);
+      return 1;
+    }
+
   f = vlib_get_frame_to_node (vm, lookup_node_index);
   /* f can not be NULL here - frame allocation failure causes panic */
 
@@ -40,6 +48,48 @@ ip46_enqueue_packet (vlib_main_t *vm, u32 bi0, int is_ip4)
   return f->n_vectors;
 }
 
+void
+wg_send_batch_open (vlib_main_t *vm)
+{
+  wg_per_thread_data_t *ptd =
+    vec_elt_at_index (wg_main.per_thread_data, vm->thread_index);
+
+  ptd->send_batch_open = 1;
+}
+
+void
+wg_send_batch_close (vlib_main_t *vm)
+{
+  wg_per_thread_data_t *ptd =
+    vec_elt_at_index (wg_main.per_thread_data, vm->thread_index);
+  u32 is_ip4, n_left, n, *bi;
+  vlib_frame_t *f;
+
+  for (is_ip4 = 0; is_ip4 < 2; is_ip4++)
+    {
+      u32 lookup_node_index =
+	is_ip4 ? ip4_lookup_node.index : ip6_lookup_node.index;
+
+      bi = ptd->send_bis[is_ip4];
+      n_left = vec_len (bi);
+
+      while (n_left)
+	{
+	  n = clib_min (n_left, VLIB_FRAME_SIZE);
+	  f = vlib_get_frame_to_node (vm, lookup_node_index);
+	  vlib_buffer_copy_indices (vlib_frame_vector_args (f), bi, n);
+	  f->n_vectors = n;
+	  vlib_put_frame_to_node (vm, lookup_node_index, f);
+	  bi += n;
+	  n_left -= n;
+	}
+
+      vec_reset_length (ptd->send_bis[is_ip4]);
+    }
+
+  ptd->send_batch_open = 0;
+}
+
 static void
 wg_buffer_prepend_rewrite (vlib_main_t *vm, vlib_buffer_t *b0,
 			   const u8 *rewrite, u8 is_ip4)
@@ -31,6 +31,13 @@ bool wg_send_handshake_cookie (vlib_main_t *vm, u32 sender_index,
 			       ip46_address_t *wg_if_addr, u16 wg_if_port,
 			       ip46_address_t *remote_addr, u16 remote_port);
 
+/**
+ * Queue the messages sent by this thread until the batch is closed and
+ * hand them to ip4/6-lookup in full frames then
+ */
+void wg_send_batch_open (vlib_main_t *vm);
+void wg_send_batch_close (vlib_main_t *vm);
+
 always_inline void
 ip4_header_set_len_w_chksum (ip4_header_t * ip4, u16 len)
 {
@@ -25,6 +25,40 @@ static init_fn client_init_fns[SSVM_N_SEGMENT_TYPES] =
 static delete_fn delete_fns[SSVM_N_SEGMENT_TYPES] =
   { ssvm_delete_shm, ssvm_delete_memfd, ssvm_delete_private };
 
+/**
+ * Fault in all pages of a newly mapped server segment
+ *
+ * If numa binding is requested, pages are faulted in while the calling
+ * thread's memory policy is bound to the segment's numa node, so binding
+ * implies prefaulting. Avoids page faults later on when segment memory is
+ * first used, e.g., by fifo allocations on session setup.
+ */
+static int
+ssvm_server_prefault (ssvm_private_t *ssvm, void *base, uword size,
+		      uword page_size)
+{
+  u8 *p, *end = (u8 *) base + size;
+
+  if (!ssvm->prefault && !ssvm->numa_bind)
+    return 0;
+
+  if (ssvm->numa_bind &&
+      clib_mem_set_numa_affinity (ssvm->numa, 1 /* force */))
+    {
+      clib_warning ("failed to bind segment '%s' to numa %u", ssvm->name,
+		    ssvm->numa);
+      return SSVM_API_ERROR_CREATE_FAILURE;
+    }
+
+  for (p = base; p < end; p += page_size)
+    *(volatile u8 *) p = 0;
+
+  if (ssvm->numa_bind)
+    clib_mem_set_default_numa_affinity ();
+
+  return 0;
+}
+
 int
 ssvm_server_init_shm (ssvm_private_t * ssvm)
 {
@@ -265,6 +299,14 @@ ssvm_server_init_memfd (ssvm_private_t * memfd)
       return SSVM_API_ERROR_CREATE_FAILURE;
     }
 
+  if (ssvm_server_prefault (memfd, sh, memfd->ssvm_size,
+			    1ULL << log2_page_size))
+    {
+      clib_mem_vm_unmap (sh);
+      close (memfd->fd);
+      return SSVM_API_ERROR_CREATE_FAILURE;
+    }
+
   memfd->sh = sh;
   memfd->my_pid = getpid ();
   memfd->is_server = 1;
@@ -388,6 +430,12 @@ ssvm_server_init_private (ssvm_private_t * ssvm)
       return SSVM_API_ERROR_CREATE_FAILURE;
     }
 
+  if (ssvm_server_prefault (ssvm, sh, rnd_size + page_size, page_size))
+    {
+      clib_mem_vm_unmap (sh);
+      return SSVM_API_ERROR_CREATE_FAILURE;
+    }
+
   heap = clib_mem_create_heap ((u8 *) sh + page_size, rnd_size,
 			       1 /* locked */ , "ssvm server private");
   if (heap == 0)
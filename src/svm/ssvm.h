@@ -85,7 +85,9 @@ typedef struct
   uword requested_va;
   u32 my_pid;
   u8 *name;
-  u8 numa;			/**< UNUSED: numa requested at alloc time */
+  u8 numa;			/**< numa node for segment memory */
+  u8 numa_bind;			/**< bind segment memory to @ref numa */
+  u8 prefault;			/**< fault in all pages at creation */
   int is_server;
   int huge_page;
   union
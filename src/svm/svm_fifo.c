@@ -1234,6 +1234,70 @@ svm_fifo_fill_chunk_list (svm_fifo_t * f)
   return 0;
 }
 
+u32
+svm_fifo_compact (svm_fifo_t *f, u32 max_bytes)
+{
+  svm_fifo_chunk_t *c, *old, *prev;
+  fs_sptr_t last = F_INVALID_CPTR;
+  u32 head, tail, len, n_bytes;
+  rb_node_t *n;
+
+  if (f->ooos_list_head != OOO_SEGMENT_INVALID_INDEX)
+    return 0;
+
+  f_load_head_tail_all_acq (f, &head, &tail);
+  len = f_cursize (f, head, tail);
+
+  old = f_start_cptr (f);
+  n_bytes = f_chunk_end (f_end_cptr (f)) - old->start_byte;
+  if (n_bytes <= max_bytes || len >= max_bytes)
+    return 0;
+
+  c = fsh_alloc_chunk (f->fs_hdr, f->shr->slice_index, max_bytes);
+  if (PREDICT_FALSE (!c))
+    return 0;
+
+  /* Only worth it if a single, smaller chunk could be allocated */
+  if (c->next || c->length >= n_bytes || c->length <= len)
+    {
+      fsh_collect_chunks (f->fs_hdr, f->shr->slice_index, c);
+      return 0;
+    }
+
+  if (len)
+    svm_fifo_copy_from_chunk (f, svm_fifo_find_chunk (f, head), head,
+			      c->data, len, &last);
+
+  /* Drop ooo lookup state of old chunks, if any */
+  prev = old;
+  while (prev)
+    {
+      if (prev->enq_rb_index != RBTREE_TNIL_INDEX)
+	{
+	  n = rb_node (&f->ooo_enq_lookup, prev->enq_rb_index);
+	  rb_tree_del_node (&f->ooo_enq_lookup, n);
+	}
+      if (prev->deq_rb_index != RBTREE_TNIL_INDEX)
+	{
+	  n = rb_node (&f->ooo_deq_lookup, prev->deq_rb_index);
+	  rb_tree_del_node (&f->ooo_deq_lookup, n);
+	}
+      prev = f_cptr (f, prev->next);
+    }
+
+  c->start_byte = head;
+  c->enq_rb_index = c->deq_rb_index = RBTREE_TNIL_INDEX;
+
+  f->shr->start_chunk = f->shr->end_chunk = f_csptr (f, c);
+  f->shr->head_chunk = f->shr->tail_chunk = f_csptr (f, c);
+  f->ooo_deq = f->ooo_enq = 0;
+
+  n_bytes -= c->length;
+  fsh_collect_chunks (f->fs_hdr, f->shr->slice_index, old);
+
+  return n_bytes;
+}
+
 int
 svm_fifo_provision_chunks (svm_fifo_t *f, svm_fifo_seg_t *fs, u32 n_segs,
 			   u32 len)
@@ -249,6 +249,23 @@ svm_fifo_chunk_t *svm_fifo_chunk_alloc (u32 size);
  * @param f	fifo
  */
 int svm_fifo_fill_chunk_list (svm_fifo_t * f);
+/**
+ * Compact fifo chunk list
+ *
+ * Replaces the fifo's chunk list with a single chunk of at most
+ * @a max_bytes, rounded up to chunk size, and returns the old chunks to
+ * the fifo segment slice. Data not yet dequeued is copied to the new
+ * chunk. Fifos with out-of-order data, or with more data than fits into
+ * @a max_bytes, are not compacted.
+ *
+ * Both producer and consumer must be quiescent, so this is only safe
+ * if both ends of the fifo are owned by the caller's thread.
+ *
+ * @param f		fifo
+ * @param max_bytes	upper bound for bytes left allocated to fifo
+ * @return		number of chunk bytes released
+ */
+u32 svm_fifo_compact (svm_fifo_t *f, u32 max_bytes);
 /**
  * Provision and return chunks for number of bytes requested
  *
@@ -143,6 +143,13 @@ failed:
   vec_free (fds);
 }
 
+static void
+vl_api_app_attach_v2_reply_t_handler (vl_api_app_attach_v2_reply_t *mp)
+{
+  /* same layout as the v1 reply */
+  vl_api_app_attach_reply_t_handler ((vl_api_app_attach_reply_t *) mp);
+}
+
 static void
 vl_api_app_worker_add_del_reply_t_handler (vl_api_app_worker_add_del_reply_t *
 					   mp)
@@ -267,6 +274,7 @@ vl_api_app_del_cert_key_pair_reply_t_handler (
 #define foreach_sock_msg                                                      \
   _ (SESSION_ENABLE_DISABLE_REPLY, session_enable_disable_reply)              \
   _ (APP_ATTACH_REPLY, app_attach_reply)                                      \
+  _ (APP_ATTACH_V2_REPLY, app_attach_v2_reply)                                \
   _ (APP_ADD_CERT_KEY_PAIR_REPLY, app_add_cert_key_pair_reply)                \
   _ (APP_DEL_CERT_KEY_PAIR_REPLY, app_del_cert_key_pair_reply)                \
   _ (APP_WORKER_ADD_DEL_REPLY, app_worker_add_del_reply)
@@ -341,7 +349,7 @@ vcl_bapi_send_attach (void)
 {
   vcl_worker_t *wrk = vcl_worker_get_current ();
   u8 tls_engine = CRYPTO_ENGINE_OPENSSL;
-  vl_api_app_attach_t *bmp;
+  vl_api_app_attach_v2_t *bmp;
   u8 nsid_len = vec_len (vcm->cfg.namespace_id);
   u8 app_is_proxy = (vcm->cfg.app_proxy_transport_tcp ||
 		     vcm->cfg.app_proxy_transport_udp);
@@ -351,7 +359,7 @@ vcl_bapi_send_attach (void)
   bmp = vl_msg_api_alloc (sizeof (*bmp));
   memset (bmp, 0, sizeof (*bmp));
 
-  bmp->_vl_msg_id = ntohs (REPLY_MSG_ID_BASE + VL_API_APP_ATTACH);
+  bmp->_vl_msg_id = ntohs (REPLY_MSG_ID_BASE + VL_API_APP_ATTACH_V2);
   bmp->client_index = wrk->api_client_handle;
   bmp->context = htonl (0xfeedface);
   bmp->options[APP_OPTIONS_FLAGS] =
@@ -361,6 +369,8 @@ vcl_bapi_send_attach (void)
     (app_is_proxy ? APP_OPTIONS_FLAGS_IS_PROXY : 0) |
     (vcm->cfg.use_mq_eventfd ? APP_OPTIONS_FLAGS_EVT_MQ_USE_EVENTFD : 0) |
     (vcm->cfg.huge_page ? APP_OPTIONS_FLAGS_USE_HUGE_PAGE : 0) |
+    (vcm->cfg.segment_prefault ? APP_OPTIONS_FLAGS_PREFAULT_SEGMENTS : 0) |
+    (vcm->cfg.segment_numa_bind ? APP_OPTIONS_FLAGS_NUMA_BIND_SEGMENTS : 0) |
     (vcm->cfg.app_original_dst ? APP_OPTIONS_FLAGS_GET_ORIGINAL_DST : 0);
   bmp->options[APP_OPTIONS_PROXY_TRANSPORT] =
     (u64) ((vcm->cfg.app_proxy_transport_tcp ? 1 << TRANSPORT_PROTO_TCP : 0) |
@@ -373,6 +383,8 @@ vcl_bapi_send_attach (void)
     vcm->cfg.preallocated_fifo_pairs;
   bmp->options[APP_OPTIONS_EVT_QUEUE_SIZE] = vcm->cfg.event_queue_size;
   bmp->options[APP_OPTIONS_TLS_ENGINE] = tls_engine;
+  bmp->options[APP_OPTIONS_NUMA_NODE] = vcm->cfg.segment_numa_node;
+  bmp->options[APP_OPTIONS_PREALLOC_CHUNKS] = vcm->cfg.prealloc_chunks;
   if (nsid_len)
     {
       vl_api_vec_to_api_string (vcm->cfg.namespace_id, &bmp->namespace_id);
@@ -474,7 +486,7 @@ vcl_bapi_send_app_del_cert_key_pair (u32 ckpair_index)
 u32
 vcl_bapi_max_nsid_len (void)
 {
-  vl_api_app_attach_t *mp;
+  vl_api_app_attach_v2_t *mp;
   return (sizeof (mp->namespace_id) - 1);
 }
 
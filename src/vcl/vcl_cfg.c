@@ -225,7 +225,7 @@ vppcom_cfg_read_file (char *conf_fname)
   unformat_input_t _line_input, *line_input = &_line_input;
   u8 vc_cfg_input = 0;
   struct stat s;
-  u32 uid, gid;
+  u32 uid, gid, tmp;
 
   fd = open (conf_fname, O_RDONLY);
   if (fd < 0)
@@ -422,6 +422,43 @@ vppcom_cfg_read_file (char *conf_fname)
 	      VCFG_DBG (0, "VCL<%d>: configured huge_page (%d)", getpid (),
 			vcl_cfg->huge_page);
 	    }
+	  else if (unformat (line_input, "segment-prefault"))
+	    {
+	      vcl_cfg->segment_prefault = 1;
+	      VCFG_DBG (0, "VCL<%d>: configured segment_prefault (%d)",
+			getpid (), vcl_cfg->segment_prefault);
+	    }
+	  else if (unformat (line_input, "segment-numa-node %u", &tmp))
+	    {
+	      if (tmp < CLIB_MAX_NUMAS)
+		{
+		  vcl_cfg->segment_numa_node = tmp;
+		  vcl_cfg->segment_numa_bind = 1;
+		  VCFG_DBG (0, "VCL<%d>: configured segment_numa_node %u",
+			    getpid (), vcl_cfg->segment_numa_node);
+		}
+	      else
+		clib_warning ("VCL<%d>: invalid segment-numa-node %u",
+			      getpid (), tmp);
+	    }
+	  else if (unformat (line_input, "prealloc-chunks %u",
+			     &vcl_cfg->prealloc_chunks))
+	    {
+	      VCFG_DBG (0, "VCL<%d>: configured prealloc_chunks %u",
+			getpid (), vcl_cfg->prealloc_chunks);
+	    }
+	  else if (unformat (line_input, "io-evt-batch %u",
+			     &vcl_cfg->io_evt_batch))
+	    {
+	      VCFG_DBG (0, "VCL<%d>: configured io_evt_batch %u", getpid (),
+			vcl_cfg->io_evt_batch);
+	    }
+	  else if (unformat (line_input, "epoll-busy-poll-us %u",
+			     &vcl_cfg->epoll_busy_poll_us))
+	    {
+	      VCFG_DBG (0, "VCL<%d>: configured epoll_busy_poll_us %u",
+			getpid (), vcl_cfg->epoll_busy_poll_us);
+	    }
 	  else if (unformat (line_input, "namespace-secret %lu",
 			     &vcl_cfg->namespace_secret))
 	    {
@@ -609,6 +646,39 @@ vppcom_cfg (vppcom_cfg_t * vcl_cfg)
       VCFG_DBG (0, "VCL<%d>: configured " VPPCOM_ENV_APP_USE_MQ_EVENTFD,
 		getpid ());
     }
+  env_var_str = getenv (VPPCOM_ENV_IO_EVT_BATCH);
+  if (env_var_str)
+    {
+      if (sscanf (env_var_str, "%u", &vcm->cfg.io_evt_batch) != 1)
+	{
+	  VCFG_DBG (0, "VCL<%d>: WARNING: Invalid io event batch specified"
+		    " in the environment variable " VPPCOM_ENV_IO_EVT_BATCH
+		    " (%s)!\n", getpid (), env_var_str);
+	}
+      else
+	{
+	  VCFG_DBG (0, "VCL<%d>: configured io_evt_batch (%u) from "
+		    VPPCOM_ENV_IO_EVT_BATCH "!", getpid (),
+		    vcm->cfg.io_evt_batch);
+	}
+    }
+  env_var_str = getenv (VPPCOM_ENV_EPOLL_BUSY_POLL_US);
+  if (env_var_str)
+    {
+      if (sscanf (env_var_str, "%u", &vcm->cfg.epoll_busy_poll_us) != 1)
+	{
+	  VCFG_DBG (0, "VCL<%d>: WARNING: Invalid epoll busy-poll time"
+		    " specified in the environment variable "
+		    VPPCOM_ENV_EPOLL_BUSY_POLL_US " (%s)!\n", getpid (),
+		    env_var_str);
+	}
+      else
+	{
+	  VCFG_DBG (0, "VCL<%d>: configured epoll_busy_poll_us (%u) from "
+		    VPPCOM_ENV_EPOLL_BUSY_POLL_US "!", getpid (),
+		    vcm->cfg.epoll_busy_poll_us);
+	}
+    }
 }
 
 /*
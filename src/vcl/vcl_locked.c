@@ -318,7 +318,13 @@ vls_mt_add (void)
 	VERR ("failed to register worker");
     }
   else
-    vcl_set_worker_index (vlsl->vls_wrk_index);
+    {
+      vcl_set_worker_index (vlsl->vls_wrk_index);
+      /* Another thread may be blocked in epoll/select on the shared worker
+       * while this one writes, so batched io events could be left pending
+       * for as long as the wait lasts. Send them right away */
+      vcl_worker_get_current ()->io_evt_batch = 0;
+    }
 
   /* Only allow new pthread to be cancled in vls_mt_mq_lock */
   if (vlsl->vls_mt_n_threads >= 2)
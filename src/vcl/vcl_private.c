@@ -165,6 +165,8 @@ vcl_worker_cleanup (vcl_worker_t * wrk, u8 notify_vpp)
   vec_free (wrk->mq_msg_vector);
   vec_free (wrk->unhandled_evts_vector);
   vec_free (wrk->pending_session_wrk_updates);
+  vec_free (wrk->pending_io_evts);
+  vec_free (wrk->io_evts_batch);
   clib_bitmap_free (wrk->rd_bitmap);
   clib_bitmap_free (wrk->wr_bitmap);
   clib_bitmap_free (wrk->ex_bitmap);
@@ -172,6 +174,40 @@ vcl_worker_cleanup (vcl_worker_t * wrk, u8 notify_vpp)
   clib_spinlock_unlock (&vcm->workers_lock);
 }
 
+void
+vcl_worker_flush_io_evts (vcl_worker_t *wrk)
+{
+  vcl_io_evt_t *pe;
+  session_event_t *e;
+  u32 n_left;
+  svm_msg_q_t *mq;
+
+  n_left = vec_len (wrk->pending_io_evts);
+
+  /* Events are typically for a handful of vpp workers, so group them per
+   * vpp mq with multiple passes over the pending vector */
+  while (n_left)
+    {
+      mq = 0;
+      vec_foreach (pe, wrk->pending_io_evts)
+	{
+	  if (!pe->mq || (mq && pe->mq != mq))
+	    continue;
+	  mq = pe->mq;
+	  vec_add2 (wrk->io_evts_batch, e, 1);
+	  e->session_index = pe->session_index;
+	  e->event_type = pe->event_type;
+	  pe->mq = 0;
+	  n_left -= 1;
+	}
+      app_send_io_evts_to_vpp (mq, wrk->io_evts_batch,
+			       vec_len (wrk->io_evts_batch));
+      vec_reset_length (wrk->io_evts_batch);
+    }
+
+  vec_reset_length (wrk->pending_io_evts);
+}
+
 static void
 vcl_worker_cleanup_cb (void *arg)
 {
@@ -292,6 +328,8 @@ vcl_worker_alloc_and_init ()
     }
 
   wrk->ep_lt_current = VCL_INVALID_SESSION_INDEX;
+  wrk->busy_poll_budget = vcm->cfg.epoll_busy_poll_us / 1e6;
+  wrk->io_evt_batch = vcm->cfg.io_evt_batch;
   wrk->session_index_by_vpp_handles = hash_create (0, sizeof (uword));
   clib_time_init (&wrk->clib_time);
   vec_validate (wrk->mq_events, 64);
@@ -218,6 +218,12 @@ typedef struct vppcom_cfg_t_
   u8 mt_wrk_supported;
   u8 huge_page;
   u8 app_original_dst;
+  u8 segment_prefault;		/**< prefault fifo segment memory */
+  u8 segment_numa_bind;		/**< bind segments to segment_numa_node */
+  u32 segment_numa_node;
+  u32 prealloc_chunks;		/**< fifo chunks preallocated per slice */
+  u32 io_evt_batch;		/**< io events sent to vpp per batch */
+  u32 epoll_busy_poll_us;	/**< max time epoll spins before sleeping */
 } vppcom_cfg_t;
 
 void vppcom_cfg (vppcom_cfg_t * vcl_cfg);
@@ -237,6 +243,13 @@ typedef struct vcl_mq_evt_conn_
   int mq_fd;
 } vcl_mq_evt_conn_t;
 
+typedef struct vcl_io_evt_
+{
+  svm_msg_q_t *mq;	/**< vpp worker mq the event is for */
+  u32 session_index;	/**< vpp session index */
+  u8 event_type;
+} vcl_io_evt_t;
+
 typedef void (*vcl_worker_wait_mq_fn) (u32 vcl_sh);
 typedef struct vcl_worker_
 {
@@ -297,6 +310,25 @@ typedef struct vcl_worker_
 
   u32 *pending_session_wrk_updates;
 
+  /** Io events to vpp not yet sent. Used if io events are batched */
+  vcl_io_evt_t *pending_io_evts;
+
+  /** Max io events batched before sending to vpp. 0 if not batching */
+  u32 io_evt_batch;
+
+  /** Per vpp mq batch of io events being flushed */
+  session_event_t *io_evts_batch;
+
+  /** Time epoll wait currently spins on mqs before sleeping. Adapted
+   *  between 0 and the configured epoll busy-poll time */
+  f64 busy_poll_budget;
+
+  /** Epoll busy-poll stats */
+  u64 n_busy_poll_hits;
+  u64 n_busy_poll_sleeps;
+  f64 busy_poll_spin_time;
+  f64 busy_poll_sleep_time;
+
   /** Used also as a thread stop key buffer */
   pthread_t thread_id;
 
@@ -728,6 +760,7 @@ int vcl_worker_register_with_vpp (void);
 svm_msg_q_t *vcl_worker_ctrl_mq (vcl_worker_t * wrk);
 
 void vcl_flush_mq_events (void);
+void vcl_worker_flush_io_evts (vcl_worker_t *wrk);
 int vcl_session_cleanup (vcl_worker_t * wrk, vcl_session_t * session,
 			 vcl_session_handle_t sh, u8 do_disconnect);
 
@@ -761,6 +794,38 @@ vcl_worker_get_current (void)
   return vcl_worker_get (vcl_get_worker_index ());
 }
 
+/**
+ * Send io event to vpp
+ *
+ * If io event batching is configured, events of nonblocking sessions are
+ * only queued and sent together with other pending events, once the batch
+ * fills up, before the worker waits for events from vpp, when select, poll
+ * or epoll wait are called and whenever a nonblocking call would block.
+ * Blocking sessions send their events right away, as the app may not call
+ * into vcl again until vpp acts on them.
+ */
+static inline void
+vcl_send_io_evt_to_vpp (vcl_worker_t *wrk, vcl_session_t *s,
+			u32 session_index, u8 evt_type)
+{
+  vcl_io_evt_t *evt;
+
+  if (!wrk->io_evt_batch || !vcl_session_has_attr (s, VCL_SESS_ATTR_NONBLOCK))
+    {
+      app_send_io_evt_to_vpp (s->vpp_evt_q, session_index, evt_type,
+			      SVM_Q_WAIT);
+      return;
+    }
+
+  vec_add2 (wrk->pending_io_evts, evt, 1);
+  evt->mq = s->vpp_evt_q;
+  evt->session_index = session_index;
+  evt->event_type = evt_type;
+
+  if (vec_len (wrk->pending_io_evts) >= wrk->io_evt_batch)
+    vcl_worker_flush_io_evts (wrk);
+}
+
 static inline u8
 vcl_n_workers (void)
 {
@@ -115,7 +115,8 @@ static int
 vcl_api_send_attach (clib_socket_t * cs)
 {
   app_sapi_msg_t msg = { 0 };
-  app_sapi_attach_msg_t *mp = &msg.attach;
+  app_sapi_attach_v2_msg_t *mp = &msg.attach_v2;
+  u64 options[APP_OPTIONS_N_OPTIONS] = { 0 };
   u8 app_is_proxy, tls_engine;
   clib_error_t *err;
 
@@ -124,27 +125,33 @@ vcl_api_send_attach (clib_socket_t * cs)
   tls_engine = CRYPTO_ENGINE_OPENSSL;
 
   clib_memcpy (&mp->name, vcm->app_name, vec_len (vcm->app_name));
-  mp->options[APP_OPTIONS_FLAGS] =
+  options[APP_OPTIONS_FLAGS] =
     APP_OPTIONS_FLAGS_ACCEPT_REDIRECT | APP_OPTIONS_FLAGS_ADD_SEGMENT |
     (vcm->cfg.app_scope_local ? APP_OPTIONS_FLAGS_USE_LOCAL_SCOPE : 0) |
     (vcm->cfg.app_scope_global ? APP_OPTIONS_FLAGS_USE_GLOBAL_SCOPE : 0) |
     (app_is_proxy ? APP_OPTIONS_FLAGS_IS_PROXY : 0) |
     (vcm->cfg.use_mq_eventfd ? APP_OPTIONS_FLAGS_EVT_MQ_USE_EVENTFD : 0) |
     (vcm->cfg.huge_page ? APP_OPTIONS_FLAGS_USE_HUGE_PAGE : 0) |
+    (vcm->cfg.segment_prefault ? APP_OPTIONS_FLAGS_PREFAULT_SEGMENTS : 0) |
+    (vcm->cfg.segment_numa_bind ? APP_OPTIONS_FLAGS_NUMA_BIND_SEGMENTS : 0) |
     (vcm->cfg.app_original_dst ? APP_OPTIONS_FLAGS_GET_ORIGINAL_DST : 0);
-  mp->options[APP_OPTIONS_PROXY_TRANSPORT] =
+  options[APP_OPTIONS_PROXY_TRANSPORT] =
     (u64) ((vcm->cfg.app_proxy_transport_tcp ? 1 << TRANSPORT_PROTO_TCP : 0) |
 	   (vcm->cfg.app_proxy_transport_udp ? 1 << TRANSPORT_PROTO_UDP : 0));
-  mp->options[APP_OPTIONS_SEGMENT_SIZE] = vcm->cfg.segment_size;
-  mp->options[APP_OPTIONS_ADD_SEGMENT_SIZE] = vcm->cfg.add_segment_size;
-  mp->options[APP_OPTIONS_RX_FIFO_SIZE] = vcm->cfg.rx_fifo_size;
-  mp->options[APP_OPTIONS_TX_FIFO_SIZE] = vcm->cfg.tx_fifo_size;
-  mp->options[APP_OPTIONS_PREALLOC_FIFO_PAIRS] =
+  options[APP_OPTIONS_SEGMENT_SIZE] = vcm->cfg.segment_size;
+  options[APP_OPTIONS_ADD_SEGMENT_SIZE] = vcm->cfg.add_segment_size;
+  options[APP_OPTIONS_RX_FIFO_SIZE] = vcm->cfg.rx_fifo_size;
+  options[APP_OPTIONS_TX_FIFO_SIZE] = vcm->cfg.tx_fifo_size;
+  options[APP_OPTIONS_PREALLOC_FIFO_PAIRS] =
     vcm->cfg.preallocated_fifo_pairs;
-  mp->options[APP_OPTIONS_EVT_QUEUE_SIZE] = vcm->cfg.event_queue_size;
-  mp->options[APP_OPTIONS_TLS_ENGINE] = tls_engine;
+  options[APP_OPTIONS_EVT_QUEUE_SIZE] = vcm->cfg.event_queue_size;
+  options[APP_OPTIONS_TLS_ENGINE] = tls_engine;
+  options[APP_OPTIONS_NUMA_NODE] = vcm->cfg.segment_numa_node;
+  options[APP_OPTIONS_PREALLOC_CHUNKS] = vcm->cfg.prealloc_chunks;
 
-  msg.type = APP_SAPI_MSG_TYPE_ATTACH;
+  mp->n_options = APP_OPTIONS_N_OPTIONS;
+
+  msg.type = APP_SAPI_MSG_TYPE_ATTACH_V2;
   err = clib_socket_sendmsg (cs, &msg, sizeof (msg), 0, 0);
   if (err)
     {
@@ -152,6 +159,13 @@ vcl_api_send_attach (clib_socket_t * cs)
       return -1;
     }
 
+  err = clib_socket_sendmsg (cs, options, sizeof (options), 0, 0);
+  if (err)
+    {
+      clib_error_report (err);
+      return -1;
+    }
+
   return 0;
 }
 
@@ -144,6 +144,9 @@ vcl_send_session_shutdown (vcl_worker_t *wrk, vcl_session_t *s)
   session_shutdown_msg_t *mp;
   svm_msg_q_t *mq;
 
+  /* Make sure vpp sees pending io events before the shutdown */
+  vcl_worker_flush_io_evts (wrk);
+
   /* Send to thread that owns the session */
   mq = s->vpp_evt_q;
   app_alloc_ctrl_evt_to_vpp (mq, app_evt, SESSION_CTRL_EVT_SHUTDOWN);
@@ -161,6 +164,9 @@ vcl_send_session_disconnect (vcl_worker_t * wrk, vcl_session_t * s)
   session_disconnect_msg_t *mp;
   svm_msg_q_t *mq;
 
+  /* Make sure vpp sees pending io events before the disconnect */
+  vcl_worker_flush_io_evts (wrk);
+
   /* Send to thread that owns the session */
   mq = s->vpp_evt_q;
   app_alloc_ctrl_evt_to_vpp (mq, app_evt, SESSION_CTRL_EVT_DISCONNECT);
@@ -1268,6 +1274,8 @@ vcl_worker_wait_mq (vcl_worker_t *wrk, u32 session_handle,
   if (wrk->pre_wait_fn)
     wrk->pre_wait_fn (session_handle);
 
+  vcl_worker_flush_io_evts (wrk);
+
   if (session_handle != VCL_INVALID_SESSION_INDEX)
     {
       s = vcl_session_get_w_handle (wrk, session_handle);
@@ -2144,6 +2152,7 @@ vppcom_session_read_internal (uint32_t session_handle, void *buf, int n,
 	{
 	  if (vcl_session_is_closing (s))
 	    return vcl_session_closing_error (s);
+	  vcl_worker_flush_io_evts (wrk);
 	  return VPPCOM_EWOULDBLOCK;
 	}
       while (svm_fifo_is_empty_cons (rx_fifo))
@@ -2210,8 +2219,8 @@ read_again:
   if (PREDICT_FALSE (svm_fifo_needs_deq_ntf (rx_fifo, n_read)))
     {
       svm_fifo_clear_deq_ntf (rx_fifo);
-      app_send_io_evt_to_vpp (s->vpp_evt_q, s->rx_fifo->vpp_session_index,
-			      SESSION_IO_EVT_RX, SVM_Q_WAIT);
+      vcl_send_io_evt_to_vpp (wrk, s, s->rx_fifo->vpp_session_index,
+			      SESSION_IO_EVT_RX);
     }
 
   VDBG (2, "session %u[0x%llx]: read %d bytes from (%p)", s->session_index,
@@ -2264,6 +2273,7 @@ vppcom_session_read_segments (uint32_t session_handle,
 	{
 	  if (vcl_session_is_closing (s))
 	    return vcl_session_closing_error (s);
+	  vcl_worker_flush_io_evts (wrk);
 	  return VPPCOM_EWOULDBLOCK;
 	}
       while (svm_fifo_is_empty_cons (rx_fifo))
@@ -2382,6 +2392,7 @@ vppcom_session_write_inline (vcl_worker_t *wrk, vcl_session_t *s, void *buf,
     {
       if (is_nonblocking)
 	{
+	  vcl_worker_flush_io_evts (wrk);
 	  return VPPCOM_EWOULDBLOCK;
 	}
       while (!vcl_fifo_is_writeable (tx_fifo, n, is_dgram))
@@ -2415,8 +2426,7 @@ vppcom_session_write_inline (vcl_worker_t *wrk, vcl_session_t *s, void *buf,
     }
 
   if (svm_fifo_set_event (s->tx_fifo))
-    app_send_io_evt_to_vpp (s->vpp_evt_q, s->tx_fifo->vpp_session_index, et,
-			    SVM_Q_WAIT);
+    vcl_send_io_evt_to_vpp (wrk, s, s->tx_fifo->vpp_session_index, et);
 
   /* The underlying fifo segment can run out of memory */
   if (PREDICT_FALSE (n_write < 0))
@@ -2467,6 +2477,7 @@ vppcom_session_write_segments (uint32_t session_handle,
     {
       if (is_nonblocking)
 	{
+	  vcl_worker_flush_io_evts (wrk);
 	  return VPPCOM_EWOULDBLOCK;
 	}
       while (svm_fifo_max_enqueue_prod (tx_fifo) < n_bytes)
@@ -2490,9 +2501,8 @@ vppcom_session_write_segments (uint32_t session_handle,
     return VPPCOM_EAGAIN;
 
   if (svm_fifo_set_event (s->tx_fifo))
-    app_send_io_evt_to_vpp (s->vpp_evt_q,
-			    s->tx_fifo->shr->master_session_index,
-			    SESSION_IO_EVT_TX, SVM_Q_WAIT);
+    vcl_send_io_evt_to_vpp (wrk, s, s->tx_fifo->shr->master_session_index,
+			    SESSION_IO_EVT_TX);
 
   return n_write;
 }
@@ -2838,6 +2848,8 @@ vppcom_select (int n_bits, vcl_si_set * read_map, vcl_si_set * write_map,
   vcl_session_t *s = 0;
   int i;
 
+  vcl_worker_flush_io_evts (wrk);
+
   if (n_bits && read_map)
     {
       clib_bitmap_validate (wrk->rd_bitmap, minbits);
@@ -3622,6 +3634,76 @@ vppcom_epoll_wait_eventfd (vcl_worker_t *wrk, struct epoll_event *events,
   return 0;
 }
 
+/**
+ * Spin on worker's mq for at most the current busy-poll budget
+ *
+ * If a timeout is provided, it is updated to account for the time spent
+ * spinning and set to 0 if it expired.
+ */
+static u32
+vppcom_epoll_busy_poll (vcl_worker_t *wrk, struct epoll_event *events,
+			int maxevents, double *timeout_ms)
+{
+  f64 start, now, end;
+  u32 n_evts = 0;
+
+  start = now = clib_time_now (&wrk->clib_time);
+  end = start + wrk->busy_poll_budget;
+  if (*timeout_ms > 0)
+    end = clib_min (end, start + *timeout_ms / 1e3);
+
+  do
+    {
+      vcl_epoll_wait_handle_mq (wrk, wrk->app_event_queue, events, maxevents,
+				0 /* do not wait */, &n_evts);
+      if (n_evts)
+	break;
+      CLIB_PAUSE ();
+      now = clib_time_now (&wrk->clib_time);
+    }
+  while (now < end);
+
+  now = clib_time_now (&wrk->clib_time);
+  wrk->busy_poll_spin_time += now - start;
+
+  if (n_evts)
+    {
+      wrk->n_busy_poll_hits += 1;
+      return n_evts;
+    }
+
+  if (*timeout_ms > 0)
+    *timeout_ms = clib_max (*timeout_ms - (now - start) * 1e3, 0);
+
+  return 0;
+}
+
+/**
+ * Adapt busy-poll budget after worker had to sleep for @param slept
+ *
+ * If events arrived shortly after we stopped spinning, spinning for the
+ * full configured time would've caught them, so restore the budget.
+ * Otherwise, traffic is sparse so halve the time burned before sleeping.
+ */
+static void
+vppcom_epoll_busy_poll_adapt (vcl_worker_t *wrk, f64 slept, u32 n_evts)
+{
+  f64 max_budget = vcm->cfg.epoll_busy_poll_us / 1e6;
+
+  wrk->n_busy_poll_sleeps += 1;
+  wrk->busy_poll_sleep_time += slept;
+
+  if (n_evts && slept < max_budget)
+    {
+      wrk->busy_poll_budget = max_budget;
+      return;
+    }
+
+  wrk->busy_poll_budget /= 2;
+  if (wrk->busy_poll_budget < 1e-6)
+    wrk->busy_poll_budget = 0;
+}
+
 static void
 vcl_epoll_wait_handle_lt (vcl_worker_t *wrk, struct epoll_event *events,
 			  int maxevents, u32 *n_evts)
@@ -3721,6 +3803,8 @@ vppcom_epoll_wait (uint32_t vep_handle, struct epoll_event *events,
       return VPPCOM_EINVAL;
     }
 
+  vcl_worker_flush_io_evts (wrk);
+
   if (vec_len (wrk->unhandled_evts_vector))
     {
       for (i = 0; i < vec_len (wrk->unhandled_evts_vector); i++)
@@ -3743,6 +3827,32 @@ vppcom_epoll_wait (uint32_t vep_handle, struct epoll_event *events,
   if ((int) wait_for_time == -2)
     return n_evts;
 
+  /* Spin before sleeping if asked to wait for events */
+  if (vcm->cfg.epoll_busy_poll_us && wait_for_time != 0 && !n_evts &&
+      wrk->api_client_handle != ~0)
+    {
+      f64 sleep_start;
+
+      if (wrk->busy_poll_budget > 0)
+	{
+	  n_evts = vppcom_epoll_busy_poll (wrk, events, maxevents,
+					   &wait_for_time);
+	  if (n_evts || wait_for_time == 0)
+	    return n_evts;
+	}
+
+      sleep_start = clib_time_now (&wrk->clib_time);
+      if (vcm->cfg.use_mq_eventfd)
+	n_evts = vppcom_epoll_wait_eventfd (wrk, events, maxevents, n_evts,
+					    wait_for_time);
+      else
+	n_evts = vppcom_epoll_wait_condvar (wrk, events, maxevents, n_evts,
+					    wait_for_time);
+      vppcom_epoll_busy_poll_adapt (
+	wrk, clib_time_now (&wrk->clib_time) - sleep_start, n_evts);
+
+      return n_evts;
+    }
 
   if (vcm->cfg.use_mq_eventfd)
     n_evts = vppcom_epoll_wait_eventfd (wrk, events, maxevents, n_evts,
@@ -4613,6 +4723,8 @@ vppcom_poll (vcl_poll_t * vp, uint32_t n_sids, double wait_for_time)
   if (!vp)
     return VPPCOM_EFAULT;
 
+  vcl_worker_flush_io_evts (wrk);
+
   do
     {
       vcl_session_t *session;
@@ -4953,6 +5065,23 @@ vppcom_worker_is_detached (void)
   return wrk->api_client_handle == ~0;
 }
 
+int
+vppcom_worker_busy_poll_stats (vppcom_busy_poll_stats_t *stats)
+{
+  vcl_worker_t *wrk = vcl_worker_get_current ();
+
+  if (!stats)
+    return VPPCOM_EINVAL;
+
+  stats->n_spin_hits = wrk->n_busy_poll_hits;
+  stats->n_sleeps = wrk->n_busy_poll_sleeps;
+  stats->spin_time = wrk->busy_poll_spin_time;
+  stats->sleep_time = wrk->busy_poll_sleep_time;
+  stats->spin_budget = wrk->busy_poll_budget;
+
+  return VPPCOM_OK;
+}
+
 /*
  * fd.io coding-style-patch-verification: ON
  *
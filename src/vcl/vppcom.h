@@ -48,6 +48,8 @@ extern "C"
 #define VPPCOM_ENV_APP_USE_MQ_EVENTFD		"VCL_APP_USE_MQ_EVENTFD"
 #define VPPCOM_ENV_VPP_API_SOCKET           	"VCL_VPP_API_SOCKET"
 #define VPPCOM_ENV_VPP_SAPI_SOCKET		"VCL_VPP_SAPI_SOCKET"
+#define VPPCOM_ENV_IO_EVT_BATCH			"VCL_IO_EVT_BATCH"
+#define VPPCOM_ENV_EPOLL_BUSY_POLL_US		"VCL_EPOLL_BUSY_POLL_US"
 
 typedef enum vppcom_proto_
 {
@@ -205,6 +207,15 @@ typedef struct vppcom_data_segment_
 
 typedef vppcom_data_segment_t vppcom_data_segments_t[2];
 
+typedef struct vppcom_busy_poll_stats_
+{
+  uint64_t n_spin_hits;		/**< waits that found events while spinning */
+  uint64_t n_sleeps;		/**< waits that fell back to sleeping */
+  double spin_time;		/**< seconds spent spinning */
+  double sleep_time;		/**< seconds spent sleeping */
+  double spin_budget;		/**< current spin budget, in seconds */
+} vppcom_busy_poll_stats_t;
+
 typedef unsigned long vcl_si_set;
 
 /*
@@ -322,6 +333,13 @@ extern int vppcom_session_get_error (uint32_t session_handle);
  */
 extern int vppcom_worker_is_detached (void);
 
+/**
+ * Retrieve current worker's epoll busy-poll stats
+ *
+ * Only meaningful if vcl is configured with `epoll-busy-poll-us`
+ */
+extern int vppcom_worker_busy_poll_stats (vppcom_busy_poll_stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -98,6 +98,38 @@ vlib_validate_simple_counter (vlib_simple_counter_main_t * cm, u32 index)
   cm->counters = vlib_stats_get_entry_data_pointer (cm->stats_entry_index);
 }
 
+int
+vlib_validate_simple_counter_will_expand (vlib_simple_counter_main_t *cm,
+					  u32 index)
+{
+  vlib_thread_main_t *tm = vlib_get_thread_main ();
+  int i;
+  void *oldheap = vlib_stats_set_heap ();
+
+  /* Possibly once in recorded history */
+  if (PREDICT_FALSE (vec_len (cm->counters) == 0))
+    {
+      clib_mem_set_heap (oldheap);
+      return 1;
+    }
+
+  for (i = 0; i < tm->n_vlib_mains; i++)
+    {
+      /* Trivially OK, and proves that index >= vec_len(...) */
+      if (index < vec_len (cm->counters[i]))
+	continue;
+      if (vec_resize_will_expand (cm->counters[i],
+				  index - vec_len (cm->counters[i]) +
+				    1 /* length_increment */))
+	{
+	  clib_mem_set_heap (oldheap);
+	  return 1;
+	}
+    }
+  clib_mem_set_heap (oldheap);
+  return 0;
+}
+
 void
 vlib_free_simple_counter (vlib_simple_counter_main_t * cm)
 {
@@ -333,6 +333,8 @@ vlib_zero_combined_counter (vlib_combined_counter_main_t * cm, u32 index)
 
 void vlib_validate_simple_counter (vlib_simple_counter_main_t * cm,
 				   u32 index);
+int vlib_validate_simple_counter_will_expand (vlib_simple_counter_main_t *cm,
+					      u32 index);
 void vlib_free_simple_counter (vlib_simple_counter_main_t * cm);
 
 /** validate a combined counter
@@ -40,7 +40,9 @@
   _ (AES_128_NULL_GMAC, "aes-128-null-gmac", .is_aead = 1, .key_length = 16)  \
   _ (AES_192_NULL_GMAC, "aes-192-null-gmac", .is_aead = 1, .key_length = 24)  \
   _ (AES_256_NULL_GMAC, "aes-256-null-gmac", .is_aead = 1, .key_length = 32)  \
-  _ (CHACHA20_POLY1305, "chacha20-poly1305", .is_aead = 1, .key_length = 32)
+  _ (CHACHA20_POLY1305, "chacha20-poly1305", .is_aead = 1, .key_length = 32)  \
+  _ (AES_128_GCM_SIV, "aes-128-gcm-siv", .is_aead = 1, .key_length = 16)      \
+  _ (AES_256_GCM_SIV, "aes-256-gcm-siv", .is_aead = 1, .key_length = 32)
 
 #define foreach_crypto_hash_alg                                               \
   _ (MD5, "md5")                                                              \
@@ -91,7 +93,11 @@ typedef enum
   _ (AES_256_NULL_GMAC, "aes-256-null-gmac-aad12", 32, 16, 12)                \
   _ (CHACHA20_POLY1305, "chacha20-poly1305-aad8", 32, 16, 8)                  \
   _ (CHACHA20_POLY1305, "chacha20-poly1305-aad12", 32, 16, 12)                \
-  _ (CHACHA20_POLY1305, "chacha20-poly1305-aad0", 32, 16, 0)
+  _ (CHACHA20_POLY1305, "chacha20-poly1305-aad0", 32, 16, 0)                  \
+  _ (AES_128_GCM_SIV, "aes-128-gcm-siv-aad8", 16, 16, 8)                      \
+  _ (AES_128_GCM_SIV, "aes-128-gcm-siv-aad12", 16, 16, 12)                    \
+  _ (AES_256_GCM_SIV, "aes-256-gcm-siv-aad8", 32, 16, 8)                      \
+  _ (AES_256_GCM_SIV, "aes-256-gcm-siv-aad12", 32, 16, 12)
 
 /* CRYPTO_ID, INTEG_ID, PRETTY_NAME, KEY_LENGTH_IN_BYTES, DIGEST_LEN */
 #define foreach_crypto_link_async_alg                                         \
@@ -505,6 +511,22 @@ vnet_crypto_get_key (vnet_crypto_key_index_t index)
   return cm->keys[index];
 }
 
+/**
+ * Would adding n_keys keys grow the key pool, and with it the per-key data
+ * the engines keep in vectors indexed by key. Keys reusing a free index do
+ * not, so they can be added while the workers run.
+ **/
+static_always_inline int
+vnet_crypto_key_add_will_expand (u32 n_keys)
+{
+  vnet_crypto_main_t *cm = &crypto_main;
+
+  if (cm->keys == 0)
+    return n_keys > 0;
+
+  return vec_len (pool_header (cm->keys)->free_indices) < n_keys;
+}
+
 /** async crypto inline functions **/
 
 static_always_inline vnet_crypto_async_frame_t *
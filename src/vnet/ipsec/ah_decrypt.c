@@ -156,7 +156,10 @@ ah_decrypt_inline (vlib_main_t * vm,
 					  thread_index, current_sa_index);
 	}
 
-      if (PREDICT_FALSE ((u16) ~0 == irt->thread_index))
+      /* multi-worker SAs are decrypted on the worker that received
+       * the packet, there is no thread to claim or hand off to */
+      if (PREDICT_FALSE (!irt->is_multi_worker &&
+			 (u16) ~0 == irt->thread_index))
 	{
 	  /* this is the first packet to use this SA, claim the SA
 	   * for this thread. this could happen simultaneously on
@@ -165,7 +168,8 @@ ah_decrypt_inline (vlib_main_t * vm,
 				    ipsec_sa_assign_thread (thread_index));
 	}
 
-      if (PREDICT_TRUE (thread_index != irt->thread_index))
+      if (PREDICT_TRUE (!irt->is_multi_worker &&
+			thread_index != irt->thread_index))
 	{
 	  vnet_buffer (b[0])->ipsec.thread_index = irt->thread_index;
 	  next[0] = AH_DECRYPT_NEXT_HANDOFF;
@@ -317,8 +321,21 @@ ah_decrypt_inline (vlib_main_t * vm,
 					 AH_DECRYPT_NEXT_DROP, pd->sa_index);
 	      goto trace;
 	    }
-	  n_lost = ipsec_sa_anti_replay_advance (irt, thread_index, pd->seq,
-						 pd->seq_hi);
+	  if (PREDICT_FALSE (irt->is_multi_worker))
+	    {
+	      if (ipsec_sa_anti_replay_mt_advance (irt, pd->seq, pd->seq_hi,
+						   &n_lost))
+		{
+		  ah_decrypt_set_next_index (b[0], node, vm->thread_index,
+					     AH_DECRYPT_ERROR_REPLAY, 0, next,
+					     AH_DECRYPT_NEXT_DROP,
+					     pd->sa_index);
+		  goto trace;
+		}
+	    }
+	  else
+	    n_lost = ipsec_sa_anti_replay_advance (irt, thread_index, pd->seq,
+						   pd->seq_hi);
 	  vlib_prefetch_simple_counter (
 	    &ipsec_sa_err_counters[IPSEC_SA_ERROR_LOST], thread_index,
 	    pd->sa_index);
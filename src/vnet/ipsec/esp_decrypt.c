@@ -817,8 +817,21 @@ esp_decrypt_post_crypto (vlib_main_t *vm, vlib_node_runtime_t *node,
 				  ESP_DECRYPT_NEXT_DROP, pd->sa_index);
       return;
     }
-  n_lost =
-    ipsec_sa_anti_replay_advance (irt, vm->thread_index, pd->seq, pd->seq_hi);
+  if (PREDICT_FALSE (irt->is_multi_worker))
+    {
+      /* the window is shared between workers, a duplicate decrypted
+       * concurrently elsewhere is only caught here */
+      if (ipsec_sa_anti_replay_mt_advance (irt, pd->seq, pd->seq_hi, &n_lost))
+	{
+	  esp_decrypt_set_next_index (b, node, vm->thread_index,
+				      ESP_DECRYPT_ERROR_REPLAY, 0, next,
+				      ESP_DECRYPT_NEXT_DROP, pd->sa_index);
+	  return;
+	}
+    }
+  else
+    n_lost = ipsec_sa_anti_replay_advance (irt, vm->thread_index, pd->seq,
+					   pd->seq_hi);
 
   vlib_prefetch_simple_counter (&ipsec_sa_err_counters[IPSEC_SA_ERROR_LOST],
 				vm->thread_index, pd->sa_index);
@@ -1147,7 +1160,10 @@ esp_decrypt_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 	  is_async = irt->is_async;
 	}
 
-      if (PREDICT_FALSE ((u16) ~0 == irt->thread_index))
+      /* multi-worker SAs are decrypted on the worker that received
+       * the packet, there is no thread to claim or hand off to */
+      if (PREDICT_FALSE (!irt->is_multi_worker &&
+			 (u16) ~0 == irt->thread_index))
 	{
 	  /* this is the first packet to use this SA, claim the SA
 	   * for this thread. this could happen simultaneously on
@@ -1156,7 +1172,8 @@ esp_decrypt_inline (vlib_main_t *vm, vlib_node_runtime_t *node,
 				    ipsec_sa_assign_thread (thread_index));
 	}
 
-      if (PREDICT_FALSE (thread_index != irt->thread_index))
+      if (PREDICT_FALSE (!irt->is_multi_worker &&
+			 thread_index != irt->thread_index))
 	{
 	  vnet_buffer (b[0])->ipsec.thread_index = irt->thread_index;
 	  err = ESP_DECRYPT_ERROR_HANDOFF;
@@ -236,6 +236,72 @@ ipsec_register_udp_port (u16 port, u8 is_ip4)
   hash_set (im->udp_port_registrations, key, n_regs);
 }
 
+u32
+ipsec_udp_port_n_registrations (u16 port, u8 is_ip4)
+{
+  ipsec_main_t *im = &ipsec_main;
+  uword *p;
+
+  p = hash_get (im->udp_port_registrations,
+		ipsec_udp_registration_key (port, is_ip4));
+
+  return (p ? p[0] : 0);
+}
+
+void
+ipsec_ctl_op_begin (ipsec_ctl_op_ctx_t *ctx, ipsec_ctl_op_t op)
+{
+  ASSERT (vlib_get_thread_index () == 0);
+
+  ctx->op = op;
+  ctx->own_barrier = 0;
+  ctx->caller_barrier =
+    vlib_num_workers () && vlib_worker_thread_barrier_held ();
+  ctx->barrier_start = vlib_time_now (vlib_get_main ());
+}
+
+void
+ipsec_ctl_op_barrier_sync (ipsec_ctl_op_ctx_t *ctx)
+{
+  vlib_main_t *vm = vlib_get_main ();
+
+  if (ctx->caller_barrier || ctx->own_barrier || !vlib_num_workers ())
+    return;
+
+  ctx->barrier_start = vlib_time_now (vm);
+  vlib_worker_thread_barrier_sync (vm);
+  ctx->own_barrier = 1;
+}
+
+void
+ipsec_ctl_op_end (ipsec_ctl_op_ctx_t *ctx)
+{
+  ipsec_ctl_op_stats_t *st = &ipsec_main.ctl_op_stats[ctx->op];
+  vlib_main_t *vm = vlib_get_main ();
+  f64 dt;
+
+  st->n_ops++;
+
+  if (!ctx->caller_barrier && !ctx->own_barrier)
+    return;
+
+  if (ctx->own_barrier)
+    vlib_worker_thread_barrier_release (vm);
+
+  /* when the caller holds the barrier the whole operation counts */
+  dt = vlib_time_now (vm) - ctx->barrier_start;
+  st->n_barrier++;
+  st->barrier_time += dt;
+  st->max_barrier_time = clib_max (st->max_barrier_time, dt);
+  ctx->own_barrier = 0;
+}
+
+void
+ipsec_ctl_op_stats_clear (void)
+{
+  clib_memset (ipsec_main.ctl_op_stats, 0, sizeof (ipsec_main.ctl_op_stats));
+}
+
 u32
 ipsec_register_ah_backend (vlib_main_t * vm, ipsec_main_t * im,
 			   const char *name,
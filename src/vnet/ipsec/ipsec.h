@@ -141,6 +141,43 @@ typedef struct
   vnet_crypto_async_frame_t **async_frames;
 } ipsec_per_thread_data_t;
 
+/*
+ * Control plane operations that may need to stop the workers
+ */
+#define foreach_ipsec_ctl_op                                                  \
+  _ (SA_ADD, "sa-add")                                                        \
+  _ (SA_DEL, "sa-del")                                                        \
+  _ (TUN_PROTECT_UPDATE, "tun-protect-update")                                \
+  _ (TUN_PROTECT_DEL, "tun-protect-del")
+
+typedef enum
+{
+#define _(a, s) IPSEC_CTL_OP_##a,
+  foreach_ipsec_ctl_op
+#undef _
+    IPSEC_CTL_N_OPS,
+} ipsec_ctl_op_t;
+
+typedef struct
+{
+  u64 n_ops;
+  /* operations that ran with the workers stopped */
+  u64 n_barrier;
+  f64 barrier_time;
+  f64 max_barrier_time;
+} ipsec_ctl_op_stats_t;
+
+/* an operation in progress */
+typedef struct
+{
+  ipsec_ctl_op_t op;
+  /* the caller holds the barrier for the whole operation */
+  u8 caller_barrier;
+  /* the operation took the barrier itself */
+  u8 own_barrier;
+  f64 barrier_start;
+} ipsec_ctl_op_ctx_t;
+
 typedef struct
 {
   /* pool of tunnel instances */
@@ -270,6 +307,9 @@ typedef struct
   ipsec_sa_t *sa_pool;
   ipsec_sa_inb_rt_t **inb_sa_runtimes;
   ipsec_sa_outb_rt_t **outb_sa_runtimes;
+
+  /* barrier usage of SA and tunnel protection updates */
+  ipsec_ctl_op_stats_t ctl_op_stats[IPSEC_CTL_N_OPS];
 } ipsec_main_t;
 
 typedef enum ipsec_format_flags_t_
@@ -398,6 +438,18 @@ void ipsec_set_async_mode (u32 is_enabled);
 
 extern void ipsec_register_udp_port (u16 udp_port, u8 is_ip4);
 extern void ipsec_unregister_udp_port (u16 udp_port, u8 is_ip4);
+extern u32 ipsec_udp_port_n_registrations (u16 udp_port, u8 is_ip4);
+
+/*
+ * SA and tunnel protection updates run without the worker barrier when
+ * they can be published to the workers safely, and take it only for the
+ * steps that cannot, e.g. growing a vector the workers index.
+ */
+extern void ipsec_ctl_op_begin (ipsec_ctl_op_ctx_t *ctx, ipsec_ctl_op_t op);
+extern void ipsec_ctl_op_barrier_sync (ipsec_ctl_op_ctx_t *ctx);
+extern void ipsec_ctl_op_end (ipsec_ctl_op_ctx_t *ctx);
+extern void ipsec_ctl_op_stats_clear (void);
+extern u8 *format_ipsec_ctl_op_stats (u8 *s, va_list *args);
 
 extern clib_error_t *ipsec_register_next_header (vlib_main_t *vm,
 						 u8 next_header,
@@ -166,6 +166,8 @@ ipsec_sa_add_del_command_fn (vlib_main_t * vm,
 	flags |= IPSEC_SA_FLAG_UDP_ENCAP;
       else if (unformat (line_input, "async"))
 	flags |= IPSEC_SA_FLAG_IS_ASYNC;
+      else if (unformat (line_input, "multi-worker"))
+	flags |= IPSEC_SA_FLAG_MULTI_WORKER;
       else
 	{
 	  error = clib_error_return (0, "parse error: '%U'",
@@ -211,6 +213,7 @@ VLIB_CLI_COMMAND (ipsec_sa_add_del_command, static) = {
     .short_help =
     "ipsec sa [add|del]",
     .function = ipsec_sa_add_del_command_fn,
+    .is_mp_safe = 1,
 };
 
 static clib_error_t *
@@ -328,6 +331,71 @@ VLIB_CLI_COMMAND (ipsec_spd_add_del_command, static) = {
     .function = ipsec_spd_add_del_command_fn,
 };
 
+static clib_error_t *
+set_ipsec_spd_classifier_command_fn (vlib_main_t *vm,
+				     unformat_input_t *input,
+				     vlib_cli_command_t *cmd)
+{
+  unformat_input_t _line_input, *line_input = &_line_input;
+  u32 spd_id = ~0;
+  int is_enable = 1;
+  clib_error_t *error = NULL;
+  int rv;
+
+  if (!unformat_user (input, unformat_line_input, line_input))
+    return 0;
+
+  while (unformat_check_input (line_input) != UNFORMAT_END_OF_INPUT)
+    {
+      if (unformat (line_input, "%u", &spd_id))
+	;
+      else if (unformat (line_input, "enable"))
+	is_enable = 1;
+      else if (unformat (line_input, "disable"))
+	is_enable = 0;
+      else
+	{
+	  error = clib_error_return (0, "parse error: '%U'",
+				     format_unformat_error, line_input);
+	  goto done;
+	}
+    }
+
+  if (spd_id == ~0)
+    {
+      error = clib_error_return (0, "please specify SPD ID");
+      goto done;
+    }
+
+  rv = ipsec_spd_classifier_enable_disable (spd_id, is_enable);
+
+  switch (rv)
+    {
+    case 0:
+      break;
+    case VNET_API_ERROR_NO_SUCH_ENTRY:
+      error = clib_error_return (0, "no such SPD %u", spd_id);
+      break;
+    case VNET_API_ERROR_FEATURE_DISABLED:
+      error = clib_error_return (0, "IPv4 SPD fast path is not enabled");
+      break;
+    default:
+      error = clib_error_return (0, "failed: %d", rv);
+      break;
+    }
+
+done:
+  unformat_free (line_input);
+
+  return error;
+}
+
+VLIB_CLI_COMMAND (set_ipsec_spd_classifier_command, static) = {
+  .path = "set ipsec spd classifier",
+  .short_help = "set ipsec spd classifier <id> [enable|disable]",
+  .function = set_ipsec_spd_classifier_command_fn,
+};
+
 
 static clib_error_t *
 ipsec_policy_add_del_command_fn (vlib_main_t * vm,
@@ -802,6 +870,21 @@ VLIB_CLI_COMMAND (ipsec_select_backend_command, static) = {
 };
 
 
+static clib_error_t *
+show_ipsec_barrier_command_fn (vlib_main_t *vm, unformat_input_t *input,
+			       vlib_cli_command_t *cmd)
+{
+  vlib_cli_output (vm, "%U", format_ipsec_ctl_op_stats);
+
+  return (NULL);
+}
+
+VLIB_CLI_COMMAND (show_ipsec_barrier_command, static) = {
+  .path = "show ipsec barrier",
+  .short_help = "show ipsec barrier",
+  .function = show_ipsec_barrier_command_fn,
+};
+
 static clib_error_t *
 clear_ipsec_counters_command_fn (vlib_main_t * vm,
 				 unformat_input_t * input,
@@ -811,6 +894,7 @@ clear_ipsec_counters_command_fn (vlib_main_t * vm,
   vlib_clear_combined_counters (&ipsec_sa_counters);
   for (int i = 0; i < IPSEC_SA_N_ERRORS; i++)
     vlib_clear_simple_counters (&ipsec_sa_err_counters[i]);
+  ipsec_ctl_op_stats_clear ();
 
   return (NULL);
 }
@@ -874,7 +958,7 @@ VLIB_CLI_COMMAND (ipsec_tun_protect_cmd_node, static) =
   .path = "ipsec tunnel protect",
   .function = ipsec_tun_protect_cmd,
   .short_help = "ipsec tunnel protect <interface> input-sa <SA> output-sa <SA> [add|del]",
-    // this is not MP safe
+  .is_mp_safe = 1,
 };
 
 
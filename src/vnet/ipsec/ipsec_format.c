@@ -377,6 +377,9 @@ format_ipsec_spd (u8 * s, va_list * args)
   foreach_ipsec_spd_policy_type;
 #undef _
 
+  if (spd->fp_spd.cls_enabled)
+    s = format (s, "\n %U", format_ipsec_spd_classifier, spd);
+
 done:
   return (s);
 }
@@ -615,6 +618,27 @@ format_ipsec_itf (u8 * s, va_list * a)
   return (s);
 }
 
+u8 *
+format_ipsec_ctl_op_stats (u8 *s, va_list *args)
+{
+  ipsec_main_t *im = &ipsec_main;
+  ipsec_ctl_op_stats_t *st;
+  u32 indent = format_get_indent (s);
+
+  s = format (s, "%-20s%12s%12s%14s%14s", "operation", "ops", "barrier",
+	      "total (us)", "max (us)");
+
+#define _(a, n)                                                               \
+  st = &im->ctl_op_stats[IPSEC_CTL_OP_##a];                                   \
+  s = format (s, "\n%U%-20s%12lu%12lu%14.1f%14.1f", format_white_space,       \
+	      indent, n, st->n_ops, st->n_barrier, st->barrier_time * 1e6,     \
+	      st->max_barrier_time * 1e6);
+  foreach_ipsec_ctl_op
+#undef _
+
+    return (s);
+}
+
 /*
  * fd.io coding-style-patch-verification: ON
  *
@@ -297,6 +297,9 @@ ipsec_sa_update (u32 id, u16 src_port, u16 dst_port, const tunnel_t *tun,
       (ip_address_cmp (&tun->t_src, &sa->tunnel.t_src) != 0 ||
        ip_address_cmp (&tun->t_dst, &sa->tunnel.t_dst) != 0))
     {
+      /* compiled SPD classifiers match on the old endpoints */
+      ipsec_spd_classifier_sa_changed (sa_index);
+
       /* if the source IP is updated for an inbound SA under a tunnel protect,
        we need to update the tun_protect DB with the new src IP */
       if (ipsec_sa_is_set_IS_INBOUND (sa) &&
@@ -410,13 +413,61 @@ ipsec_sa_update (u32 id, u16 src_port, u16 dst_port, const tunnel_t *tun,
   return (0);
 }
 
-int
-ipsec_sa_add_and_lock (u32 id, u32 spi, ipsec_protocol_t proto,
-		       ipsec_crypto_alg_t crypto_alg, const ipsec_key_t *ck,
-		       ipsec_integ_alg_t integ_alg, const ipsec_key_t *ik,
-		       ipsec_sa_flags_t flags, u32 salt, u16 src_port,
-		       u16 dst_port, u32 anti_replay_window_size,
-		       const tunnel_t *tun, u32 *sa_out_index)
+/*
+ * Would building the SA at sa_index change any of the state the workers
+ * read, other than its own not yet published slots.
+ */
+static int
+ipsec_sa_add_will_expand (u32 sa_index, ipsec_crypto_alg_t crypto_alg,
+			  ipsec_integ_alg_t integ_alg, ipsec_sa_flags_t flags,
+			  u16 dst_port)
+{
+  ipsec_main_t *im = &ipsec_main;
+  u32 len = vec_len (im->inb_sa_runtimes);
+  u32 n_keys;
+
+  if (sa_index >= len &&
+      (vec_resize_will_expand (im->inb_sa_runtimes, sa_index + 1 - len) ||
+       vec_resize_will_expand (im->outb_sa_runtimes, sa_index + 1 - len)))
+    return 1;
+
+  if (vlib_validate_combined_counter_will_expand (&ipsec_sa_counters,
+						  sa_index))
+    return 1;
+
+  for (int i = 0; i < IPSEC_SA_N_ERRORS; i++)
+    if (vlib_validate_simple_counter_will_expand (&ipsec_sa_err_counters[i],
+						  sa_index))
+      return 1;
+
+  /* cipher and integrity keys, linked for async if both are used */
+  n_keys = (crypto_alg != IPSEC_CRYPTO_ALG_NONE) +
+	   (integ_alg != IPSEC_INTEG_ALG_NONE);
+  if (n_keys == 2 && !im->crypto_algs[crypto_alg].is_aead)
+    n_keys++;
+  if (vnet_crypto_key_add_will_expand (n_keys))
+    return 1;
+
+  if ((flags & IPSEC_SA_FLAG_UDP_ENCAP) && (flags & IPSEC_SA_FLAG_IS_INBOUND))
+    {
+      if (dst_port == IPSEC_UDP_PORT_NONE)
+	dst_port = UDP_DST_PORT_ipsec;
+      if (0 == ipsec_udp_port_n_registrations (dst_port, 1) ||
+	  0 == ipsec_udp_port_n_registrations (dst_port, 0))
+	return 1;
+    }
+
+  return 0;
+}
+
+static int
+ipsec_sa_add_and_lock_i (ipsec_ctl_op_ctx_t *ctx, u32 id, u32 spi,
+			 ipsec_protocol_t proto, ipsec_crypto_alg_t crypto_alg,
+			 const ipsec_key_t *ck, ipsec_integ_alg_t integ_alg,
+			 const ipsec_key_t *ik, ipsec_sa_flags_t flags,
+			 u32 salt, u16 src_port, u16 dst_port,
+			 u32 anti_replay_window_size, const tunnel_t *tun,
+			 u32 *sa_out_index)
 {
   vlib_main_t *vm = vlib_get_main ();
   ipsec_main_t *im = &ipsec_main;
@@ -438,10 +489,22 @@ ipsec_sa_add_and_lock (u32 id, u32 spi, ipsec_protocol_t proto,
   if (getrandom (rand, sizeof (rand), 0) != sizeof (rand))
     return VNET_API_ERROR_INIT_FAILED;
 
+  /*
+   * The workers do not see the new SA until a tunnel protection or a
+   * policy refers to it, so it is built while they run unless that
+   * reallocates something they use.
+   */
+  if (pool_get_will_expand (im->sa_pool))
+    ipsec_ctl_op_barrier_sync (ctx);
+
   pool_get_aligned_zero (im->sa_pool, sa, CLIB_CACHE_LINE_BYTES);
   sa_index = sa - im->sa_pool;
   sa->flags = flags;
 
+  if (ipsec_sa_add_will_expand (sa_index, crypto_alg, integ_alg, flags,
+				dst_port))
+    ipsec_ctl_op_barrier_sync (ctx);
+
   if (ipsec_sa_is_set_USE_ANTI_REPLAY (sa) && anti_replay_window_size > 64)
     /* window size rounded up to next power of 2 */
     anti_replay_window_size = 1 << max_log2 (anti_replay_window_size);
@@ -452,7 +515,11 @@ ipsec_sa_add_and_lock (u32 id, u32 spi, ipsec_protocol_t proto,
   vec_validate (im->outb_sa_runtimes, sa_index);
 
   irt_sz = sizeof (ipsec_sa_inb_rt_t);
-  irt_sz += anti_replay_window_size / 8;
+  if (ipsec_sa_is_set_MULTI_WORKER (sa))
+    irt_sz += ipsec_sa_anti_replay_mt_n_slots (anti_replay_window_size) *
+	      sizeof (u64);
+  else
+    irt_sz += anti_replay_window_size / 8;
   irt_sz = round_pow2 (irt_sz, CLIB_CACHE_LINE_BYTES);
 
   irt = clib_mem_alloc_aligned (irt_sz, alignof (ipsec_sa_inb_rt_t));
@@ -463,6 +530,7 @@ ipsec_sa_add_and_lock (u32 id, u32 spi, ipsec_protocol_t proto,
 
   *irt = (ipsec_sa_inb_rt_t){
     .thread_index = thread_index,
+    .is_multi_worker = ipsec_sa_is_set_MULTI_WORKER (sa),
     .anti_replay_window_size = anti_replay_window_size,
   };
 
@@ -610,8 +678,7 @@ ipsec_sa_add_and_lock (u32 id, u32 spi, ipsec_protocol_t proto,
 	ipsec_register_udp_port (dst_port, !ipsec_sa_is_set_IS_TUNNEL_V6 (sa));
     }
 
-  for (u32 i = 0; i < anti_replay_window_size / uword_bits; i++)
-    irt->replay_window[i] = ~0ULL;
+  ipsec_sa_anti_replay_window_reset (irt, true /* seen */);
 
   hash_set (im->sa_index_by_sa_id, sa->id, sa_index);
 
@@ -623,43 +690,84 @@ ipsec_sa_add_and_lock (u32 id, u32 spi, ipsec_protocol_t proto,
   return (0);
 }
 
+int
+ipsec_sa_add_and_lock (u32 id, u32 spi, ipsec_protocol_t proto,
+		       ipsec_crypto_alg_t crypto_alg, const ipsec_key_t *ck,
+		       ipsec_integ_alg_t integ_alg, const ipsec_key_t *ik,
+		       ipsec_sa_flags_t flags, u32 salt, u16 src_port,
+		       u16 dst_port, u32 anti_replay_window_size,
+		       const tunnel_t *tun, u32 *sa_out_index)
+{
+  ipsec_ctl_op_ctx_t ctx;
+  int rv;
+
+  ipsec_ctl_op_begin (&ctx, IPSEC_CTL_OP_SA_ADD);
+  rv = ipsec_sa_add_and_lock_i (&ctx, id, spi, proto, crypto_alg, ck,
+				integ_alg, ik, flags, salt, src_port, dst_port,
+				anti_replay_window_size, tun, sa_out_index);
+  ipsec_ctl_op_end (&ctx);
+
+  return (rv);
+}
+
 static void
 ipsec_sa_del (ipsec_sa_t * sa)
 {
   vlib_main_t *vm = vlib_get_main ();
   ipsec_main_t *im = &ipsec_main;
+  ipsec_ctl_op_ctx_t ctx;
   u32 sa_index;
   ipsec_sa_inb_rt_t *irt = ipsec_sa_get_inb_rt (sa);
   ipsec_sa_outb_rt_t *ort = ipsec_sa_get_outb_rt (sa);
 
+  ipsec_ctl_op_begin (&ctx, IPSEC_CTL_OP_SA_DEL);
+
   sa_index = sa - im->sa_pool;
   hash_unset (im->sa_index_by_sa_id, sa->id);
   tunnel_unresolve (&sa->tunnel);
 
+  if (ipsec_sa_is_set_UDP_ENCAP (sa) && ipsec_sa_is_set_IS_INBOUND (sa))
+    {
+      u8 is_ip4 = !ipsec_sa_is_set_IS_TUNNEL_V6 (sa);
+
+      if (1 == ipsec_udp_port_n_registrations (sa->udp_dst_port, is_ip4))
+	ipsec_ctl_op_barrier_sync (&ctx);
+      ipsec_unregister_udp_port (sa->udp_dst_port, is_ip4);
+    }
+
+  if (ipsec_sa_is_set_IS_TUNNEL (sa) && !ipsec_sa_is_set_IS_INBOUND (sa))
+    dpo_reset (&ort->dpo);
+
+  /*
+   * Nothing refers to the SA any more, but the workers may still be
+   * processing packets that found it before then. Let each of them finish
+   * its current loop before the SA state is freed.
+   */
+  if (pool_put_will_expand (im->sa_pool, sa))
+    ipsec_ctl_op_barrier_sync (&ctx);
+  else
+    vlib_worker_wait_one_loop ();
+
   /* no recovery possible when deleting an SA */
   (void) ipsec_call_add_del_callbacks (im, sa, sa_index, 0);
 
   if (sa->linked_key_index != ~0)
     vnet_crypto_key_del (vm, sa->linked_key_index);
-
-  if (ipsec_sa_is_set_UDP_ENCAP (sa) && ipsec_sa_is_set_IS_INBOUND (sa))
-    ipsec_unregister_udp_port (sa->udp_dst_port,
-			       !ipsec_sa_is_set_IS_TUNNEL_V6 (sa));
-
-  if (ipsec_sa_is_set_IS_TUNNEL (sa) && !ipsec_sa_is_set_IS_INBOUND (sa))
-    dpo_reset (&ort->dpo);
   if (sa->crypto_alg != IPSEC_CRYPTO_ALG_NONE)
     vnet_crypto_key_del (vm, sa->crypto_sync_key_index);
   if (sa->integ_alg != IPSEC_INTEG_ALG_NONE)
     vnet_crypto_key_del (vm, sa->integ_sync_key_index);
-  foreach_pointer (p, irt, ort)
-    if (p)
-      clib_mem_free (p);
 
   im->inb_sa_runtimes[sa_index] = 0;
   im->outb_sa_runtimes[sa_index] = 0;
 
+  foreach_pointer (p, irt, ort)
+    if (p)
+      clib_mem_free (p);
+
   pool_put (im->sa_pool, sa);
+
+  ipsec_ctl_op_end (&ctx);
 }
 
 int
@@ -99,6 +99,7 @@ typedef struct ipsec_key_t_
   _ (16, UDP_ENCAP, "udp-encap")                                              \
   _ (32, IS_PROTECT, "Protect")                                               \
   _ (64, IS_INBOUND, "inbound")                                               \
+  _ (128, MULTI_WORKER, "multi-worker")                                       \
   _ (512, IS_ASYNC, "async")                                                  \
   _ (1024, NO_ALGO_NO_DROP, "no-algo-no-drop")
 
@@ -152,6 +153,7 @@ typedef struct
   u16 is_tunnel : 1;
   u16 is_transport : 1;
   u16 is_async : 1;
+  u16 is_multi_worker : 1;
   u16 cipher_op_id;
   u16 integ_op_id;
   u8 cipher_iv_size;
@@ -326,6 +328,141 @@ extern uword unformat_ipsec_key (unformat_input_t *input, va_list *args);
 
 #define IPSEC_UDP_PORT_NONE ((u16) ~0)
 
+/*
+ * Multi-worker anti-replay window.
+ * Inbound SAs with the multi-worker flag are decrypted on whichever
+ * worker receives the packet, so the window is updated concurrently
+ * and cannot be shifted in place. It is instead kept as a ring of
+ * 64-bit slots, each holding the bitmap of one block of 32 sequence
+ * numbers in the low half and the block number (seq >> 5) in the high
+ * half. Setting a bit and recycling a slot for a newer block is then a
+ * single compare-and-swap. The ring covers twice the window size, so a
+ * block is never recycled while it is still inside the window.
+ */
+#define IPSEC_SA_MT_BLOCK_LOG2 5
+#define IPSEC_SA_MT_BLOCK_BITS (1 << IPSEC_SA_MT_BLOCK_LOG2)
+#define IPSEC_SA_MT_TAG_MASK pow2_mask (32 - IPSEC_SA_MT_BLOCK_LOG2)
+
+always_inline u32
+ipsec_sa_anti_replay_mt_n_slots (u32 window_size)
+{
+  return 2 * window_size / IPSEC_SA_MT_BLOCK_BITS;
+}
+
+/* number of blocks block blk is ahead of the block held in the slot,
+ * block numbers wrap with the 32-bit sequence number */
+always_inline i32
+ipsec_sa_anti_replay_mt_block_diff (u32 blk, u64 slot)
+{
+  u32 d = (blk - (u32) (slot >> 32)) << IPSEC_SA_MT_BLOCK_LOG2;
+  return (i32) d >> IPSEC_SA_MT_BLOCK_LOG2;
+}
+
+always_inline int
+ipsec_sa_anti_replay_mt_check (const ipsec_sa_inb_rt_t *irt, u32 seq)
+{
+  u64 *slots = (u64 *) irt->replay_window;
+  u32 n_slots = ipsec_sa_anti_replay_mt_n_slots (irt->anti_replay_window_size);
+  u32 blk = seq >> IPSEC_SA_MT_BLOCK_LOG2;
+  u64 slot = __atomic_load_n (slots + (blk & (n_slots - 1)), __ATOMIC_RELAXED);
+  i32 diff = ipsec_sa_anti_replay_mt_block_diff (blk, slot);
+
+  if (diff > 0)
+    /* slot still holds an older block, nothing seen in this one yet */
+    return 0;
+  if (diff < 0)
+    /* slot already recycled, the sequence number left the window */
+    return 1;
+
+  return (slot >> (seq & (IPSEC_SA_MT_BLOCK_BITS - 1))) & 1;
+}
+
+/*
+ * Multi-worker equivalent of ipsec_sa_anti_replay_advance.
+ * The bit is tested and set atomically, so unlike the single worker
+ * case this also catches a duplicate decrypted concurrently on another
+ * worker. Returns non-zero if the packet is a replay.
+ */
+always_inline int
+ipsec_sa_anti_replay_mt_advance (ipsec_sa_inb_rt_t *irt, u32 seq, u32 hi_seq,
+				 u64 *n_lost)
+{
+  u64 *slots = (u64 *) irt->replay_window;
+  u32 n_slots = ipsec_sa_anti_replay_mt_n_slots (irt->anti_replay_window_size);
+  u32 blk = seq >> IPSEC_SA_MT_BLOCK_LOG2;
+  u64 *slot = slots + (blk & (n_slots - 1));
+  u64 bit = 1ULL << (seq & (IPSEC_SA_MT_BLOCK_BITS - 1));
+  u64 seq64 = irt->use_esn ? (u64) hi_seq << 32 | seq : seq;
+  u64 old, new, cur;
+  i32 diff = 0;
+
+  *n_lost = 0;
+
+  if (irt->use_anti_replay)
+    {
+      old = __atomic_load_n (slot, __ATOMIC_RELAXED);
+      do
+	{
+	  diff = ipsec_sa_anti_replay_mt_block_diff (blk, old);
+	  if (diff < 0 || (diff == 0 && (old & bit)))
+	    return 1;
+	  new = diff ? (u64) blk << 32 | bit : old | bit;
+	}
+      while (!__atomic_compare_exchange_n (slot, &old, new, 0,
+					   __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+      /* the block evicted from the slot, and any blocks that would have
+       * used the slot in between, have now left the window */
+      if (diff)
+	*n_lost = IPSEC_SA_MT_BLOCK_BITS - count_set_bits ((u32) old) +
+		  (u64) (diff / n_slots - 1) * IPSEC_SA_MT_BLOCK_BITS;
+    }
+
+  cur = __atomic_load_n (&irt->seq64, __ATOMIC_RELAXED);
+  while (seq64 > cur &&
+	 !__atomic_compare_exchange_n (&irt->seq64, &cur, seq64, 0,
+				       __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    ;
+
+  return 0;
+}
+
+/*
+ * (Re)initialise the window at the SA's current sequence number.
+ * With seen set, all sequence numbers up to and including it are
+ * treated as received.
+ */
+always_inline void
+ipsec_sa_anti_replay_window_reset (ipsec_sa_inb_rt_t *irt, bool seen)
+{
+  u32 window_size = irt->anti_replay_window_size;
+
+  if (irt->is_multi_worker)
+    {
+      u64 *slots = (u64 *) irt->replay_window;
+      u32 n_slots = ipsec_sa_anti_replay_mt_n_slots (window_size);
+      u32 seq = irt->seq64;
+      u32 blk = seq >> IPSEC_SA_MT_BLOCK_LOG2;
+
+      for (u32 i = 0; i < n_slots; i++)
+	{
+	  /* most recent block, not after the current one, using this slot */
+	  u32 b = blk - ((blk - i) & (n_slots - 1));
+	  u64 bits = 0;
+
+	  if (seen)
+	    bits = b == blk ?
+		     pow2_mask ((seq & (IPSEC_SA_MT_BLOCK_BITS - 1)) + 1) :
+		     pow2_mask (IPSEC_SA_MT_BLOCK_BITS);
+	  slots[i] = (u64) (b & IPSEC_SA_MT_TAG_MASK) << 32 | bits;
+	}
+    }
+  else if (seen)
+    clib_memset (irt->replay_window, 0xff, window_size / 8);
+  else
+    uword_bitmap_clear (irt->replay_window, window_size / uword_bits);
+}
+
 always_inline u64
 ipsec_sa_anti_replay_get_64b_window (const ipsec_sa_inb_rt_t *irt)
 {
@@ -334,6 +471,16 @@ ipsec_sa_anti_replay_get_64b_window (const ipsec_sa_inb_rt_t *irt)
   u32 tl_win_index = irt->seq64 & (window_size - 1);
   uword *bmp = (uword *) irt->replay_window;
 
+  if (irt->is_multi_worker)
+    {
+      u32 bl = (u32) irt->seq64 - 63;
+
+      w = 0;
+      for (u32 i = 0; i < 64; i++)
+	w |= (u64) ipsec_sa_anti_replay_mt_check (irt, bl + i) << i;
+      return w;
+    }
+
   if (PREDICT_TRUE (tl_win_index >= 63))
     return uword_bitmap_get_multiple (bmp, tl_win_index - 63, 64);
 
@@ -353,6 +500,9 @@ ipsec_sa_anti_replay_check (const ipsec_sa_inb_rt_t *irt, u32 window_size,
    * if the packet falls left (sa->seq - seq >= window size),
    * the result is wrong */
 
+  if (irt->is_multi_worker)
+    return ipsec_sa_anti_replay_mt_check (irt, seq);
+
   return uword_bitmap_is_bit_set ((uword *) irt->replay_window,
 				  seq & (window_size - 1));
 }
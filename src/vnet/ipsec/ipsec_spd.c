@@ -49,6 +49,8 @@ ipsec_add_del_spd (vlib_main_t * vm, u32 spd_id, int is_add)
 
 	fp_spd = &spd->fp_spd;
 
+      ipsec_spd_classifier_free (spd);
+
       if (im->fp_spd_ipv4_out_is_enabled)
 	{
 	  if (fp_spd->ip4_out_lookup_hash_idx != INDEX_INVALID)
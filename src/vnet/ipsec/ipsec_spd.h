@@ -18,6 +18,7 @@
 #include <vppinfra/bihash_40_8.h>
 #include <vppinfra/bihash_16_8.h>
 #include <vlib/vlib.h>
+#include <vnet/ipsec/ipsec_spd_classifier.h>
 
 #define foreach_ipsec_spd_policy_type                 \
   _(IP4_OUTBOUND, "ip4-outbound")                     \
@@ -65,6 +66,10 @@ typedef struct
   u32 ip4_out_lookup_hash_idx; /* fp ip4 lookup hash out index in the pool */
   u32 ip6_in_lookup_hash_idx;  /* fp ip6 lookup hash in index in the pool */
   u32 ip4_in_lookup_hash_idx;  /* fp ip4 lookup hash in index in the pool */
+  /* compiled ip4 classifiers, per policy type; 0 while being recompiled,
+   * in which case lookups fall back to the hash tables above */
+  ipsec_spd_cls_t *cls[IPSEC_SPD_POLICY_N_TYPES];
+  u8 cls_enabled;
 } ipsec_spd_fp_t;
 
 /**
@@ -90,7 +95,18 @@ extern int ipsec_add_del_spd (vlib_main_t * vm, u32 spd_id, int is_add);
 extern int ipsec_set_interface_spd (vlib_main_t * vm,
 				    u32 sw_if_index, u32 spd_id, int is_add);
 
+/**
+ * @brief Enable/Disable the compiled classifier on a fast path SPD
+ */
+extern int ipsec_spd_classifier_enable_disable (u32 spd_id, int is_enable);
+extern void ipsec_spd_classifier_compile (ipsec_spd_t *spd);
+extern void ipsec_spd_classifier_policy_changed (ipsec_spd_t *spd,
+						 ipsec_spd_policy_type_t type);
+extern void ipsec_spd_classifier_sa_changed (u32 sa_index);
+extern void ipsec_spd_classifier_free (ipsec_spd_t *spd);
+
 extern u8 *format_ipsec_spd (u8 * s, va_list * args);
+extern u8 *format_ipsec_spd_classifier (u8 *s, va_list *args);
 
 extern u8 *format_ipsec_out_spd_flow_cache (u8 *s, va_list *args);
 extern u8 *format_ipsec_in_spd_flow_cache (u8 *s, va_list *args);
@@ -0,0 +1,593 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright (c) 2025 Cisco Systems, Inc.
+ */
+
+#include <vnet/ipsec/ipsec.h>
+
+/*
+ * Policy updates invalidate the classifier of the changed policy type and
+ * the recompile is left to a process, so bulk policy updates only trigger
+ * a single recompile once they settle. Until then lookups use the fast
+ * path hash tables, which are kept up to date regardless.
+ */
+
+#define IPSEC_SPD_CLS_SETTLE_TIME 10e-3
+
+typedef enum
+{
+  IPSEC_SPD_CLS_EVENT_RECOMPILE = 1,
+} ipsec_spd_cls_event_t;
+
+typedef struct
+{
+  ipsec_spd_cls_t *cls;
+  u32 max_leaf_rules;
+  /* scratch vectors for threshold selection */
+  u32 *los;
+  u32 *his;
+} ipsec_spd_cls_build_ctx_t;
+
+static const ipsec_spd_policy_type_t ipsec_spd_cls_types[] = {
+  IPSEC_SPD_POLICY_IP4_OUTBOUND,
+  IPSEC_SPD_POLICY_IP4_INBOUND_PROTECT,
+  IPSEC_SPD_POLICY_IP4_INBOUND_BYPASS,
+  IPSEC_SPD_POLICY_IP4_INBOUND_DISCARD,
+};
+
+vlib_node_registration_t ipsec_spd_cls_process_node;
+
+static int
+ipsec_spd_cls_is_ip4_type (ipsec_spd_policy_type_t t)
+{
+  for (int i = 0; i < ARRAY_LEN (ipsec_spd_cls_types); i++)
+    if (ipsec_spd_cls_types[i] == t)
+      return 1;
+  return 0;
+}
+
+static u32
+ipsec_spd_cls_table_index (ipsec_spd_t *spd, ipsec_spd_policy_type_t t)
+{
+  if (t == IPSEC_SPD_POLICY_IP4_OUTBOUND)
+    return spd->fp_spd.ip4_out_lookup_hash_idx;
+  return spd->fp_spd.ip4_in_lookup_hash_idx;
+}
+
+static void
+ipsec_spd_cls_rule_init (ipsec_spd_cls_rule_t *r, ipsec_policy_t *p,
+			 u32 policy_index, int is_port_proto)
+{
+  for (int d = 0; d < IPSEC_SPD_CLS_N_DIMS; d++)
+    {
+      r->lo[d] = 0;
+      r->hi[d] = ~0;
+    }
+
+  r->policy_index = policy_index;
+  r->lo[IPSEC_SPD_CLS_DIM_LADDR] =
+    clib_net_to_host_u32 (p->laddr.start.ip4.as_u32);
+  r->hi[IPSEC_SPD_CLS_DIM_LADDR] =
+    clib_net_to_host_u32 (p->laddr.stop.ip4.as_u32);
+  r->lo[IPSEC_SPD_CLS_DIM_RADDR] =
+    clib_net_to_host_u32 (p->raddr.start.ip4.as_u32);
+  r->hi[IPSEC_SPD_CLS_DIM_RADDR] =
+    clib_net_to_host_u32 (p->raddr.stop.ip4.as_u32);
+
+  if (p->type == IPSEC_SPD_POLICY_IP4_OUTBOUND)
+    {
+      if (p->protocol != IPSEC_POLICY_PROTOCOL_ANY)
+	r->lo[IPSEC_SPD_CLS_DIM_PROTO] = r->hi[IPSEC_SPD_CLS_DIM_PROTO] =
+	  p->protocol;
+
+      /* ports are only matched for protocols which have them */
+      if (is_port_proto)
+	{
+	  r->lo[IPSEC_SPD_CLS_DIM_LPORT] = p->lport.start;
+	  r->hi[IPSEC_SPD_CLS_DIM_LPORT] = p->lport.stop;
+	  r->lo[IPSEC_SPD_CLS_DIM_RPORT] = p->rport.start;
+	  r->hi[IPSEC_SPD_CLS_DIM_RPORT] = p->rport.stop;
+	}
+    }
+  else if (p->type == IPSEC_SPD_POLICY_IP4_INBOUND_PROTECT)
+    {
+      ipsec_sa_t *sa = ipsec_sa_get (p->sa_index);
+
+      /* same selector as single_rule_in_match_5tuple () */
+      r->lo[IPSEC_SPD_CLS_DIM_SPI] = r->hi[IPSEC_SPD_CLS_DIM_SPI] = sa->spi;
+
+      if (ipsec_sa_is_set_IS_TUNNEL (sa))
+	{
+	  r->lo[IPSEC_SPD_CLS_DIM_LADDR] = r->hi[IPSEC_SPD_CLS_DIM_LADDR] =
+	    clib_net_to_host_u32 (sa->tunnel.t_dst.ip.ip4.as_u32);
+	  r->lo[IPSEC_SPD_CLS_DIM_RADDR] = r->hi[IPSEC_SPD_CLS_DIM_RADDR] =
+	    clib_net_to_host_u32 (sa->tunnel.t_src.ip.ip4.as_u32);
+	}
+    }
+}
+
+static int
+ipsec_spd_cls_rule_covers (ipsec_spd_cls_rule_t *r, u32 *lo, u32 *hi)
+{
+  for (int d = 0; d < IPSEC_SPD_CLS_N_DIMS; d++)
+    if (r->lo[d] > lo[d] || r->hi[d] < hi[d])
+      return 0;
+  return 1;
+}
+
+static int
+ipsec_spd_cls_u32_cmp (void *a1, void *a2)
+{
+  u32 a = *(u32 *) a1, b = *(u32 *) a2;
+  return (a > b) - (a < b);
+}
+
+/* number of elements of sorted vector which are <= t */
+static u32
+ipsec_spd_cls_count_le (u32 *v, u32 t)
+{
+  u32 l = 0, r = vec_len (v);
+
+  while (l < r)
+    {
+      u32 m = (l + r) / 2;
+      if (v[m] <= t)
+	l = m + 1;
+      else
+	r = m;
+    }
+  return l;
+}
+
+static void
+ipsec_spd_cls_build_node (ipsec_spd_cls_build_ctx_t *ctx, u32 node_index,
+			  u32 *rules, u32 *lo, u32 *hi, u32 depth)
+{
+  ipsec_spd_cls_t *cls = ctx->cls;
+  ipsec_spd_cls_node_t *node;
+  u32 best_dim = ~0, best_t = 0, best_cost, best_sum = ~0;
+  u32 *left = 0, *right = 0, *ri, n, i, save;
+
+  cls->max_depth = clib_max (cls->max_depth, depth);
+
+  /* rules are in priority order, so anything after the first rule
+   * covering the whole region can't be hit */
+  vec_foreach_index (i, rules)
+    if (ipsec_spd_cls_rule_covers (cls->rules + rules[i], lo, hi))
+      {
+	vec_set_len (rules, i + 1);
+	break;
+      }
+
+  n = vec_len (rules);
+  best_cost = n;
+
+  if (n <= IPSEC_SPD_CLS_LEAF_SIZE || depth >= IPSEC_SPD_CLS_MAX_DEPTH ||
+      vec_len (cls->leaf_rules) >= ctx->max_leaf_rules)
+    goto leaf;
+
+  for (u32 d = 0; d < IPSEC_SPD_CLS_N_DIMS; d++)
+    {
+      if (lo[d] == hi[d])
+	continue;
+
+      vec_reset_length (ctx->los);
+      vec_reset_length (ctx->his);
+      vec_foreach (ri, rules)
+	{
+	  ipsec_spd_cls_rule_t *r = cls->rules + ri[0];
+	  vec_add1 (ctx->los, clib_max (r->lo[d], lo[d]));
+	  vec_add1 (ctx->his, clib_min (r->hi[d], hi[d]));
+	}
+      vec_sort_with_function (ctx->los, ipsec_spd_cls_u32_cmp);
+      vec_sort_with_function (ctx->his, ipsec_spd_cls_u32_cmp);
+
+      /* candidate thresholds are right before the start and at the end of
+       * each rule range, a rule goes left if it starts at or below the
+       * threshold and right if it ends above it */
+      for (i = 0; i < 2 * n; i++)
+	{
+	  u32 t, nl, nr, cost;
+
+	  if (i < n)
+	    {
+	      if (ctx->los[i] == lo[d] ||
+		  (i && ctx->los[i] == ctx->los[i - 1]))
+		continue;
+	      t = ctx->los[i] - 1;
+	    }
+	  else
+	    {
+	      u32 j = i - n;
+	      if (ctx->his[j] == hi[d] ||
+		  (j && ctx->his[j] == ctx->his[j - 1]))
+		continue;
+	      t = ctx->his[j];
+	    }
+
+	  nl = ipsec_spd_cls_count_le (ctx->los, t);
+	  nr = n - ipsec_spd_cls_count_le (ctx->his, t);
+	  cost = clib_max (nl, nr);
+
+	  if (cost < best_cost || (cost == best_cost && nl + nr < best_sum))
+	    {
+	      best_cost = cost;
+	      best_sum = nl + nr;
+	      best_dim = d;
+	      best_t = t;
+	    }
+	}
+    }
+
+  /* no threshold separates any of the rules */
+  if (best_dim == ~0 || best_cost >= n)
+    goto leaf;
+
+  vec_foreach (ri, rules)
+    {
+      ipsec_spd_cls_rule_t *r = cls->rules + ri[0];
+      if (r->lo[best_dim] <= best_t)
+	vec_add1 (left, ri[0]);
+      if (r->hi[best_dim] > best_t)
+	vec_add1 (right, ri[0]);
+    }
+
+  node = vec_elt_at_index (cls->nodes, node_index);
+  node->dim = best_dim;
+  node->threshold = best_t;
+  node->index = vec_len (cls->nodes);
+  vec_resize (cls->nodes, 2);
+
+  save = hi[best_dim];
+  hi[best_dim] = best_t;
+  ipsec_spd_cls_build_node (ctx, vec_len (cls->nodes) - 2, left, lo, hi,
+			    depth + 1);
+  hi[best_dim] = save;
+
+  node = vec_elt_at_index (cls->nodes, node_index);
+  save = lo[best_dim];
+  lo[best_dim] = best_t + 1;
+  ipsec_spd_cls_build_node (ctx, node->index + 1, right, lo, hi, depth + 1);
+  lo[best_dim] = save;
+
+  vec_free (left);
+  vec_free (right);
+  return;
+
+leaf:
+  node = vec_elt_at_index (cls->nodes, node_index);
+  node->dim = IPSEC_SPD_CLS_LEAF;
+  node->index = vec_len (cls->leaf_rules);
+  node->n_rules = n;
+  vec_append (cls->leaf_rules, rules);
+}
+
+static ipsec_spd_cls_t *
+ipsec_spd_cls_build (u32 *policy_indices, int is_outbound)
+{
+  ipsec_main_t *im = &ipsec_main;
+  ipsec_spd_cls_build_ctx_t ctx = {};
+  ipsec_spd_cls_t *cls;
+  u32 *pi, n_trees = is_outbound ? 2 : 1;
+
+  cls = clib_mem_alloc (sizeof (*cls));
+  clib_memset (cls, 0, sizeof (*cls));
+  cls->n_policies = vec_len (policy_indices);
+
+  ctx.cls = cls;
+  ctx.max_leaf_rules =
+    IPSEC_SPD_CLS_MAX_REPLICATION * n_trees * clib_max (cls->n_policies, 1);
+
+  for (u32 is_port_proto = 0; is_port_proto < n_trees; is_port_proto++)
+    {
+      ipsec_spd_cls_rule_t *r;
+      u32 lo[IPSEC_SPD_CLS_N_DIMS], hi[IPSEC_SPD_CLS_N_DIMS];
+      u32 *rules = 0;
+
+      vec_foreach (pi, policy_indices)
+	{
+	  ipsec_policy_t *p = pool_elt_at_index (im->policies, pi[0]);
+
+	  /* rules for a specific protocol live only in one of the trees */
+	  if (is_outbound && p->protocol != IPSEC_POLICY_PROTOCOL_ANY &&
+	      ipsec_spd_cls_is_port_proto (p->protocol) != is_port_proto)
+	    continue;
+
+	  vec_add2 (cls->rules, r, 1);
+	  ipsec_spd_cls_rule_init (r, p, pi[0], is_port_proto);
+	  vec_add1 (rules, r - cls->rules);
+	}
+
+      for (int d = 0; d < IPSEC_SPD_CLS_N_DIMS; d++)
+	{
+	  lo[d] = 0;
+	  hi[d] = ~0;
+	}
+
+      cls->root[is_port_proto] = vec_len (cls->nodes);
+      vec_resize (cls->nodes, 1);
+      ipsec_spd_cls_build_node (&ctx, cls->root[is_port_proto], rules, lo,
+				hi, 0);
+      vec_free (rules);
+    }
+
+  if (!is_outbound)
+    cls->root[1] = cls->root[0];
+
+  vec_free (ctx.los);
+  vec_free (ctx.his);
+
+  return cls;
+}
+
+static void
+ipsec_spd_cls_free (ipsec_spd_cls_t *cls)
+{
+  if (!cls)
+    return;
+
+  vec_free (cls->nodes);
+  vec_free (cls->rules);
+  vec_free (cls->leaf_rules);
+  clib_mem_free (cls);
+}
+
+/*
+ * Workers pick up the tree with an acquire load and may keep walking the
+ * old one until the end of their current loop, so it is only freed after
+ * every worker went around once.
+ */
+static void
+ipsec_spd_cls_replace (ipsec_spd_t *spd, ipsec_spd_policy_type_t t,
+		       ipsec_spd_cls_t *cls)
+{
+  ipsec_spd_cls_t *old = spd->fp_spd.cls[t];
+
+  clib_atomic_store_rel_n (&spd->fp_spd.cls[t], cls);
+
+  if (old)
+    {
+      vlib_worker_wait_one_loop ();
+      ipsec_spd_cls_free (old);
+    }
+}
+
+typedef struct
+{
+  u32 *policies;
+  ipsec_spd_policy_type_t t;
+} ipsec_spd_cls_walk_ctx_t;
+
+static int
+ipsec_spd_cls_walk_cb (clib_bihash_kv_16_8_t *kvp, void *arg)
+{
+  ipsec_spd_cls_walk_ctx_t *ctx = arg;
+  ipsec_fp_lookup_value_t *val = (ipsec_fp_lookup_value_t *) &kvp->value;
+  ipsec_main_t *im = &ipsec_main;
+  u32 *policy_id;
+
+  vec_foreach (policy_id, val->fp_policies_ids)
+    {
+      ipsec_policy_t *p = pool_elt_at_index (im->policies, *policy_id);
+      if (p->type == ctx->t)
+	vec_add1 (ctx->policies, *policy_id);
+    }
+
+  return BIHASH_WALK_CONTINUE;
+}
+
+static int
+ipsec_spd_cls_policy_cmp (void *a1, void *a2)
+{
+  ipsec_main_t *im = &ipsec_main;
+  u32 i1 = *(u32 *) a1, i2 = *(u32 *) a2;
+  ipsec_policy_t *p1 = pool_elt_at_index (im->policies, i1);
+  ipsec_policy_t *p2 = pool_elt_at_index (im->policies, i2);
+
+  /* highest priority first */
+  if (p1->priority != p2->priority)
+    return p1->priority > p2->priority ? -1 : 1;
+  return (i1 > i2) - (i1 < i2);
+}
+
+static void
+ipsec_spd_cls_compile_type (ipsec_spd_t *spd, ipsec_spd_policy_type_t t)
+{
+  ipsec_main_t *im = &ipsec_main;
+  ipsec_spd_cls_walk_ctx_t ctx = { .t = t };
+  ipsec_spd_cls_t *cls;
+  clib_bihash_16_8_t *h;
+
+  h = pool_elt_at_index (im->fp_ip4_lookup_hashes_pool,
+			 ipsec_spd_cls_table_index (spd, t));
+  clib_bihash_foreach_key_value_pair_16_8 (h, ipsec_spd_cls_walk_cb, &ctx);
+  vec_sort_with_function (ctx.policies, ipsec_spd_cls_policy_cmp);
+
+  cls =
+    ipsec_spd_cls_build (ctx.policies, t == IPSEC_SPD_POLICY_IP4_OUTBOUND);
+  vec_free (ctx.policies);
+
+  ipsec_spd_cls_replace (spd, t, cls);
+}
+
+void
+ipsec_spd_classifier_compile (ipsec_spd_t *spd)
+{
+  for (int i = 0; i < ARRAY_LEN (ipsec_spd_cls_types); i++)
+    {
+      ipsec_spd_policy_type_t t = ipsec_spd_cls_types[i];
+
+      if (ipsec_spd_cls_table_index (spd, t) != INDEX_INVALID)
+	ipsec_spd_cls_compile_type (spd, t);
+    }
+}
+
+void
+ipsec_spd_classifier_free (ipsec_spd_t *spd)
+{
+  ipsec_spd_cls_t *old[IPSEC_SPD_POLICY_N_TYPES];
+
+  spd->fp_spd.cls_enabled = 0;
+  for (int t = 0; t < IPSEC_SPD_POLICY_N_TYPES; t++)
+    {
+      old[t] = spd->fp_spd.cls[t];
+      clib_atomic_store_rel_n (&spd->fp_spd.cls[t], 0);
+    }
+
+  /* see ipsec_spd_cls_replace */
+  vlib_worker_wait_one_loop ();
+
+  for (int t = 0; t < IPSEC_SPD_POLICY_N_TYPES; t++)
+    ipsec_spd_cls_free (old[t]);
+}
+
+void
+ipsec_spd_classifier_policy_changed (ipsec_spd_t *spd,
+				     ipsec_spd_policy_type_t type)
+{
+  vlib_main_t *vm = vlib_get_main ();
+
+  if (!spd->fp_spd.cls_enabled || !ipsec_spd_cls_is_ip4_type (type))
+    return;
+
+  ipsec_spd_cls_replace (spd, type, 0);
+
+  vlib_process_signal_event (vm, ipsec_spd_cls_process_node.index,
+			     IPSEC_SPD_CLS_EVENT_RECOMPILE, 0);
+}
+
+/*
+ * Inbound protect rules take their SPI and tunnel endpoints from the SA,
+ * so trees with rules of an SA are compiled again when the SA changes.
+ */
+void
+ipsec_spd_classifier_sa_changed (u32 sa_index)
+{
+  ipsec_main_t *im = &ipsec_main;
+  ipsec_policy_t *p;
+  ipsec_spd_t *spd;
+  uword *sp;
+
+  pool_foreach (p, im->policies)
+    {
+      if (p->type != IPSEC_SPD_POLICY_IP4_INBOUND_PROTECT ||
+	  p->sa_index != sa_index)
+	continue;
+
+      sp = hash_get (im->spd_index_by_spd_id, p->id);
+      if (!sp)
+	continue;
+
+      /* already dropped, or disabled */
+      spd = pool_elt_at_index (im->spds, sp[0]);
+      if (spd->fp_spd.cls[p->type])
+	ipsec_spd_classifier_policy_changed (spd, p->type);
+    }
+}
+
+int
+ipsec_spd_classifier_enable_disable (u32 spd_id, int is_enable)
+{
+  ipsec_main_t *im = &ipsec_main;
+  ipsec_spd_t *spd;
+  uword *p;
+
+  p = hash_get (im->spd_index_by_spd_id, spd_id);
+  if (!p)
+    return VNET_API_ERROR_NO_SUCH_ENTRY;
+
+  spd = pool_elt_at_index (im->spds, p[0]);
+
+  if (!is_enable)
+    {
+      ipsec_spd_classifier_free (spd);
+      return 0;
+    }
+
+  if (spd->fp_spd.ip4_out_lookup_hash_idx == INDEX_INVALID &&
+      spd->fp_spd.ip4_in_lookup_hash_idx == INDEX_INVALID)
+    return VNET_API_ERROR_FEATURE_DISABLED;
+
+  spd->fp_spd.cls_enabled = 1;
+  ipsec_spd_classifier_compile (spd);
+
+  return 0;
+}
+
+static uword
+ipsec_spd_cls_process (vlib_main_t *vm, vlib_node_runtime_t *rt,
+		       vlib_frame_t *f)
+{
+  ipsec_main_t *im = &ipsec_main;
+  ipsec_spd_t *spd;
+
+  while (1)
+    {
+      vlib_process_wait_for_event (vm);
+      vlib_process_get_events (vm, 0);
+
+      /* wait until policy updates stop coming */
+      do
+	vlib_process_wait_for_event_or_clock (vm, IPSEC_SPD_CLS_SETTLE_TIME);
+      while (vlib_process_get_events (vm, 0) != ~0);
+
+      pool_foreach (spd, im->spds)
+	{
+	  if (!spd->fp_spd.cls_enabled)
+	    continue;
+
+	  for (int i = 0; i < ARRAY_LEN (ipsec_spd_cls_types); i++)
+	    {
+	      ipsec_spd_policy_type_t t = ipsec_spd_cls_types[i];
+
+	      if (ipsec_spd_cls_table_index (spd, t) != INDEX_INVALID &&
+		  spd->fp_spd.cls[t] == 0)
+		ipsec_spd_cls_compile_type (spd, t);
+	    }
+	}
+    }
+
+  return 0;
+}
+
+VLIB_REGISTER_NODE (ipsec_spd_cls_process_node) = {
+  .function = ipsec_spd_cls_process,
+  .type = VLIB_NODE_TYPE_PROCESS,
+  .name = "ipsec-spd-classifier-process",
+  .process_log2_n_stack_bytes = 17,
+};
+
+u8 *
+format_ipsec_spd_classifier (u8 *s, va_list *args)
+{
+  ipsec_spd_t *spd = va_arg (*args, ipsec_spd_t *);
+
+  if (!spd->fp_spd.cls_enabled)
+    return s;
+
+  s = format (s, "classifier:");
+
+  for (int i = 0; i < ARRAY_LEN (ipsec_spd_cls_types); i++)
+    {
+      ipsec_spd_policy_type_t t = ipsec_spd_cls_types[i];
+      ipsec_spd_cls_t *cls = spd->fp_spd.cls[t];
+
+      if (ipsec_spd_cls_table_index (spd, t) == INDEX_INVALID)
+	continue;
+
+      s = format (s, "\n  %U: ", format_ipsec_policy_type, t);
+      if (!cls)
+	{
+	  s = format (s, "compiling");
+	  continue;
+	}
+
+      s = format (s, "%u policies, %u nodes, %u leaf entries, depth %u, %U",
+		  cls->n_policies, vec_len (cls->nodes),
+		  vec_len (cls->leaf_rules), cls->max_depth,
+		  format_memory_size,
+		  vec_mem_size (cls->nodes) + vec_mem_size (cls->rules) +
+		    vec_mem_size (cls->leaf_rules));
+    }
+
+  return s;
+}
@@ -0,0 +1,119 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright (c) 2025 Cisco Systems, Inc.
+ */
+
+#ifndef __IPSEC_SPD_CLASSIFIER_H__
+#define __IPSEC_SPD_CLASSIFIER_H__
+
+#include <vppinfra/clib.h>
+#include <vppinfra/vec.h>
+#include <vnet/ip/ip_packet.h>
+
+/*
+ * Compiled SPD classifier
+ *
+ * Policies of one SPD policy type are compiled into a binary decision tree
+ * over the selector dimensions below. Each internal node splits the region
+ * it covers in one dimension at a threshold, policies spanning the
+ * threshold are copied to both children. Leaves hold a short list of
+ * policies in priority order, so the first one matching the key is the
+ * result of the lookup.
+ */
+
+#define foreach_ipsec_spd_cls_dim                                             \
+  _ (LADDR, "laddr")                                                          \
+  _ (RADDR, "raddr")                                                          \
+  _ (PROTO, "proto")                                                          \
+  _ (LPORT, "lport")                                                          \
+  _ (RPORT, "rport")                                                          \
+  _ (SPI, "spi")
+
+typedef enum
+{
+#define _(d, s) IPSEC_SPD_CLS_DIM_##d,
+  foreach_ipsec_spd_cls_dim
+#undef _
+    IPSEC_SPD_CLS_N_DIMS,
+} ipsec_spd_cls_dim_t;
+
+#define IPSEC_SPD_CLS_LEAF 0xff
+
+/* max number of policies kept in leaf before it is split further */
+#define IPSEC_SPD_CLS_LEAF_SIZE 8
+#define IPSEC_SPD_CLS_MAX_DEPTH 48
+/* leaf lists stop growing once they hold this many copies per policy */
+#define IPSEC_SPD_CLS_MAX_REPLICATION 16
+
+typedef struct
+{
+  /* inclusive range per dimension, host byte order */
+  u32 lo[IPSEC_SPD_CLS_N_DIMS];
+  u32 hi[IPSEC_SPD_CLS_N_DIMS];
+  u32 policy_index;
+} ipsec_spd_cls_rule_t;
+
+typedef struct
+{
+  /* internal node: keys <= threshold go to the left child */
+  u32 threshold;
+  /* internal node: index of left child, right one follows it
+   * leaf: index of the first rule in leaf_rules */
+  u32 index;
+  u32 n_rules;
+  u8 dim;
+} ipsec_spd_cls_node_t;
+
+typedef struct ipsec_spd_cls_t_
+{
+  ipsec_spd_cls_node_t *nodes;
+  ipsec_spd_cls_rule_t *rules;
+  u32 *leaf_rules;
+
+  /* root node, indexed by is-port-protocol (outbound only, inbound
+   * selectors have no protocol or ports and both point to the same tree) */
+  u32 root[2];
+
+  u32 n_policies;
+  u32 max_depth;
+} ipsec_spd_cls_t;
+
+static_always_inline int
+ipsec_spd_cls_is_port_proto (u8 proto)
+{
+  return proto == IP_PROTOCOL_TCP || proto == IP_PROTOCOL_UDP ||
+	 proto == IP_PROTOCOL_SCTP;
+}
+
+static_always_inline int
+ipsec_spd_cls_rule_match (const ipsec_spd_cls_rule_t *r, const u32 *key)
+{
+  u32 miss = 0;
+
+  for (int d = 0; d < IPSEC_SPD_CLS_N_DIMS; d++)
+    miss |= (key[d] < r->lo[d]) | (key[d] > r->hi[d]);
+
+  return miss == 0;
+}
+
+/* returns policy index or ~0 if nothing matches */
+static_always_inline u32
+ipsec_spd_cls_lookup (const ipsec_spd_cls_t *cls, u32 root, const u32 *key)
+{
+  const ipsec_spd_cls_node_t *n = cls->nodes + root;
+
+  while (n->dim != IPSEC_SPD_CLS_LEAF)
+    n = cls->nodes + n->index + (key[n->dim] > n->threshold);
+
+  for (u32 i = 0; i < n->n_rules; i++)
+    {
+      const ipsec_spd_cls_rule_t *r =
+	cls->rules + cls->leaf_rules[n->index + i];
+
+      if (ipsec_spd_cls_rule_match (r, key))
+	return r->policy_index;
+    }
+
+  return ~0;
+}
+
+#endif /* __IPSEC_SPD_CLASSIFIER_H__ */
@@ -408,6 +408,45 @@ ipsec_fp_in_ip4_policy_match_n (void *spd_fp, ipsec_fp_5tuple_t *tuples,
   return counter;
 }
 
+/**
+ * @brief lookup in compiled SPD classifier for inbound traffic burst of
+ * n packets, same contract as ipsec_fp_in_ip4_policy_match_n ()
+ **/
+
+static_always_inline u32
+ipsec_spd_cls_in_ip4_policy_match_n (ipsec_spd_cls_t *cls,
+				     ipsec_fp_5tuple_t *tuples,
+				     ipsec_policy_t **policies, u32 n)
+{
+  ipsec_main_t *im = &ipsec_main;
+  u32 key[IPSEC_SPD_CLS_N_DIMS] = {};
+  u32 counter = 0;
+
+  for (u32 i = 0; i < n; i++)
+    {
+      ipsec_fp_5tuple_t *match = tuples + i;
+      u32 pi;
+
+      key[IPSEC_SPD_CLS_DIM_LADDR] =
+	clib_net_to_host_u32 (match->laddr.as_u32);
+      key[IPSEC_SPD_CLS_DIM_RADDR] =
+	clib_net_to_host_u32 (match->raddr.as_u32);
+      key[IPSEC_SPD_CLS_DIM_SPI] = match->spi;
+
+      pi = ipsec_spd_cls_lookup (cls, cls->root[0], key);
+      if (pi == ~0)
+	{
+	  policies[i] = 0;
+	  continue;
+	}
+
+      policies[i] = pool_elt_at_index (im->policies, pi);
+      counter++;
+    }
+
+  return counter;
+}
+
 /**
  * @brief function handler to perform lookup in fastpath SPD
  * for inbound traffic burst of n packets
@@ -418,10 +457,17 @@ ipsec_fp_in_policy_match_n (void *spd_fp, u8 is_ipv6,
 			    ipsec_fp_5tuple_t *tuples,
 			    ipsec_policy_t **policies, u32 n)
 {
+  ipsec_spd_cls_t *cls;
+
   if (is_ipv6)
     return ipsec_fp_in_ip6_policy_match_n (spd_fp, tuples, policies, n);
-  else
-    return ipsec_fp_in_ip4_policy_match_n (spd_fp, tuples, policies, n);
+
+  cls = clib_atomic_load_acq_n (
+    &((ipsec_spd_fp_t *) spd_fp)->cls[tuples->action]);
+  if (cls)
+    return ipsec_spd_cls_in_ip4_policy_match_n (cls, tuples, policies, n);
+
+  return ipsec_fp_in_ip4_policy_match_n (spd_fp, tuples, policies, n);
 }
 
 static_always_inline u32
@@ -634,6 +680,50 @@ ipsec_fp_out_ip4_policy_match_n (void *spd_fp, ipsec_fp_5tuple_t *tuples,
   return counter;
 }
 
+/**
+ * @brief lookup in compiled SPD classifier for outbound traffic burst of
+ * n packets, same contract as ipsec_fp_out_ip4_policy_match_n ()
+ **/
+
+static_always_inline u32
+ipsec_spd_cls_out_ip4_policy_match_n (ipsec_spd_cls_t *cls,
+				      ipsec_fp_5tuple_t *tuples,
+				      ipsec_policy_t **policies, u32 *ids,
+				      u32 n)
+{
+  ipsec_main_t *im = &ipsec_main;
+  u32 key[IPSEC_SPD_CLS_N_DIMS] = {};
+  u32 counter = 0;
+
+  for (u32 i = 0; i < n; i++)
+    {
+      ipsec_fp_5tuple_t *match = tuples + i;
+      u32 pi;
+
+      key[IPSEC_SPD_CLS_DIM_LADDR] =
+	clib_net_to_host_u32 (match->laddr.as_u32);
+      key[IPSEC_SPD_CLS_DIM_RADDR] =
+	clib_net_to_host_u32 (match->raddr.as_u32);
+      key[IPSEC_SPD_CLS_DIM_PROTO] = match->protocol;
+      key[IPSEC_SPD_CLS_DIM_LPORT] = match->lport;
+      key[IPSEC_SPD_CLS_DIM_RPORT] = match->rport;
+
+      pi = ipsec_spd_cls_lookup (
+	cls, cls->root[ipsec_spd_cls_is_port_proto (match->protocol)], key);
+      if (pi == ~0)
+	{
+	  policies[i] = 0;
+	  continue;
+	}
+
+      policies[i] = pool_elt_at_index (im->policies, pi);
+      ids[i] = pi;
+      counter++;
+    }
+
+  return counter;
+}
+
 /**
  * @brief function handler to perform lookup in fastpath SPD
  * for outbound traffic burst of n packets
@@ -646,10 +736,18 @@ ipsec_fp_out_policy_match_n (void *spd_fp, u8 is_ipv6,
 			     ipsec_policy_t **policies, u32 *ids, u32 n)
 
 {
+  ipsec_spd_cls_t *cls;
+
   if (is_ipv6)
     return ipsec_fp_out_ip6_policy_match_n (spd_fp, tuples, policies, ids, n);
-  else
-    return ipsec_fp_out_ip4_policy_match_n (spd_fp, tuples, policies, ids, n);
+
+  cls = clib_atomic_load_acq_n (
+    &((ipsec_spd_fp_t *) spd_fp)->cls[IPSEC_SPD_POLICY_IP4_OUTBOUND]);
+  if (cls)
+    return ipsec_spd_cls_out_ip4_policy_match_n (cls, tuples, policies, ids,
+						 n);
+
+  return ipsec_fp_out_ip4_policy_match_n (spd_fp, tuples, policies, ids, n);
 }
 
 #endif /* !IPSEC_SPD_FP_LOOKUP_H */
@@ -111,6 +111,7 @@ ipsec_add_del_policy (vlib_main_t * vm,
   ipsec_policy_t *vp;
   u32 spd_index;
   uword *p;
+  int rv;
 
   p = hash_get (im->spd_index_by_spd_id, policy->id);
 
@@ -191,8 +192,12 @@ ipsec_add_del_policy (vlib_main_t * vm,
        * traditional SPD when failed.
        **/
       if (ipsec_is_fp_enabled (im, spd, policy))
-	return ipsec_fp_add_del_policy ((void *) &spd->fp_spd, policy, 1,
+	{
+	  rv = ipsec_fp_add_del_policy ((void *) &spd->fp_spd, policy, 1,
 					stat_index);
+	  ipsec_spd_classifier_policy_changed (spd, policy->type);
+	  return rv;
+	}
 
       pool_get (im->policies, vp);
       clib_memcpy (vp, policy, sizeof (*vp));
@@ -241,8 +246,10 @@ ipsec_add_del_policy (vlib_main_t * vm,
 	  else
 	    policy->sa_index = INDEX_INVALID;
 
-	  return ipsec_fp_add_del_policy ((void *) &spd->fp_spd, policy, 0,
-					  stat_index);
+	  rv = ipsec_fp_add_del_policy ((void *) &spd->fp_spd, policy, 0,
+					stat_index);
+	  ipsec_spd_classifier_policy_changed (spd, policy->type);
+	  return rv;
 	}
 
       vec_foreach_index (ii, (spd->policies[policy->type]))
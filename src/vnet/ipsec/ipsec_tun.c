@@ -547,6 +547,189 @@ ipsec_tun_protect_unconfig (ipsec_main_t * im, ipsec_tun_protect_t * itp)
   ITP_DBG (itp, "unconfigured");
 }
 
+/*
+ * The SAs of a protection can be replaced while the workers run if the
+ * crypto endpoints, which key its entries in the RX DB, stay the same.
+ */
+static bool
+ipsec_tun_protect_can_swap (const ipsec_tun_protect_t *itp, const u32 *sas_in)
+{
+  ipsec_protect_flags_t flags = itp->itp_flags;
+  ip46_address_t src = itp->itp_crypto.src;
+  ip46_address_t dst = itp->itp_crypto.dst;
+  const u32 *sai;
+
+  vec_foreach (sai, sas_in)
+    {
+      const ipsec_sa_t *sa = ipsec_sa_get (*sai);
+
+      if (ipsec_sa_is_set_IS_TUNNEL (sa))
+	{
+	  src = ip_addr_46 (&sa->tunnel.t_dst);
+	  dst = ip_addr_46 (&sa->tunnel.t_src);
+	  if (!(flags & IPSEC_PROTECT_ITF))
+	    flags |= IPSEC_PROTECT_ENCAPED;
+	}
+      else
+	{
+	  src = itp->itp_tun.src;
+	  dst = itp->itp_tun.dst;
+	  flags &= ~IPSEC_PROTECT_ENCAPED;
+	}
+    }
+
+  return (flags == itp->itp_flags &&
+	  ip46_address_is_equal (&src, &itp->itp_crypto.src) &&
+	  ip46_address_is_equal (&dst, &itp->itp_crypto.dst));
+}
+
+static adj_walk_rc_t
+ipsec_tun_protect_adj_swap (adj_index_t ai, void *arg)
+{
+  ipsec_tun_protect_t *itp = arg;
+
+  ASSERT (ai < vec_len (ipsec_tun_protect_sa_by_adj_index));
+
+  /* a single store, each packet sees either the old or the new SA */
+  clib_atomic_store_rel_n (&ipsec_tun_protect_sa_by_adj_index[ai],
+			   itp->itp_out_sa);
+
+  if (itp->itp_flags & IPSEC_PROTECT_ITF)
+    ipsec_itf_adj_stack (ai, itp->itp_out_sa);
+
+  return (ADJ_WALK_RC_CONTINUE);
+}
+
+static bool
+ipsec_tun_protect_uses_sa_in (const ipsec_tun_protect_t *itp, u32 sai)
+{
+  u32 ii;
+
+  for (ii = 0; ii < itp->itp_n_sa_in; ii++)
+    if (itp->itp_in_sas[ii] == sai)
+      return (true);
+
+  return (false);
+}
+
+static bool
+ipsec_tun_protect_uses_spi_in (const ipsec_tun_protect_t *itp, u32 spi)
+{
+  u32 ii;
+
+  for (ii = 0; ii < itp->itp_n_sa_in; ii++)
+    if (ipsec_sa_get (itp->itp_in_sas[ii])->spi == spi)
+      return (true);
+
+  return (false);
+}
+
+/*
+ * Replace the SAs of a configured protection without stopping the workers.
+ * The new SAs are made reachable before the old ones are withdrawn, so
+ * in-flight packets find one or the other but never neither.
+ */
+static void
+ipsec_tun_protect_swap (ipsec_main_t *im, ipsec_tun_protect_t *itp,
+			u32 sa_out, u32 *sas_in)
+{
+  ipsec_tun_protect_t old = *itp, stale, withdraw;
+  fib_protocol_t nh_proto;
+  ip46_address_t nh;
+  ipsec_sa_t *sa;
+  u32 ii, n_sa_in;
+
+  ipsec_sa_lock (sa_out);
+  vec_foreach_index (ii, sas_in)
+    ipsec_sa_lock (sas_in[ii]);
+
+  if (itp->itp_flags & IPSEC_PROTECT_ITF)
+    {
+      sa = ipsec_sa_get (sa_out);
+      ipsec_sa_set_NO_ALGO_NO_DROP (sa);
+      ipsec_sa_update_runtime (sa);
+    }
+
+  itp->itp_n_sa_in = vec_len (sas_in);
+  for (ii = 0; ii < itp->itp_n_sa_in; ii++)
+    itp->itp_in_sas[ii] = sas_in[ii];
+  itp->itp_out_sa = sa_out;
+  ipsec_tun_protect_set_crypto_addr (itp);
+
+  /* make: add the input SAs that are new to the RX DB ... */
+  n_sa_in = 0;
+  for (ii = 0; ii < vec_len (sas_in); ii++)
+    if (!ipsec_tun_protect_uses_sa_in (&old, sas_in[ii]))
+      itp->itp_in_sas[n_sa_in++] = sas_in[ii];
+  itp->itp_n_sa_in = n_sa_in;
+  ipsec_tun_protect_rx_db_add (im, itp);
+
+  itp->itp_n_sa_in = vec_len (sas_in);
+  for (ii = 0; ii < itp->itp_n_sa_in; ii++)
+    itp->itp_in_sas[ii] = sas_in[ii];
+
+  /* ... and move the adjacencies over to the new output SA */
+  nh_proto = ip_address_to_46 (itp->itp_key, &nh);
+
+  if (vnet_sw_interface_is_p2p (vnet_get_main (), itp->itp_sw_if_index))
+    {
+      FOR_EACH_FIB_IP_PROTOCOL (nh_proto)
+	adj_nbr_walk (itp->itp_sw_if_index, nh_proto,
+		      ipsec_tun_protect_adj_swap, itp);
+    }
+  else
+    adj_nbr_walk_nh (itp->itp_sw_if_index, nh_proto, &nh,
+		     ipsec_tun_protect_adj_swap, itp);
+
+  /* break: withdraw the input SAs that are no longer used */
+  stale = old;
+  stale.itp_n_sa_in = 0;
+  for (ii = 0; ii < old.itp_n_sa_in; ii++)
+    if (!ipsec_tun_protect_uses_sa_in (itp, old.itp_in_sas[ii]))
+      stale.itp_in_sas[stale.itp_n_sa_in++] = old.itp_in_sas[ii];
+
+  /*
+   * a new SA that reuses the SPI of a stale one has already replaced its
+   * entry in the RX DB, so removing the stale one by key would remove the
+   * new one. Keep the entry and only drop the extra node registration.
+   */
+  withdraw = stale;
+  withdraw.itp_n_sa_in = 0;
+  for (ii = 0; ii < stale.itp_n_sa_in; ii++)
+    {
+      sa = ipsec_sa_get (stale.itp_in_sas[ii]);
+
+      if (!ipsec_tun_protect_uses_spi_in (itp, sa->spi))
+	withdraw.itp_in_sas[withdraw.itp_n_sa_in++] = stale.itp_in_sas[ii];
+      else if (!ip46_address_is_zero (&itp->itp_crypto.dst))
+	ipsec_tun_unregister_nodes (
+	  ip46_address_is_ip4 (&itp->itp_crypto.dst) ? AF_IP4 : AF_IP6);
+    }
+
+  ipsec_tun_protect_rx_db_remove (im, &withdraw);
+
+  for (ii = 0; ii < stale.itp_n_sa_in; ii++)
+    {
+      sa = ipsec_sa_get (stale.itp_in_sas[ii]);
+      ipsec_sa_unset_IS_PROTECT (sa);
+      ipsec_sa_update_runtime (sa);
+    }
+
+  if (old.itp_out_sa != sa_out)
+    {
+      sa = ipsec_sa_get (old.itp_out_sa);
+      ipsec_sa_unset_NO_ALGO_NO_DROP (sa);
+      ipsec_sa_update_runtime (sa);
+    }
+
+  /* SAs no longer locked by anything else are deleted here */
+  ipsec_sa_unlock (old.itp_out_sa);
+  for (ii = 0; ii < old.itp_n_sa_in; ii++)
+    ipsec_sa_unlock (old.itp_in_sas[ii]);
+
+  ITP_DBG (itp, "swapped");
+}
+
 static void
 ipsec_tun_protect_update_from_teib (ipsec_tun_protect_t * itp,
 				    const teib_entry_t * ne)
@@ -568,6 +751,7 @@ ipsec_tun_protect_update (u32 sw_if_index,
 			  const ip_address_t * nh, u32 sa_out, u32 * sas_in)
 {
   ipsec_tun_protect_t *itp;
+  ipsec_ctl_op_ctx_t ctx;
   u32 itpi, ii, *saip;
   ipsec_main_t *im;
   int rv;
@@ -579,6 +763,8 @@ ipsec_tun_protect_update (u32 sw_if_index,
 	    format_vnet_sw_if_index_name, vnet_get_main (), sw_if_index,
 	    format_ip_address, nh);
 
+  ipsec_ctl_op_begin (&ctx, IPSEC_CTL_OP_TUN_PROTECT_UPDATE);
+
   if (vec_len (sas_in) > ITP_MAX_N_SA_IN)
     {
       rv = VNET_API_ERROR_LIMIT_EXCEEDED;
@@ -624,6 +810,9 @@ ipsec_tun_protect_update (u32 sw_if_index,
 	  goto out;
 	}
 
+      /* a new protection changes the interface's output features */
+      ipsec_ctl_op_barrier_sync (&ctx);
+
       pool_get_zero (ipsec_tun_protect_pool, itp);
 
       itp->itp_sw_if_index = sw_if_index;
@@ -702,8 +891,14 @@ ipsec_tun_protect_update (u32 sw_if_index,
       /* updating SAs only */
       itp = pool_elt_at_index (ipsec_tun_protect_pool, itpi);
 
-      ipsec_tun_protect_unconfig (im, itp);
-      ipsec_tun_protect_config (im, itp, sa_out, sas_in);
+      if (ipsec_tun_protect_can_swap (itp, sas_in))
+	ipsec_tun_protect_swap (im, itp, sa_out, sas_in);
+      else
+	{
+	  ipsec_ctl_op_barrier_sync (&ctx);
+	  ipsec_tun_protect_unconfig (im, itp);
+	  ipsec_tun_protect_config (im, itp, sa_out, sas_in);
+	}
     }
 
   ipsec_sa_unlock (sa_out);
@@ -711,6 +906,7 @@ ipsec_tun_protect_update (u32 sw_if_index,
   vec_free (sas_in);
 
 out:
+  ipsec_ctl_op_end (&ctx);
   return (rv);
 }
 
@@ -740,7 +936,9 @@ ipsec_tun_protect_del_by_idx (index_t itpi)
 int
 ipsec_tun_protect_del (u32 sw_if_index, const ip_address_t *nh)
 {
+  ipsec_ctl_op_ctx_t ctx;
   index_t itpi;
+  int rv;
 
   ITP_DBG2 ("delete: %U/%U", format_vnet_sw_if_index_name, vnet_get_main (),
 	    sw_if_index, format_ip_address, nh);
@@ -750,7 +948,13 @@ ipsec_tun_protect_del (u32 sw_if_index, const ip_address_t *nh)
 
   itpi = ipsec_tun_protect_find (sw_if_index, nh);
 
-  return ipsec_tun_protect_del_by_idx (itpi);
+  /* removing the protection changes the interface's output features */
+  ipsec_ctl_op_begin (&ctx, IPSEC_CTL_OP_TUN_PROTECT_DEL);
+  ipsec_ctl_op_barrier_sync (&ctx);
+  rv = ipsec_tun_protect_del_by_idx (itpi);
+  ipsec_ctl_op_end (&ctx);
+
+  return (rv);
 }
 
 void
@@ -785,8 +785,12 @@ application_alloc_and_init (app_init_args_t *a)
   application_t *app;
   u64 *opts;
 
-  app = application_alloc ();
   opts = a->options;
+  if ((opts[APP_OPTIONS_FLAGS] & APP_OPTIONS_FLAGS_NUMA_BIND_SEGMENTS) &&
+      opts[APP_OPTIONS_NUMA_NODE] >= CLIB_MAX_NUMAS)
+    return SESSION_E_INVALID;
+
+  app = application_alloc ();
   /*
    * Make sure we support the requested configuration
    */
@@ -853,6 +857,15 @@ application_alloc_and_init (app_init_args_t *a)
     props->low_watermark = opts[APP_OPTIONS_LOW_WATERMARK];
   if (opts[APP_OPTIONS_PCT_FIRST_ALLOC])
     props->pct_first_alloc = opts[APP_OPTIONS_PCT_FIRST_ALLOC];
+  if (opts[APP_OPTIONS_FLAGS] & APP_OPTIONS_FLAGS_PREFAULT_SEGMENTS)
+    props->prefault = 1;
+  if (opts[APP_OPTIONS_FLAGS] & APP_OPTIONS_FLAGS_NUMA_BIND_SEGMENTS)
+    {
+      props->numa_bind = 1;
+      props->numa_node = opts[APP_OPTIONS_NUMA_NODE];
+    }
+  if (opts[APP_OPTIONS_PREALLOC_CHUNKS])
+    props->prealloc_chunks = opts[APP_OPTIONS_PREALLOC_CHUNKS];
   props->segment_type = seg_type;
 
   /* Add app to lookup by api_client_index table */
@@ -229,6 +229,8 @@ typedef enum
   APP_OPTIONS_HIGH_WATERMARK,
   APP_OPTIONS_LOW_WATERMARK,
   APP_OPTIONS_PCT_FIRST_ALLOC,
+  APP_OPTIONS_NUMA_NODE,
+  APP_OPTIONS_PREALLOC_CHUNKS,
   APP_OPTIONS_N_OPTIONS
 } app_attach_options_index_t;
 
@@ -243,7 +245,9 @@ typedef enum
   _ (EVT_MQ_USE_EVENTFD, "Use eventfds for signaling")                        \
   _ (MEMFD_FOR_BUILTIN, "Use memfd for builtin app segs")                     \
   _ (USE_HUGE_PAGE, "Use huge page for FIFO")                                 \
-  _ (GET_ORIGINAL_DST, "Get original dst enabled")
+  _ (GET_ORIGINAL_DST, "Get original dst enabled")                            \
+  _ (PREFAULT_SEGMENTS, "Prefault fifo segment memory")                       \
+  _ (NUMA_BIND_SEGMENTS, "Bind fifo segments to numa node")
 
 typedef enum _app_options
 {
@@ -657,6 +661,39 @@ app_send_io_evt_to_vpp (svm_msg_q_t * mq, u32 session_index, u8 evt_type,
     }
 }
 
+/**
+ * Send batch of fifo io events to vpp worker thread
+ *
+ * Events are added to the queue under one lock acquisition and, because
+ * vpp is only signaled on the queue's transition from empty, with at most
+ * one notification.
+ *
+ * @param mq		vpp message queue
+ * @param evts		events to be sent. Only session index and event
+ * 			type are used
+ * @param n_evts	number of events
+ */
+static inline void
+app_send_io_evts_to_vpp (svm_msg_q_t *mq, session_event_t *evts, u32 n_evts)
+{
+  session_event_t *evt;
+  svm_msg_q_msg_t msg;
+  u32 i;
+
+  svm_msg_q_lock (mq);
+  for (i = 0; i < n_evts; i++)
+    {
+      while (svm_msg_q_or_ring_is_full (mq, SESSION_MQ_IO_EVT_RING))
+	svm_msg_q_or_ring_wait_prod (mq, SESSION_MQ_IO_EVT_RING);
+      msg = svm_msg_q_alloc_msg_w_ring (mq, SESSION_MQ_IO_EVT_RING);
+      evt = (session_event_t *) svm_msg_q_msg_data (mq, &msg);
+      evt->session_index = evts[i].session_index;
+      evt->event_type = evts[i].event_type;
+      svm_msg_q_add_raw (mq, &msg);
+    }
+  svm_msg_q_unlock (mq);
+}
+
 #define app_send_dgram_raw(f, at, vpp_evt_q, data, len, evt_type, do_evt,     \
 			   noblock)                                           \
   app_send_dgram_raw_gso (f, at, vpp_evt_q, data, len, 0, evt_type, do_evt,   \
@@ -836,6 +873,7 @@ typedef enum app_sapi_msg_type
   APP_SAPI_MSG_TYPE_SEND_FDS,
   APP_SAPI_MSG_TYPE_ADD_DEL_CERT_KEY,
   APP_SAPI_MSG_TYPE_ADD_DEL_CERT_KEY_REPLY,
+  APP_SAPI_MSG_TYPE_ATTACH_V2,
 } __clib_packed app_sapi_msg_type_e;
 
 typedef struct app_sapi_attach_msg_
@@ -844,9 +882,13 @@ typedef struct app_sapi_attach_msg_
   u64 options[18];
 } __clib_packed app_sapi_attach_msg_t;
 
-STATIC_ASSERT (sizeof (u64) * APP_OPTIONS_N_OPTIONS <=
-	       sizeof (((app_sapi_attach_msg_t *) 0)->options),
-	       "Out of options, fix message definition");
+/* Options are sent as a separate message of n_options u64s, after this
+ * one, so the size of app_sapi_msg_t does not change as options are added */
+typedef struct app_sapi_attach_v2_msg_
+{
+  u8 name[64];
+  u32 n_options;
+} __clib_packed app_sapi_attach_v2_msg_t;
 
 typedef struct app_sapi_attach_reply_msg_
 {
@@ -902,6 +944,7 @@ typedef struct app_sapi_msg_
   union
   {
     app_sapi_attach_msg_t attach;
+    app_sapi_attach_v2_msg_t attach_v2;
     app_sapi_attach_reply_msg_t attach_reply;
     app_sapi_worker_add_del_msg_t worker_add_del;
     app_sapi_worker_add_del_reply_msg_t worker_add_del_reply;
@@ -910,6 +953,9 @@ typedef struct app_sapi_msg_
   };
 } __clib_packed app_sapi_msg_t;
 
+STATIC_ASSERT (sizeof (app_sapi_msg_t) == 1 + 64 + 18 * sizeof (u64),
+	       "sapi message size is part of the wire format");
+
 static inline void
 session_endpoint_init_ext_cfgs (session_endpoint_cfg_t *sep_ext, u32 len)
 {
@@ -81,6 +81,35 @@ segment_manager_segment_index (segment_manager_t * sm, fifo_segment_t * seg)
   return (seg - sm->segments);
 }
 
+/**
+ * Populate chunk freelists of all slices of a new segment
+ *
+ * Chunks are sized for the default rx and tx fifos so that fifo allocation
+ * and growth on session setup can be served from freelists.
+ */
+static void
+segment_manager_segment_prealloc_chunks (fifo_segment_t *fs,
+					 segment_manager_props_t *props)
+{
+  u32 i;
+
+  for (i = 0; i < fs->n_slices; i++)
+    {
+      if (fifo_segment_prealloc_fifo_chunks (fs, i, props->rx_fifo_size,
+					     props->prealloc_chunks))
+	{
+	  SESSION_DBG ("rx chunk prealloc failed: slice %u", i);
+	  break;
+	}
+      if (fifo_segment_prealloc_fifo_chunks (fs, i, props->tx_fifo_size,
+					     props->prealloc_chunks))
+	{
+	  SESSION_DBG ("tx chunk prealloc failed: slice %u", i);
+	  break;
+	}
+    }
+}
+
 /**
  * Adds segment to segment manager's pool
  *
@@ -143,6 +172,9 @@ segment_manager_add_segment_inline (segment_manager_t *sm, uword segment_size,
   fs->ssvm.ssvm_size = segment_size;
   fs->ssvm.name = seg_name;
   fs->ssvm.requested_va = 0;
+  fs->ssvm.prefault = props->prefault;
+  fs->ssvm.numa_bind = props->numa_bind;
+  fs->ssvm.numa = props->numa_node;
 
   if ((rv = ssvm_server_init (&fs->ssvm, props->segment_type)))
     {
@@ -174,6 +206,9 @@ segment_manager_add_segment_inline (segment_manager_t *sm, uword segment_size,
   fs->flags &= ~FIFO_SEGMENT_F_MEM_LIMIT;
   fs->h->pct_first_alloc = props->pct_first_alloc;
 
+  if (props->prealloc_chunks)
+    segment_manager_segment_prealloc_chunks (fs, props);
+
   if (notify_app)
     {
       app_worker_t *app_wrk;
@@ -923,6 +958,51 @@ segment_manager_attach_fifo (segment_manager_t *sm, svm_fifo_t **f,
   (*f)->vpp_sh = s->handle;
 }
 
+u32
+segment_manager_compact_fifo (svm_fifo_t *f, u32 max_bytes)
+{
+  segment_manager_t *sm;
+  u32 n_bytes;
+
+  n_bytes = svm_fifo_compact (f, max_bytes);
+  if (!n_bytes)
+    return 0;
+
+  /* Workers update stats concurrently */
+  sm = segment_manager_get_if_valid (f->segment_manager);
+  if (sm)
+    {
+      clib_atomic_fetch_add_relax (&sm->n_compacted_fifos, 1);
+      clib_atomic_fetch_add_relax (&sm->compacted_bytes, n_bytes);
+    }
+
+  return n_bytes;
+}
+
+void
+segment_manager_get_mem_stats (segment_manager_t *sm,
+			       segment_manager_mem_stats_t *st)
+{
+  fifo_segment_t *seg;
+  uword free_bytes;
+
+  clib_memset (st, 0, sizeof (*st));
+
+  segment_manager_foreach_segment_w_lock (
+    seg, sm, ({
+      free_bytes = fifo_segment_free_bytes (seg);
+      st->n_segments += 1;
+      st->n_fifos += fifo_segment_num_fifos (seg);
+      st->size += fifo_segment_size (seg);
+      st->cached += fifo_segment_fl_chunk_bytes (seg);
+      st->in_use += fifo_segment_size (seg) - free_bytes -
+		    fifo_segment_cached_bytes (seg);
+    }));
+
+  st->n_compacted_fifos = clib_atomic_load_relax_n (&sm->n_compacted_fifos);
+  st->compacted_bytes = clib_atomic_load_relax_n (&sm->compacted_bytes);
+}
+
 u32
 segment_manager_evt_q_expected_size (u32 q_len)
 {
@@ -1088,13 +1168,34 @@ format_segment_manager (u8 *s, va_list *args)
   return s;
 }
 
+u8 *
+format_segment_manager_mem_stats (u8 *s, va_list *args)
+{
+  segment_manager_t *sm = va_arg (*args, segment_manager_t *);
+  segment_manager_mem_stats_t _st, *st = &_st;
+  f64 usage;
+
+  segment_manager_get_mem_stats (sm, st);
+  usage = st->size ? (100.0 * st->in_use) / st->size : 0;
+
+  s = format (s,
+	      "[%u] segs: %u fifos: %u size: %U in-use: %U (%.2f%%) "
+	      "cached: %U compacted: %lu fifos %U",
+	      segment_manager_index (sm), st->n_segments, st->n_fifos,
+	      format_memory_size, st->size, format_memory_size, st->in_use,
+	      usage, format_memory_size, st->cached, st->n_compacted_fifos,
+	      format_memory_size, st->compacted_bytes);
+
+  return s;
+}
+
 static clib_error_t *
 segment_manager_show_fn (vlib_main_t * vm, unformat_input_t * input,
 			 vlib_cli_command_t * cmd)
 {
   unformat_input_t _line_input, *line_input = &_line_input;
   segment_manager_main_t *smm = &sm_main;
-  u8 show_segments = 0, verbose = 0;
+  u8 show_segments = 0, verbose = 0, show_mem = 0;
   segment_manager_t *sm;
   u32 sm_index = ~0;
 
@@ -1111,6 +1212,8 @@ segment_manager_show_fn (vlib_main_t * vm, unformat_input_t * input,
 	show_segments = 1;
       else if (unformat (line_input, "verbose"))
 	verbose = 1;
+      else if (unformat (line_input, "mem"))
+	show_mem = 1;
       else if (unformat (line_input, "index %u", &sm_index))
 	;
       else
@@ -1132,7 +1235,20 @@ segment_manager_show_fn (vlib_main_t * vm, unformat_input_t * input,
 	  vlib_cli_output (vm, "segment manager %u not allocated", sm_index);
 	  goto done;
 	}
-      vlib_cli_output (vm, "%U", format_segment_manager, sm, 1 /* verbose */);
+      if (show_mem)
+	vlib_cli_output (vm, "%U", format_segment_manager_mem_stats, sm);
+      else
+	vlib_cli_output (vm, "%U", format_segment_manager, sm,
+			 1 /* verbose */);
+      goto done;
+    }
+
+  if (show_mem)
+    {
+      pool_foreach (sm, smm->segment_managers)
+	{
+	  vlib_cli_output (vm, "%U", format_segment_manager_mem_stats, sm);
+	}
       goto done;
     }
 
@@ -1155,7 +1271,8 @@ done:
 
 VLIB_CLI_COMMAND (segment_manager_show_command, static) = {
   .path = "show segment-manager",
-  .short_help = "show segment-manager [segments][verbose][index <nn>]",
+  .short_help =
+    "show segment-manager [segments][verbose][mem][index <nn>]",
   .function = segment_manager_show_fn,
 };
 
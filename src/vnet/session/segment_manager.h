@@ -32,7 +32,9 @@ typedef struct _segment_manager_props
   uword add_segment_size;		/**< additional segment size */
   u8 add_segment:1;			/**< can add new segments flag */
   u8 use_mq_eventfd:1;			/**< use eventfds for mqs flag */
-  u8 reserved:6;			/**< reserved flags */
+  u8 prefault:1;			/**< prefault segments flag */
+  u8 numa_bind:1;			/**< bind segments to numa flag */
+  u8 reserved:4;			/**< reserved flags */
   u8 n_slices;				/**< number of fs slices/threads */
   ssvm_segment_type_t segment_type;	/**< seg type: if set to SSVM_N_TYPES,
 					     private segments are used */
@@ -41,6 +43,9 @@ typedef struct _segment_manager_props
   u8 low_watermark;			/**< memory usage low watermark % */
   u8 pct_first_alloc;			/**< pct of fifo size to alloc */
   u8 huge_page;				/**< use hugepage */
+  u8 numa_node;				/**< numa node segments bind to */
+  u32 prealloc_chunks;			/**< per slice chunks preallocated
+					     for each new segment */
 } segment_manager_props_t;
 
 #define foreach_seg_manager_flag                                              \
@@ -84,8 +89,25 @@ typedef struct _segment_manager
   u32 max_fifo_size;
   u8 high_watermark;
   u8 low_watermark;
+
+  /** Number of idle fifos compacted */
+  u64 n_compacted_fifos;
+
+  /** Fifo chunk bytes released by compaction */
+  u64 compacted_bytes;
 } segment_manager_t;
 
+typedef struct segment_manager_mem_stats_
+{
+  u32 n_segments;	/**< segments owned by segment manager */
+  u32 n_fifos;		/**< active fifos in all segments */
+  uword size;		/**< bytes usable for fifos */
+  uword in_use;		/**< bytes allocated to fifos */
+  uword cached;		/**< chunk bytes on slice freelists */
+  u64 n_compacted_fifos;
+  u64 compacted_bytes;
+} segment_manager_mem_stats_t;
+
 #define SEGMENT_MANAGER_INVALID_APP_INDEX ((u32) ~0)
 
 segment_manager_t *segment_manager_alloc (void);
@@ -161,6 +183,27 @@ void segment_manager_detach_fifo (segment_manager_t *sm, svm_fifo_t **f);
 void segment_manager_attach_fifo (segment_manager_t *sm, svm_fifo_t **f,
 				  session_t *s);
 
+/**
+ * Compact fifo allocated by a segment manager
+ *
+ * See @ref svm_fifo_compact for constraints. Bytes released are accounted
+ * in the fifo's segment manager memory stats.
+ *
+ * @param f		fifo to be compacted
+ * @param max_bytes	upper bound for bytes left allocated to fifo
+ * @return		number of chunk bytes released
+ */
+u32 segment_manager_compact_fifo (svm_fifo_t *f, u32 max_bytes);
+
+/**
+ * Collect segment manager memory usage
+ *
+ * @param sm	segment manager
+ * @param st	stats to be filled in
+ */
+void segment_manager_get_mem_stats (segment_manager_t *sm,
+				    segment_manager_mem_stats_t *st);
+
 void segment_manager_set_watermarks (segment_manager_t * sm,
 				     u8 high_watermark, u8 low_watermark);
 
@@ -204,6 +247,7 @@ segment_manager_parse_segment_handle (u64 segment_handle, u32 * sm_index,
 }
 
 extern u8 *format_segment_manager (u8 *s, va_list *args);
+extern u8 *format_segment_manager_mem_stats (u8 *s, va_list *args);
 
 #endif /* SRC_VNET_SESSION_SEGMENT_MANAGER_H_ */
 /*
@@ -676,6 +676,22 @@ session_enqueue_dgram_connection_cl (session_t *s, session_dgram_hdr_t *hdr,
 						  queue_event, 1 /* is_cl */);
 }
 
+/**
+ * Burst version of @ref session_enqueue_dgram_connection_cl. All dgrams
+ * must belong to the same flow, so they go to the same app worker.
+ */
+u32
+session_enqueue_dgrams_connection_cl (session_t *s, session_dgram_hdr_t *hdrs,
+				      vlib_buffer_t **bufs, u32 n_dgrams,
+				      u8 proto, u8 queue_event)
+{
+  session_t *awls;
+
+  awls = app_listener_select_wrk_cl_session (s, &hdrs[0]);
+  return session_enqueue_dgrams_connection_inline (
+    awls, hdrs, bufs, n_dgrams, proto, queue_event, 1 /* is_cl */);
+}
+
 int
 session_tx_fifo_peek_bytes (transport_connection_t * tc, u8 * buffer,
 			    u32 offset, u32 max_bytes)
@@ -1814,6 +1830,10 @@ session_manager_main_enable (vlib_main_t *vm,
       wrk->last_vlib_time = vlib_time_now (vm);
       wrk->last_vlib_us_time = wrk->last_vlib_time * CLIB_US_TIME_FREQ;
       wrk->timerfd = -1;
+      wrk->next_fifo_compact = smm->fifo_compact_interval ?
+				 wrk->last_vlib_time +
+				   smm->fifo_compact_interval :
+				 CLIB_F64_MAX;
       vec_validate (wrk->session_to_enqueue, smm->last_transport_proto_type);
 
       if (!smm->no_adaptive && smm->use_private_rx_mqs)
@@ -2043,6 +2063,7 @@ session_main_init (vlib_main_t * vm)
   smm->last_transport_proto_type = TRANSPORT_PROTO_HTTP;
   smm->port_allocator_min_src_port = 1024;
   smm->port_allocator_max_src_port = 65535;
+  smm->fifo_compact_size = 4 << 10;
 
   return 0;
 }
@@ -2090,6 +2111,12 @@ session_config_fn (vlib_main_t * vm, unformat_input_t * input)
       else if (unformat (input, "preallocated-sessions %d",
 			 &smm->preallocated_sessions))
 	;
+      else if (unformat (input, "fifo-compact-interval %f",
+			 &smm->fifo_compact_interval))
+	;
+      else if (unformat (input, "fifo-compact-size %U", unformat_memory_size,
+			 &tmp))
+	smm->fifo_compact_size = tmp;
       else if (unformat (input, "v4-session-table-buckets %d",
 			 &smm->configured_v4_session_table_buckets))
 	;
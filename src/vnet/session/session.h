@@ -164,6 +164,15 @@ typedef struct session_worker_
 
   session_wrk_stats_t stats;
 
+  /** Time when next idle fifo compaction scan starts */
+  clib_time_type_t next_fifo_compact;
+
+  /** Session pool index where the idle fifo compaction scan resumes */
+  u32 fifo_compact_index;
+
+  /** Per session fifo positions seen by last idle fifo compaction scan */
+  u64 *fifo_compact_marks;
+
 #if SESSION_DEBUG
   /** last event poll time by thread */
   clib_time_type_t last_event_poll;
@@ -297,6 +306,12 @@ typedef struct session_main_
   /** Preallocate session config parameter */
   u32 preallocated_sessions;
 
+  /** Interval between idle fifo compaction scans. Disabled if 0 */
+  f64 fifo_compact_interval;
+
+  /** Bytes left allocated to fifos of idle sessions after compaction */
+  u32 fifo_compact_size;
+
   u16 msg_id_base;
 
   /** Query nat44-ed session to get original dst ip4 & dst port. */
@@ -621,6 +636,10 @@ void session_queue_run_on_main_thread (vlib_main_t *vm);
 int session_tx_fifo_peek_bytes (transport_connection_t * tc, u8 * buffer,
 				u32 offset, u32 max_bytes);
 u32 session_tx_fifo_dequeue_drop (transport_connection_t * tc, u32 max_bytes);
+u32 session_enqueue_dgrams_connection_cl (session_t *s,
+					  session_dgram_hdr_t *hdrs,
+					  vlib_buffer_t **bufs, u32 n_dgrams,
+					  u8 proto, u8 queue_event);
 int session_enqueue_dgram_connection_cl (session_t *s,
 					 session_dgram_hdr_t *hdr,
 					 vlib_buffer_t *b, u8 proto,
@@ -873,6 +892,73 @@ session_enqueue_dgram_connection_inline (session_t *s,
   return rv > 0 ? rv : 0;
 }
 
+/**
+ * Enqueue a burst of single buffer dgrams to a session's rx fifo with one
+ * fifo operation. Only the dgrams that fit in full, in order, are enqueued.
+ *
+ * @return number of dgrams enqueued
+ */
+always_inline u32
+session_enqueue_dgrams_connection_inline (session_t *s,
+					  session_dgram_hdr_t *hdrs,
+					  vlib_buffer_t **bufs, u32 n_dgrams,
+					  u8 proto, u8 queue_event, u32 is_cl)
+{
+  svm_fifo_seg_t segs[2 * VLIB_FRAME_SIZE];
+  u32 max_enq, len = 0, dgram_len, i;
+  int rv;
+
+  ASSERT (n_dgrams <= VLIB_FRAME_SIZE);
+
+  max_enq = svm_fifo_max_enqueue_prod (s->rx_fifo);
+  for (i = 0; i < n_dgrams; i++)
+    {
+      ASSERT (!(bufs[i]->flags & VLIB_BUFFER_NEXT_PRESENT));
+      dgram_len = sizeof (session_dgram_hdr_t) + bufs[i]->current_length;
+      if (len + dgram_len > max_enq)
+	break;
+      len += dgram_len;
+      segs[2 * i].data = (u8 *) &hdrs[i];
+      segs[2 * i].len = sizeof (session_dgram_hdr_t);
+      segs[2 * i + 1].data = vlib_buffer_get_current (bufs[i]);
+      segs[2 * i + 1].len = bufs[i]->current_length;
+    }
+
+  if (!i)
+    return 0;
+
+  rv = svm_fifo_enqueue_segments (s->rx_fifo, segs, 2 * i,
+				  0 /* allow partial */);
+  if (PREDICT_FALSE (rv <= 0))
+    return 0;
+
+  if (queue_event)
+    {
+      if (!(s->flags & SESSION_F_RX_EVT))
+	{
+	  u32 thread_index =
+	    is_cl ? vlib_get_thread_index () : s->thread_index;
+	  session_worker_t *wrk = session_main_get_worker (thread_index);
+	  ASSERT (s->thread_index == vlib_get_thread_index () || is_cl);
+	  s->flags |= SESSION_F_RX_EVT;
+	  vec_add1 (wrk->session_to_enqueue[proto], session_handle (s));
+	}
+
+      session_fifo_tuning (s, s->rx_fifo, SESSION_FT_ACTION_ENQUEUED, 0);
+    }
+
+  return i;
+}
+
+always_inline u32
+session_enqueue_dgrams_connection (session_t *s, session_dgram_hdr_t *hdrs,
+				   vlib_buffer_t **bufs, u32 n_dgrams,
+				   u8 proto, u8 queue_event)
+{
+  return session_enqueue_dgrams_connection_inline (
+    s, hdrs, bufs, n_dgrams, proto, queue_event, 0 /* is_cl */);
+}
+
 always_inline int
 session_enqueue_dgram_connection (session_t *s, session_dgram_hdr_t *hdr,
 				  vlib_buffer_t *b, u8 proto, u8 queue_event)
@@ -747,21 +747,25 @@ vl_api_session_sapi_enable_disable_t_handler (
   REPLY_MACRO (VL_API_SESSION_SAPI_ENABLE_DISABLE_REPLY);
 }
 
+/* app_attach and app_attach_v2 only differ in the size of the options
+ * array, both replies share the app_attach_reply layout */
+STATIC_ASSERT (sizeof (vl_api_app_attach_reply_t) ==
+		 sizeof (vl_api_app_attach_v2_reply_t),
+	       "attach replies must have the same layout");
+
 static void
-vl_api_app_attach_t_handler (vl_api_app_attach_t * mp)
+session_api_app_attach (vl_api_registration_t *reg, u32 client_index,
+			u32 context, u64 *options, u8 *namespace_id,
+			u16 reply_msg_id)
 {
   int rv = 0, *fds = 0, n_fds = 0, n_workers, i;
   fifo_segment_t *segp, *rx_mqs_seg = 0;
   vnet_app_attach_args_t _a, *a = &_a;
   vl_api_app_attach_reply_t *rmp;
   u8 fd_flags = 0, ctrl_thread;
-  vl_api_registration_t *reg;
   svm_msg_q_t *rx_mq;
   application_t *app;
-
-  reg = vl_api_client_index_to_registration (mp->client_index);
-  if (!reg)
-    return;
+  u32 name_len;
 
   n_workers = vlib_num_workers ();
   if (!session_main_is_enabled () || appns_sapi_enabled ())
@@ -776,24 +780,18 @@ vl_api_app_attach_t_handler (vl_api_app_attach_t * mp)
       goto done;
     }
 
-  STATIC_ASSERT (sizeof (u64) * APP_OPTIONS_N_OPTIONS <=
-		 sizeof (mp->options),
-		 "Out of options, fix api message definition");
-
   clib_memset (a, 0, sizeof (*a));
-  a->api_client_index = mp->client_index;
-  a->options = mp->options;
+  a->api_client_index = client_index;
+  a->options = options;
   a->session_cb_vft = &session_mq_cb_vft;
-  a->namespace_id = vl_api_from_api_to_new_vec (mp, &mp->namespace_id);
+  a->namespace_id = namespace_id;
 
   if ((rv = vnet_application_attach (a)))
     {
       clib_warning ("attach returned: %U", format_session_error, rv);
       rv = VNET_API_ERROR_UNSPECIFIED;
-      vec_free (a->namespace_id);
       goto done;
     }
-  vec_free (a->namespace_id);
 
   vec_validate (fds, 3 /* segs + tx evtfd */ + n_workers);
 
@@ -831,34 +829,76 @@ vl_api_app_attach_t_handler (vl_api_app_attach_t * mp)
     }
 
 done:
-  REPLY_MACRO3 (
-    VL_API_APP_ATTACH_REPLY,
-    ((!rv) ? vec_len (((fifo_segment_t *) a->segment)->ssvm.name) : 0), ({
-      if (!rv)
+  vec_free (namespace_id);
+
+  name_len = !rv ? vec_len (((fifo_segment_t *) a->segment)->ssvm.name) : 0;
+  rmp = vl_msg_api_alloc (sizeof (*rmp) + name_len);
+  clib_memset (rmp, 0, sizeof (*rmp));
+  rmp->_vl_msg_id = htons (reply_msg_id + REPLY_MSG_ID_BASE);
+  rmp->context = context;
+  rmp->retval = ntohl (rv);
+  if (!rv)
+    {
+      ctrl_thread = n_workers ? 1 : 0;
+      segp = (fifo_segment_t *) a->segment;
+      rmp->app_index = clib_host_to_net_u32 (a->app_index);
+      rmp->app_mq = fifo_segment_msg_q_offset (segp, 0);
+      rmp->vpp_ctrl_mq = fifo_segment_msg_q_offset (rx_mqs_seg, ctrl_thread);
+      rmp->vpp_ctrl_mq_thread = ctrl_thread;
+      rmp->n_fds = n_fds;
+      rmp->fd_flags = fd_flags;
+      if (vec_len (segp->ssvm.name))
 	{
-	  ctrl_thread = n_workers ? 1 : 0;
-	  segp = (fifo_segment_t *) a->segment;
-	  rmp->app_index = clib_host_to_net_u32 (a->app_index);
-	  rmp->app_mq = fifo_segment_msg_q_offset (segp, 0);
-	  rmp->vpp_ctrl_mq =
-	    fifo_segment_msg_q_offset (rx_mqs_seg, ctrl_thread);
-	  rmp->vpp_ctrl_mq_thread = ctrl_thread;
-	  rmp->n_fds = n_fds;
-	  rmp->fd_flags = fd_flags;
-	  if (vec_len (segp->ssvm.name))
-	    {
-	      vl_api_vec_to_api_string (segp->ssvm.name, &rmp->segment_name);
-	    }
-	  rmp->segment_size = segp->ssvm.ssvm_size;
-	  rmp->segment_handle = clib_host_to_net_u64 (a->segment_handle);
+	  vl_api_vec_to_api_string (segp->ssvm.name, &rmp->segment_name);
 	}
-    }));
+      rmp->segment_size = segp->ssvm.ssvm_size;
+      rmp->segment_handle = clib_host_to_net_u64 (a->segment_handle);
+    }
+  vl_api_send_msg (reg, (u8 *) rmp);
 
   if (n_fds)
     session_send_fds (reg, fds, n_fds);
   vec_free (fds);
 }
 
+static void
+vl_api_app_attach_t_handler (vl_api_app_attach_t * mp)
+{
+  u64 options[APP_OPTIONS_N_OPTIONS] = {};
+  vl_api_registration_t *reg;
+
+  reg = vl_api_client_index_to_registration (mp->client_index);
+  if (!reg)
+    return;
+
+  /* options added after this message was defined are left unset */
+  STATIC_ASSERT (sizeof (mp->options) <= sizeof (options),
+		 "app_attach has more options than the session layer");
+  clib_memcpy_fast (options, mp->options, sizeof (mp->options));
+
+  session_api_app_attach (reg, mp->client_index, mp->context, options,
+			  vl_api_from_api_to_new_vec (mp, &mp->namespace_id),
+			  VL_API_APP_ATTACH_REPLY);
+}
+
+static void
+vl_api_app_attach_v2_t_handler (vl_api_app_attach_v2_t *mp)
+{
+  vl_api_registration_t *reg;
+
+  reg = vl_api_client_index_to_registration (mp->client_index);
+  if (!reg)
+    return;
+
+  STATIC_ASSERT (sizeof (u64) * APP_OPTIONS_N_OPTIONS <=
+		   sizeof (mp->options),
+		 "Out of options, fix api message definition");
+
+  session_api_app_attach (reg, mp->client_index, mp->context, mp->options,
+			  vl_api_from_api_to_new_vec (mp, &mp->namespace_id),
+			  VL_API_APP_ATTACH_V2_REPLY);
+}
+
 static void
 vl_api_app_worker_add_del_t_handler (vl_api_app_worker_add_del_t * mp)
 {
@@ -1900,8 +1940,8 @@ static session_cb_vft_t session_mq_sapi_cb_vft = {
 };
 
 static void
-session_api_attach_handler (app_namespace_t * app_ns, clib_socket_t * cs,
-			    app_sapi_attach_msg_t * mp)
+session_api_attach_handler (app_namespace_t *app_ns, clib_socket_t *cs,
+			    u8 *name, u64 *options)
 {
   int rv = 0, *fds = 0, n_fds = 0, i, n_workers;
   vnet_app_attach_args_t _a, *a = &_a;
@@ -1915,12 +1955,12 @@ session_api_attach_handler (app_namespace_t * app_ns, clib_socket_t * cs,
   svm_msg_q_t *rx_mq;
 
   /* Make sure name is null terminated */
-  mp->name[63] = 0;
+  name[63] = 0;
 
   clib_memset (a, 0, sizeof (*a));
   a->api_client_index = appns_sapi_socket_handle (app_ns, cs);
-  a->name = format (0, "%s", (char *) mp->name);
-  a->options = mp->options;
+  a->name = format (0, "%s", (char *) name);
+  a->options = options;
   a->session_cb_vft = &session_mq_sapi_cb_vft;
   a->use_sock_api = 1;
   a->options[APP_OPTIONS_NAMESPACE] = app_namespace_index (app_ns);
@@ -2129,6 +2169,59 @@ sapi_socket_receive_wait (clib_socket_t *cs, u8 *msg, u32 msg_len)
   return err;
 }
 
+static void
+sapi_attach_handler (app_namespace_t *app_ns, clib_socket_t *cs,
+		     app_sapi_attach_msg_t *mp)
+{
+  u64 options[APP_OPTIONS_N_OPTIONS] = { 0 };
+
+  STATIC_ASSERT (sizeof (mp->options) <= sizeof (options),
+		 "attach options must fit in app options");
+
+  /* Options added after the v1 message was defined stay zero */
+  clib_memcpy_fast (options, mp->options, sizeof (mp->options));
+  session_api_attach_handler (app_ns, cs, mp->name, options);
+}
+
+static void
+sapi_attach_v2_handler (app_namespace_t *app_ns, clib_socket_t *cs,
+			app_sapi_attach_v2_msg_t *mp)
+{
+  u64 options[APP_OPTIONS_N_OPTIONS] = { 0 }, *rx_options = 0;
+  app_sapi_attach_reply_msg_t *rmp;
+  app_sapi_msg_t msg = { 0 };
+  clib_error_t *err;
+  const u32 max_options = 256;
+
+  if (!mp->n_options || mp->n_options > max_options)
+    goto error;
+
+  vec_validate (rx_options, mp->n_options - 1);
+  err = sapi_socket_receive_wait (cs, (u8 *) rx_options,
+				  mp->n_options * sizeof (u64));
+  if (err)
+    {
+      clib_error_report (err);
+      vec_free (rx_options);
+      goto error;
+    }
+
+  /* Options unknown to this vpp are ignored, missing ones stay zero */
+  clib_memcpy_fast (options, rx_options,
+		    clib_min (mp->n_options, APP_OPTIONS_N_OPTIONS) *
+		      sizeof (u64));
+  vec_free (rx_options);
+
+  session_api_attach_handler (app_ns, cs, mp->name, options);
+  return;
+
+error:
+  msg.type = APP_SAPI_MSG_TYPE_ATTACH_REPLY;
+  rmp = &msg.attach_reply;
+  rmp->retval = SESSION_E_INVALID;
+  clib_socket_sendmsg (cs, &msg, sizeof (msg), 0, 0);
+}
+
 static void
 sapi_add_del_cert_key_handler (app_namespace_t *app_ns, clib_socket_t *cs,
 			       app_sapi_cert_key_add_del_msg_t *mp)
@@ -2262,7 +2355,10 @@ sapi_sock_read_ready (clib_file_t * cf)
   switch (msg.type)
     {
     case APP_SAPI_MSG_TYPE_ATTACH:
-      session_api_attach_handler (app_ns, cs, &msg.attach);
+      sapi_attach_handler (app_ns, cs, &msg.attach);
+      break;
+    case APP_SAPI_MSG_TYPE_ATTACH_V2:
+      sapi_attach_v2_handler (app_ns, cs, &msg.attach_v2);
       break;
     case APP_SAPI_MSG_TYPE_ADD_DEL_WORKER:
       sapi_add_del_worker_handler (app_ns, cs, &msg.worker_add_del);
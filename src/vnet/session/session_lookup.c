@@ -927,6 +927,59 @@ session_lookup_half_open_connection (u64 handle, u8 proto, u8 is_ip4)
   return 0;
 }
 
+/**
+ * Slow path of @ref session_lookup_connection_wt4, used once lookup amongst
+ * established sessions failed. Tries half-opens, session rules and
+ * listeners, in that order.
+ */
+always_inline transport_connection_t *
+session_lookup_connection_wt4_miss (session_table_t *st, session_kv4_t *kv4,
+				    ip4_address_t *lcl, ip4_address_t *rmt,
+				    u16 lcl_port, u16 rmt_port, u8 proto,
+				    u8 *result)
+{
+  u32 action_index;
+  session_t *s;
+  int rv;
+
+  /*
+   * Try half-open connections
+   */
+  rv = clib_bihash_search_inline_16_8 (&st->v4_half_open_hash, kv4);
+  if (rv == 0)
+    return transport_get_half_open (proto, kv4->value & 0xFFFFFFFF);
+
+  if (st->srtg_handle != SESSION_SRTG_HANDLE_INVALID)
+    {
+      /*
+       * Check the session rules table
+       */
+      action_index = session_rules_table_lookup4 (st->srtg_handle, proto, lcl,
+						  rmt, lcl_port, rmt_port);
+      if (session_lookup_action_index_is_valid (action_index))
+	{
+	  if (action_index == SESSION_RULES_TABLE_ACTION_DROP)
+	    {
+	      *result = SESSION_LOOKUP_RESULT_FILTERED;
+	      return 0;
+	    }
+	  if ((s = session_lookup_action_to_session (action_index,
+						     FIB_PROTOCOL_IP4, proto)))
+	    return transport_get_listener (proto, s->connection_index);
+	  return 0;
+	}
+    }
+
+  /*
+   * If nothing is found, check if any listener is available
+   */
+  s = session_lookup_listener4_i (st, lcl, lcl_port, proto, 1);
+  if (s)
+    return transport_get_listener (proto, s->connection_index);
+
+  return 0;
+}
+
 /**
  * Lookup connection with ip4 and transport layer information
  *
@@ -962,7 +1015,6 @@ session_lookup_connection_wt4 (u32 fib_index, ip4_address_t * lcl,
   session_table_t *st;
   session_kv4_t kv4;
   session_t *s;
-  u32 action_index;
   int rv;
 
   st = session_table_get_for_fib_index (FIB_PROTOCOL_IP4, fib_index);
@@ -986,42 +1038,8 @@ session_lookup_connection_wt4 (u32 fib_index, ip4_address_t * lcl,
 				       thread_index);
     }
 
-  /*
-   * Try half-open connections
-   */
-  rv = clib_bihash_search_inline_16_8 (&st->v4_half_open_hash, &kv4);
-  if (rv == 0)
-    return transport_get_half_open (proto, kv4.value & 0xFFFFFFFF);
-
-  if (st->srtg_handle != SESSION_SRTG_HANDLE_INVALID)
-    {
-      /*
-       * Check the session rules table
-       */
-      action_index = session_rules_table_lookup4 (st->srtg_handle, proto, lcl,
-						  rmt, lcl_port, rmt_port);
-      if (session_lookup_action_index_is_valid (action_index))
-	{
-	  if (action_index == SESSION_RULES_TABLE_ACTION_DROP)
-	    {
-	      *result = SESSION_LOOKUP_RESULT_FILTERED;
-	      return 0;
-	    }
-	  if ((s = session_lookup_action_to_session (action_index,
-						     FIB_PROTOCOL_IP4, proto)))
-	    return transport_get_listener (proto, s->connection_index);
-	  return 0;
-	}
-    }
-
-  /*
-   * If nothing is found, check if any listener is available
-   */
-  s = session_lookup_listener4_i (st, lcl, lcl_port, proto, 1);
-  if (s)
-    return transport_get_listener (proto, s->connection_index);
-
-  return 0;
+  return session_lookup_connection_wt4_miss (st, &kv4, lcl, rmt, lcl_port,
+					     rmt_port, proto, result);
 }
 
 /**
@@ -1101,6 +1119,43 @@ session_lookup_connection4 (u32 fib_index, ip4_address_t * lcl,
   return 0;
 }
 
+/**
+ * Slow path of @ref session_lookup_safe4, used once lookup amongst
+ * established sessions failed. Tries session rules and listeners.
+ */
+always_inline session_t *
+session_lookup_safe4_miss (session_table_t *st, ip4_address_t *lcl,
+			   ip4_address_t *rmt, u16 lcl_port, u16 rmt_port,
+			   u8 proto)
+{
+  u32 action_index;
+  session_t *s;
+
+  if (st->srtg_handle != SESSION_SRTG_HANDLE_INVALID)
+    {
+      /*
+       * Check the session rules table
+       */
+      action_index = session_rules_table_lookup4 (st->srtg_handle, proto, lcl,
+						  rmt, lcl_port, rmt_port);
+      if (session_lookup_action_index_is_valid (action_index))
+	{
+	  if (action_index == SESSION_RULES_TABLE_ACTION_DROP)
+	    return 0;
+	  return session_lookup_action_to_session (action_index,
+						   FIB_PROTOCOL_IP4, proto);
+	}
+    }
+
+  /*
+   *  If nothing is found, check if any listener is available
+   */
+  if ((s = session_lookup_listener4_i (st, lcl, lcl_port, proto, 1)))
+    return s;
+
+  return 0;
+}
+
 /**
  * Lookup session with ip4 and transport layer information
  *
@@ -1118,8 +1173,6 @@ session_lookup_safe4 (u32 fib_index, ip4_address_t * lcl, ip4_address_t * rmt,
 {
   session_table_t *st;
   session_kv4_t kv4;
-  session_t *s;
-  u32 action_index;
   int rv;
 
   st = session_table_get_for_fib_index (FIB_PROTOCOL_IP4, fib_index);
@@ -1134,27 +1187,51 @@ session_lookup_safe4 (u32 fib_index, ip4_address_t * lcl, ip4_address_t * rmt,
   if (rv == 0)
     return session_get_from_handle_safe (kv4.value);
 
+  return session_lookup_safe4_miss (st, lcl, rmt, lcl_port, rmt_port, proto);
+}
+
+/**
+ * Slow path of @ref session_lookup_connection_wt6. Lookup logic is identical
+ * to that of @ref session_lookup_connection_wt4_miss
+ */
+always_inline transport_connection_t *
+session_lookup_connection_wt6_miss (session_table_t *st, session_kv6_t *kv6,
+				    ip6_address_t *lcl, ip6_address_t *rmt,
+				    u16 lcl_port, u16 rmt_port, u8 proto,
+				    u8 *result)
+{
+  u32 action_index;
+  session_t *s;
+  int rv;
+
+  /* Try half-open connections */
+  rv = clib_bihash_search_inline_48_8 (&st->v6_half_open_hash, kv6);
+  if (rv == 0)
+    return transport_get_half_open (proto, kv6->value & 0xFFFFFFFF);
+
   if (st->srtg_handle != SESSION_SRTG_HANDLE_INVALID)
     {
-      /*
-       * Check the session rules table
-       */
-      action_index = session_rules_table_lookup4 (st->srtg_handle, proto, lcl,
+      /* Check the session rules table */
+      action_index = session_rules_table_lookup6 (st->srtg_handle, proto, lcl,
 						  rmt, lcl_port, rmt_port);
       if (session_lookup_action_index_is_valid (action_index))
 	{
 	  if (action_index == SESSION_RULES_TABLE_ACTION_DROP)
-	    return 0;
-	  return session_lookup_action_to_session (action_index,
-						   FIB_PROTOCOL_IP4, proto);
+	    {
+	      *result = SESSION_LOOKUP_RESULT_FILTERED;
+	      return 0;
+	    }
+	  if ((s = session_lookup_action_to_session (action_index,
+						     FIB_PROTOCOL_IP6, proto)))
+	    return transport_get_listener (proto, s->connection_index);
+	  return 0;
 	}
     }
 
-  /*
-   *  If nothing is found, check if any listener is available
-   */
-  if ((s = session_lookup_listener4_i (st, lcl, lcl_port, proto, 1)))
-    return s;
+  /* If nothing is found, check if any listener is available */
+  s = session_lookup_listener6_i (st, lcl, lcl_port, proto, 1);
+  if (s)
+    return transport_get_listener (proto, s->connection_index);
 
   return 0;
 }
@@ -1193,7 +1270,6 @@ session_lookup_connection_wt6 (u32 fib_index, ip6_address_t * lcl,
   session_table_t *st;
   session_t *s;
   session_kv6_t kv6;
-  u32 action_index;
   int rv;
 
   st = session_table_get_for_fib_index (FIB_PROTOCOL_IP6, fib_index);
@@ -1214,36 +1290,8 @@ session_lookup_connection_wt6 (u32 fib_index, ip6_address_t * lcl,
 				       thread_index);
     }
 
-  /* Try half-open connections */
-  rv = clib_bihash_search_inline_48_8 (&st->v6_half_open_hash, &kv6);
-  if (rv == 0)
-    return transport_get_half_open (proto, kv6.value & 0xFFFFFFFF);
-
-  if (st->srtg_handle != SESSION_SRTG_HANDLE_INVALID)
-    {
-      /* Check the session rules table */
-      action_index = session_rules_table_lookup6 (st->srtg_handle, proto, lcl,
-						  rmt, lcl_port, rmt_port);
-      if (session_lookup_action_index_is_valid (action_index))
-	{
-	  if (action_index == SESSION_RULES_TABLE_ACTION_DROP)
-	    {
-	      *result = SESSION_LOOKUP_RESULT_FILTERED;
-	      return 0;
-	    }
-	  if ((s = session_lookup_action_to_session (action_index,
-						     FIB_PROTOCOL_IP6, proto)))
-	    return transport_get_listener (proto, s->connection_index);
-	  return 0;
-	}
-    }
-
-  /* If nothing is found, check if any listener is available */
-  s = session_lookup_listener6_i (st, lcl, lcl_port, proto, 1);
-  if (s)
-    return transport_get_listener (proto, s->connection_index);
-
-  return 0;
+  return session_lookup_connection_wt6_miss (st, &kv6, lcl, rmt, lcl_port,
+					     rmt_port, proto, result);
 }
 
 /**
@@ -1315,6 +1363,38 @@ session_lookup_connection6 (u32 fib_index, ip6_address_t * lcl,
   return 0;
 }
 
+/**
+ * Slow path of @ref session_lookup_safe6. Lookup logic is identical to that
+ * of @ref session_lookup_safe4_miss
+ */
+always_inline session_t *
+session_lookup_safe6_miss (session_table_t *st, ip6_address_t *lcl,
+			   ip6_address_t *rmt, u16 lcl_port, u16 rmt_port,
+			   u8 proto)
+{
+  u32 action_index;
+  session_t *s;
+
+  if (st->srtg_handle != SESSION_SRTG_HANDLE_INVALID)
+    {
+      /* Check the session rules table */
+      action_index = session_rules_table_lookup6 (st->srtg_handle, proto, lcl,
+						  rmt, lcl_port, rmt_port);
+      if (session_lookup_action_index_is_valid (action_index))
+	{
+	  if (action_index == SESSION_RULES_TABLE_ACTION_DROP)
+	    return 0;
+	  return session_lookup_action_to_session (action_index,
+						   FIB_PROTOCOL_IP6, proto);
+	}
+    }
+
+  /* If nothing is found, check if any listener is available */
+  if ((s = session_lookup_listener6_i (st, lcl, lcl_port, proto, 1)))
+    return s;
+  return 0;
+}
+
 /**
  * Lookup session with ip6 and transport layer information
  *
@@ -1334,8 +1414,6 @@ session_lookup_safe6 (u32 fib_index, ip6_address_t * lcl, ip6_address_t * rmt,
 {
   session_table_t *st;
   session_kv6_t kv6;
-  session_t *s;
-  u32 action_index;
   int rv;
 
   st = session_table_get_for_fib_index (FIB_PROTOCOL_IP6, fib_index);
@@ -1347,24 +1425,348 @@ session_lookup_safe6 (u32 fib_index, ip6_address_t * lcl, ip6_address_t * rmt,
   if (rv == 0)
     return session_get_from_handle_safe (kv6.value);
 
-  if (st->srtg_handle != SESSION_SRTG_HANDLE_INVALID)
+  return session_lookup_safe6_miss (st, lcl, rmt, lcl_port, rmt_port, proto);
+}
+
+/**
+ * Number of keys between consecutive stages of the batched lookup pipeline.
+ * Buckets are prefetched twice this far ahead of the search and bucket data
+ * once this far ahead.
+ */
+#define SESSION_LOOKUP_PREFETCH_STRIDE 4
+
+/**
+ * Batched lookup of established ip4 sessions
+ *
+ * Resolves session tables and builds bihash keys for all entries, computes
+ * all hashes in one pass and then searches the tables in a software
+ * pipeline that prefetches buckets and bucket data ahead of the search.
+ *
+ * @param keys		keys to lookup, at most VLIB_FRAME_SIZE
+ * @param n_keys	number of keys
+ * @param proto		transport protocol
+ * @param sts		per key session table, 0 if none exists for the fib
+ * @param kvs		per key search results
+ * @param found		per key flag set if an established session was found
+ */
+static_always_inline void
+session_lookup_established4_n (session_lookup_key4_t *keys, u32 n_keys,
+			       u8 proto, session_table_t **sts,
+			       session_kv4_t *kvs, u8 *found)
+{
+  const u32 stride = SESSION_LOOKUP_PREFETCH_STRIDE;
+  u64 hashes[VLIB_FRAME_SIZE];
+  u32 i, fib_index = ~0;
+  session_table_t *st = 0;
+
+  ASSERT (n_keys <= VLIB_FRAME_SIZE);
+
+  for (i = 0; i < n_keys; i++)
     {
-      /* Check the session rules table */
-      action_index = session_rules_table_lookup6 (st->srtg_handle, proto, lcl,
-						  rmt, lcl_port, rmt_port);
-      if (session_lookup_action_index_is_valid (action_index))
+      if (keys[i].fib_index != fib_index)
 	{
-	  if (action_index == SESSION_RULES_TABLE_ACTION_DROP)
-	    return 0;
-	  return session_lookup_action_to_session (action_index,
-						   FIB_PROTOCOL_IP6, proto);
+	  fib_index = keys[i].fib_index;
+	  st = session_table_get_for_fib_index (FIB_PROTOCOL_IP4, fib_index);
 	}
+      sts[i] = st;
+      make_v4_ss_kv (&kvs[i], &keys[i].lcl, &keys[i].rmt, keys[i].lcl_port,
+		     keys[i].rmt_port, proto);
+      hashes[i] = clib_bihash_hash_16_8 (&kvs[i]);
     }
 
-  /* If nothing is found, check if any listener is available */
-  if ((s = session_lookup_listener6_i (st, lcl, lcl_port, proto, 1)))
-    return s;
-  return 0;
+  for (i = 0; i < clib_min (n_keys, 2 * stride); i++)
+    if (sts[i])
+      clib_bihash_prefetch_bucket_16_8 (&sts[i]->v4_session_hash, hashes[i]);
+  for (i = 0; i < clib_min (n_keys, stride); i++)
+    if (sts[i])
+      clib_bihash_prefetch_data_16_8 (&sts[i]->v4_session_hash, hashes[i]);
+
+  for (i = 0; i < n_keys; i++)
+    {
+      if (i + 2 * stride < n_keys && sts[i + 2 * stride])
+	clib_bihash_prefetch_bucket_16_8 (&sts[i + 2 * stride]->v4_session_hash,
+					  hashes[i + 2 * stride]);
+      if (i + stride < n_keys && sts[i + stride])
+	clib_bihash_prefetch_data_16_8 (&sts[i + stride]->v4_session_hash,
+					hashes[i + stride]);
+
+      found[i] = sts[i] && !clib_bihash_search_inline_with_hash_16_8 (
+			     &sts[i]->v4_session_hash, hashes[i], &kvs[i]);
+    }
+}
+
+/**
+ * Batched lookup of established ip6 sessions
+ *
+ * Logic is identical to that of @ref session_lookup_established4_n
+ */
+static_always_inline void
+session_lookup_established6_n (session_lookup_key6_t *keys, u32 n_keys,
+			       u8 proto, session_table_t **sts,
+			       session_kv6_t *kvs, u8 *found)
+{
+  const u32 stride = SESSION_LOOKUP_PREFETCH_STRIDE;
+  u64 hashes[VLIB_FRAME_SIZE];
+  u32 i, fib_index = ~0;
+  session_table_t *st = 0;
+
+  ASSERT (n_keys <= VLIB_FRAME_SIZE);
+
+  for (i = 0; i < n_keys; i++)
+    {
+      if (keys[i].fib_index != fib_index)
+	{
+	  fib_index = keys[i].fib_index;
+	  st = session_table_get_for_fib_index (FIB_PROTOCOL_IP6, fib_index);
+	}
+      sts[i] = st;
+      make_v6_ss_kv (&kvs[i], &keys[i].lcl, &keys[i].rmt, keys[i].lcl_port,
+		     keys[i].rmt_port, proto);
+      hashes[i] = clib_bihash_hash_48_8 (&kvs[i]);
+    }
+
+  for (i = 0; i < clib_min (n_keys, 2 * stride); i++)
+    if (sts[i])
+      clib_bihash_prefetch_bucket_48_8 (&sts[i]->v6_session_hash, hashes[i]);
+  for (i = 0; i < clib_min (n_keys, stride); i++)
+    if (sts[i])
+      clib_bihash_prefetch_data_48_8 (&sts[i]->v6_session_hash, hashes[i]);
+
+  for (i = 0; i < n_keys; i++)
+    {
+      if (i + 2 * stride < n_keys && sts[i + 2 * stride])
+	clib_bihash_prefetch_bucket_48_8 (&sts[i + 2 * stride]->v6_session_hash,
+					  hashes[i + 2 * stride]);
+      if (i + stride < n_keys && sts[i + stride])
+	clib_bihash_prefetch_data_48_8 (&sts[i + stride]->v6_session_hash,
+					hashes[i + stride]);
+
+      found[i] = sts[i] && !clib_bihash_search_inline_with_hash_48_8 (
+			     &sts[i]->v6_session_hash, hashes[i], &kvs[i]);
+    }
+}
+
+/**
+ * Batched lookup of established ip4 session handles
+ *
+ * Only established sessions are considered, i.e., no half-open, rules or
+ * listener lookups are done. Can be called with any number of keys.
+ *
+ * @param keys		keys to lookup
+ * @param n_keys	number of keys
+ * @param proto		transport protocol (e.g., tcp, udp)
+ * @param handles	per key session handle or SESSION_INVALID_HANDLE
+ */
+void
+session_lookup_handles4_n (session_lookup_key4_t *keys, u32 n_keys, u8 proto,
+			   u64 *handles)
+{
+  session_table_t *sts[VLIB_FRAME_SIZE];
+  session_kv4_t kvs[VLIB_FRAME_SIZE];
+  u8 found[VLIB_FRAME_SIZE];
+  u32 i, n;
+
+  while (n_keys)
+    {
+      n = clib_min (n_keys, VLIB_FRAME_SIZE);
+      session_lookup_established4_n (keys, n, proto, sts, kvs, found);
+      for (i = 0; i < n; i++)
+	handles[i] = found[i] ? kvs[i].value : SESSION_INVALID_HANDLE;
+      keys += n;
+      handles += n;
+      n_keys -= n;
+    }
+}
+
+/**
+ * Batched lookup of established ip6 session handles
+ *
+ * Logic is identical to that of @ref session_lookup_handles4_n
+ */
+void
+session_lookup_handles6_n (session_lookup_key6_t *keys, u32 n_keys, u8 proto,
+			   u64 *handles)
+{
+  session_table_t *sts[VLIB_FRAME_SIZE];
+  session_kv6_t kvs[VLIB_FRAME_SIZE];
+  u8 found[VLIB_FRAME_SIZE];
+  u32 i, n;
+
+  while (n_keys)
+    {
+      n = clib_min (n_keys, VLIB_FRAME_SIZE);
+      session_lookup_established6_n (keys, n, proto, sts, kvs, found);
+      for (i = 0; i < n; i++)
+	handles[i] = found[i] ? kvs[i].value : SESSION_INVALID_HANDLE;
+      keys += n;
+      handles += n;
+      n_keys -= n;
+    }
+}
+
+/**
+ * Batched version of @ref session_lookup_connection_wt4
+ *
+ * Established sessions are looked up for all keys in one pipelined pass.
+ * Keys that miss fall back to the per key half-open, rules and listener
+ * lookups.
+ *
+ * @param keys		keys to lookup, at most VLIB_FRAME_SIZE
+ * @param n_keys	number of keys
+ * @param proto		transport protocol (e.g., tcp, udp)
+ * @param thread_index	thread index for request
+ * @param tcs		per key transport connection or 0 if none found
+ * @param results	per key @ref session_lookup_result_t
+ */
+void
+session_lookup_connection_wt4_n (session_lookup_key4_t *keys, u32 n_keys,
+				 u8 proto, u32 thread_index,
+				 transport_connection_t **tcs, u8 *results)
+{
+  session_table_t *sts[VLIB_FRAME_SIZE];
+  session_kv4_t kvs[VLIB_FRAME_SIZE];
+  u8 found[VLIB_FRAME_SIZE];
+  session_t *s;
+  u32 i;
+
+  session_lookup_established4_n (keys, n_keys, proto, sts, kvs, found);
+
+  for (i = 0; i < n_keys; i++)
+    {
+      results[i] = SESSION_LOOKUP_RESULT_NONE;
+      if (PREDICT_TRUE (found[i]))
+	{
+	  if (PREDICT_FALSE ((u32) (kvs[i].value >> 32) != thread_index))
+	    {
+	      results[i] = SESSION_LOOKUP_RESULT_WRONG_THREAD;
+	      tcs[i] = 0;
+	      continue;
+	    }
+	  s = session_get (kvs[i].value & 0xFFFFFFFFULL, thread_index);
+	  tcs[i] =
+	    transport_get_connection (proto, s->connection_index, thread_index);
+	}
+      else if (PREDICT_FALSE (!sts[i]))
+	{
+	  tcs[i] = 0;
+	}
+      else
+	{
+	  tcs[i] = session_lookup_connection_wt4_miss (
+	    sts[i], &kvs[i], &keys[i].lcl, &keys[i].rmt, keys[i].lcl_port,
+	    keys[i].rmt_port, proto, &results[i]);
+	}
+    }
+}
+
+/**
+ * Batched version of @ref session_lookup_connection_wt6
+ *
+ * Logic is identical to that of @ref session_lookup_connection_wt4_n
+ */
+void
+session_lookup_connection_wt6_n (session_lookup_key6_t *keys, u32 n_keys,
+				 u8 proto, u32 thread_index,
+				 transport_connection_t **tcs, u8 *results)
+{
+  session_table_t *sts[VLIB_FRAME_SIZE];
+  session_kv6_t kvs[VLIB_FRAME_SIZE];
+  u8 found[VLIB_FRAME_SIZE];
+  session_t *s;
+  u32 i;
+
+  session_lookup_established6_n (keys, n_keys, proto, sts, kvs, found);
+
+  for (i = 0; i < n_keys; i++)
+    {
+      results[i] = SESSION_LOOKUP_RESULT_NONE;
+      if (PREDICT_TRUE (found[i]))
+	{
+	  if (PREDICT_FALSE ((u32) (kvs[i].value >> 32) != thread_index))
+	    {
+	      results[i] = SESSION_LOOKUP_RESULT_WRONG_THREAD;
+	      tcs[i] = 0;
+	      continue;
+	    }
+	  s = session_get (kvs[i].value & 0xFFFFFFFFULL, thread_index);
+	  tcs[i] =
+	    transport_get_connection (proto, s->connection_index, thread_index);
+	}
+      else if (PREDICT_FALSE (!sts[i]))
+	{
+	  tcs[i] = 0;
+	}
+      else
+	{
+	  tcs[i] = session_lookup_connection_wt6_miss (
+	    sts[i], &kvs[i], &keys[i].lcl, &keys[i].rmt, keys[i].lcl_port,
+	    keys[i].rmt_port, proto, &results[i]);
+	}
+    }
+}
+
+/**
+ * Batched version of @ref session_lookup_safe4
+ *
+ * Same caveats as for the non-batched version apply. That is, sessions
+ * returned may belong to other threads.
+ *
+ * @param keys		keys to lookup, at most VLIB_FRAME_SIZE
+ * @param n_keys	number of keys
+ * @param proto		transport protocol (e.g., tcp, udp)
+ * @param sessions	per key session or 0 if none found
+ */
+void
+session_lookup_safe4_n (session_lookup_key4_t *keys, u32 n_keys, u8 proto,
+			session_t **sessions)
+{
+  session_table_t *sts[VLIB_FRAME_SIZE];
+  session_kv4_t kvs[VLIB_FRAME_SIZE];
+  u8 found[VLIB_FRAME_SIZE];
+  u32 i;
+
+  session_lookup_established4_n (keys, n_keys, proto, sts, kvs, found);
+
+  for (i = 0; i < n_keys; i++)
+    {
+      if (PREDICT_TRUE (found[i]))
+	sessions[i] = session_get_from_handle_safe (kvs[i].value);
+      else if (PREDICT_FALSE (!sts[i]))
+	sessions[i] = 0;
+      else
+	sessions[i] = session_lookup_safe4_miss (
+	  sts[i], &keys[i].lcl, &keys[i].rmt, keys[i].lcl_port,
+	  keys[i].rmt_port, proto);
+    }
+}
+
+/**
+ * Batched version of @ref session_lookup_safe6
+ *
+ * Logic is identical to that of @ref session_lookup_safe4_n
+ */
+void
+session_lookup_safe6_n (session_lookup_key6_t *keys, u32 n_keys, u8 proto,
+			session_t **sessions)
+{
+  session_table_t *sts[VLIB_FRAME_SIZE];
+  session_kv6_t kvs[VLIB_FRAME_SIZE];
+  u8 found[VLIB_FRAME_SIZE];
+  u32 i;
+
+  session_lookup_established6_n (keys, n_keys, proto, sts, kvs, found);
+
+  for (i = 0; i < n_keys; i++)
+    {
+      if (PREDICT_TRUE (found[i]))
+	sessions[i] = session_get_from_handle_safe (kvs[i].value);
+      else if (PREDICT_FALSE (!sts[i]))
+	sessions[i] = 0;
+      else
+	sessions[i] = session_lookup_safe6_miss (
+	  sts[i], &keys[i].lcl, &keys[i].rmt, keys[i].lcl_port,
+	  keys[i].rmt_port, proto);
+    }
 }
 
 transport_connection_t *
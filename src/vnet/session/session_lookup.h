@@ -37,6 +37,28 @@ typedef struct session_lookup_main_
   fib_source_t fib_src;
 } session_lookup_main_t;
 
+/**
+ * Keys for batched lookups. Addresses and ports are in network order, as
+ * found in packet headers, and lcl/rmt are from the receiver's perspective.
+ */
+typedef struct session_lookup_key4_
+{
+  ip4_address_t lcl;
+  ip4_address_t rmt;
+  u16 lcl_port;
+  u16 rmt_port;
+  u32 fib_index;
+} session_lookup_key4_t;
+
+typedef struct session_lookup_key6_
+{
+  ip6_address_t lcl;
+  ip6_address_t rmt;
+  u16 lcl_port;
+  u16 rmt_port;
+  u32 fib_index;
+} session_lookup_key6_t;
+
 session_t *session_lookup_safe4 (u32 fib_index, ip4_address_t * lcl,
 				 ip4_address_t * rmt, u16 lcl_port,
 				 u16 rmt_port, u8 proto);
@@ -75,6 +97,22 @@ transport_connection_t *session_lookup_connection (u32 fib_index,
 transport_connection_t *
 session_lookup_6tuple (u32 fib_index, ip46_address_t *lcl, ip46_address_t *rmt,
 		       u16 lcl_port, u16 rmt_port, u8 proto, u8 is_ip4);
+void session_lookup_handles4_n (session_lookup_key4_t *keys, u32 n_keys,
+				u8 proto, u64 *handles);
+void session_lookup_handles6_n (session_lookup_key6_t *keys, u32 n_keys,
+				u8 proto, u64 *handles);
+void session_lookup_connection_wt4_n (session_lookup_key4_t *keys, u32 n_keys,
+				      u8 proto, u32 thread_index,
+				      transport_connection_t **tcs,
+				      u8 *results);
+void session_lookup_connection_wt6_n (session_lookup_key6_t *keys, u32 n_keys,
+				      u8 proto, u32 thread_index,
+				      transport_connection_t **tcs,
+				      u8 *results);
+void session_lookup_safe4_n (session_lookup_key4_t *keys, u32 n_keys,
+			     u8 proto, session_t **sessions);
+void session_lookup_safe6_n (session_lookup_key6_t *keys, u32 n_keys,
+			     u8 proto, session_t **sessions);
 session_t *session_lookup_listener4 (u32 fib_index, ip4_address_t * lcl,
 				     u16 lcl_port, u8 proto, u8 use_wildcard);
 session_t *session_lookup_listener6 (u32 fib_index, ip6_address_t * lcl,
@@ -1949,6 +1949,73 @@ session_wrk_update_state (session_worker_t *wrk)
     }
 }
 
+#define SESSION_FIFO_COMPACT_BATCH 256
+
+always_inline u64
+session_fifo_compact_mark (session_t *s)
+{
+  svm_fifo_shared_t *rx = s->rx_fifo->shr, *tx = s->tx_fifo->shr;
+
+  /* Fifo positions only move forward so any enqueue or dequeue since
+   * the last scan changes the mark */
+  return ((u64) (rx->head + rx->tail) << 32) | (u32) (tx->head + tx->tail);
+}
+
+/**
+ * Compact fifos of sessions idle since last scan
+ *
+ * Only fifos of builtin apps are compacted, as only for those both fifo
+ * producer and consumer run on this worker. Scan is done incrementally,
+ * at most @ref SESSION_FIFO_COMPACT_BATCH sessions per dispatch.
+ */
+static void
+session_wrk_compact_idle_fifos (session_worker_t *wrk)
+{
+  u32 si, max_index, n_scanned = 0, max_bytes;
+  session_main_t *smm = &session_main;
+  app_worker_t *app_wrk;
+  session_t *s;
+  u64 mark;
+
+  max_index = pool_len (wrk->sessions);
+  max_bytes = smm->fifo_compact_size;
+  if (max_index)
+    vec_validate_init_empty (wrk->fifo_compact_marks, max_index - 1, ~0ULL);
+
+  while (wrk->fifo_compact_index < max_index &&
+	 n_scanned++ < SESSION_FIFO_COMPACT_BATCH)
+    {
+      si = wrk->fifo_compact_index++;
+      if (pool_is_free_index (wrk->sessions, si))
+	continue;
+
+      s = pool_elt_at_index (wrk->sessions, si);
+      if (s->session_state != SESSION_STATE_READY || !s->rx_fifo ||
+	  !s->tx_fifo || session_get_transport_proto (s) == TRANSPORT_PROTO_CT)
+	continue;
+
+      app_wrk = app_worker_get_if_valid (s->app_wrk_index);
+      if (!app_wrk || !app_worker_application_is_builtin (app_wrk))
+	continue;
+
+      mark = session_fifo_compact_mark (s);
+      if (mark != wrk->fifo_compact_marks[si])
+	{
+	  wrk->fifo_compact_marks[si] = mark;
+	  continue;
+	}
+
+      segment_manager_compact_fifo (s->rx_fifo, max_bytes);
+      segment_manager_compact_fifo (s->tx_fifo, max_bytes);
+    }
+
+  if (wrk->fifo_compact_index < max_index)
+    return;
+
+  wrk->fifo_compact_index = 0;
+  wrk->next_fifo_compact = wrk->last_vlib_time + smm->fifo_compact_interval;
+}
+
 static uword
 session_queue_node_fn (vlib_main_t * vm, vlib_node_runtime_t * node,
 		       vlib_frame_t * frame)
@@ -2065,6 +2132,10 @@ session_queue_node_fn (vlib_main_t * vm, vlib_node_runtime_t * node,
 
   SESSION_EVT (SESSION_EVT_DSP_CNTRS, OLD_IO_EVTS, wrk);
 
+  if (PREDICT_FALSE (wrk->last_vlib_time >= wrk->next_fifo_compact) &&
+      !wrk->dma_enabled)
+    session_wrk_compact_idle_fifos (wrk);
+
   if (vec_len (wrk->pending_tx_buffers))
     {
       if (PREDICT_FALSE (vlib_get_trace_count (vm, node) > 0))
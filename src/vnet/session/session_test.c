@@ -141,6 +141,11 @@ vl_api_app_attach_reply_t_handler (vl_api_app_attach_reply_t *mp)
 {
 }
 
+static void
+vl_api_app_attach_v2_reply_t_handler (vl_api_app_attach_v2_reply_t *mp)
+{
+}
+
 static void
 vl_api_app_add_cert_key_pair_reply_t_handler (
   vl_api_app_add_cert_key_pair_reply_t *mp)
@@ -153,6 +158,12 @@ api_app_attach (vat_main_t *vat)
   return -1;
 }
 
+static int
+api_app_attach_v2 (vat_main_t *vat)
+{
+  return -1;
+}
+
 static int
 api_application_detach (vat_main_t *vat)
 {
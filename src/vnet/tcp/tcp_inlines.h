@@ -255,15 +255,23 @@ tcp_update_time_now (tcp_worker_ctx_t *wrk)
   tcp_set_time_now (wrk, now);
 }
 
-always_inline tcp_connection_t *
-tcp_input_lookup_buffer (vlib_buffer_t * b, u8 thread_index, u32 * error,
-			 u8 is_ip4, u8 is_nolookup)
+/**
+ * Parse tcp and ip headers of buffer and build its session lookup key
+ *
+ * Fills in the tcp fields of the buffer's opaque. If lookup is needed, the
+ * key is written to @a key4 or @a key6, depending on @a is_ip4.
+ *
+ * @return 1 if buffer is valid, 0 otherwise, in which case @a error is set
+ */
+always_inline int
+tcp_input_parse_buffer (vlib_buffer_t *b, u32 *error, u8 is_ip4,
+			u8 is_nolookup, session_lookup_key4_t *key4,
+			session_lookup_key6_t *key6)
 {
   u32 fib_index = vnet_buffer (b)->ip.fib_index;
+  u32 rx_sw_if_index = vnet_buffer (b)->ip.rx_sw_if_index;
   int n_advance_bytes, n_data_bytes;
-  transport_connection_t *tc;
   tcp_header_t *tcp;
-  u8 result = 0;
 
   if (is_ip4)
     {
@@ -287,11 +295,13 @@ tcp_input_lookup_buffer (vlib_buffer_t * b, u8 thread_index, u32 * error,
 	}
 
       if (!is_nolookup)
-	tc = session_lookup_connection_wt4 (fib_index, &ip4->dst_address,
-					    &ip4->src_address, tcp->dst_port,
-					    tcp->src_port,
-					    TRANSPORT_PROTO_TCP, thread_index,
-					    &result);
+	{
+	  key4->lcl = ip4->dst_address;
+	  key4->rmt = ip4->src_address;
+	  key4->lcl_port = tcp->dst_port;
+	  key4->rmt_port = tcp->src_port;
+	  key4->fib_index = fib_index;
+	}
     }
   else
     {
@@ -321,26 +331,20 @@ tcp_input_lookup_buffer (vlib_buffer_t * b, u8 thread_index, u32 * error,
 	    {
 	      ip6_main_t *im = &ip6_main;
 	      fib_index = vec_elt (im->fib_index_by_sw_if_index,
-				   vnet_buffer (b)->ip.rx_sw_if_index);
+				   rx_sw_if_index);
 	    }
 
-	  tc = session_lookup_connection_wt6 (fib_index, &ip6->dst_address,
-					      &ip6->src_address,
-					      tcp->dst_port, tcp->src_port,
-					      TRANSPORT_PROTO_TCP,
-					      thread_index, &result);
+	  key6->lcl = ip6->dst_address;
+	  key6->rmt = ip6->src_address;
+	  key6->lcl_port = tcp->dst_port;
+	  key6->rmt_port = tcp->src_port;
+	  key6->fib_index = fib_index;
 	}
     }
 
   /* Set the sw_if_index[VLIB_RX] to the interface we received
    * the connection on (the local interface) */
-  vnet_buffer (b)->sw_if_index[VLIB_RX] = vnet_buffer (b)->ip.rx_sw_if_index;
-
-  if (is_nolookup)
-    tc =
-      (transport_connection_t *) tcp_connection_get (vnet_buffer (b)->
-						     tcp.connection_index,
-						     thread_index);
+  vnet_buffer (b)->sw_if_index[VLIB_RX] = rx_sw_if_index;
 
   vnet_buffer (b)->tcp.seq_number = clib_net_to_host_u32 (tcp->seq_number);
   vnet_buffer (b)->tcp.ack_number = clib_net_to_host_u32 (tcp->ack_number);
@@ -349,9 +353,7 @@ tcp_input_lookup_buffer (vlib_buffer_t * b, u8 thread_index, u32 * error,
   vnet_buffer (b)->tcp.seq_end = vnet_buffer (b)->tcp.seq_number
     + n_data_bytes;
 
-  *error = result ? TCP_ERROR_NONE + result : *error;
-
-  return tcp_get_connection_from_transport (tc);
+  return 1;
 }
 
 /**
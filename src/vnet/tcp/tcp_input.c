@@ -2808,6 +2808,64 @@ tcp_input_dispatch_buffer (tcp_main_t *tm, tcp_connection_t *tc,
     }
 }
 
+/**
+ * Parse all buffers in a frame and lookup their connections
+ *
+ * Headers are parsed first and the lookup keys of all valid buffers are
+ * then resolved in one batched session lookup.
+ */
+static_always_inline void
+tcp_input_lookup_buffers (vlib_buffer_t **b, tcp_connection_t **tcs,
+			  u32 *errors, u32 n_bufs, u32 thread_index,
+			  int is_ip4, u8 is_nolookup)
+{
+  session_lookup_key4_t keys4[VLIB_FRAME_SIZE];
+  session_lookup_key6_t keys6[VLIB_FRAME_SIZE];
+  transport_connection_t *ltcs[VLIB_FRAME_SIZE];
+  u8 results[VLIB_FRAME_SIZE];
+  u16 slots[VLIB_FRAME_SIZE];
+  u32 i, n_keys = 0;
+
+  for (i = 0; i < n_bufs; i++)
+    {
+      if (i + 4 < n_bufs)
+	{
+	  vlib_prefetch_buffer_header (b[i + 4], STORE);
+	  CLIB_PREFETCH (b[i + 4]->data, 2 * CLIB_CACHE_LINE_BYTES, LOAD);
+	}
+
+      errors[i] = TCP_ERROR_NO_LISTENER;
+      tcs[i] = 0;
+
+      if (!tcp_input_parse_buffer (b[i], &errors[i], is_ip4, is_nolookup,
+				   &keys4[n_keys], &keys6[n_keys]))
+	continue;
+
+      if (is_nolookup)
+	tcs[i] = tcp_connection_get (vnet_buffer (b[i])->tcp.connection_index,
+				     thread_index);
+      else
+	slots[n_keys++] = i;
+    }
+
+  if (is_nolookup || !n_keys)
+    return;
+
+  if (is_ip4)
+    session_lookup_connection_wt4_n (keys4, n_keys, TRANSPORT_PROTO_TCP,
+				     thread_index, ltcs, results);
+  else
+    session_lookup_connection_wt6_n (keys6, n_keys, TRANSPORT_PROTO_TCP,
+				     thread_index, ltcs, results);
+
+  for (i = 0; i < n_keys; i++)
+    {
+      tcs[slots[i]] = tcp_get_connection_from_transport (ltcs[i]);
+      if (results[i])
+	errors[slots[i]] = TCP_ERROR_NONE + results[i];
+    }
+}
+
 always_inline uword
 tcp46_input_inline (vlib_main_t * vm, vlib_node_runtime_t * node,
 		    vlib_frame_t * frame, int is_ip4, u8 is_nolookup)
@@ -2815,6 +2873,8 @@ tcp46_input_inline (vlib_main_t * vm, vlib_node_runtime_t * node,
   u32 n_left_from, *from, thread_index = vm->thread_index;
   tcp_main_t *tm = vnet_get_tcp_main ();
   vlib_buffer_t *bufs[VLIB_FRAME_SIZE], **b;
+  tcp_connection_t *tcs[VLIB_FRAME_SIZE], **tc;
+  u32 errors[VLIB_FRAME_SIZE], *error;
   u16 nexts[VLIB_FRAME_SIZE], *next;
   u16 err_counters[TCP_N_ERROR] = { 0 };
 
@@ -2824,14 +2884,16 @@ tcp46_input_inline (vlib_main_t * vm, vlib_node_runtime_t * node,
   n_left_from = frame->n_vectors;
   vlib_get_buffers (vm, from, bufs, n_left_from);
 
+  tcp_input_lookup_buffers (bufs, tcs, errors, n_left_from, thread_index,
+			    is_ip4, is_nolookup);
+
   b = bufs;
+  tc = tcs;
+  error = errors;
   next = nexts;
 
   while (n_left_from >= 4)
     {
-      u32 error0 = TCP_ERROR_NO_LISTENER, error1 = TCP_ERROR_NO_LISTENER;
-      tcp_connection_t *tc0, *tc1;
-
       {
 	vlib_prefetch_buffer_header (b[2], STORE);
 	CLIB_PREFETCH (b[2]->data, 2 * CLIB_CACHE_LINE_BYTES, LOAD);
@@ -2840,81 +2902,69 @@ tcp46_input_inline (vlib_main_t * vm, vlib_node_runtime_t * node,
 	CLIB_PREFETCH (b[3]->data, 2 * CLIB_CACHE_LINE_BYTES, LOAD);
       }
 
-      tc0 = tcp_input_lookup_buffer (b[0], thread_index, &error0, is_ip4,
-				     is_nolookup);
-      tc1 = tcp_input_lookup_buffer (b[1], thread_index, &error1, is_ip4,
-				     is_nolookup);
-
-      if (PREDICT_TRUE (!tc0 + !tc1 == 0))
+      if (PREDICT_TRUE (!tc[0] + !tc[1] == 0))
 	{
-	  ASSERT (tcp_lookup_is_valid (tc0, b[0], tcp_buffer_hdr (b[0])));
-	  ASSERT (tcp_lookup_is_valid (tc1, b[1], tcp_buffer_hdr (b[1])));
+	  ASSERT (tcp_lookup_is_valid (tc[0], b[0], tcp_buffer_hdr (b[0])));
+	  ASSERT (tcp_lookup_is_valid (tc[1], b[1], tcp_buffer_hdr (b[1])));
 
-	  vnet_buffer (b[0])->tcp.connection_index = tc0->c_c_index;
-	  vnet_buffer (b[1])->tcp.connection_index = tc1->c_c_index;
+	  vnet_buffer (b[0])->tcp.connection_index = tc[0]->c_c_index;
+	  vnet_buffer (b[1])->tcp.connection_index = tc[1]->c_c_index;
 
-	  tcp_input_dispatch_buffer (tm, tc0, b[0], &next[0], err_counters);
-	  tcp_input_dispatch_buffer (tm, tc1, b[1], &next[1], err_counters);
+	  tcp_input_dispatch_buffer (tm, tc[0], b[0], &next[0], err_counters);
+	  tcp_input_dispatch_buffer (tm, tc[1], b[1], &next[1], err_counters);
 	}
       else
 	{
-	  if (PREDICT_TRUE (tc0 != 0))
+	  if (PREDICT_TRUE (tc[0] != 0))
 	    {
-	      ASSERT (tcp_lookup_is_valid (tc0, b[0], tcp_buffer_hdr (b[0])));
-	      vnet_buffer (b[0])->tcp.connection_index = tc0->c_c_index;
-	      tcp_input_dispatch_buffer (tm, tc0, b[0], &next[0],
+	      ASSERT (tcp_lookup_is_valid (tc[0], b[0], tcp_buffer_hdr (b[0])));
+	      vnet_buffer (b[0])->tcp.connection_index = tc[0]->c_c_index;
+	      tcp_input_dispatch_buffer (tm, tc[0], b[0], &next[0],
 					 err_counters);
 	    }
 	  else
 	    {
-	      tcp_input_set_error_next (tm, &next[0], &error0, is_ip4);
-	      tcp_inc_err_counter (err_counters, error0, 1);
+	      tcp_input_set_error_next (tm, &next[0], &error[0], is_ip4);
+	      tcp_inc_err_counter (err_counters, error[0], 1);
 	    }
 
-	  if (PREDICT_TRUE (tc1 != 0))
+	  if (PREDICT_TRUE (tc[1] != 0))
 	    {
-	      ASSERT (tcp_lookup_is_valid (tc1, b[1], tcp_buffer_hdr (b[1])));
-	      vnet_buffer (b[1])->tcp.connection_index = tc1->c_c_index;
-	      tcp_input_dispatch_buffer (tm, tc1, b[1], &next[1],
+	      ASSERT (tcp_lookup_is_valid (tc[1], b[1], tcp_buffer_hdr (b[1])));
+	      vnet_buffer (b[1])->tcp.connection_index = tc[1]->c_c_index;
+	      tcp_input_dispatch_buffer (tm, tc[1], b[1], &next[1],
 					 err_counters);
 	    }
 	  else
 	    {
-	      tcp_input_set_error_next (tm, &next[1], &error1, is_ip4);
-	      tcp_inc_err_counter (err_counters, error1, 1);
+	      tcp_input_set_error_next (tm, &next[1], &error[1], is_ip4);
+	      tcp_inc_err_counter (err_counters, error[1], 1);
 	    }
 	}
 
       b += 2;
+      tc += 2;
+      error += 2;
       next += 2;
       n_left_from -= 2;
     }
   while (n_left_from > 0)
     {
-      tcp_connection_t *tc0;
-      u32 error0 = TCP_ERROR_NO_LISTENER;
-
-      if (n_left_from > 1)
-	{
-	  vlib_prefetch_buffer_header (b[1], STORE);
-	  CLIB_PREFETCH (b[1]->data, 2 * CLIB_CACHE_LINE_BYTES, LOAD);
-	}
-
-      tc0 = tcp_input_lookup_buffer (b[0], thread_index, &error0, is_ip4,
-				     is_nolookup);
-      if (PREDICT_TRUE (tc0 != 0))
+      if (PREDICT_TRUE (tc[0] != 0))
 	{
-	  ASSERT (tcp_lookup_is_valid (tc0, b[0], tcp_buffer_hdr (b[0])));
-	  vnet_buffer (b[0])->tcp.connection_index = tc0->c_c_index;
-	  tcp_input_dispatch_buffer (tm, tc0, b[0], &next[0], err_counters);
+	  ASSERT (tcp_lookup_is_valid (tc[0], b[0], tcp_buffer_hdr (b[0])));
+	  vnet_buffer (b[0])->tcp.connection_index = tc[0]->c_c_index;
+	  tcp_input_dispatch_buffer (tm, tc[0], b[0], &next[0], err_counters);
 	}
       else
 	{
-	  tcp_input_set_error_next (tm, &next[0], &error0, is_ip4);
-	  tcp_inc_err_counter (err_counters, error0, 1);
+	  tcp_input_set_error_next (tm, &next[0], &error[0], is_ip4);
+	  tcp_inc_err_counter (err_counters, error[0], 1);
 	}
 
       b += 1;
+      tc += 1;
+      error += 1;
       next += 1;
       n_left_from -= 1;
     }
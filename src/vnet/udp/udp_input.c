@@ -128,6 +128,26 @@ udp_connection_accept (udp_connection_t * listener, session_dgram_hdr_t * hdr,
   return uc;
 }
 
+static u32
+udp_connection_enqueue_burst (udp_connection_t *uc0, session_t *s0,
+			      session_dgram_hdr_t *hdrs, vlib_buffer_t **b,
+			      u32 n_dgrams)
+{
+  u32 n_enq;
+
+  if (!(uc0->flags & UDP_CONN_F_CONNECTED))
+    {
+      clib_spinlock_lock (&uc0->rx_lock);
+      n_enq = session_enqueue_dgrams_connection_cl (
+	s0, hdrs, b, n_dgrams, TRANSPORT_PROTO_UDP, 1 /* queue_event */);
+      clib_spinlock_unlock (&uc0->rx_lock);
+      return n_enq;
+    }
+
+  return session_enqueue_dgrams_connection (
+    s0, hdrs, b, n_dgrams, TRANSPORT_PROTO_UDP, 1 /* queue_event */);
+}
+
 static void
 udp_connection_enqueue (udp_connection_t * uc0, session_t * s0,
 			session_dgram_hdr_t * hdr0, u32 thread_index,
@@ -178,13 +198,12 @@ udp_connection_enqueue (udp_connection_t * uc0, session_t * s0,
     *error0 = UDP_ERROR_FIFO_NOMEM;
 }
 
-always_inline session_t *
-udp_parse_and_lookup_buffer (vlib_buffer_t * b, session_dgram_hdr_t * hdr,
-			     u8 is_ip4)
+always_inline void
+udp_parse_buffer (vlib_buffer_t *b, session_dgram_hdr_t *hdr, u8 is_ip4,
+		  session_lookup_key4_t *key4, session_lookup_key6_t *key6)
 {
   udp_header_t *udp;
   u32 fib_index;
-  session_t *s;
 
   /* udp_local hands us a pointer to the udp data */
   udp = (udp_header_t *) (vlib_buffer_get_current (b) - sizeof (*udp));
@@ -206,9 +225,11 @@ udp_parse_and_lookup_buffer (vlib_buffer_t * b, session_dgram_hdr_t * hdr,
       ip_set (&hdr->rmt_ip, &ip4->src_address, 1);
       hdr->data_length = clib_net_to_host_u16 (ip4->length);
       hdr->data_length -= sizeof (ip4_header_t) + sizeof (udp_header_t);
-      s = session_lookup_safe4 (fib_index, &ip4->dst_address,
-				&ip4->src_address, udp->dst_port,
-				udp->src_port, TRANSPORT_PROTO_UDP);
+      key4->lcl = ip4->dst_address;
+      key4->rmt = ip4->src_address;
+      key4->lcl_port = udp->dst_port;
+      key4->rmt_port = udp->src_port;
+      key4->fib_index = fib_index;
     }
   else
     {
@@ -219,9 +240,11 @@ udp_parse_and_lookup_buffer (vlib_buffer_t * b, session_dgram_hdr_t * hdr,
       ip_set (&hdr->rmt_ip, &ip60->src_address, 0);
       hdr->data_length = clib_net_to_host_u16 (ip60->payload_length);
       hdr->data_length -= sizeof (udp_header_t);
-      s = session_lookup_safe6 (fib_index, &ip60->dst_address,
-				&ip60->src_address, udp->dst_port,
-				udp->src_port, TRANSPORT_PROTO_UDP);
+      key6->lcl = ip60->dst_address;
+      key6->rmt = ip60->src_address;
+      key6->lcl_port = udp->dst_port;
+      key6->rmt_port = udp->src_port;
+      key6->fib_index = fib_index;
     }
 
   /* Set the sw_if_index[VLIB_RX] to the interface we received
@@ -233,8 +256,72 @@ udp_parse_and_lookup_buffer (vlib_buffer_t * b, session_dgram_hdr_t * hdr,
   else
     b->total_length_not_including_first_buffer = hdr->data_length
       - b->current_length;
+}
 
-  return s;
+always_inline void
+udp_lookup_sessions (session_lookup_key4_t *keys4,
+		     session_lookup_key6_t *keys6, session_t **sessions,
+		     u32 n_keys, u8 is_ip4)
+{
+  if (is_ip4)
+    session_lookup_safe4_n (keys4, n_keys, TRANSPORT_PROTO_UDP, sessions);
+  else
+    session_lookup_safe6_n (keys6, n_keys, TRANSPORT_PROTO_UDP, sessions);
+}
+
+/* Datagrams of a flow tend to arrive back to back, so only the first of
+ * each run of same flow datagrams is looked up. Datagrams of a run get
+ * the same flow index */
+always_inline void
+udp_lookup_sessions_cached (session_lookup_key4_t *keys4,
+			    session_lookup_key6_t *keys6,
+			    session_t **sessions, u16 *uindex, u32 n_keys,
+			    u8 is_ip4)
+{
+  session_lookup_key4_t ukeys4[VLIB_FRAME_SIZE];
+  session_lookup_key6_t ukeys6[VLIB_FRAME_SIZE];
+  session_t *usessions[VLIB_FRAME_SIZE];
+  u32 i, n_uniq = 0;
+
+  for (i = 0; i < n_keys; i++)
+    {
+      if (i && (is_ip4 ? !clib_memcmp (&keys4[i], &keys4[i - 1],
+				       sizeof (keys4[i])) :
+			 !clib_memcmp (&keys6[i], &keys6[i - 1],
+				       sizeof (keys6[i]))))
+	{
+	  uindex[i] = n_uniq - 1;
+	  continue;
+	}
+      if (is_ip4)
+	ukeys4[n_uniq] = keys4[i];
+      else
+	ukeys6[n_uniq] = keys6[i];
+      uindex[i] = n_uniq++;
+    }
+
+  if (n_uniq == n_keys)
+    {
+      udp_lookup_sessions (keys4, keys6, sessions, n_keys, is_ip4);
+      return;
+    }
+
+  udp_lookup_sessions (ukeys4, ukeys6, usessions, n_uniq, is_ip4);
+  for (i = 0; i < n_keys; i++)
+    sessions[i] = usessions[uindex[i]];
+}
+
+/* Number of consecutive single buffer datagrams of a flow */
+always_inline u32
+udp_flow_run_len (u16 *flows, vlib_buffer_t **b, u32 n_left)
+{
+  u32 n = 0;
+
+  while (n < n_left && flows[n] == flows[0] &&
+	 !(b[n]->flags & VLIB_BUFFER_NEXT_PRESENT))
+    n++;
+
+  return n;
 }
 
 always_inline uword
@@ -243,28 +330,83 @@ udp46_input_inline (vlib_main_t * vm, vlib_node_runtime_t * node,
 {
   u32 thread_index = vm->thread_index, n_left_from, *from, *first_buffer;
   vlib_buffer_t *bufs[VLIB_FRAME_SIZE], **b;
+  session_dgram_hdr_t hdrs[VLIB_FRAME_SIZE];
+  session_lookup_key4_t keys4[VLIB_FRAME_SIZE];
+  session_lookup_key6_t keys6[VLIB_FRAME_SIZE];
+  session_t *sessions[VLIB_FRAME_SIZE];
+  u16 flows[VLIB_FRAME_SIZE];
   u16 err_counters[UDP_N_ERROR] = { 0 };
+  u8 relookup = 0;
+  u32 i;
 
   from = first_buffer = vlib_frame_vector_args (frame);
   n_left_from = frame->n_vectors;
   vlib_get_buffers (vm, from, bufs, n_left_from);
 
+  for (i = 0; i < n_left_from; i++)
+    {
+      if (i + 4 < n_left_from)
+	vlib_prefetch_buffer_header (bufs[i + 4], STORE);
+      udp_parse_buffer (bufs[i], &hdrs[i], is_ip4, &keys4[i], &keys6[i]);
+    }
+
+  udp_lookup_sessions_cached (keys4, keys6, sessions, flows, n_left_from,
+			      is_ip4);
+
   b = bufs;
+  i = 0;
 
   while (n_left_from > 0)
     {
       u32 error0 = UDP_ERROR_ENQUEUED;
-      session_dgram_hdr_t hdr0;
+      session_dgram_hdr_t *hdr0 = &hdrs[i];
       udp_connection_t *uc0;
       session_t *s0;
 
-      s0 = udp_parse_and_lookup_buffer (b[0], &hdr0, is_ip4);
+      /* Sessions created or migrated while handling earlier buffers may
+       * invalidate batched lookup results, so lookup again */
+      if (PREDICT_FALSE (relookup))
+	udp_lookup_sessions (&keys4[i], &keys6[i], &sessions[i], 1, is_ip4);
+
+      s0 = sessions[i];
       if (PREDICT_FALSE (!s0))
 	{
 	  error0 = UDP_ERROR_NO_LISTENER;
 	  goto done;
 	}
 
+      /* Burst of datagrams of one flow for a connected session owned by
+       * this thread, or for a connectionless listener. Enqueue all of them
+       * with one fifo operation */
+      if (PREDICT_TRUE (!relookup) &&
+	  udp_flow_run_len (&flows[i], b, clib_min (n_left_from, 2)) > 1)
+	{
+	  u32 n_run, n_enq, j;
+
+	  uc0 = udp_connection_from_transport (session_get_transport (s0));
+	  if ((s0->session_state == SESSION_STATE_READY &&
+	       s0->thread_index == thread_index &&
+	       (uc0->flags & UDP_CONN_F_CONNECTED)) ||
+	      (s0->session_state == SESSION_STATE_LISTENING &&
+	       !(uc0->flags & UDP_CONN_F_CONNECTED)))
+	    {
+	      n_run = udp_flow_run_len (&flows[i], b, n_left_from);
+	      n_enq = udp_connection_enqueue_burst (uc0, s0, hdr0, b, n_run);
+	      if (PREDICT_FALSE (node->flags & VLIB_NODE_FLAG_TRACE))
+		for (j = 0; j < n_run; j++)
+		  udp_trace_buffer (vm, node, b[j], s0,
+				    j < n_enq ? UDP_ERROR_ENQUEUED :
+						UDP_ERROR_FIFO_FULL);
+	      udp_inc_err_counter (err_counters, UDP_ERROR_ENQUEUED, n_enq);
+	      udp_inc_err_counter (err_counters, UDP_ERROR_FIFO_FULL,
+				   n_run - n_enq);
+	      b += n_run;
+	      i += n_run;
+	      n_left_from -= n_run;
+	      continue;
+	    }
+	}
+
       if (s0->session_state == SESSION_STATE_OPENED)
 	{
 	  u8 queue_event = 1;
@@ -289,18 +431,19 @@ udp46_input_inline (vlib_main_t * vm, vlib_node_runtime_t * node,
 		  session_dgram_connect_notify (&uc0->connection,
 						s0->thread_index, &s0);
 		  queue_event = 0;
+		  relookup = 1;
 		}
 	      else
 		s0->session_state = SESSION_STATE_READY;
 	    }
-	  udp_connection_enqueue (uc0, s0, &hdr0, thread_index, b[0],
+	  udp_connection_enqueue (uc0, s0, hdr0, thread_index, b[0],
 				  queue_event, &error0);
 	}
       else if (s0->session_state == SESSION_STATE_READY ||
 	       s0->session_state == SESSION_STATE_ACCEPTING)
 	{
 	  uc0 = udp_connection_from_transport (session_get_transport (s0));
-	  udp_connection_enqueue (uc0, s0, &hdr0, thread_index, b[0], 1,
+	  udp_connection_enqueue (uc0, s0, hdr0, thread_index, b[0], 1,
 				  &error0);
 	}
       else if (s0->session_state == SESSION_STATE_LISTENING)
@@ -308,17 +451,18 @@ udp46_input_inline (vlib_main_t * vm, vlib_node_runtime_t * node,
 	  uc0 = udp_connection_from_transport (session_get_transport (s0));
 	  if (uc0->flags & UDP_CONN_F_CONNECTED)
 	    {
-	      uc0 = udp_connection_accept (uc0, &hdr0, thread_index);
+	      uc0 = udp_connection_accept (uc0, hdr0, thread_index);
 	      if (!uc0)
 		{
 		  error0 = UDP_ERROR_CREATE_SESSION;
 		  goto done;
 		}
+	      relookup = 1;
 	      s0 = session_get (uc0->c_s_index, uc0->c_thread_index);
 	      uc0->sw_if_index = vnet_buffer (b[0])->sw_if_index[VLIB_RX];
 	      error0 = UDP_ERROR_ACCEPT;
 	    }
-	  udp_connection_enqueue (uc0, s0, &hdr0, thread_index, b[0], 1,
+	  udp_connection_enqueue (uc0, s0, hdr0, thread_index, b[0], 1,
 				  &error0);
 	}
       else
@@ -331,6 +475,7 @@ udp46_input_inline (vlib_main_t * vm, vlib_node_runtime_t * node,
 	udp_trace_buffer (vm, node, b[0], s0, error0);
 
       b += 1;
+      i += 1;
       n_left_from -= 1;
 
       udp_inc_err_counter (err_counters, error0, 1);
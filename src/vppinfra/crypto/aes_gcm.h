@@ -792,23 +792,11 @@ aes_gcm_dec (aes_gcm_ctx_t *ctx, const u8 *src, u8 *dst, uword n_left)
     aes_gcm_enc_ctr0_round (ctx, i);
 }
 
-static_always_inline int
-aes_gcm (const u8 *src, u8 *dst, const u8 *aad, u8 *ivp, u8 *tag,
-	 u32 data_bytes, u32 aad_bytes, u8 tag_len,
-	 const aes_gcm_key_data_t *kd, int aes_rounds, aes_gcm_op_t op)
+static_always_inline void
+aes_gcm_init_counter (aes_gcm_ctx_t *ctx, const u8 *ivp)
 {
-  u8 *addt = (u8 *) aad;
   u32x4 Y0;
 
-  aes_gcm_ctx_t _ctx = { .counter = 2,
-			 .rounds = aes_rounds,
-			 .operation = op,
-			 .data_bytes = data_bytes,
-			 .aad_bytes = aad_bytes,
-			 .Ke = kd->Ke,
-			 .Hi = kd->Hi },
-		*ctx = &_ctx;
-
   /* initalize counter */
   Y0 = (u32x4) (u64x2){ *(u64u *) ivp, 0 };
   Y0[2] = *(u32u *) (ivp + 8);
@@ -825,23 +813,19 @@ aes_gcm (const u8 *src, u8 *dst, const u8 *aad, u8 *ivp, u8 *tag,
 #else
   ctx->Y = Y0 + (u32x4){ 0, 0, 0, 1 << 24 };
 #endif
+}
 
-  /* calculate ghash for AAD */
-  aes_gcm_ghash (ctx, addt, aad_bytes);
-
-  /* ghash and encrypt/edcrypt  */
-  if (op == AES_GCM_OP_ENCRYPT)
-    aes_gcm_enc (ctx, src, dst, data_bytes);
-  else if (op == AES_GCM_OP_DECRYPT)
-    aes_gcm_dec (ctx, src, dst, data_bytes);
-
+/* store the final tag, or compare it with the one in tag if verify is set */
+static_always_inline int
+aes_gcm_final_tag (aes_gcm_ctx_t *ctx, u8 *tag, u8 tag_len, int verify)
+{
   /* final tag is */
   ctx->T = u8x16_reflect (ctx->T) ^ ctx->EY0;
 
   /* tag_len 16 -> 0 */
   tag_len &= 0xf;
 
-  if (op == AES_GCM_OP_ENCRYPT || op == AES_GCM_OP_GMAC)
+  if (!verify)
     {
       /* store tag */
       if (tag_len)
@@ -868,6 +852,105 @@ aes_gcm (const u8 *src, u8 *dst, const u8 *aad, u8 *ivp, u8 *tag,
   return 0;
 }
 
+static_always_inline int
+aes_gcm (const u8 *src, u8 *dst, const u8 *aad, u8 *ivp, u8 *tag,
+	 u32 data_bytes, u32 aad_bytes, u8 tag_len,
+	 const aes_gcm_key_data_t *kd, int aes_rounds, aes_gcm_op_t op)
+{
+  u8 *addt = (u8 *) aad;
+
+  aes_gcm_ctx_t _ctx = { .counter = 2,
+			 .rounds = aes_rounds,
+			 .operation = op,
+			 .data_bytes = data_bytes,
+			 .aad_bytes = aad_bytes,
+			 .Ke = kd->Ke,
+			 .Hi = kd->Hi },
+		*ctx = &_ctx;
+
+  aes_gcm_init_counter (ctx, ivp);
+
+  /* calculate ghash for AAD */
+  aes_gcm_ghash (ctx, addt, aad_bytes);
+
+  /* ghash and encrypt/edcrypt  */
+  if (op == AES_GCM_OP_ENCRYPT)
+    aes_gcm_enc (ctx, src, dst, data_bytes);
+  else if (op == AES_GCM_OP_DECRYPT)
+    aes_gcm_dec (ctx, src, dst, data_bytes);
+
+  return aes_gcm_final_tag (ctx, tag, tag_len, op == AES_GCM_OP_DECRYPT);
+}
+
+/* GMAC over aad followed by data, both only authenticated. This is RFC 4543
+ * ENCR_NULL_AUTH_AES_GMAC, where aad is the ESP header and data is the
+ * payload, without copying them into one buffer first. */
+static_always_inline int
+aes_gmac (const u8 *aad, u32 aad_bytes, const u8 *data, u32 data_bytes,
+	  const u8 *ivp, u8 *tag, u8 tag_len, const aes_gcm_key_data_t *kd,
+	  int aes_rounds, int verify)
+{
+  u32 n_full = aad_bytes & ~15;
+  u8x16 b;
+
+  aes_gcm_ctx_t _ctx = { .rounds = aes_rounds,
+			 .operation = AES_GCM_OP_ENCRYPT,
+			 .aad_bytes = aad_bytes + data_bytes,
+			 .Ke = kd->Ke,
+			 .Hi = kd->Hi },
+		*ctx = &_ctx;
+
+  aes_gcm_init_counter (ctx, ivp);
+
+  /* whole aad blocks are hashed in place, without the final block */
+  if (n_full)
+    aes_gcm_ghash (ctx, (u8 *) aad, n_full);
+
+  /* aad tail and data head share a block */
+  aad_bytes -= n_full;
+  if (aad_bytes)
+    {
+      u32 n = clib_min (16 - aad_bytes, data_bytes), n_blocks;
+      u8 buf[32];
+      u8x16_store_unaligned (u8x16_load_partial ((u8 *) aad + n_full,
+						 aad_bytes),
+			     buf);
+      u8x16_store_unaligned (u8x16_load_partial ((u8 *) data, n),
+			     buf + aad_bytes);
+      b = u8x16_load_unaligned (buf);
+      data += n;
+      data_bytes -= n;
+      ctx->operation = AES_GCM_OP_GMAC;
+
+      if (data_bytes == 0)
+	{
+	  aes_gcm_ghash (ctx, (u8 *) &b, aad_bytes + n);
+	  goto done;
+	}
+
+      /* shared block is followed by data blocks and the final block */
+      n_blocks = (data_bytes + 15) / 16 + 1;
+      b = u8x16_reflect (b) ^ ctx->T;
+
+      if (n_blocks < NUM_HI)
+	{
+	  /* multiply it by H^(n_blocks + 1) in parallel with data ghash */
+	  ctx->T = u8x16_zero ();
+	  aes_gcm_ghash (ctx, (u8 *) data, data_bytes);
+	  ctx->T ^= ghash_mul (b, ctx->Hi[NUM_HI - n_blocks - 1]);
+	  goto done;
+	}
+
+      ctx->T = ghash_mul (b, ctx->Hi[NUM_HI - 1]);
+    }
+
+  ctx->operation = AES_GCM_OP_GMAC;
+  aes_gcm_ghash (ctx, (u8 *) data, data_bytes);
+
+done:
+  return aes_gcm_final_tag (ctx, tag, tag_len, verify);
+}
+
 static_always_inline void
 clib_aes_gcm_key_expand (aes_gcm_key_data_t *kd, const u8 *key,
 			 aes_key_size_t ks)
@@ -0,0 +1,373 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright(c) 2025 Cisco Systems, Inc.
+ */
+
+/*
+ * AES-GCM-SIV (RFC 8452)
+ *
+ * POLYVAL is computed with the ghash.h primitives. They already multiply
+ * in the bit-reflected field (a * b * x^-128 mod x^128 + x^127 + x^126 +
+ * x^121 + 1), which is the POLYVAL dot operation, so POLYVAL blocks are
+ * used as they are, without the byte reflection GHASH needs, and the hash
+ * key is used without the H << 1 done by ghash_precompute.
+ *
+ * Per-nonce message authentication and encryption keys are derived from
+ * the key-generating key, so the POLYVAL key powers and the encryption key
+ * schedule are calculated on each call, higher powers only as many as the
+ * message needs.
+ */
+
+#ifndef __crypto_aes_gcm_siv_h__
+#define __crypto_aes_gcm_siv_h__
+
+#include <vppinfra/clib.h>
+#include <vppinfra/vector.h>
+#include <vppinfra/cache.h>
+#include <vppinfra/string.h>
+#include <vppinfra/crypto/aes.h>
+#include <vppinfra/crypto/ghash.h>
+
+/* blocks hashed per reduction */
+#define AES_GCM_SIV_N_HI (4 * N_AES_LANES)
+
+#if N_AES_LANES == 4
+#define aes_gcm_siv_ghash_mul_first(gd, a, b) ghash4_mul_first (gd, a, b)
+#define aes_gcm_siv_ghash_mul_next(gd, a, b)  ghash4_mul_next (gd, a, b)
+#define aes_gcm_siv_ghash_reduce(gd)	      ghash4_reduce (gd)
+#define aes_gcm_siv_ghash_reduce2(gd)	      ghash4_reduce2 (gd)
+#define aes_gcm_siv_ghash_final(gd)	      ghash4_final (gd)
+#define aes_gcm_siv_insert(T)                                                 \
+  u8x64_insert_u8x16 (u8x64_zero (), T, 0)
+#elif N_AES_LANES == 2
+#define aes_gcm_siv_ghash_mul_first(gd, a, b) ghash2_mul_first (gd, a, b)
+#define aes_gcm_siv_ghash_mul_next(gd, a, b)  ghash2_mul_next (gd, a, b)
+#define aes_gcm_siv_ghash_reduce(gd)	      ghash2_reduce (gd)
+#define aes_gcm_siv_ghash_reduce2(gd)	      ghash2_reduce2 (gd)
+#define aes_gcm_siv_ghash_final(gd)	      ghash2_final (gd)
+#define aes_gcm_siv_insert(T)		      u8x32_insert_lo (u8x32_zero (), T)
+#else
+#define aes_gcm_siv_ghash_mul_first(gd, a, b) ghash_mul_first (gd, a, b)
+#define aes_gcm_siv_ghash_mul_next(gd, a, b)  ghash_mul_next (gd, a, b)
+#define aes_gcm_siv_ghash_reduce(gd)	      ghash_reduce (gd)
+#define aes_gcm_siv_ghash_reduce2(gd)	      ghash_reduce2 (gd)
+#define aes_gcm_siv_ghash_final(gd)	      ghash_final (gd)
+#define aes_gcm_siv_insert(T)		      (T)
+#endif
+
+typedef struct
+{
+  /* expanded key-generating key */
+  const u8x16 Kg[AES_KEY_ROUNDS (AES_KEY_256) + 1];
+} aes_gcm_siv_key_data_t;
+
+typedef struct
+{
+  /* powers of H, H^1 last, padded with zeros for partial vectors */
+  u8x16 Hi[AES_GCM_SIV_N_HI + N_AES_LANES];
+
+  /* per-nonce encryption key */
+  u8x16 ek[AES_KEY_ROUNDS (AES_KEY_256) + 1];
+  aes_expaned_key_t Ke[AES_KEY_ROUNDS (AES_KEY_256) + 1];
+
+  /* polyval accumulator */
+  u8x16 S;
+} aes_gcm_siv_ctx_t;
+
+static_always_inline void
+aes_gcm_siv_derive_keys (aes_gcm_siv_ctx_t *ctx,
+			 const aes_gcm_siv_key_data_t *kd, const u8 *nonce,
+			 aes_key_size_t ks)
+{
+  int n_blocks = ks == AES_KEY_256 ? 6 : 4;
+  int rounds = AES_KEY_ROUNDS (ks);
+  u32x4 n = { 0, *(u32u *) nonce, *(u32u *) (nonce + 4),
+	      *(u32u *) (nonce + 8) };
+  u64 k[4];
+  u8x16 b[6];
+
+  /* little-endian block counter followed by the nonce */
+  for (int i = 0; i < n_blocks; i++)
+    b[i] = (u8x16) (n + (u32x4){ i, 0, 0, 0 }) ^ kd->Kg[0];
+
+  for (int r = 1; r < rounds; r++)
+    for (int i = 0; i < n_blocks; i++)
+      b[i] = aes_enc_round_x1 (b[i], kd->Kg[r]);
+
+  for (int i = 0; i < n_blocks; i++)
+    b[i] = aes_enc_last_round_x1 (b[i], kd->Kg[rounds]);
+
+  /* first 8 bytes of each block */
+  ctx->Hi[AES_GCM_SIV_N_HI - 1] =
+    (u8x16) (u64x2){ ((u64x2) b[0])[0], ((u64x2) b[1])[0] };
+  for (int i = 2; i < n_blocks; i++)
+    k[i - 2] = ((u64x2) b[i])[0];
+
+  aes_key_expand (ctx->ek, (u8 *) k, ks);
+  for (int i = 0; i < rounds + 1; i++)
+#if N_AES_LANES == 4
+    ctx->Ke[i].x4 = u8x64_splat_u8x16 (ctx->ek[i]);
+#elif N_AES_LANES == 2
+    ctx->Ke[i].x2 = u8x32_splat_u8x16 (ctx->ek[i]);
+#else
+    ctx->Ke[i].x1 = ctx->ek[i];
+#endif
+}
+
+static_always_inline void
+aes_gcm_siv_precompute (aes_gcm_siv_ctx_t *ctx, u32 n_bytes)
+{
+  u8x16 *Hi = ctx->Hi + AES_GCM_SIV_N_HI;
+#if N_AES_LANES > 1
+  u32 n_blocks = clib_min ((n_bytes + 15) / 16, AES_GCM_SIV_N_HI);
+#endif
+
+  /* zero padding */
+  for (int i = 0; i < N_AES_LANES; i++)
+    Hi[i] = u8x16_zero ();
+
+  Hi[-2] = ghash_mul (Hi[-1], Hi[-1]);
+  Hi[-3] = ghash_mul (Hi[-1], Hi[-2]);
+  Hi[-4] = ghash_mul (Hi[-2], Hi[-2]);
+
+  /* higher powers, one vector at a time, only as many as needed */
+#if N_AES_LANES == 4
+  for (int i = 4; i < n_blocks; i += 4)
+    *(u8x64u *) (Hi - i - 4) =
+      ghash4_mul (*(u8x64u *) (Hi - i), u8x64_splat_u8x16 (Hi[-4]));
+#elif N_AES_LANES == 2
+  for (int i = 4; i < n_blocks; i += 2)
+    *(u8x32u *) (Hi - i - 2) =
+      ghash2_mul (*(u8x32u *) (Hi - i), u8x32_splat_u8x16 (Hi[-2]));
+#endif
+}
+
+static_always_inline void
+aes_gcm_siv_polyval_blocks (aes_gcm_siv_ctx_t *ctx, const u8 *data,
+			    u32 n_parallel, u32 n_bytes, int last)
+{
+  const aes_mem_t *d = (aes_mem_t *) data;
+  const aes_mem_t *h =
+    (aes_mem_t *) (ctx->Hi + AES_GCM_SIV_N_HI - (n_bytes + 15) / 16);
+  aes_data_t r[4];
+  ghash_ctx_t gd;
+
+  for (int i = 0; i < n_parallel - last; i++)
+    r[i] = d[i];
+
+  if (last)
+    r[n_parallel - 1] = aes_load_partial (
+      (u8 *) (d + n_parallel - 1), n_bytes - (n_parallel - 1) * N_AES_BYTES);
+
+  aes_gcm_siv_ghash_mul_first (&gd, r[0] ^ aes_gcm_siv_insert (ctx->S), h[0]);
+  for (int i = 1; i < n_parallel; i++)
+    aes_gcm_siv_ghash_mul_next (&gd, r[i], h[i]);
+
+  aes_gcm_siv_ghash_reduce (&gd);
+  aes_gcm_siv_ghash_reduce2 (&gd);
+  ctx->S = aes_gcm_siv_ghash_final (&gd);
+}
+
+static_always_inline void
+aes_gcm_siv_polyval (aes_gcm_siv_ctx_t *ctx, const u8 *data, u32 n_bytes)
+{
+  for (int n = 4 * N_AES_BYTES; n_bytes >= n; n_bytes -= n, data += n)
+    aes_gcm_siv_polyval_blocks (ctx, data, 4, n, 0);
+
+  if (n_bytes > 3 * N_AES_BYTES)
+    aes_gcm_siv_polyval_blocks (ctx, data, 4, n_bytes, 1);
+  else if (n_bytes > 2 * N_AES_BYTES)
+    aes_gcm_siv_polyval_blocks (ctx, data, 3, n_bytes, 1);
+  else if (n_bytes > N_AES_BYTES)
+    aes_gcm_siv_polyval_blocks (ctx, data, 2, n_bytes, 1);
+  else if (n_bytes)
+    aes_gcm_siv_polyval_blocks (ctx, data, 1, n_bytes, 1);
+}
+
+static_always_inline aes_counter_t
+aes_gcm_siv_ctr_blocks (aes_gcm_siv_ctx_t *ctx, aes_counter_t ctr,
+			const u8 *src, u8 *dst, u32 n_parallel, u32 n_bytes,
+			int rounds, int last)
+{
+  u32 __clib_aligned (N_AES_BYTES)
+  inc[] = { N_AES_LANES, 0, 0, 0, N_AES_LANES, 0, 0, 0,
+	    N_AES_LANES, 0, 0, 0, N_AES_LANES, 0, 0, 0 };
+  const aes_expaned_key_t *k = ctx->Ke;
+  const aes_mem_t *sv = (aes_mem_t *) src;
+  aes_mem_t *dv = (aes_mem_t *) dst;
+  aes_data_t d[4], t[4];
+  u32 r;
+
+  n_bytes -= (n_parallel - 1) * N_AES_BYTES;
+
+  /* AES First Round, counter is not reflected */
+  for (int i = 0; i < n_parallel; i++)
+    {
+#if N_AES_LANES == 4
+      t[i] = k[0].x4 ^ (u8x64) ctr;
+#elif N_AES_LANES == 2
+      t[i] = k[0].x2 ^ (u8x32) ctr;
+#else
+      t[i] = k[0].x1 ^ (u8x16) ctr;
+#endif
+      ctr += *(aes_counter_t *) inc;
+    }
+
+  /* Load Data */
+  for (int i = 0; i < n_parallel - last; i++)
+    d[i] = sv[i];
+
+  if (last)
+    d[n_parallel - 1] =
+      aes_load_partial ((u8 *) (sv + n_parallel - 1), n_bytes);
+
+  /* AES Intermediate Rounds */
+  for (r = 1; r < rounds; r++)
+    aes_enc_round (t, k + r, n_parallel);
+
+  /* AES Last Round */
+  aes_enc_last_round (t, d, k + r, n_parallel);
+
+  /* Store Data */
+  for (int i = 0; i < n_parallel - last; i++)
+    dv[i] = d[i];
+
+  if (last)
+    aes_store_partial (d[n_parallel - 1], dv + n_parallel - 1, n_bytes);
+
+  return ctr;
+}
+
+static_always_inline void
+aes_gcm_siv_ctr (aes_gcm_siv_ctx_t *ctx, u8x16 tag, const u8 *src, u8 *dst,
+		 u32 n_bytes, aes_key_size_t ks)
+{
+  int r = AES_KEY_ROUNDS (ks);
+  aes_counter_t ctr;
+
+  /* initial counter block is the tag with the msb set, only the first
+   * 32 bits (little-endian) are incremented */
+  tag[15] |= 0x80;
+#if N_AES_LANES == 4
+  ctr = u32x16_splat_u32x4 ((u32x4) tag) +
+	(u32x16){ 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0 };
+#elif N_AES_LANES == 2
+  ctr = u32x8_splat_u32x4 ((u32x4) tag) + (u32x8){ 0, 0, 0, 0, 1, 0, 0, 0 };
+#else
+  ctr = (u32x4) tag;
+#endif
+
+  /* main loop */
+  for (int n = 4 * N_AES_BYTES; n_bytes >= n; n_bytes -= n, dst += n, src += n)
+    ctr = aes_gcm_siv_ctr_blocks (ctx, ctr, src, dst, 4, n, r, 0);
+
+  if (n_bytes > 3 * N_AES_BYTES)
+    aes_gcm_siv_ctr_blocks (ctx, ctr, src, dst, 4, n_bytes, r, 1);
+  else if (n_bytes > 2 * N_AES_BYTES)
+    aes_gcm_siv_ctr_blocks (ctx, ctr, src, dst, 3, n_bytes, r, 1);
+  else if (n_bytes > N_AES_BYTES)
+    aes_gcm_siv_ctr_blocks (ctx, ctr, src, dst, 2, n_bytes, r, 1);
+  else if (n_bytes)
+    aes_gcm_siv_ctr_blocks (ctx, ctr, src, dst, 1, n_bytes, r, 1);
+}
+
+static_always_inline u8x16
+aes_gcm_siv_tag (aes_gcm_siv_ctx_t *ctx, const u8 *aad, u32 aad_bytes,
+		 const u8 *data, u32 data_bytes, const u8 *nonce,
+		 aes_key_size_t ks)
+{
+  u32x4 n = { *(u32u *) nonce, *(u32u *) (nonce + 4), *(u32u *) (nonce + 8),
+	      0 };
+  u8x16 S;
+
+  ctx->S = u8x16_zero ();
+  aes_gcm_siv_precompute (ctx, clib_max (aad_bytes, data_bytes));
+  aes_gcm_siv_polyval (ctx, aad, aad_bytes);
+  aes_gcm_siv_polyval (ctx, data, data_bytes);
+
+  /* length block, bit lengths as little-endian u64 */
+  S = (u8x16) ((u64x2){ aad_bytes, data_bytes } << 3);
+  S = ghash_mul (ctx->S ^ S, ctx->Hi[AES_GCM_SIV_N_HI - 1]);
+
+  S ^= (u8x16) n;
+  S[15] &= 0x7f;
+  return aes_encrypt_block (S, ctx->ek, ks);
+}
+
+static_always_inline int
+aes_gcm_siv (const u8 *src, u8 *dst, const u8 *aad, const u8 *nonce, u8 *tag,
+	     u32 data_bytes, u32 aad_bytes, const aes_gcm_siv_key_data_t *kd,
+	     aes_key_size_t ks, int is_encrypt)
+{
+  aes_gcm_siv_ctx_t _ctx, *ctx = &_ctx;
+  u8x16 T;
+
+  aes_gcm_siv_derive_keys (ctx, kd, nonce, ks);
+
+  if (is_encrypt)
+    {
+      T = aes_gcm_siv_tag (ctx, aad, aad_bytes, src, data_bytes, nonce, ks);
+      *(u8x16u *) tag = T;
+      aes_gcm_siv_ctr (ctx, T, src, dst, data_bytes, ks);
+      return 1;
+    }
+
+  /* decrypt first, tag is calculated over the plaintext */
+  aes_gcm_siv_ctr (ctx, *(u8x16u *) tag, src, dst, data_bytes, ks);
+  T = aes_gcm_siv_tag (ctx, aad, aad_bytes, dst, data_bytes, nonce, ks);
+
+  if (u8x16_is_equal (T, *(u8x16u *) tag))
+    return 1;
+
+  /* plaintext must not be released if the tag doesn't match */
+  clib_memset_u8 (dst, 0, data_bytes);
+  return 0;
+}
+
+static_always_inline void
+clib_aes_gcm_siv_key_expand (aes_gcm_siv_key_data_t *kd, const u8 *key,
+			     aes_key_size_t ks)
+{
+  aes_key_expand ((u8x16 *) kd->Kg, key, ks);
+}
+
+static_always_inline void
+clib_aes128_gcm_siv_enc (const aes_gcm_siv_key_data_t *kd,
+			 const u8 *plaintext, u32 data_bytes, const u8 *aad,
+			 u32 aad_bytes, const u8 *nonce, u8 *cyphertext,
+			 u8 *tag)
+{
+  aes_gcm_siv (plaintext, cyphertext, aad, nonce, tag, data_bytes, aad_bytes,
+	       kd, AES_KEY_128, 1);
+}
+
+static_always_inline void
+clib_aes256_gcm_siv_enc (const aes_gcm_siv_key_data_t *kd,
+			 const u8 *plaintext, u32 data_bytes, const u8 *aad,
+			 u32 aad_bytes, const u8 *nonce, u8 *cyphertext,
+			 u8 *tag)
+{
+  aes_gcm_siv (plaintext, cyphertext, aad, nonce, tag, data_bytes, aad_bytes,
+	       kd, AES_KEY_256, 1);
+}
+
+static_always_inline int
+clib_aes128_gcm_siv_dec (const aes_gcm_siv_key_data_t *kd,
+			 const u8 *cyphertext, u32 data_bytes, const u8 *aad,
+			 u32 aad_bytes, const u8 *nonce, const u8 *tag,
+			 u8 *plaintext)
+{
+  return aes_gcm_siv (cyphertext, plaintext, aad, nonce, (u8 *) tag,
+		      data_bytes, aad_bytes, kd, AES_KEY_128, 0);
+}
+
+static_always_inline int
+clib_aes256_gcm_siv_dec (const aes_gcm_siv_key_data_t *kd,
+			 const u8 *cyphertext, u32 data_bytes, const u8 *aad,
+			 u32 aad_bytes, const u8 *nonce, const u8 *tag,
+			 u8 *plaintext)
+{
+  return aes_gcm_siv (cyphertext, plaintext, aad, nonce, (u8 *) tag,
+		      data_bytes, aad_bytes, kd, AES_KEY_256, 0);
+}
+
+#endif /* __crypto_aes_gcm_siv_h__ */
@@ -0,0 +1,348 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright(c) 2025 Cisco Systems, Inc.
+ */
+
+#ifndef __clib_chacha20_h__
+#define __clib_chacha20_h__
+
+#include <vppinfra/clib.h>
+#include <vppinfra/vector.h>
+#include <vppinfra/cache.h>
+#include <vppinfra/string.h>
+
+/* implementation of DJB's ChaCha20 (RFC8439) keystream generator
+
+   state is kept in row layout, one 128-bit lane holds one row of one
+   64-byte block, so wider vectors simply carry more independent blocks
+   and column/diagonal rounds become in-lane shuffles. Independent blocks
+   are called lanes here and each lane may use different key, nonce and
+   counter, which allows caller to interleave blocks of different buffers
+   (multi-buffer) or to compute consecutive blocks of the same stream */
+
+#if defined(CLIB_HAVE_VEC512)
+typedef u32x16 chacha20_vec_t;
+#define CHACHA20_BLOCKS_PER_VEC 4
+#define CHACHA20_N_VEC		2
+#elif defined(CLIB_HAVE_VEC256)
+typedef u32x8 chacha20_vec_t;
+#define CHACHA20_BLOCKS_PER_VEC 2
+#define CHACHA20_N_VEC		2
+#else
+typedef u32x4 chacha20_vec_t;
+#define CHACHA20_BLOCKS_PER_VEC 1
+#define CHACHA20_N_VEC		4
+#endif
+
+#define CLIB_CHACHA20_N_LANES (CHACHA20_BLOCKS_PER_VEC * CHACHA20_N_VEC)
+#define CLIB_CHACHA20_BLOCK_SIZE 64
+
+typedef struct
+{
+  u32x4 k[2];
+} clib_chacha20_key_t;
+
+typedef struct
+{
+  const clib_chacha20_key_t *key;
+  u32x4 d; /* block counter and nonce */
+  u8 keystream_bytes[CLIB_CHACHA20_N_LANES * CLIB_CHACHA20_BLOCK_SIZE];
+  u32 n_keystream_bytes; /* number of keystream leftovers */
+} clib_chacha20_ctx_t;
+
+/* rotate 32-bit elements within each 128-bit lane */
+#define _chacha20_idx(o, n)                                                   \
+  (o) + ((n) &3), (o) + (((n) + 1) & 3), (o) + (((n) + 2) & 3),             \
+    (o) + (((n) + 3) & 3)
+#define _chacha20_idx16(o, n)                                                 \
+  _chacha20_idx (o, n), _chacha20_idx ((o) + 4, n),                           \
+    _chacha20_idx ((o) + 8, n), _chacha20_idx ((o) + 12, n)
+
+#if defined(CLIB_HAVE_VEC512)
+#define _chacha20_shuffle(x, n)                                               \
+  u32x16_shuffle (x, _chacha20_idx16 (0, n))
+#elif defined(CLIB_HAVE_VEC256)
+#define _chacha20_shuffle(x, n)                                               \
+  u32x8_shuffle (x, _chacha20_idx (0, n), _chacha20_idx (4, n))
+#else
+#define _chacha20_shuffle(x, n) u32x4_shuffle (x, _chacha20_idx (0, n))
+#endif
+
+static_always_inline chacha20_vec_t
+_chacha20_rotl (chacha20_vec_t x, const int n)
+{
+  return (x << n) | (x >> (32 - n));
+}
+
+/* rotations by 16 and 8 are byte permutations, cheaper than shifts unless
+ * CPU have native vector rotate instruction */
+static_always_inline chacha20_vec_t
+_chacha20_rotl16 (chacha20_vec_t x)
+{
+#if defined(CLIB_HAVE_VEC512)
+  return _chacha20_rotl (x, 16);
+#elif defined(CLIB_HAVE_VEC256)
+  return (chacha20_vec_t) u8x32_shuffle (x, _chacha20_idx16 (0, 2),
+					 _chacha20_idx16 (16, 2));
+#else
+  return (chacha20_vec_t) u8x16_shuffle (x, _chacha20_idx16 (0, 2));
+#endif
+}
+
+static_always_inline chacha20_vec_t
+_chacha20_rotl8 (chacha20_vec_t x)
+{
+#if defined(CLIB_HAVE_VEC512)
+  return _chacha20_rotl (x, 8);
+#elif defined(CLIB_HAVE_VEC256)
+  return (chacha20_vec_t) u8x32_shuffle (x, _chacha20_idx16 (0, 3),
+					 _chacha20_idx16 (16, 3));
+#else
+  return (chacha20_vec_t) u8x16_shuffle (x, _chacha20_idx16 (0, 3));
+#endif
+}
+
+typedef union
+{
+  chacha20_vec_t v;
+  u32x4 x[CHACHA20_BLOCKS_PER_VEC];
+} _chacha20_vec_u;
+
+/* concatenate rows of CHACHA20_BLOCKS_PER_VEC lanes into single vector,
+ * done in registers to avoid store forwarding stalls */
+static_always_inline chacha20_vec_t
+_chacha20_vec_from_rows (const u32x4 *x)
+{
+#if defined(CLIB_HAVE_VEC512)
+  __m256i lo = _mm256_set_m128i ((__m128i) x[1], (__m128i) x[0]);
+  __m256i hi = _mm256_set_m128i ((__m128i) x[3], (__m128i) x[2]);
+  return (chacha20_vec_t) _mm512_inserti64x4 (_mm512_castsi256_si512 (lo), hi,
+					      1);
+#elif defined(CLIB_HAVE_VEC256)
+  return (chacha20_vec_t) _mm256_set_m128i ((__m128i) x[1], (__m128i) x[0]);
+#else
+  return x[0];
+#endif
+}
+
+static_always_inline void
+clib_chacha20_key_init (clib_chacha20_key_t *kd, const u8 *key)
+{
+  kd->k[0] = *(u32x4u *) key;
+  kd->k[1] = *(u32x4u *) (key + 16);
+}
+
+/* 4th row of the state, 32-bit block counter followed by 96-bit nonce */
+static_always_inline u32x4
+clib_chacha20_counter_and_nonce (const u8 *nonce, u32 counter)
+{
+  const u32u *n = (u32u *) nonce;
+  return (u32x4){ counter, n[0], n[1], n[2] };
+}
+
+/* generates CLIB_CHACHA20_N_LANES keystream blocks, lane i uses key
+ * key[i] and counter/nonce row d[i]. Keystream of lane i is stored into
+ * ks[4 * i] - ks[4 * i + 3] */
+static_always_inline void
+_clib_chacha20_blocks (u32x4 *ks, const clib_chacha20_key_t *const key[],
+		       const u32x4 d[])
+{
+  const u32x4 sigma = { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+  _chacha20_vec_u a0[CHACHA20_N_VEC], b0[CHACHA20_N_VEC], c0[CHACHA20_N_VEC],
+    d0[CHACHA20_N_VEC];
+  chacha20_vec_t a[CHACHA20_N_VEC], b[CHACHA20_N_VEC], c[CHACHA20_N_VEC],
+    dd[CHACHA20_N_VEC];
+
+  for (int i = 0; i < CHACHA20_N_VEC; i++)
+    {
+      u32x4 kb[CHACHA20_BLOCKS_PER_VEC], kc[CHACHA20_BLOCKS_PER_VEC];
+      u32x4 s[CHACHA20_BLOCKS_PER_VEC];
+
+      for (int j = 0; j < CHACHA20_BLOCKS_PER_VEC; j++)
+	{
+	  int l = i * CHACHA20_BLOCKS_PER_VEC + j;
+	  s[j] = sigma;
+	  kb[j] = key[l]->k[0];
+	  kc[j] = key[l]->k[1];
+	}
+      a0[i].v = a[i] = _chacha20_vec_from_rows (s);
+      b0[i].v = b[i] = _chacha20_vec_from_rows (kb);
+      c0[i].v = c[i] = _chacha20_vec_from_rows (kc);
+      d0[i].v = dd[i] =
+	_chacha20_vec_from_rows (d + i * CHACHA20_BLOCKS_PER_VEC);
+    }
+
+  for (int r = 0; r < 10; r++)
+    {
+      /* column round */
+      for (int i = 0; i < CHACHA20_N_VEC; i++)
+	{
+	  a[i] += b[i];
+	  dd[i] = _chacha20_rotl16 (dd[i] ^ a[i]);
+	}
+      for (int i = 0; i < CHACHA20_N_VEC; i++)
+	{
+	  c[i] += dd[i];
+	  b[i] = _chacha20_rotl (b[i] ^ c[i], 12);
+	}
+      for (int i = 0; i < CHACHA20_N_VEC; i++)
+	{
+	  a[i] += b[i];
+	  dd[i] = _chacha20_rotl8 (dd[i] ^ a[i]);
+	}
+      for (int i = 0; i < CHACHA20_N_VEC; i++)
+	{
+	  c[i] += dd[i];
+	  b[i] = _chacha20_rotl (b[i] ^ c[i], 7);
+	}
+
+      /* move diagonals into columns */
+      for (int i = 0; i < CHACHA20_N_VEC; i++)
+	{
+	  b[i] = _chacha20_shuffle (b[i], 1);
+	  c[i] = _chacha20_shuffle (c[i], 2);
+	  dd[i] = _chacha20_shuffle (dd[i], 3);
+	}
+
+      /* diagonal round */
+      for (int i = 0; i < CHACHA20_N_VEC; i++)
+	{
+	  a[i] += b[i];
+	  dd[i] = _chacha20_rotl16 (dd[i] ^ a[i]);
+	}
+      for (int i = 0; i < CHACHA20_N_VEC; i++)
+	{
+	  c[i] += dd[i];
+	  b[i] = _chacha20_rotl (b[i] ^ c[i], 12);
+	}
+      for (int i = 0; i < CHACHA20_N_VEC; i++)
+	{
+	  a[i] += b[i];
+	  dd[i] = _chacha20_rotl8 (dd[i] ^ a[i]);
+	}
+      for (int i = 0; i < CHACHA20_N_VEC; i++)
+	{
+	  c[i] += dd[i];
+	  b[i] = _chacha20_rotl (b[i] ^ c[i], 7);
+	}
+
+      /* and back */
+      for (int i = 0; i < CHACHA20_N_VEC; i++)
+	{
+	  b[i] = _chacha20_shuffle (b[i], 3);
+	  c[i] = _chacha20_shuffle (c[i], 2);
+	  dd[i] = _chacha20_shuffle (dd[i], 1);
+	}
+    }
+
+  for (int i = 0; i < CHACHA20_N_VEC; i++)
+    {
+      a0[i].v += a[i];
+      b0[i].v += b[i];
+      c0[i].v += c[i];
+      d0[i].v += dd[i];
+      for (int j = 0; j < CHACHA20_BLOCKS_PER_VEC; j++)
+	{
+	  u32x4 *k = ks + 4 * (i * CHACHA20_BLOCKS_PER_VEC + j);
+	  k[0] = a0[i].x[j];
+	  k[1] = b0[i].x[j];
+	  k[2] = c0[i].x[j];
+	  k[3] = d0[i].x[j];
+	}
+    }
+}
+
+static_always_inline void
+_clib_chacha20_xor (u8 *dst, const u8 *src, const u32x4 *ks, u32 n_bytes)
+{
+  u32x4u *dv = (u32x4u *) dst;
+  const u32x4u *sv = (u32x4u *) src;
+  u32 i = 0;
+
+  for (; n_bytes >= 16; n_bytes -= 16, i++)
+    dv[i] = sv[i] ^ ks[i];
+
+  if (n_bytes)
+    {
+      const u8 *k = (u8 *) (ks + i);
+      dst += i * 16;
+      src += i * 16;
+      for (u32 j = 0; j < n_bytes; j++)
+	dst[j] = src[j] ^ k[j];
+    }
+}
+
+static_always_inline void
+clib_chacha20_init (clib_chacha20_ctx_t *ctx, const clib_chacha20_key_t *kd,
+		    const u8 *nonce, u32 counter)
+{
+  ctx->key = kd;
+  ctx->d = clib_chacha20_counter_and_nonce (nonce, counter);
+  ctx->n_keystream_bytes = 0;
+}
+
+/* generates keystream for next CLIB_CHACHA20_N_LANES consecutive blocks */
+static_always_inline void
+_clib_chacha20_next_blocks (clib_chacha20_ctx_t *ctx, u32x4 *ks)
+{
+  const clib_chacha20_key_t *key[CLIB_CHACHA20_N_LANES];
+  u32x4 d[CLIB_CHACHA20_N_LANES];
+
+  for (int i = 0; i < CLIB_CHACHA20_N_LANES; i++)
+    {
+      key[i] = ctx->key;
+      d[i] = ctx->d + (u32x4){ i, 0, 0, 0 };
+    }
+
+  _clib_chacha20_blocks (ks, key, d);
+  ctx->d += (u32x4){ CLIB_CHACHA20_N_LANES, 0, 0, 0 };
+}
+
+/* encrypts or decrypts n_bytes of data, may be called multiple times with
+ * arbitrary length chunks */
+static_always_inline void
+clib_chacha20_transform (clib_chacha20_ctx_t *ctx, const u8 *src, u8 *dst,
+			 u32 n_bytes)
+{
+  const u32 n_lanes_bytes = CLIB_CHACHA20_N_LANES * CLIB_CHACHA20_BLOCK_SIZE;
+  u32x4 ks[CLIB_CHACHA20_N_LANES * 4];
+
+  if (ctx->n_keystream_bytes)
+    {
+      u8 *k = ctx->keystream_bytes + n_lanes_bytes - ctx->n_keystream_bytes;
+      u32 n = clib_min (n_bytes, ctx->n_keystream_bytes);
+
+      for (u32 i = 0; i < n; i++)
+	dst[i] = src[i] ^ k[i];
+
+      ctx->n_keystream_bytes -= n;
+      n_bytes -= n;
+      src += n;
+      dst += n;
+    }
+
+  for (; n_bytes >= n_lanes_bytes; n_bytes -= n_lanes_bytes)
+    {
+      _clib_chacha20_next_blocks (ctx, ks);
+      _clib_chacha20_xor (dst, src, ks, n_lanes_bytes);
+      src += n_lanes_bytes;
+      dst += n_lanes_bytes;
+    }
+
+  if (n_bytes)
+    {
+      _clib_chacha20_next_blocks (ctx, (u32x4 *) ctx->keystream_bytes);
+      _clib_chacha20_xor (dst, src, (u32x4 *) ctx->keystream_bytes, n_bytes);
+      ctx->n_keystream_bytes = n_lanes_bytes - n_bytes;
+    }
+}
+
+static_always_inline void
+clib_chacha20 (const clib_chacha20_key_t *kd, const u8 *nonce, u32 counter,
+	       const u8 *src, u8 *dst, u32 n_bytes)
+{
+  clib_chacha20_ctx_t ctx;
+  clib_chacha20_init (&ctx, kd, nonce, counter);
+  clib_chacha20_transform (&ctx, src, dst, n_bytes);
+}
+
+#endif /* __clib_chacha20_h__ */
@@ -0,0 +1,242 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright(c) 2025 Cisco Systems, Inc.
+ */
+
+#ifndef __clib_chacha20_poly1305_h__
+#define __clib_chacha20_poly1305_h__
+
+#include <vppinfra/crypto/chacha20.h>
+#include <vppinfra/crypto/poly1305.h>
+
+/* ChaCha20-Poly1305 AEAD construction (RFC8439 section 2.8) */
+
+typedef enum
+{
+  CHACHA20_POLY1305_OP_ENCRYPT,
+  CHACHA20_POLY1305_OP_DECRYPT,
+} chacha20_poly1305_op_type_t;
+
+typedef struct
+{
+  clib_chacha20_ctx_t chacha20;
+  clib_poly1305_ctx poly1305;
+  u64 aad_len;
+  u64 data_len;
+} clib_chacha20_poly1305_ctx_t;
+
+/* single operation descriptor for multi-buffer API */
+typedef struct
+{
+  const clib_chacha20_key_t *key;
+  const u8 *iv; /* 96-bit nonce */
+  const u8 *aad;
+  const u8 *src;
+  u8 *dst;
+  u8 *tag;
+  u32 len;
+  u16 aad_len;
+  u8 tag_len;
+  u8 bad_tag; /* set on decrypt if tag doesn't match */
+} clib_chacha20_poly1305_op_t;
+
+static const u8 _chacha20_poly1305_zero_pad[16] = {};
+
+static_always_inline void
+_clib_chacha20_poly1305_pad (clib_poly1305_ctx *pctx, u64 n_bytes)
+{
+  if (n_bytes & 15)
+    clib_poly1305_update (pctx, _chacha20_poly1305_zero_pad,
+			  16 - (n_bytes & 15));
+}
+
+static_always_inline void
+_clib_chacha20_poly1305_start (clib_poly1305_ctx *pctx, const u8 *poly_key,
+			       const u8 *aad, u32 aad_len)
+{
+  clib_poly1305_init (pctx, poly_key);
+  clib_poly1305_update (pctx, aad, aad_len);
+  _clib_chacha20_poly1305_pad (pctx, aad_len);
+}
+
+static_always_inline void
+_clib_chacha20_poly1305_finish (clib_poly1305_ctx *pctx, u64 aad_len,
+				u64 data_len, u8 *tag)
+{
+  u64 lengths[2] = { aad_len, data_len };
+  _clib_chacha20_poly1305_pad (pctx, data_len);
+  clib_poly1305_update (pctx, (u8 *) lengths, sizeof (lengths));
+  clib_poly1305_final (pctx, tag);
+}
+
+/* streaming API, used for chained buffers */
+
+static_always_inline void
+clib_chacha20_poly1305_init (clib_chacha20_poly1305_ctx_t *ctx,
+			     const clib_chacha20_key_t *kd, const u8 *iv,
+			     const u8 *aad, u32 aad_len)
+{
+  u8 poly_key[CLIB_CHACHA20_BLOCK_SIZE];
+
+  /* first block of keystream (counter 0) is used as one-time poly1305 key,
+   * data is encrypted with keystream starting at counter 1 */
+  clib_chacha20_init (&ctx->chacha20, kd, iv, 0);
+  clib_memset_u8 (poly_key, 0, sizeof (poly_key));
+  clib_chacha20_transform (&ctx->chacha20, poly_key, poly_key,
+			   sizeof (poly_key));
+  _clib_chacha20_poly1305_start (&ctx->poly1305, poly_key, aad, aad_len);
+  ctx->aad_len = aad_len;
+  ctx->data_len = 0;
+}
+
+static_always_inline void
+clib_chacha20_poly1305_update (clib_chacha20_poly1305_ctx_t *ctx,
+			       const u8 *src, u8 *dst, u32 n_bytes,
+			       chacha20_poly1305_op_type_t op)
+{
+  if (op == CHACHA20_POLY1305_OP_DECRYPT)
+    clib_poly1305_update (&ctx->poly1305, src, n_bytes);
+
+  clib_chacha20_transform (&ctx->chacha20, src, dst, n_bytes);
+
+  if (op == CHACHA20_POLY1305_OP_ENCRYPT)
+    clib_poly1305_update (&ctx->poly1305, dst, n_bytes);
+
+  ctx->data_len += n_bytes;
+}
+
+static_always_inline void
+clib_chacha20_poly1305_final (clib_chacha20_poly1305_ctx_t *ctx, u8 *tag)
+{
+  _clib_chacha20_poly1305_finish (&ctx->poly1305, ctx->aad_len,
+				  ctx->data_len, tag);
+}
+
+/* multi-buffer API
+
+   keystream blocks of all ops are packed back to back into lanes, so
+   small packets (where single op needs 2 or 3 blocks including one used
+   for poly1305 key) still fill all lanes. Lanes are consumed in order,
+   so only one poly1305 context is in flight at any time */
+
+static_always_inline void
+_clib_chacha20_poly1305_consume (clib_chacha20_poly1305_op_t *ops,
+				 clib_poly1305_ctx *pctx, const u32x4 *ks,
+				 const u32 *lane_op, const u32 *lane_block,
+				 u32 n_lanes, chacha20_poly1305_op_type_t type)
+{
+  for (u32 i = 0; i < n_lanes; i++, ks += 4)
+    {
+      clib_chacha20_poly1305_op_t *op = ops + lane_op[i];
+      u32 blk = lane_block[i];
+      u32 n_blocks = round_pow2 (op->len, CLIB_CHACHA20_BLOCK_SIZE) /
+		     CLIB_CHACHA20_BLOCK_SIZE;
+
+      if (blk == 0)
+	_clib_chacha20_poly1305_start (pctx, (u8 *) ks, op->aad, op->aad_len);
+      else
+	{
+	  u32 off = (blk - 1) * CLIB_CHACHA20_BLOCK_SIZE;
+	  u32 n_bytes = clib_min (op->len - off, CLIB_CHACHA20_BLOCK_SIZE);
+
+	  if (type == CHACHA20_POLY1305_OP_DECRYPT)
+	    clib_poly1305_update (pctx, op->src + off, n_bytes);
+
+	  _clib_chacha20_xor (op->dst + off, op->src + off, ks, n_bytes);
+
+	  if (type == CHACHA20_POLY1305_OP_ENCRYPT)
+	    clib_poly1305_update (pctx, op->dst + off, n_bytes);
+	}
+
+      if (blk == n_blocks)
+	{
+	  u8 tag[16];
+	  _clib_chacha20_poly1305_finish (pctx, op->aad_len, op->len, tag);
+	  if (type == CHACHA20_POLY1305_OP_ENCRYPT)
+	    u8x16_store_partial (*(u8x16u *) tag, op->tag, op->tag_len);
+	  else
+	    op->bad_tag = memcmp (op->tag, tag, op->tag_len) != 0;
+	}
+    }
+}
+
+/* returns number of ops which failed tag verification */
+static_always_inline u32
+clib_chacha20_poly1305_ops (clib_chacha20_poly1305_op_t *ops, u32 n_ops,
+			    chacha20_poly1305_op_type_t type)
+{
+  const clib_chacha20_key_t *key[CLIB_CHACHA20_N_LANES];
+  u32x4 ks[CLIB_CHACHA20_N_LANES * 4];
+  u32x4 d[CLIB_CHACHA20_N_LANES];
+  u32 lane_op[CLIB_CHACHA20_N_LANES], lane_block[CLIB_CHACHA20_N_LANES];
+  clib_poly1305_ctx pctx;
+  u32 n_lanes = 0, n_fail = 0;
+
+  for (u32 i = 0; i < n_ops; i++)
+    {
+      clib_chacha20_poly1305_op_t *op = ops + i;
+      u32x4 cn = clib_chacha20_counter_and_nonce (op->iv, 0);
+      u32 n_blocks = round_pow2 (op->len, CLIB_CHACHA20_BLOCK_SIZE) /
+		     CLIB_CHACHA20_BLOCK_SIZE;
+
+      op->bad_tag = 0;
+
+      for (u32 blk = 0; blk <= n_blocks; blk++)
+	{
+	  key[n_lanes] = op->key;
+	  d[n_lanes] = cn + (u32x4){ blk, 0, 0, 0 };
+	  lane_op[n_lanes] = i;
+	  lane_block[n_lanes] = blk;
+
+	  if (++n_lanes == CLIB_CHACHA20_N_LANES)
+	    {
+	      _clib_chacha20_blocks (ks, key, d);
+	      _clib_chacha20_poly1305_consume (ops, &pctx, ks, lane_op,
+					       lane_block, n_lanes, type);
+	      n_lanes = 0;
+	    }
+	}
+    }
+
+  if (n_lanes)
+    {
+      /* fill unused lanes with copy of last one */
+      for (u32 i = n_lanes; i < CLIB_CHACHA20_N_LANES; i++)
+	{
+	  key[i] = key[n_lanes - 1];
+	  d[i] = d[n_lanes - 1];
+	}
+      _clib_chacha20_blocks (ks, key, d);
+      _clib_chacha20_poly1305_consume (ops, &pctx, ks, lane_op, lane_block,
+				       n_lanes, type);
+    }
+
+  if (type == CHACHA20_POLY1305_OP_DECRYPT)
+    for (u32 i = 0; i < n_ops; i++)
+      n_fail += ops[i].bad_tag;
+
+  return n_fail;
+}
+
+static_always_inline int
+clib_chacha20_poly1305 (const clib_chacha20_key_t *kd, const u8 *iv,
+			const u8 *aad, u32 aad_len, const u8 *src, u8 *dst,
+			u32 len, u8 *tag, u32 tag_len,
+			chacha20_poly1305_op_type_t type)
+{
+  clib_chacha20_poly1305_op_t op = {
+    .key = kd,
+    .iv = iv,
+    .aad = aad,
+    .aad_len = aad_len,
+    .src = src,
+    .dst = dst,
+    .len = len,
+    .tag = tag,
+    .tag_len = tag_len,
+  };
+
+  /* returns 1 on success */
+  return clib_chacha20_poly1305_ops (&op, 1, type) == 0;
+}
+
+#endif /* __clib_chacha20_poly1305_h__ */
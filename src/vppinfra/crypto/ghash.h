@@ -375,6 +375,18 @@ ghash4_final (ghash_ctx_t *gd)
   t = u8x64_extract_lo (r) ^ u8x64_extract_hi (r);
   return u8x32_extract_hi (t) ^ u8x32_extract_lo (t);
 }
+
+/* multiply each of 4 128-bit lanes separately */
+static_always_inline u8x64
+ghash4_mul (u8x64 a, u8x64 b)
+{
+  ghash_ctx_t _gd, *gd = &_gd;
+  ghash4_mul_first (gd, a, b);
+  ghash4_reduce (gd);
+  ghash4_reduce2 (gd);
+  return u8x64_xor3 (gd->hi4, u8x64_word_shift_right (gd->tmp_lo4, 4),
+		     u8x64_word_shift_left (gd->tmp_hi4, 4));
+}
 #endif
 
 #if defined(__VPCLMULQDQ__)
@@ -486,6 +498,18 @@ ghash2_final (ghash_ctx_t *gd)
   /* horizontal XOR of 2 128-bit lanes */
   return u8x32_extract_hi (r) ^ u8x32_extract_lo (r);
 }
+
+/* multiply each of 2 128-bit lanes separately */
+static_always_inline u8x32
+ghash2_mul (u8x32 a, u8x32 b)
+{
+  ghash_ctx_t _gd, *gd = &_gd;
+  ghash2_mul_first (gd, a, b);
+  ghash2_reduce (gd);
+  ghash2_reduce2 (gd);
+  return u8x32_xor3 (gd->hi2, u8x32_word_shift_right (gd->tmp_lo2, 4),
+		     u8x32_word_shift_left (gd->tmp_hi2, 4));
+}
 #endif
 
 static_always_inline void
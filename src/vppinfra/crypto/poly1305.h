@@ -177,12 +177,13 @@ clib_poly1305_update (clib_poly1305_ctx *ctx, const u8 *msg, uword len)
       msg += missing_bytes;
     }
 
-  n_left = _clib_poly1305_add_blocks (ctx, msg, n_left, 1);
+  msg += n_left;
+  n_left = _clib_poly1305_add_blocks (ctx, msg - n_left, n_left, 1);
 
   if (n_left)
     {
       ctx->partial.as_u64[0] = ctx->partial.as_u64[1] = 0;
-      clib_memcpy_fast (ctx->partial.as_u8, msg + len - n_left, n_left);
+      clib_memcpy_fast (ctx->partial.as_u8, msg - n_left, n_left);
       ctx->n_partial_bytes = n_left;
     }
 }
@@ -712,4 +712,240 @@ clib_sha2_hmac (clib_sha2_type_t type, const u8 *key, uword key_len,
 #define clib_hmac_sha512_256(...)                                             \
   clib_sha2_hmac (CLIB_SHA2_512_256, __VA_ARGS__)
 
+/*
+ *  multi-buffer HMAC-SHA224 / HMAC-SHA256
+ *
+ *  Each vector lane computes one independent HMAC, so throughput scales with
+ *  vector width on CPUs without SHA instructions. Lanes are refilled with
+ *  new ops as soon as they finish, so ops of different length can share
+ *  one call.
+ */
+
+#if defined(CLIB_HAVE_VEC512)
+#define CLIB_SHA256_MB_N_LANES 16
+typedef u32x16 clib_sha256_mb_vec_t;
+#elif defined(CLIB_HAVE_VEC256)
+#define CLIB_SHA256_MB_N_LANES 8
+typedef u32x8 clib_sha256_mb_vec_t;
+#elif defined(CLIB_HAVE_VEC128)
+#define CLIB_SHA256_MB_N_LANES 4
+typedef u32x4 clib_sha256_mb_vec_t;
+#endif
+
+#ifdef CLIB_SHA256_MB_N_LANES
+
+typedef struct
+{
+  const clib_sha2_hmac_key_data_t *kd;
+  const u8 *src;
+  u8 *digest; /* full digest size is always written */
+  u32 len;
+} clib_sha2_hmac_mb_op_t;
+
+typedef enum
+{
+  CLIB_SHA2_MB_LANE_IDLE,
+  CLIB_SHA2_MB_LANE_DATA,
+  CLIB_SHA2_MB_LANE_TAIL,
+  CLIB_SHA2_MB_LANE_OUTER,
+} clib_sha2_mb_lane_state_t;
+
+/* load one block from each lane and transpose so w[i] holds word i of all
+ * lanes */
+static_always_inline void
+_clib_sha256_mb_load (clib_sha256_mb_vec_t w[16], const u8 *p[])
+{
+#if CLIB_SHA256_MB_N_LANES == 16
+  for (int i = 0; i < 16; i++)
+    w[i] = u32x16_byte_swap (u32x16_load_unaligned ((void *) p[i]));
+  u32x16_transpose (w);
+#elif CLIB_SHA256_MB_N_LANES == 8
+  for (int i = 0; i < 8; i++)
+    {
+      w[i] = u32x8_load_unaligned ((void *) p[i]);
+      w[i + 8] = u32x8_load_unaligned ((void *) (p[i] + 32));
+    }
+  u32x8_transpose (w);
+  u32x8_transpose (w + 8);
+  for (int i = 0; i < 16; i++)
+    w[i] = u32x8_byte_swap (w[i]);
+#else
+  for (int i = 0; i < 16; i += 4)
+    {
+      u32x4 r0, r1, r2, r3, t0, t1, t2, t3;
+      r0 = u32x4_load_unaligned ((void *) (p[0] + i * 4));
+      r1 = u32x4_load_unaligned ((void *) (p[1] + i * 4));
+      r2 = u32x4_load_unaligned ((void *) (p[2] + i * 4));
+      r3 = u32x4_load_unaligned ((void *) (p[3] + i * 4));
+      t0 = u32x4_shuffle2 (r0, r1, 0, 4, 1, 5);
+      t1 = u32x4_shuffle2 (r0, r1, 2, 6, 3, 7);
+      t2 = u32x4_shuffle2 (r2, r3, 0, 4, 1, 5);
+      t3 = u32x4_shuffle2 (r2, r3, 2, 6, 3, 7);
+      w[i + 0] = u32x4_byte_swap (u32x4_shuffle2 (t0, t2, 0, 1, 4, 5));
+      w[i + 1] = u32x4_byte_swap (u32x4_shuffle2 (t0, t2, 2, 3, 6, 7));
+      w[i + 2] = u32x4_byte_swap (u32x4_shuffle2 (t1, t3, 0, 1, 4, 5));
+      w[i + 3] = u32x4_byte_swap (u32x4_shuffle2 (t1, t3, 2, 3, 6, 7));
+    }
+#endif
+}
+
+static_always_inline void
+_clib_sha256_mb_blocks (clib_sha256_mb_vec_t h[8], const u8 *p[],
+			u32 n_blocks)
+{
+  clib_sha256_mb_vec_t w[64], s[8];
+
+  for (; n_blocks; n_blocks--)
+    {
+      _clib_sha256_mb_load (w, p);
+
+      for (int i = 0; i < 8; i++)
+	s[i] = h[i];
+
+      for (int i = 0; i < 16; i++)
+	SHA256_TRANSFORM (s, w, i, clib_sha2_256_k[i]);
+
+      for (int i = 16; i < 64; i++)
+	{
+	  SHA256_MSG_SCHED (w, i);
+	  SHA256_TRANSFORM (s, w, i, clib_sha2_256_k[i]);
+	}
+
+      for (int i = 0; i < 8; i++)
+	h[i] += s[i];
+
+      for (int i = 0; i < CLIB_SHA256_MB_N_LANES; i++)
+	p[i] += CLIB_SHA2_256_BLOCK_SIZE;
+    }
+}
+
+static_always_inline void
+_clib_sha256_mb_lane_set (clib_sha256_mb_vec_t h[8], u32 lane,
+			  const clib_sha2_h_t *v)
+{
+  for (int i = 0; i < 8; i++)
+    h[i][lane] = v->h32[i];
+}
+
+static_always_inline void
+_clib_sha256_mb_lane_digest (clib_sha256_mb_vec_t h[8], u32 lane, u8 *digest,
+			     u8 digest_size)
+{
+  for (int i = 0; i < digest_size / sizeof (u32); i++)
+    ((u32u *) digest)[i] = clib_host_to_net_u32 (h[i][lane]);
+}
+
+/* build final padded block(s) in buf, returns number of blocks */
+static_always_inline u32
+_clib_sha256_mb_pad (u8 *buf, const u8 *data, u32 n_bytes, u64 total_bytes)
+{
+  u32 n_blocks = n_bytes + 9 > CLIB_SHA2_256_BLOCK_SIZE ? 2 : 1;
+  u32 end = n_blocks * CLIB_SHA2_256_BLOCK_SIZE;
+
+  clib_memcpy_fast (buf, data, n_bytes);
+  buf[n_bytes] = 0x80;
+  clib_memset_u8 (buf + n_bytes + 1, 0, end - n_bytes - 1 - sizeof (u64));
+  *(u64u *) (buf + end - sizeof (u64)) =
+    clib_host_to_net_u64 (total_bytes * 8);
+  return n_blocks;
+}
+
+static_always_inline void
+clib_sha2_hmac_mb (clib_sha2_type_t type, clib_sha2_hmac_mb_op_t *ops,
+		   u32 n_ops)
+{
+  const u32 n_lanes = CLIB_SHA256_MB_N_LANES;
+  const u8 digest_size = clib_sha2_variants[type].digest_size;
+  u8 buf[CLIB_SHA256_MB_N_LANES][2 * CLIB_SHA2_256_BLOCK_SIZE];
+  clib_sha2_mb_lane_state_t state[CLIB_SHA256_MB_N_LANES];
+  clib_sha2_hmac_mb_op_t *op[CLIB_SHA256_MB_N_LANES];
+  u32 n_blocks[CLIB_SHA256_MB_N_LANES];
+  const u8 *ptr[CLIB_SHA256_MB_N_LANES];
+  clib_sha256_mb_vec_t h[8] = {};
+  u32 next_op = 0, n_active = 0;
+
+  ASSERT (clib_sha2_variants[type].block_size == CLIB_SHA2_256_BLOCK_SIZE);
+
+  for (u32 i = 0; i < n_lanes; i++)
+    {
+      state[i] = CLIB_SHA2_MB_LANE_IDLE;
+      n_blocks[i] = 0;
+    }
+
+  while (1)
+    {
+      u32 n = ~0, first_active = 0;
+
+      /* move lanes with completed segment to the next one */
+      for (u32 i = 0; i < n_lanes; i++)
+	{
+	  while (n_blocks[i] == 0)
+	    {
+	      clib_sha2_hmac_mb_op_t *o = op[i];
+
+	      if (state[i] == CLIB_SHA2_MB_LANE_IDLE)
+		{
+		  if (next_op == n_ops)
+		    break;
+		  o = op[i] = ops + next_op++;
+		  _clib_sha256_mb_lane_set (h, i, &o->kd->ipad_h);
+		  ptr[i] = o->src;
+		  n_blocks[i] = o->len / CLIB_SHA2_256_BLOCK_SIZE;
+		  state[i] = CLIB_SHA2_MB_LANE_DATA;
+		  n_active++;
+		}
+	      else if (state[i] == CLIB_SHA2_MB_LANE_DATA)
+		{
+		  u32 n_tail = o->len % CLIB_SHA2_256_BLOCK_SIZE;
+		  n_blocks[i] = _clib_sha256_mb_pad (
+		    buf[i], o->src + o->len - n_tail, n_tail,
+		    CLIB_SHA2_256_BLOCK_SIZE + o->len);
+		  ptr[i] = buf[i];
+		  state[i] = CLIB_SHA2_MB_LANE_TAIL;
+		}
+	      else if (state[i] == CLIB_SHA2_MB_LANE_TAIL)
+		{
+		  u8 inner[32];
+		  _clib_sha256_mb_lane_digest (h, i, inner, digest_size);
+		  n_blocks[i] = _clib_sha256_mb_pad (
+		    buf[i], inner, digest_size,
+		    CLIB_SHA2_256_BLOCK_SIZE + digest_size);
+		  _clib_sha256_mb_lane_set (h, i, &o->kd->opad_h);
+		  ptr[i] = buf[i];
+		  state[i] = CLIB_SHA2_MB_LANE_OUTER;
+		}
+	      else
+		{
+		  _clib_sha256_mb_lane_digest (h, i, o->digest, digest_size);
+		  state[i] = CLIB_SHA2_MB_LANE_IDLE;
+		  n_active--;
+		}
+	    }
+
+	  if (n_blocks[i])
+	    {
+	      n = clib_min (n, n_blocks[i]);
+	      first_active = i;
+	    }
+	}
+
+      if (n_active == 0)
+	break;
+
+      /* idle lanes process the same data as one of the active lanes,
+       * results are ignored */
+      for (u32 i = 0; i < n_lanes; i++)
+	if (state[i] == CLIB_SHA2_MB_LANE_IDLE)
+	  ptr[i] = ptr[first_active];
+
+      _clib_sha256_mb_blocks (h, ptr, n);
+
+      for (u32 i = 0; i < n_lanes; i++)
+	if (state[i] != CLIB_SHA2_MB_LANE_IDLE)
+	  n_blocks[i] -= n;
+    }
+}
+
+#endif /* CLIB_SHA256_MB_N_LANES */
+
 #endif /* included_sha2_h */
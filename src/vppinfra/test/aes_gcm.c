@@ -1105,6 +1105,25 @@ test_clib_aes128_gmac (clib_error_t *err)
       if (memcmp (tc->tag_gmac_128, tag, 16) != 0)
 	return clib_error_return (err, "incremental %u bytes: invalid tag",
 				  tc->n_bytes);
+
+      /* same data split between aad and data */
+      for (u32 off = 1; off < tc->n_bytes; off = off * 2 + 3)
+	{
+	  aes_gmac (data, off, data + off, tc->n_bytes - off, inc_iv, tag, 16,
+		    &kd, AES_KEY_ROUNDS (AES_KEY_128), 0);
+
+	  if (memcmp (tc->tag_gmac_128, tag, 16) != 0)
+	    return clib_error_return (
+	      err, "incremental %u bytes split at %u: invalid tag",
+	      tc->n_bytes, off);
+
+	  if (!aes_gmac (data, off, data + off, tc->n_bytes - off, inc_iv,
+			 (u8 *) tc->tag_gmac_128, 16, &kd,
+			 AES_KEY_ROUNDS (AES_KEY_128), 1))
+	    return clib_error_return (
+	      err, "incremental %u bytes split at %u: verify failed",
+	      tc->n_bytes, off);
+	}
     }
 
   return err;
@@ -0,0 +1,283 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright(c) 2025 Cisco Systems, Inc.
+ */
+
+#if defined(__AES__) && defined(__PCLMUL__)
+#include <vppinfra/format.h>
+#include <vppinfra/test/test.h>
+#include <vppinfra/crypto/aes_gcm_siv.h>
+
+static const u8 rfc8452_key128[16] = { 0x01 };
+static const u8 rfc8452_key256[32] = { 0x01 };
+static const u8 rfc8452_nonce[12] = { 0x03 };
+
+static const struct
+{
+  char *name;
+  const u8 *pt, *aad, *ct, *tag;
+  u32 data_len, aad_len;
+} test_cases128[] = {
+  /* RFC 8452 Appendix C.1 */
+  { .name = "RFC8452 AEAD_AES_128_GCM_SIV #1",
+    .tag = (const u8[]){ 0xdc, 0x20, 0xe2, 0xd8, 0x3f, 0x25, 0x70, 0x5b, 0xb4,
+			 0x9e, 0x43, 0x9e, 0xca, 0x56, 0xde, 0x25 } },
+  { .name = "RFC8452 AEAD_AES_128_GCM_SIV #2",
+    .pt = (const u8[]){ 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    .ct = (const u8[]){ 0xb5, 0xd8, 0x39, 0x33, 0x0a, 0xc7, 0xb7, 0x86 },
+    .tag = (const u8[]){ 0x57, 0x87, 0x82, 0xff, 0xf6, 0x01, 0x3b, 0x81, 0x5b,
+			 0x28, 0x7c, 0x22, 0x49, 0x3a, 0x36, 0x4c },
+    .data_len = 8 },
+  { .name = "RFC8452 AEAD_AES_128_GCM_SIV #3",
+    .pt = (const u8[]){ 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00 },
+    .ct = (const u8[]){ 0x73, 0x23, 0xea, 0x61, 0xd0, 0x59, 0x32, 0x26, 0x00,
+			0x47, 0xd9, 0x42 },
+    .tag = (const u8[]){ 0xa4, 0x97, 0x8d, 0xb3, 0x57, 0x39, 0x1a, 0x0b, 0xc4,
+			 0xfd, 0xec, 0x8b, 0x0d, 0x10, 0x66, 0x39 },
+    .data_len = 12 },
+  { .name = "RFC8452 AEAD_AES_128_GCM_SIV #4",
+    .aad = (const u8[]){ 0x01 },
+    .pt = (const u8[]){ 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    .ct = (const u8[]){ 0x1e, 0x6d, 0xab, 0xa3, 0x56, 0x69, 0xf4, 0x27 },
+    .tag = (const u8[]){ 0x3b, 0x0a, 0x1a, 0x25, 0x60, 0x96, 0x9c, 0xdf, 0x79,
+			 0x0d, 0x99, 0x75, 0x9a, 0xbd, 0x15, 0x08 },
+    .data_len = 8,
+    .aad_len = 1 },
+  { .name = "RFC8452 AEAD_AES_128_GCM_SIV #5",
+    .aad = (const u8[]){ 0x01 },
+    .pt = (const u8[]){ 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    .ct = (const u8[]){ 0x62, 0x00, 0x48, 0xef, 0x3c, 0x1e, 0x73, 0xe5,
+			0x7e, 0x02, 0xbb, 0x85, 0x62, 0xc4, 0x16, 0xa3,
+			0x19, 0xe7, 0x3e, 0x4c, 0xaa, 0xc8, 0xe9, 0x6a,
+			0x1e, 0xcb, 0x29, 0x33, 0x14, 0x5a, 0x1d, 0x71 },
+    .tag = (const u8[]){ 0xe6, 0xaf, 0x6a, 0x7f, 0x87, 0x28, 0x7d, 0xa0, 0x59,
+			 0xa7, 0x16, 0x84, 0xed, 0x34, 0x98, 0xe1 },
+    .data_len = 32,
+    .aad_len = 1 },
+}, test_cases256[] = {
+  /* RFC 8452 Appendix C.2 */
+  { .name = "RFC8452 AEAD_AES_256_GCM_SIV #1",
+    .tag = (const u8[]){ 0x07, 0xf5, 0xf4, 0x16, 0x9b, 0xbf, 0x55, 0xa8, 0x40,
+			 0x0c, 0xd4, 0x7e, 0xa6, 0xfd, 0x40, 0x0f } },
+  { .name = "RFC8452 AEAD_AES_256_GCM_SIV #2",
+    .pt = (const u8[]){ 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    .ct = (const u8[]){ 0xc2, 0xef, 0x32, 0x8e, 0x5c, 0x71, 0xc8, 0x3b },
+    .tag = (const u8[]){ 0x84, 0x31, 0x22, 0x13, 0x0f, 0x73, 0x64, 0xb7, 0x61,
+			 0xe0, 0xb9, 0x74, 0x27, 0xe3, 0xdf, 0x28 },
+    .data_len = 8 },
+  { .name = "RFC8452 AEAD_AES_256_GCM_SIV #3",
+    .pt = (const u8[]){ 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00 },
+    .ct = (const u8[]){ 0x9a, 0xab, 0x2a, 0xeb, 0x3f, 0xaa, 0x0a, 0x34, 0xae,
+			0xa8, 0xe2, 0xb1 },
+    .tag = (const u8[]){ 0x8c, 0xa5, 0x0d, 0xa9, 0xae, 0x65, 0x59, 0xe4, 0x8f,
+			 0xd1, 0x0f, 0x6e, 0x5c, 0x9c, 0xa1, 0x7e },
+    .data_len = 12 },
+};
+
+#define INC_TEST_BYTES 259
+#define INC_AAD_BYTES  35
+
+/* key 00..1f, nonce 40..4b, aad 80..a2, plaintext incrementing bytes */
+static const u8 inc_ct128[] = {
+  0xcf, 0x64, 0x3a, 0xb4, 0x9c, 0xe9, 0xad, 0x05, 0xa4, 0xc7, 0x5d, 0xe6,
+  0x2e, 0x88, 0x6b, 0xdb, 0x56, 0x1f, 0x82, 0x6e, 0x19, 0xf6, 0x1a, 0x04,
+  0x68, 0x46, 0x56, 0x0f, 0xa6, 0x7e, 0xeb, 0x5b, 0xdd, 0xf7, 0x49, 0xae,
+  0xe5, 0x5a, 0xd7, 0x3b, 0xb4, 0x0f, 0xd2, 0xae, 0x01, 0x19, 0x37, 0xe5,
+  0xdb, 0xc7, 0x1e, 0xf4, 0xb0, 0x79, 0xba, 0xc9, 0xa5, 0xfe, 0xb4, 0xee,
+  0xfc, 0x74, 0x48, 0xaf, 0x10, 0xd1, 0x72, 0x82, 0x51, 0x2b, 0xc0, 0x5d,
+  0xce, 0xea, 0x42, 0x0a, 0x6d, 0xbb, 0x9d, 0x60, 0x35, 0x58, 0x45, 0x10,
+  0x21, 0xd3, 0x25, 0x29, 0x39, 0x9f, 0x32, 0x9e, 0xf5, 0x94, 0x32, 0x05,
+  0xd1, 0x2e, 0xbd, 0x09, 0xe7, 0x52, 0x8f, 0x66, 0x89, 0x53, 0xfd, 0xa9,
+  0x5a, 0x89, 0xe4, 0x62, 0xbe, 0xfa, 0x5a, 0x56, 0xd8, 0x11, 0x62, 0xfa,
+  0xba, 0x2b, 0x1c, 0x10, 0x6b, 0x42, 0x1c, 0x56, 0xdd, 0xd5, 0xe9, 0x4d,
+  0x8f, 0x46, 0x84, 0x56, 0xd7, 0xc9, 0x06, 0xa8, 0xe8, 0x88, 0x94, 0x0c,
+  0xd4, 0xb0, 0x98, 0xb1, 0x8e, 0xe0, 0xb5, 0x69, 0xea, 0xd5, 0x84, 0x06,
+  0x7e, 0xc1, 0x51, 0x70, 0x66, 0x2a, 0xf0, 0xef, 0x7a, 0xf1, 0xea, 0xeb,
+  0xe6, 0x37, 0x9a, 0x15, 0xe9, 0x60, 0xd1, 0xb4, 0x0e, 0x0e, 0x4b, 0xff,
+  0x80, 0x88, 0x1e, 0x4a, 0x9f, 0x26, 0x1d, 0xc7, 0xac, 0x6b, 0xdc, 0xe2,
+  0x3c, 0x1a, 0x8a, 0xae, 0x6c, 0x34, 0x8e, 0x06, 0xd0, 0xe2, 0xe2, 0x9f,
+  0xcb, 0x07, 0x2e, 0xaf, 0xba, 0x66, 0xb3, 0x84, 0x3e, 0x87, 0x8a, 0x4c,
+  0x1d, 0x0c, 0x64, 0xac, 0x69, 0x8a, 0xc0, 0x72, 0x94, 0x75, 0x5c, 0x44,
+  0xbf, 0xff, 0x78, 0x33, 0x75, 0x00, 0xa9, 0x7e, 0xe8, 0xcc, 0xe8, 0x09,
+  0x51, 0x9c, 0x7f, 0x53, 0xc4, 0x7f, 0x49, 0x92, 0x14, 0x39, 0x76, 0xb5,
+  0x1c, 0x3a, 0x1d, 0x61, 0x3c, 0x8f, 0x60,
+};
+
+static const u8 inc_tag128[] = {
+  0x09, 0xb6, 0x8e, 0x5d, 0xe3, 0x30, 0x76, 0xc5, 0xd5, 0x6a, 0x4e, 0x40,
+  0x7b, 0xec, 0xc0, 0x26,
+};
+
+static const u8 inc_ct256[] = {
+  0xb0, 0xc5, 0xbc, 0x65, 0x51, 0x4e, 0x4c, 0x43, 0x28, 0x1c, 0xf4, 0x2a,
+  0x8f, 0x90, 0x9d, 0x7d, 0x04, 0x53, 0x49, 0x00, 0xff, 0xcf, 0x73, 0x3c,
+  0xe4, 0x88, 0x73, 0x01, 0x7e, 0x3f, 0xe7, 0x80, 0xe9, 0xd2, 0x17, 0x33,
+  0x7c, 0x53, 0x6f, 0x6d, 0x57, 0xd8, 0x90, 0x1b, 0xac, 0xe2, 0x20, 0x8b,
+  0xc3, 0x5d, 0x59, 0x40, 0xe8, 0xf8, 0xcb, 0x0b, 0x5d, 0xce, 0x3f, 0x53,
+  0x3a, 0x14, 0xe7, 0xe2, 0x5c, 0xe2, 0xa6, 0x2e, 0x22, 0xcc, 0x1a, 0x59,
+  0x9b, 0xd4, 0x02, 0x48, 0xc3, 0x64, 0xa7, 0xdc, 0x78, 0xf1, 0x15, 0xf0,
+  0xc9, 0x03, 0xff, 0x0b, 0xd7, 0xb0, 0x16, 0x5d, 0x9f, 0xb5, 0x4c, 0x9f,
+  0x6a, 0x8d, 0x7e, 0xe1, 0xf0, 0x4d, 0x61, 0xdb, 0xc2, 0xff, 0xa1, 0x07,
+  0x71, 0xbe, 0x5f, 0x36, 0x5f, 0x4f, 0x57, 0xe0, 0x0a, 0xc1, 0xf5, 0xea,
+  0x65, 0x08, 0xef, 0xb5, 0x2e, 0xa2, 0x6d, 0x44, 0xf2, 0xa2, 0xc9, 0xe6,
+  0xef, 0x56, 0x4a, 0x6d, 0xd1, 0x9a, 0x2d, 0x16, 0x74, 0x8e, 0xd1, 0x3c,
+  0x3c, 0x8d, 0x81, 0xe8, 0x85, 0x86, 0xa6, 0x8b, 0x3b, 0xb0, 0x27, 0xef,
+  0xa8, 0x7e, 0x0b, 0x43, 0x21, 0x23, 0x85, 0x27, 0x1f, 0x27, 0x4f, 0xe6,
+  0x51, 0x67, 0x6f, 0x92, 0x9e, 0xd5, 0x94, 0x3a, 0xb5, 0x4d, 0x53, 0xe9,
+  0x87, 0x33, 0xfc, 0xbe, 0xb6, 0x4f, 0x1b, 0xbe, 0x05, 0xad, 0x2c, 0x76,
+  0x62, 0x75, 0x7d, 0xca, 0x6a, 0xcd, 0x4d, 0x0d, 0xac, 0x1a, 0x16, 0x54,
+  0xba, 0x0a, 0x33, 0x70, 0x01, 0xd0, 0xe8, 0xba, 0xcf, 0xd4, 0xc4, 0x9f,
+  0x2b, 0x61, 0xe9, 0xaa, 0x3a, 0xd4, 0x73, 0x6c, 0x79, 0x45, 0x51, 0x23,
+  0x77, 0x35, 0x41, 0x25, 0xdb, 0xca, 0x4e, 0x0e, 0x54, 0xfb, 0x1e, 0x54,
+  0x03, 0x65, 0x95, 0x4d, 0xab, 0xd4, 0x48, 0x30, 0x42, 0x63, 0x48, 0x7a,
+  0x13, 0x95, 0x25, 0xc8, 0xc6, 0xf3, 0xa2,
+};
+
+static const u8 inc_tag256[] = {
+  0x46, 0x43, 0x75, 0x4e, 0xb9, 0x5e, 0x5d, 0x8d, 0xaf, 0xde, 0xb5, 0x9d,
+  0x20, 0x5d, 0xb5, 0x1f,
+};
+
+static int
+test_gcm_siv_one (const aes_gcm_siv_key_data_t *kd, aes_key_size_t ks,
+		  const u8 *pt, u32 data_len, const u8 *aad, u32 aad_len,
+		  const u8 *nonce, const u8 *ect, const u8 *etag)
+{
+  u8 ct[INC_TEST_BYTES], dec[INC_TEST_BYTES], tag[16];
+
+  aes_gcm_siv (pt, ct, aad, nonce, tag, data_len, aad_len, kd, ks, 1);
+  if (memcmp (etag, tag, 16) || (data_len && memcmp (ect, ct, data_len)))
+    return 1;
+
+  if (!aes_gcm_siv (ect, dec, aad, nonce, tag, data_len, aad_len, kd, ks, 0) ||
+      (data_len && memcmp (pt, dec, data_len)))
+    return 2;
+
+  /* tampered tag must fail */
+  tag[0] ^= 1;
+  if (aes_gcm_siv (ect, dec, aad, nonce, tag, data_len, aad_len, kd, ks, 0))
+    return 3;
+
+  return 0;
+}
+
+#define test_clib_aesXXX_gcm_siv(a)                                           \
+  static clib_error_t *test_clib_aes##a##_gcm_siv (clib_error_t *err)         \
+  {                                                                           \
+    aes_gcm_siv_key_data_t kd;                                                \
+    u8 key[32], nonce[12], aad[INC_AAD_BYTES], pt[INC_TEST_BYTES];            \
+    static char *errs[] = { 0, "invalid ciphertext or tag",                   \
+			    "decryption failed", "tampered tag accepted" };   \
+    int rv;                                                                   \
+                                                                              \
+    clib_aes_gcm_siv_key_expand (&kd, rfc8452_key##a, AES_KEY_##a);           \
+    FOREACH_ARRAY_ELT (tc, test_cases##a)                                     \
+      {                                                                       \
+	rv = test_gcm_siv_one (&kd, AES_KEY_##a, tc->pt, tc->data_len,        \
+			       tc->aad, tc->aad_len, rfc8452_nonce, tc->ct,   \
+			       tc->tag);                                      \
+	if (rv)                                                               \
+	  return clib_error_return (err, "%s: %s", tc->name, errs[rv]);       \
+      }                                                                       \
+                                                                              \
+    for (int i = 0; i < sizeof (key); i++)                                    \
+      key[i] = i;                                                             \
+    for (int i = 0; i < sizeof (nonce); i++)                                  \
+      nonce[i] = 0x40 + i;                                                    \
+    for (int i = 0; i < sizeof (aad); i++)                                    \
+      aad[i] = 0x80 + i;                                                      \
+    for (int i = 0; i < sizeof (pt); i++)                                     \
+      pt[i] = i;                                                              \
+                                                                              \
+    clib_aes_gcm_siv_key_expand (&kd, key, AES_KEY_##a);                      \
+    rv = test_gcm_siv_one (&kd, AES_KEY_##a, pt, INC_TEST_BYTES, aad,         \
+			   INC_AAD_BYTES, nonce, inc_ct##a, inc_tag##a);      \
+    if (rv)                                                                   \
+      return clib_error_return (err, "incremental test: %s", errs[rv]);       \
+                                                                              \
+    return err;                                                               \
+  }
+
+#define perftest_aesXXX_enc_var_sz(a)                                         \
+  void __test_perf_fn perftest_aes##a##_enc_var_sz (test_perf_t *tp)          \
+  {                                                                           \
+    u32 n = tp->n_ops;                                                        \
+    aes_gcm_siv_key_data_t *kd = test_mem_alloc (sizeof (*kd));               \
+    u8 *dst = test_mem_alloc (n + 16);                                        \
+    u8 *src = test_mem_alloc_and_fill_inc_u8 (n + 16, 0, 0);                  \
+    u8 *tag = test_mem_alloc (16);                                            \
+    u8 *key = test_mem_alloc_and_fill_inc_u8 (32, 192, 0);                    \
+    u8 *nonce = test_mem_alloc_and_fill_inc_u8 (12, 128, 0);                  \
+                                                                              \
+    clib_aes_gcm_siv_key_expand (kd, key, AES_KEY_##a);                       \
+                                                                              \
+    test_perf_event_enable (tp);                                              \
+    clib_aes##a##_gcm_siv_enc (kd, src, n, 0, 0, nonce, dst, tag);            \
+    test_perf_event_disable (tp);                                             \
+  }
+
+#define perftest_aesXXX_dec_var_sz(a)                                         \
+  void __test_perf_fn perftest_aes##a##_dec_var_sz (test_perf_t *tp)          \
+  {                                                                           \
+    u32 n = tp->n_ops;                                                        \
+    aes_gcm_siv_key_data_t *kd = test_mem_alloc (sizeof (*kd));               \
+    u8 *dst = test_mem_alloc (n + 16);                                        \
+    u8 *src = test_mem_alloc_and_fill_inc_u8 (n + 16, 0, 0);                  \
+    u8 *tag = test_mem_alloc (16);                                            \
+    u8 *key = test_mem_alloc_and_fill_inc_u8 (32, 192, 0);                    \
+    u8 *nonce = test_mem_alloc_and_fill_inc_u8 (12, 128, 0);                  \
+    int *rv = test_mem_alloc (16);                                            \
+                                                                              \
+    clib_aes_gcm_siv_key_expand (kd, key, AES_KEY_##a);                       \
+    clib_aes##a##_gcm_siv_enc (kd, src, n, 0, 0, nonce, dst, tag);            \
+                                                                              \
+    test_perf_event_enable (tp);                                              \
+    rv[0] = clib_aes##a##_gcm_siv_dec (kd, dst, n, 0, 0, nonce, tag, src);    \
+    test_perf_event_disable (tp);                                             \
+  }
+
+test_clib_aesXXX_gcm_siv (128);
+perftest_aesXXX_enc_var_sz (128);
+perftest_aesXXX_dec_var_sz (128);
+REGISTER_TEST (clib_aes128_gcm_siv) = {
+  .name = "clib_aes128_gcm_siv",
+  .fn = test_clib_aes128_gcm_siv,
+  .perf_tests = PERF_TESTS ({ .name = "encrypt variable size (per byte)",
+			      .n_ops = 1424,
+			      .fn = perftest_aes128_enc_var_sz },
+			    { .name = "encrypt variable size (per byte)",
+			      .n_ops = 1 << 20,
+			      .fn = perftest_aes128_enc_var_sz },
+			    { .name = "decrypt variable size (per byte)",
+			      .n_ops = 1424,
+			      .fn = perftest_aes128_dec_var_sz },
+			    { .name = "decrypt variable size (per byte)",
+			      .n_ops = 1 << 20,
+			      .fn = perftest_aes128_dec_var_sz }),
+};
+
+test_clib_aesXXX_gcm_siv (256);
+perftest_aesXXX_enc_var_sz (256);
+perftest_aesXXX_dec_var_sz (256);
+REGISTER_TEST (clib_aes256_gcm_siv) = {
+  .name = "clib_aes256_gcm_siv",
+  .fn = test_clib_aes256_gcm_siv,
+  .perf_tests = PERF_TESTS ({ .name = "encrypt variable size (per byte)",
+			      .n_ops = 1424,
+			      .fn = perftest_aes256_enc_var_sz },
+			    { .name = "encrypt variable size (per byte)",
+			      .n_ops = 1 << 20,
+			      .fn = perftest_aes256_enc_var_sz },
+			    { .name = "decrypt variable size (per byte)",
+			      .n_ops = 1424,
+			      .fn = perftest_aes256_dec_var_sz },
+			    { .name = "decrypt variable size (per byte)",
+			      .n_ops = 1 << 20,
+			      .fn = perftest_aes256_dec_var_sz }),
+};
+
+#endif
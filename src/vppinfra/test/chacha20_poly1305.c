@@ -0,0 +1,435 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright(c) 2025 Cisco Systems, Inc.
+ */
+
+#include <vppinfra/format.h>
+#include <vppinfra/test/test.h>
+#include <vppinfra/crypto/chacha20_poly1305.h>
+
+static const u8 sunscreen[114] =
+  "Ladies and Gentlemen of the class of '99: If I could offer you only one "
+  "tip for the future, sunscreen would be it.";
+
+/* RFC8439 2.4.2 */
+static const u8 chacha20_tc1_key[32] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+  0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+  0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+
+static const u8 chacha20_tc1_nonce[12] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+					    0x00, 0x4a, 0x00, 0x00, 0x00, 0x00 };
+
+static const u8 chacha20_tc1_ct[114] = {
+  0x6e, 0x2e, 0x35, 0x9a, 0x25, 0x68, 0xf9, 0x80, 0x41, 0xba, 0x07, 0x28,
+  0xdd, 0x0d, 0x69, 0x81, 0xe9, 0x7e, 0x7a, 0xec, 0x1d, 0x43, 0x60, 0xc2,
+  0x0a, 0x27, 0xaf, 0xcc, 0xfd, 0x9f, 0xae, 0x0b, 0xf9, 0x1b, 0x65, 0xc5,
+  0x52, 0x47, 0x33, 0xab, 0x8f, 0x59, 0x3d, 0xab, 0xcd, 0x62, 0xb3, 0x57,
+  0x16, 0x39, 0xd6, 0x24, 0xe6, 0x51, 0x52, 0xab, 0x8f, 0x53, 0x0c, 0x35,
+  0x9f, 0x08, 0x61, 0xd8, 0x07, 0xca, 0x0d, 0xbf, 0x50, 0x0d, 0x6a, 0x61,
+  0x56, 0xa3, 0x8e, 0x08, 0x8a, 0x22, 0xb6, 0x5e, 0x52, 0xbc, 0x51, 0x4d,
+  0x16, 0xcc, 0xf8, 0x06, 0x81, 0x8c, 0xe9, 0x1a, 0xb7, 0x79, 0x37, 0x36,
+  0x5a, 0xf9, 0x0b, 0xbf, 0x74, 0xa3, 0x5b, 0xe6, 0xb4, 0x0b, 0x8e, 0xed,
+  0xf2, 0x78, 0x5e, 0x42, 0x87, 0x4d,
+};
+
+/* RFC8439 2.8.2 */
+static const u8 tc1_key[32] = {
+  0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
+  0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95,
+  0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f
+};
+
+static const u8 tc1_iv[12] = { 0x07, 0x00, 0x00, 0x00, 0x40, 0x41,
+				0x42, 0x43, 0x44, 0x45, 0x46, 0x47 };
+
+static const u8 tc1_aad[12] = { 0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1,
+				 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7 };
+
+static const u8 tc1_ct[114] = {
+  0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb, 0x7b, 0x86, 0xaf, 0xbc,
+  0x53, 0xef, 0x7e, 0xc2, 0xa4, 0xad, 0xed, 0x51, 0x29, 0x6e, 0x08, 0xfe,
+  0xa9, 0xe2, 0xb5, 0xa7, 0x36, 0xee, 0x62, 0xd6, 0x3d, 0xbe, 0xa4, 0x5e,
+  0x8c, 0xa9, 0x67, 0x12, 0x82, 0xfa, 0xfb, 0x69, 0xda, 0x92, 0x72, 0x8b,
+  0x1a, 0x71, 0xde, 0x0a, 0x9e, 0x06, 0x0b, 0x29, 0x05, 0xd6, 0xa5, 0xb6,
+  0x7e, 0xcd, 0x3b, 0x36, 0x92, 0xdd, 0xbd, 0x7f, 0x2d, 0x77, 0x8b, 0x8c,
+  0x98, 0x03, 0xae, 0xe3, 0x28, 0x09, 0x1b, 0x58, 0xfa, 0xb3, 0x24, 0xe4,
+  0xfa, 0xd6, 0x75, 0x94, 0x55, 0x85, 0x80, 0x8b, 0x48, 0x31, 0xd7, 0xbc,
+  0x3f, 0xf4, 0xde, 0xf0, 0x8e, 0x4b, 0x7a, 0x9d, 0xe5, 0x76, 0xd2, 0x65,
+  0x86, 0xce, 0xc6, 0x4b, 0x61, 0x16
+};
+
+static const u8 tc1_tag[16] = { 0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09,
+				 0xe2, 0x6a, 0x7e, 0x90, 0x2e, 0xcb,
+				 0xd0, 0x60, 0x06, 0x91 };
+
+/* generated with OpenSSL, key[i] = 0xa0 + i, iv[i] = 0x10 + i,
+ * aad[i] = 0xf0 ^ i, pt[i] = i * 7 + 3 */
+static const u8 tc2_ct[517] = {
+  0x94, 0x08, 0xa9, 0x69, 0xad, 0x7a, 0x44, 0x81, 0x54, 0xbb, 0x1b, 0xac,
+  0x45, 0x3e, 0x54, 0xa1, 0xef, 0x47, 0xa1, 0xe5, 0x34, 0xca, 0x6b, 0xd9,
+  0xa9, 0x33, 0x74, 0x27, 0xfd, 0xad, 0x86, 0x32, 0x57, 0x5c, 0xf7, 0x2f,
+  0x11, 0xcc, 0xcf, 0x7e, 0xad, 0x1f, 0xf8, 0x2f, 0x0b, 0xc1, 0xcd, 0xd0,
+  0x75, 0x54, 0xa8, 0x3e, 0xef, 0xdf, 0xb4, 0x6e, 0x00, 0x80, 0x9e, 0x59,
+  0xcd, 0x0b, 0x4f, 0x0b, 0xb0, 0xdb, 0xc7, 0xc8, 0x5d, 0xbc, 0xc0, 0xf3,
+  0x4c, 0xf9, 0xea, 0xe3, 0x52, 0x79, 0xf0, 0x13, 0xa6, 0x5f, 0x4b, 0x23,
+  0x34, 0xea, 0xff, 0x14, 0x69, 0x53, 0x94, 0x43, 0xca, 0x15, 0x60, 0xb0,
+  0x6a, 0xb4, 0x31, 0x9c, 0xe3, 0x0b, 0x31, 0xff, 0x97, 0x1a, 0x70, 0x30,
+  0xee, 0x57, 0x57, 0x5e, 0xde, 0xd3, 0x0e, 0x65, 0x17, 0x1e, 0xa6, 0x35,
+  0xc3, 0x33, 0xbb, 0xdc, 0xe5, 0x89, 0x5c, 0x7e, 0xae, 0xd3, 0xa9, 0x63,
+  0xd7, 0x76, 0x33, 0x60, 0x7d, 0x32, 0xf7, 0x0a, 0x47, 0xc4, 0x96, 0x27,
+  0xc6, 0xc1, 0x29, 0x29, 0xb0, 0x7d, 0x69, 0x77, 0xa7, 0x87, 0x05, 0x4e,
+  0x33, 0xef, 0x93, 0xfc, 0x4f, 0xb8, 0xae, 0x95, 0x16, 0xc8, 0xcf, 0x07,
+  0x11, 0xd9, 0x22, 0xa8, 0x06, 0xf6, 0xd7, 0xf9, 0xc2, 0x67, 0x50, 0x3d,
+  0xce, 0xf7, 0x91, 0x86, 0xc6, 0x93, 0x1e, 0x54, 0x67, 0x89, 0xbb, 0xe8,
+  0x3c, 0x0f, 0x42, 0xd9, 0xb7, 0x38, 0x89, 0xa3, 0xf1, 0x5b, 0x5f, 0x35,
+  0xad, 0x17, 0x44, 0x2a, 0xdc, 0x8f, 0x3a, 0x13, 0x7b, 0x02, 0x15, 0x17,
+  0x05, 0xe3, 0x9d, 0xda, 0x42, 0x2b, 0x5d, 0x60, 0x5c, 0xbe, 0x01, 0x8d,
+  0xf1, 0xa6, 0x30, 0x19, 0x6c, 0xb3, 0x38, 0xdf, 0xba, 0x55, 0x22, 0xa6,
+  0x34, 0xf9, 0x7d, 0x35, 0x5c, 0x66, 0x5c, 0x02, 0xaa, 0x1c, 0x28, 0xf1,
+  0x17, 0xaa, 0x7a, 0x8f, 0xe2, 0xb0, 0xcc, 0xee, 0x64, 0xd9, 0xc8, 0x46,
+  0x6d, 0xce, 0x45, 0x8f, 0x51, 0x21, 0xda, 0x36, 0xcd, 0x33, 0x43, 0x13,
+  0x3f, 0x1e, 0x07, 0x5e, 0xb0, 0xd2, 0x73, 0xf4, 0xf6, 0x77, 0x57, 0x5a,
+  0x9e, 0x15, 0x90, 0xea, 0x4b, 0xe6, 0x1d, 0x70, 0x29, 0x52, 0xe3, 0x8d,
+  0xe4, 0x23, 0x21, 0x85, 0x7c, 0x20, 0x3f, 0x26, 0x5d, 0xcf, 0x6f, 0x70,
+  0x52, 0x2a, 0x3e, 0xd7, 0xe4, 0xe5, 0x10, 0xdd, 0x2c, 0x6f, 0x3c, 0x73,
+  0xdf, 0x31, 0x97, 0x49, 0x3c, 0x71, 0x8c, 0x08, 0xbd, 0x7f, 0x1c, 0x13,
+  0x3b, 0x94, 0x02, 0x21, 0xc2, 0xc6, 0xdf, 0xfb, 0xa3, 0x05, 0x01, 0x77,
+  0x9a, 0x0d, 0x8c, 0x02, 0x16, 0x3d, 0x36, 0x0a, 0x88, 0x60, 0x55, 0x0a,
+  0x3c, 0xdd, 0x22, 0x5d, 0x86, 0x86, 0x96, 0xd2, 0xc4, 0xc9, 0x97, 0xbb,
+  0xff, 0x2e, 0x0b, 0x21, 0xfc, 0x0f, 0x99, 0x95, 0x99, 0x15, 0xd4, 0x25,
+  0x91, 0x88, 0x25, 0xe5, 0x17, 0xf5, 0x12, 0x29, 0x31, 0x3d, 0xf0, 0x75,
+  0xa7, 0x0d, 0x66, 0xfb, 0x1b, 0x2d, 0x7b, 0x96, 0xa6, 0xcb, 0x26, 0x00,
+  0x6b, 0xc3, 0x96, 0x71, 0x2c, 0x27, 0x25, 0xec, 0x8e, 0x3c, 0x21, 0xd9,
+  0xe2, 0x0d, 0x3d, 0xb9, 0xda, 0x63, 0xe9, 0x1d, 0xb5, 0xfd, 0xe8, 0x98,
+  0x4b, 0x2c, 0xae, 0xaf, 0x6d, 0xa2, 0xa3, 0xc7, 0x6d, 0x2f, 0xca, 0xca,
+  0x73, 0xbb, 0x1a, 0xca, 0x65, 0xce, 0x85, 0xf0, 0x33, 0x1d, 0x03, 0x2a,
+  0x6a, 0xf7, 0xae, 0x07, 0x92, 0xd2, 0x7e, 0xa2, 0xf5, 0x1d, 0x1b, 0xf7,
+  0x6a, 0x29, 0xcc, 0xdb, 0xe9, 0x30, 0x3b, 0x92, 0xa0, 0x60, 0xfe, 0xc2,
+  0x2f, 0xfb, 0x75, 0xde, 0xca, 0x23, 0x59, 0x54, 0x34, 0xac, 0xd8, 0x92,
+  0xfc, 0x0c, 0xe7, 0xaa, 0x5c, 0x8d, 0x75, 0x2b, 0x79, 0x77, 0x95, 0x9b,
+  0x25, 0x0c, 0x8a, 0xe4, 0x9a, 0x89, 0x73, 0xc5, 0xe6, 0xde, 0xf1, 0x79,
+  0x7a,
+};
+
+static const u8 tc2_tag[16] = {
+  0x75, 0xfa, 0x4c, 0x93, 0x7a, 0x94, 0x01, 0xf9, 0x7c, 0x47, 0xbf, 0x62,
+  0x99, 0x70, 0x6c, 0x5d,
+};
+
+static const struct
+{
+  char *name;
+  const u8 *key, *iv, *aad, *pt, *ct, *tag;
+  u32 data_len, aad_len;
+} test_cases[] = {
+  { .name = "RFC8439 2.8.2",
+    .key = tc1_key,
+    .iv = tc1_iv,
+    .aad = tc1_aad,
+    .aad_len = sizeof (tc1_aad),
+    .pt = sunscreen,
+    .ct = tc1_ct,
+    .tag = tc1_tag,
+    .data_len = sizeof (tc1_ct) },
+  { .name = "OpenSSL 517 bytes",
+    .key = (const u8[32]){ 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+			   0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+			   0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+			   0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf },
+    .iv = (const u8[12]){ 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+			  0x18, 0x19, 0x1a, 0x1b },
+    .aad = (const u8[13]){ 0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+			   0xf8, 0xf9, 0xfa, 0xfb, 0xfc },
+    .aad_len = 13,
+    .ct = tc2_ct,
+    .tag = tc2_tag,
+    .data_len = sizeof (tc2_ct) },
+};
+
+static clib_error_t *
+test_clib_chacha20 (clib_error_t *err)
+{
+  clib_chacha20_key_t kd;
+  clib_chacha20_ctx_t ctx;
+  u8 ct[sizeof (sunscreen)];
+  u32 chunks[] = { 1, 7, 63, 20 }, off = 0;
+
+  clib_chacha20_key_init (&kd, chacha20_tc1_key);
+  clib_chacha20 (&kd, chacha20_tc1_nonce, 1, sunscreen, ct, sizeof (ct));
+
+  if (memcmp (ct, chacha20_tc1_ct, sizeof (ct)))
+    return clib_error_return (err,
+			      "RFC8439 2.4.2 ciphertext mismatch"
+			      "\nexp: %U\ncalc: %U",
+			      format_hexdump, chacha20_tc1_ct, sizeof (ct),
+			      format_hexdump, ct, sizeof (ct));
+
+  /* same data split into odd sized chunks */
+  clib_memset_u8 (ct, 0, sizeof (ct));
+  clib_chacha20_init (&ctx, &kd, chacha20_tc1_nonce, 1);
+  FOREACH_ARRAY_ELT (c, chunks)
+    {
+      clib_chacha20_transform (&ctx, sunscreen + off, ct + off, *c);
+      off += *c;
+    }
+  clib_chacha20_transform (&ctx, sunscreen + off, ct + off,
+			   sizeof (ct) - off);
+
+  if (memcmp (ct, chacha20_tc1_ct, sizeof (ct)))
+    err = clib_error_return (err, "RFC8439 2.4.2 chunked ciphertext mismatch"
+				  "\nexp: %U\ncalc: %U",
+			     format_hexdump, chacha20_tc1_ct, sizeof (ct),
+			     format_hexdump, ct, sizeof (ct));
+  return err;
+}
+
+void __test_perf_fn
+perftest_chacha20_byte (test_perf_t *tp)
+{
+  u32 n = tp->n_ops;
+  u8 *dst = test_mem_alloc (n);
+  u8 *src = test_mem_alloc_and_fill_inc_u8 (n, 0, 0);
+  u8 *key = test_mem_alloc_and_fill_inc_u8 (32, 192, 0);
+  u8 *nonce = test_mem_alloc_and_fill_inc_u8 (12, 0, 0);
+  clib_chacha20_key_t kd;
+
+  clib_chacha20_key_init (&kd, key);
+
+  test_perf_event_enable (tp);
+  clib_chacha20 (&kd, nonce, 0, src, dst, n);
+  test_perf_event_disable (tp);
+}
+
+REGISTER_TEST (clib_chacha20) = {
+  .name = "clib_chacha20",
+  .fn = test_clib_chacha20,
+  .perf_tests = PERF_TESTS ({ .name = "variable size (per byte)",
+			      .n_ops = 1424,
+			      .fn = perftest_chacha20_byte },
+			    { .name = "variable size (per byte)",
+			      .n_ops = 1 << 20,
+			      .fn = perftest_chacha20_byte }),
+};
+
+static clib_error_t *
+test_clib_chacha20_poly1305 (clib_error_t *err)
+{
+  clib_chacha20_poly1305_ctx_t ctx;
+  clib_chacha20_key_t kd;
+  u8 pt[1024], buf[1024], tag[16];
+
+  FOREACH_ARRAY_ELT (tc, test_cases)
+    {
+      const u8 *p = tc->pt;
+      u32 len = tc->data_len, off;
+
+      if (p == 0)
+	{
+	  for (u32 i = 0; i < len; i++)
+	    pt[i] = i * 7 + 3;
+	  p = pt;
+	}
+
+      clib_chacha20_key_init (&kd, tc->key);
+
+      clib_chacha20_poly1305 (&kd, tc->iv, tc->aad, tc->aad_len, p, buf, len,
+			      tag, 16, CHACHA20_POLY1305_OP_ENCRYPT);
+
+      if (memcmp (buf, tc->ct, len))
+	err = clib_error_return (err, "%s: ciphertext mismatch\nexp: %U\ncalc: %U",
+				 tc->name, format_hexdump, tc->ct, len,
+				 format_hexdump, buf, len);
+      if (memcmp (tag, tc->tag, 16))
+	err = clib_error_return (err, "%s: tag mismatch\nexp: %U\ncalc: %U",
+				 tc->name, format_hexdump, tc->tag, 16,
+				 format_hexdump, tag, 16);
+
+      /* in-place decrypt */
+      clib_memcpy_fast (tag, tc->tag, 16);
+      if (!clib_chacha20_poly1305 (&kd, tc->iv, tc->aad, tc->aad_len, buf,
+				   buf, len, tag, 16,
+				   CHACHA20_POLY1305_OP_DECRYPT))
+	err = clib_error_return (err, "%s: decrypt tag check failed",
+				 tc->name);
+      if (memcmp (buf, p, len))
+	err = clib_error_return (err, "%s: decrypted data mismatch",
+				 tc->name);
+
+      /* corrupted tag must be detected */
+      clib_memcpy_fast (buf, tc->ct, len);
+      tag[15] ^= 1;
+      if (clib_chacha20_poly1305 (&kd, tc->iv, tc->aad, tc->aad_len, buf,
+				  buf, len, tag, 16,
+				  CHACHA20_POLY1305_OP_DECRYPT))
+	err = clib_error_return (err, "%s: bad tag not detected", tc->name);
+
+      /* streaming API with odd chunk sizes */
+      clib_chacha20_poly1305_init (&ctx, &kd, tc->iv, tc->aad, tc->aad_len);
+      for (off = 0; off < len; off += 37)
+	clib_chacha20_poly1305_update (&ctx, p + off, buf + off,
+				       clib_min (37, len - off),
+				       CHACHA20_POLY1305_OP_ENCRYPT);
+      clib_chacha20_poly1305_final (&ctx, tag);
+
+      if (memcmp (buf, tc->ct, len) || memcmp (tag, tc->tag, 16))
+	err = clib_error_return (err, "%s: chunked encrypt mismatch",
+				 tc->name);
+    }
+
+  return err;
+}
+
+static clib_error_t *
+test_clib_chacha20_poly1305_multi (clib_error_t *err)
+{
+  clib_chacha20_poly1305_op_t ops[48];
+  clib_chacha20_poly1305_ctx_t ctx;
+  clib_chacha20_key_t kd[4];
+  u8 *pt = test_mem_alloc_and_fill_inc_u8 (ARRAY_LEN (ops) * 512, 0, 0);
+  u8 *ct = test_mem_alloc (ARRAY_LEN (ops) * 512);
+  u8 *tags = test_mem_alloc (ARRAY_LEN (ops) * 16);
+  u8 *aad = test_mem_alloc_and_fill_inc_u8 (32, 0x40, 0);
+  u8 *key = test_mem_alloc_and_fill_inc_u8 (4 * 32, 0x10, 0);
+  u8 *iv = test_mem_alloc_and_fill_inc_u8 (12 + ARRAY_LEN (ops), 0x80, 0);
+  u8 buf[512], tag[16];
+  u32 n_fail;
+
+  for (int i = 0; i < ARRAY_LEN (kd); i++)
+    clib_chacha20_key_init (kd + i, key + 32 * i);
+
+  /* ops with mixed keys, nonces, lengths and aad lengths, so lanes of
+   * single batch carry blocks of different ops */
+  for (int i = 0; i < ARRAY_LEN (ops); i++)
+    ops[i] = (clib_chacha20_poly1305_op_t){
+      .key = kd + (i & 3),
+      .iv = iv + i,
+      .aad = aad,
+      .aad_len = (i * 5) % 17,
+      .src = pt + i * 512,
+      .dst = ct + i * 512,
+      .len = (i * 97) % 513,
+      .tag = tags + i * 16,
+      .tag_len = 16,
+    };
+
+  clib_chacha20_poly1305_ops (ops, ARRAY_LEN (ops),
+			      CHACHA20_POLY1305_OP_ENCRYPT);
+
+  /* verify each against streaming API */
+  for (int i = 0; i < ARRAY_LEN (ops); i++)
+    {
+      clib_chacha20_poly1305_op_t *op = ops + i;
+      clib_chacha20_poly1305_init (&ctx, op->key, op->iv, op->aad,
+				   op->aad_len);
+      clib_chacha20_poly1305_update (&ctx, op->src, buf, op->len,
+				     CHACHA20_POLY1305_OP_ENCRYPT);
+      clib_chacha20_poly1305_final (&ctx, tag);
+      if (memcmp (buf, op->dst, op->len) || memcmp (tag, op->tag, 16))
+	err = clib_error_return (err, "op %u (len %u) mismatch", i, op->len);
+    }
+
+  /* in-place multi-buffer decrypt, with one corrupted tag */
+  for (int i = 0; i < ARRAY_LEN (ops); i++)
+    ops[i].src = ops[i].dst;
+  ops[7].tag[0] ^= 0xff;
+
+  n_fail = clib_chacha20_poly1305_ops (ops, ARRAY_LEN (ops),
+				       CHACHA20_POLY1305_OP_DECRYPT);
+
+  if (n_fail != 1 || ops[7].bad_tag == 0)
+    err = clib_error_return (err, "expected 1 failed op, got %u", n_fail);
+
+  for (int i = 0; i < ARRAY_LEN (ops); i++)
+    if (memcmp (ops[i].dst, pt + i * 512, ops[i].len))
+      err = clib_error_return (err, "op %u decrypted data mismatch", i);
+
+  return err;
+}
+
+void __test_perf_fn
+perftest_byte (test_perf_t *tp)
+{
+  u32 n = tp->n_ops;
+  u8 *dst = test_mem_alloc (n);
+  u8 *src = test_mem_alloc_and_fill_inc_u8 (n, 0, 0);
+  u8 *key = test_mem_alloc_and_fill_inc_u8 (32, 192, 0);
+  u8 *iv = test_mem_alloc_and_fill_inc_u8 (12, 0, 0);
+  u8 *aad = test_mem_alloc_and_fill_inc_u8 (8, 0, 0);
+  u8 *tag = test_mem_alloc (16);
+  clib_chacha20_key_t kd;
+
+  clib_chacha20_key_init (&kd, key);
+
+  test_perf_event_enable (tp);
+  clib_chacha20_poly1305 (&kd, iv, aad, 8, src, dst, n, tag, 16,
+			  CHACHA20_POLY1305_OP_ENCRYPT);
+  test_perf_event_disable (tp);
+}
+
+static_always_inline void
+perftest_multi (test_perf_t *tp, u32 len)
+{
+  u32 n = tp->n_ops;
+  clib_chacha20_poly1305_op_t *ops = test_mem_alloc (n * sizeof (ops[0]));
+  u8 *dst = test_mem_alloc (n * len);
+  u8 *src = test_mem_alloc_and_fill_inc_u8 (n * len, 0, 0);
+  u8 *key = test_mem_alloc_and_fill_inc_u8 (32, 192, 0);
+  u8 *iv = test_mem_alloc_and_fill_inc_u8 (12 + n, 0, 0);
+  u8 *aad = test_mem_alloc_and_fill_inc_u8 (8, 0, 0);
+  u8 *tags = test_mem_alloc (16 * n);
+  clib_chacha20_key_t kd;
+
+  clib_chacha20_key_init (&kd, key);
+
+  for (u32 i = 0; i < n; i++)
+    ops[i] = (clib_chacha20_poly1305_op_t){
+      .key = &kd,
+      .iv = iv + i,
+      .aad = aad,
+      .aad_len = 8,
+      .src = src + i * len,
+      .dst = dst + i * len,
+      .len = len,
+      .tag = tags + i * 16,
+      .tag_len = 16,
+    };
+
+  test_perf_event_enable (tp);
+  clib_chacha20_poly1305_ops (ops, n, CHACHA20_POLY1305_OP_ENCRYPT);
+  test_perf_event_disable (tp);
+}
+
+void __test_perf_fn
+perftest_multi_64 (test_perf_t *tp)
+{
+  perftest_multi (tp, 64);
+}
+
+void __test_perf_fn
+perftest_multi_1424 (test_perf_t *tp)
+{
+  perftest_multi (tp, 1424);
+}
+
+REGISTER_TEST (clib_chacha20_poly1305) = {
+  .name = "clib_chacha20_poly1305",
+  .fn = test_clib_chacha20_poly1305,
+  .perf_tests = PERF_TESTS ({ .name = "variable size (per byte)",
+			      .n_ops = 1424,
+			      .fn = perftest_byte },
+			    { .name = "variable size (per byte)",
+			      .n_ops = 1 << 20,
+			      .fn = perftest_byte }),
+};
+
+REGISTER_TEST (clib_chacha20_poly1305_multi) = {
+  .name = "clib_chacha20_poly1305_multi",
+  .fn = test_clib_chacha20_poly1305_multi,
+  .perf_tests = PERF_TESTS ({ .name = "multi-buffer 64 byte (per op)",
+			      .n_ops = 256,
+			      .fn = perftest_multi_64 },
+			    { .name = "multi-buffer 1424 byte (per op)",
+			      .n_ops = 256,
+			      .fn = perftest_multi_1424 }),
+};
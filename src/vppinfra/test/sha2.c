@@ -320,3 +320,97 @@ _ (256);
 _ (384);
 _ (512);
 #undef _
+
+#ifdef CLIB_SHA256_MB_N_LANES
+#define _(bits)                                                               \
+  static clib_error_t *test_clib_hmac_sha##bits##_mb (clib_error_t *err)      \
+  {                                                                           \
+    const sha2_test_t *t;                                                     \
+    clib_sha2_hmac_key_data_t kd[8];                                          \
+    clib_sha2_hmac_mb_op_t ops[300];                                          \
+    u8 digest[300][32], expected[32];                                         \
+    u8 *data = test_mem_alloc_and_fill_inc_u8 (512, 0, 0);                    \
+    u32 n = 0;                                                                \
+                                                                              \
+    for (t = sha2_tests; t->key; t++, n++)                                    \
+      {                                                                       \
+	clib_sha2_hmac_key_data (CLIB_SHA2_##bits, t->key, t->key_len,        \
+				 kd + n);                                     \
+	ops[n] = (clib_sha2_hmac_mb_op_t){                                    \
+	  .kd = kd + n, .src = t->msg, .len = t->msg_len, .digest = digest[n] \
+	};                                                                    \
+      }                                                                       \
+                                                                              \
+    clib_sha2_hmac_mb (CLIB_SHA2_##bits, ops, n);                             \
+                                                                              \
+    for (t = sha2_tests, n = 0; t->key; t++, n++)                             \
+      {                                                                       \
+	u8 digest_len = t->digest_##bits##_len;                               \
+	if (digest_len == 0)                                                  \
+	  digest_len = sizeof (t->digest_##bits);                             \
+	if ((err = check_digest (err, t->tc, digest[n], t->digest_##bits,     \
+				 digest_len)))                                \
+	  return err;                                                         \
+      }                                                                       \
+                                                                              \
+    /* ops of different length and keys sharing lanes */                      \
+    for (n = 0; n < ARRAY_LEN (ops); n++)                                     \
+      ops[n] = (clib_sha2_hmac_mb_op_t){                                      \
+	.kd = kd + n % 7,                                                     \
+	.src = data + n % 13,                                                 \
+	.len = (n * 7) % 300,                                                 \
+	.digest = digest[n],                                                  \
+      };                                                                      \
+                                                                              \
+    clib_sha2_hmac_mb (CLIB_SHA2_##bits, ops, ARRAY_LEN (ops));               \
+                                                                              \
+    for (n = 0; n < ARRAY_LEN (ops); n++)                                     \
+      {                                                                       \
+	t = sha2_tests + n % 7;                                               \
+	clib_hmac_sha##bits (t->key, t->key_len, ops[n].src, ops[n].len,      \
+			     expected);                                       \
+	if ((err = check_digest (err, n, digest[n], expected, bits / 8)))     \
+	  return err;                                                         \
+      }                                                                       \
+                                                                              \
+    return err;                                                               \
+  }                                                                           \
+                                                                              \
+  void __test_perf_fn perftest_sha##bits##_mb (test_perf_t *tp)               \
+  {                                                                           \
+    u32 n = tp->n_ops, len = tp->arg0;                                        \
+    clib_sha2_hmac_key_data_t kd;                                             \
+    clib_sha2_hmac_mb_op_t *ops = test_mem_alloc (n * sizeof (ops[0]));       \
+    u8 *key = test_mem_alloc_and_fill_inc_u8 (20, 32, 0);                     \
+    u8 *data = test_mem_alloc_and_fill_inc_u8 (n * len, 0, 0);                \
+    u8 *digest = test_mem_alloc (n * 32);                                     \
+                                                                              \
+    clib_sha2_hmac_key_data (CLIB_SHA2_##bits, key, 20, &kd);                 \
+    for (u32 i = 0; i < n; i++)                                               \
+      ops[i] = (clib_sha2_hmac_mb_op_t){ .kd = &kd,                           \
+					 .src = data + i * len,               \
+					 .len = len,                          \
+					 .digest = digest + i * 32 };         \
+                                                                              \
+    test_perf_event_enable (tp);                                              \
+    clib_sha2_hmac_mb (CLIB_SHA2_##bits, ops, n);                             \
+    test_perf_event_disable (tp);                                             \
+  }                                                                           \
+                                                                              \
+  REGISTER_TEST (clib_hmac_sha##bits##_mb) = {                                \
+    .name = "clib_hmac_sha" #bits "_mb",                                      \
+    .fn = test_clib_hmac_sha##bits##_mb,                                      \
+    .perf_tests = PERF_TESTS ({ .name = "64B packets",                        \
+				.n_ops = 1024,                                \
+				.arg0 = 64,                                   \
+				.fn = perftest_sha##bits##_mb },              \
+			      { .name = "1408B packets",                      \
+				.n_ops = 1024,                                \
+				.arg0 = 1408,                                 \
+				.fn = perftest_sha##bits##_mb })              \
+  }
+
+_ (224);
+_ (256);
+#undef _
+#endif
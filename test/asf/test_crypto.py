@@ -24,6 +24,19 @@ class TestCrypto(VppAsfTestCase):
             self.logger.critical(error)
         self.assertNotIn("FAIL", error)
 
+    def test_crypto_perf(self):
+        """Crypto Perf Harness"""
+        reply = self.vapi.cli(
+            "test crypto perf aes-128-gcm buffer-size 64 batch-size 32 "
+            "rounds 2 warmup-rounds 1 simple chained csv"
+        )
+        lines = reply.strip().splitlines()
+
+        self.assertGreater(len(lines), 1)
+        self.assertTrue(lines[0].startswith("engine,alg,op,handler"))
+        for line in lines[1:]:
+            self.assertEqual(int(line.split(",")[-1]), 0)
+
 
 if __name__ == "__main__":
     unittest.main(testRunner=VppTestRunner)
@@ -188,5 +188,133 @@ class TestHttpStaticCli(VppAsfTestCase):
         self.vapi.cli("show http static server sessions")
 
 
+@unittest.skipIf(
+    "http_static" in config.excluded_plugins, "Exclude HTTP Static Server plugin tests"
+)
+@unittest.skipIf(config.skip_netns_tests, "netns not available or disabled from cli")
+class TestHttpStaticCache(VppAsfTestCase):
+    """http static server ranges, etags and mmap-ed cache entries"""
+
+    @classmethod
+    def setUpClass(cls):
+        super(TestHttpStaticCache, cls).setUpClass()
+        cls.temp = tempfile.NamedTemporaryFile()
+        cls.temp.write(b"0123456789abcdefghij")
+        cls.temp.flush()
+
+        # big enough to be mmap-ed
+        cls.temp2 = tempfile.NamedTemporaryFile()
+        cls.temp2.write(b"x" * 8192)
+        cls.temp2.flush()
+
+        cls.ns_history_name = (
+            f"{config.tmp_dir}/{get_testcase_dirname(cls.__name__)}/history_ns.txt"
+        )
+        cls.if_history_name = (
+            f"{config.tmp_dir}/{get_testcase_dirname(cls.__name__)}/history_if.txt"
+        )
+
+        try:
+            delete_all_namespaces(cls.ns_history_name)
+            delete_all_host_interfaces(cls.if_history_name)
+
+            cls.ns_name = create_namespace(cls.ns_history_name)
+            cls.host_if_name, cls.vpp_if_name = create_host_interface(
+                cls.if_history_name, cls.ns_name, "10.10.1.1/24"
+            )
+
+        except Exception as e:
+            cls.logger.warning(f"Unable to complete setup: {e}")
+            raise unittest.SkipTest("Skipping tests due to setup failure.")
+
+        cls.vapi.cli(f"create host-interface name {cls.vpp_if_name}")
+        cls.vapi.cli(f"set int state host-{cls.vpp_if_name} up")
+        cls.vapi.cli(f"set int ip address host-{cls.vpp_if_name} 10.10.1.2/24")
+        cls.vapi.cli(
+            "http static server www-root /tmp uri tcp://0.0.0.0/80 "
+            "cache-size 2m cache-mmap-thresh 4k"
+        )
+
+    @classmethod
+    def tearDownClass(cls):
+        delete_all_namespaces(cls.ns_history_name)
+        delete_all_host_interfaces(cls.if_history_name)
+
+        cls.temp.close()
+        cls.temp2.close()
+        super(TestHttpStaticCache, cls).tearDownClass()
+
+    def curl(self, temp, *args):
+        process = subprocess.run(
+            [
+                "ip",
+                "netns",
+                "exec",
+                self.ns_name,
+                "curl",
+                "-s",
+                "-i",
+                *args,
+                f"10.10.1.2/{temp.name[5:]}",
+            ],
+            capture_output=True,
+        )
+        return process.stdout
+
+    def test_http_static_range(self):
+        """byte ranges"""
+        reply = self.curl(self.temp, "-H", "Range: bytes=2-5")
+        self.assertIn(b"206 Partial Content", reply)
+        self.assertIn(b"Content-Range: bytes 2-5/20", reply)
+        self.assertTrue(reply.endswith(b"\r\n\r\n2345"))
+
+        reply = self.curl(self.temp, "-H", "Range: bytes=-3")
+        self.assertIn(b"206 Partial Content", reply)
+        self.assertTrue(reply.endswith(b"\r\n\r\nhij"))
+
+        reply = self.curl(self.temp, "-H", "Range: bytes=20-")
+        self.assertIn(b"416 Range Not Satisfiable", reply)
+        self.assertIn(b"Content-Range: bytes */20", reply)
+
+        # multiple ranges not supported, whole file is sent
+        reply = self.curl(self.temp, "-H", "Range: bytes=0-1,4-5")
+        self.assertIn(b"200 OK", reply)
+        self.assertTrue(reply.endswith(b"0123456789abcdefghij"))
+
+    def test_http_static_etag(self):
+        """conditional requests"""
+        reply = self.curl(self.temp)
+        self.assertIn(b"200 OK", reply)
+        etag = next(
+            line.split(b":", 1)[1].strip()
+            for line in reply.split(b"\r\n")
+            if line.lower().startswith(b"etag:")
+        )
+
+        reply = self.curl(self.temp, "-H", b"If-None-Match: " + etag)
+        self.assertIn(b"304 Not Modified", reply)
+        self.assertNotIn(b"0123456789", reply)
+
+        reply = self.curl(self.temp, "-H", 'If-None-Match: "0-0"')
+        self.assertIn(b"200 OK", reply)
+
+    def test_http_static_mmap_truncate(self):
+        """mmap-ed file truncated while cached"""
+        reply = self.curl(self.temp2)
+        self.assertIn(b"200 OK", reply)
+        self.assertTrue(reply.endswith(b"x" * 8192))
+
+        # must not fault on pages past the new end of file
+        self.temp2.seek(0)
+        self.temp2.truncate()
+        self.temp2.write(b"short")
+        self.temp2.flush()
+
+        reply = self.curl(self.temp2)
+        self.assertIn(b"200 OK", reply)
+        self.assertTrue(reply.endswith(b"\r\n\r\nshort"))
+        self.vapi.cli("show http static server cache")
+
+
 if __name__ == "__main__":
     unittest.main(testRunner=VppTestRunner)
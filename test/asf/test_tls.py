@@ -156,5 +156,186 @@ class TestTLS(VppAsfTestCase):
         ip_t10.remove_vpp_config()
 
 
+class TLSEchoTestCase(VppAsfTestCase):
+    """TLS echo client/server between two app namespaces"""
+
+    @classmethod
+    def setUpClass(cls):
+        super(TLSEchoTestCase, cls).setUpClass()
+
+    @classmethod
+    def tearDownClass(cls):
+        super(TLSEchoTestCase, cls).tearDownClass()
+
+    def setUp(self):
+        super(TLSEchoTestCase, self).setUp()
+
+        self.vapi.session_enable_disable(is_enable=1)
+        self.create_loopback_interfaces(2)
+
+        table_id = 0
+
+        for i in self.lo_interfaces:
+            i.admin_up()
+
+            if table_id != 0:
+                tbl = VppIpTable(self, table_id)
+                tbl.add_vpp_config()
+
+            i.set_table_ip4(table_id)
+            i.config_ip4()
+            table_id += 1
+
+        # Configure namespaces
+        self.vapi.app_namespace_add_del_v4(
+            namespace_id="0", sw_if_index=self.loop0.sw_if_index
+        )
+        self.vapi.app_namespace_add_del_v4(
+            namespace_id="1", sw_if_index=self.loop1.sw_if_index
+        )
+
+        # Add inter-table routes
+        self.ip_t01 = VppIpRoute(
+            self,
+            self.loop1.local_ip4,
+            32,
+            [VppRoutePath("0.0.0.0", 0xFFFFFFFF, nh_table_id=1)],
+        )
+        self.ip_t10 = VppIpRoute(
+            self,
+            self.loop0.local_ip4,
+            32,
+            [VppRoutePath("0.0.0.0", 0xFFFFFFFF, nh_table_id=0)],
+            table_id=1,
+        )
+        self.ip_t01.add_vpp_config()
+        self.ip_t10.add_vpp_config()
+
+        self.uri = "tls://" + self.loop0.local_ip4 + "/1234"
+
+    def tearDown(self):
+        self.ip_t01.remove_vpp_config()
+        self.ip_t10.remove_vpp_config()
+
+        self.vapi.app_namespace_add_del_v4(
+            is_add=0, namespace_id="0", sw_if_index=self.loop0.sw_if_index
+        )
+        self.vapi.app_namespace_add_del_v4(
+            is_add=0, namespace_id="1", sw_if_index=self.loop1.sw_if_index
+        )
+
+        for i in self.lo_interfaces:
+            i.unconfig_ip4()
+            i.set_table_ip4(0)
+            i.admin_down()
+
+        self.vapi.session_enable_disable(is_enable=0)
+        super(TLSEchoTestCase, self).tearDown()
+
+    def start_echo_server(self):
+        error = self.vapi.cli(
+            "test echo server appns 0 fifo-size 4k tls-engine 1 uri " + self.uri
+        )
+        if error:
+            self.logger.critical(error)
+            self.assertNotIn("failed", error)
+
+    def run_echo_client(self, nclients=1):
+        error = self.vapi.cli(
+            "test echo client mbytes 1 nclients %d appns 1 fifo-size 4k "
+            "test-bytes tls-engine 1 syn-timeout 2 uri %s" % (nclients, self.uri)
+        )
+        if error:
+            self.logger.critical(error)
+            self.assertNotIn("failed", error)
+
+
+class TestTLSResumption(TLSEchoTestCase):
+    """TLS OpenSSL Session Resumption Test Case."""
+
+    # Client sessions are cached per thread, keep connections on one
+    vpp_worker_count = 0
+
+    def handshakes(self):
+        """Return (full, resumed) handshakes, counting client and server"""
+        out = self.vapi.cli("show tls openssl resumption")
+        counts = re.findall(r"full handshakes (\d+) resumed (\d+)", out)
+        full = sum(int(c[0]) for c in counts)
+        resumed = sum(int(c[1]) for c in counts)
+        return full, resumed
+
+    def rotate_ticket_keys(self, lifetime, wait):
+        self.vapi.cli("tls openssl set-tls ticket-key-lifetime %s" % lifetime)
+        self.sleep(wait)
+        self.vapi.cli("tls openssl set-tls ticket-key-lifetime 3600")
+
+    def test_tls_resumption(self):
+        """TLS openssl session resumption and ticket key rotation"""
+
+        self.start_echo_server()
+
+        # First connection does a full handshake, on client and server
+        self.run_echo_client()
+        self.assertEqual(self.handshakes(), (2, 0))
+
+        # Client resumes with the ticket it got
+        self.run_echo_client()
+        self.assertEqual(self.handshakes(), (2, 2))
+
+        # And with the ticket issued after the resumed handshake
+        self.run_echo_client()
+        self.assertEqual(self.handshakes(), (2, 4))
+
+        # One rotation, the ticket's key is still accepted
+        self.rotate_ticket_keys(1, 1.5)
+        self.run_echo_client()
+        self.assertEqual(self.handshakes(), (2, 6))
+
+        # Ticket key is rotated out, full handshake
+        self.rotate_ticket_keys(0.2, 1)
+        self.run_echo_client()
+        self.assertEqual(self.handshakes(), (4, 6))
+
+        self.vapi.cli("test echo server stop")
+
+
+
+class TestTLSPka(TLSEchoTestCase):
+    """TLS OpenSSL Private Key Operation Offload Test Case."""
+
+    def test_tls_pka(self):
+        """TLS openssl private key operations offloaded to pka threads"""
+
+        # Must be enabled before the listener loads its key
+        error = self.vapi.cli("tls openssl set pka-threads 2")
+        self.assertIn("Offloading", error)
+        # Every connection does a full handshake and one private key op
+        self.vapi.cli("tls openssl set-tls no-session-resumption")
+
+        self.start_echo_server()
+        self.run_echo_client(nclients=10)
+        self.vapi.cli("test echo server stop")
+
+        out = self.vapi.cli("show tls openssl pka")
+        self.logger.info(out)
+        stats = re.findall(
+            r"offloaded (\d+) completed (\d+) cancelled (\d+) sync (\d+) "
+            r"inflight (\d+)",
+            out,
+        )
+        offloaded = sum(int(st[0]) for st in stats)
+        completed = sum(int(st[1]) for st in stats)
+        inflight = sum(int(st[4]) for st in stats)
+        self.assertEqual(offloaded, 10)
+        self.assertEqual(completed, 10)
+        self.assertEqual(inflight, 0)
+
+
+class TestTLSPkaWorkers(TestTLSPka):
+    """TLS OpenSSL Private Key Operation Offload With Workers Test Case."""
+
+    vpp_worker_count = 1
+
+
 if __name__ == "__main__":
     unittest.main(testRunner=VppTestRunner)
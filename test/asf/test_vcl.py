@@ -260,8 +260,12 @@ class VCLTestCase(VppAsfTestCase):
         self.vapi.session_enable_disable(is_enable=0)
 
     @unittest.skipUnless(_have_iperf3, "'%s' not found, Skipping.")
-    def thru_host_stack_test(self, server_app, server_args, client_app, client_args):
+    def thru_host_stack_test(
+        self, server_app, server_args, client_app, client_args, app_env=None
+    ):
         self.vcl_app_env = {"VCL_APP_SCOPE_GLOBAL": "true"}
+        if app_env:
+            self.vcl_app_env.update(app_env)
 
         self.update_vcl_app_env("1", "1234", self.sapi_server_sock)
         worker_server = VCLAppWorker(
@@ -908,6 +912,83 @@ class VCLThruHostStackBidirNsock(VCLTestCase):
         )
 
 
+@unittest.skipIf(
+    "hs_apps" in config.excluded_plugins, "Exclude tests requiring hs_apps plugin"
+)
+class VCLThruHostStackIoEvtBatch(VCLTestCase):
+    """VCL Thru Host Stack Io Event Batching"""
+
+    @classmethod
+    def setUpClass(cls):
+        super(VCLThruHostStackIoEvtBatch, cls).setUpClass()
+
+    @classmethod
+    def tearDownClass(cls):
+        super(VCLThruHostStackIoEvtBatch, cls).tearDownClass()
+
+    def setUp(self):
+        super(VCLThruHostStackIoEvtBatch, self).setUp()
+
+        self.thru_host_stack_setup()
+        self.client_io_evt_batch_timeout = 20
+        # Batch size larger than the number of sockets, so batches are only
+        # sent when vcl waits or would block
+        self.io_evt_batch_env = {"VCL_IO_EVT_BATCH": "64"}
+        self.client_bi_dir_nsock_test_args = [
+            "-Q",
+            "64",
+            "-N",
+            "1000",
+            "-B",
+            "-X",
+            "-I",
+            "2",
+            self.loop0.local_ip4,
+            self.server_port,
+        ]
+        self.client_echo_test_args = [
+            "-Q",
+            "64",
+            "-E",
+            self.echo_phrase,
+            "-X",
+            self.loop0.local_ip4,
+            self.server_port,
+        ]
+
+    def tearDown(self):
+        self.thru_host_stack_tear_down()
+        super(VCLThruHostStackIoEvtBatch, self).tearDown()
+
+    def show_commands_at_teardown(self):
+        self.logger.debug(self.vapi.cli("show session verbose 2"))
+        self.logger.debug(self.vapi.cli("show app mq"))
+
+    def test_vcl_thru_host_stack_io_evt_batch_echo(self):
+        """run VCL thru host stack echo test with io event batching"""
+
+        self.timeout = self.client_io_evt_batch_timeout
+        self.thru_host_stack_test(
+            "vcl_test_server",
+            self.server_args,
+            "vcl_test_client",
+            self.client_echo_test_args,
+            app_env=self.io_evt_batch_env,
+        )
+
+    def test_vcl_thru_host_stack_io_evt_batch_bi_dir(self):
+        """run VCL thru host stack bi-directional test with io event batching"""
+
+        self.timeout = self.client_io_evt_batch_timeout
+        self.thru_host_stack_test(
+            "vcl_test_server",
+            self.server_args,
+            "vcl_test_client",
+            self.client_bi_dir_nsock_test_args,
+            app_env=self.io_evt_batch_env,
+        )
+
+
 @unittest.skipIf(
     "hs_apps" in config.excluded_plugins, "Exclude tests requiring hs_apps plugin"
 )
@@ -9,7 +9,7 @@ from config import config
 
 from scapy.layers.inet import IP, UDP
 from scapy.layers.l2 import Ether
-from scapy.layers.dns import DNS, DNSQR
+from scapy.layers.dns import DNS, DNSQR, DNSRR, DNSRRSOA
 
 
 @unittest.skipIf("dns" in config.excluded_plugins, "Exclude DNS plugin tests")
@@ -109,6 +109,148 @@ class TestDns(VppTestCase):
         self.assertIn("1.2.3.4", str)
         self.assertIn("[P] no.clown.org:", str)
 
+    def test_dns_negative_cache(self):
+        """DNS Negative Caching Test"""
+
+        # The name server is the pg interface peer
+        self.vapi.dns_name_server_add_del(
+            is_ip6=0,
+            is_add=1,
+            server_address=IPv4Address(self.pg0.remote_ip4).packed,
+        )
+        self.vapi.dns_enable_disable(enable=1)
+
+        query = (
+            Ether(dst=self.pg0.local_mac, src=self.pg0.remote_mac)
+            / IP(src=self.pg0.remote_ip4, dst=self.pg0.local_ip4)
+            / UDP(sport=1234, dport=53)
+            / DNS(id=1, rd=1, qd=DNSQR(qname="no.clown.org"))
+        )
+
+        # Not cached, the request goes to the name server
+        self.pg0.add_stream([query])
+        self.pg_enable_capture(self.pg_interfaces)
+        self.pg_start()
+        upstream = self.pg0.get_capture(1)[0]
+        self.assertEqual(upstream[IP].dst, self.pg0.remote_ip4)
+
+        # Which doesn't know the name. The pending request gets NXDOMAIN
+        nxdomain = (
+            Ether(dst=self.pg0.local_mac, src=self.pg0.remote_mac)
+            / IP(src=self.pg0.remote_ip4, dst=self.pg0.local_ip4)
+            / UDP(sport=53, dport=upstream[UDP].sport)
+            / DNS(
+                id=upstream[DNS].id,
+                qr=1,
+                rd=1,
+                ra=1,
+                rcode=3,
+                qd=upstream[DNS].qd,
+                ns=DNSRRSOA(rrname="clown.org", ttl=3600, minimum=60),
+            )
+        )
+        self.pg0.add_stream([nxdomain])
+        self.pg_enable_capture(self.pg_interfaces)
+        self.pg_start()
+        reply = self.pg0.get_capture(1)[0]
+        self.assertEqual(reply[DNS].id, 1)
+        self.assertEqual(reply[DNS].rcode, 3)
+
+        # NXDOMAIN is cached for the SOA minimum
+        str = self.vapi.cli("show dns cache verbose")
+        self.assertIn("[N] no.clown.org", str)
+        self.assertIn("Worker cache contains 1 entries", str)
+
+        # Later requests are answered from the worker cache, names are
+        # case insensitive
+        query[DNS].id = 2
+        query[DNS].qd = DNSQR(qname="NO.Clown.org")
+        self.pg0.add_stream([query])
+        self.pg_enable_capture(self.pg_interfaces)
+        self.pg_start()
+        reply = self.pg0.get_capture(1)[0]
+        self.assertEqual(reply[IP].src, self.pg0.local_ip4)
+        self.assertEqual(reply[UDP].dport, 1234)
+        self.assertEqual(reply[DNS].id, 2)
+        self.assertEqual(reply[DNS].rcode, 3)
+        self.assertEqual(reply[DNS].qd.qname, b"NO.Clown.org.")
+        err = self.statistics.get_err_counter(
+            "/err/dns4-request/DNS pkts answered NXDOMAIN from worker cache"
+        )
+        self.assertEqual(err, 1)
+
+        self.vapi.dns_enable_disable(enable=0)
+        self.vapi.dns_name_server_add_del(
+            is_ip6=0,
+            is_add=0,
+            server_address=IPv4Address(self.pg0.remote_ip4).packed,
+        )
+
+    def test_dns_no_answer_not_negative(self):
+        """DNS Response Without Usable Answer Is Not Cached Negative"""
+
+        self.vapi.dns_name_server_add_del(
+            is_ip6=0,
+            is_add=1,
+            server_address=IPv4Address(self.pg0.remote_ip4).packed,
+        )
+        self.vapi.dns_enable_disable(enable=1)
+
+        query = (
+            Ether(dst=self.pg0.local_mac, src=self.pg0.remote_mac)
+            / IP(src=self.pg0.remote_ip4, dst=self.pg0.local_ip4)
+            / UDP(sport=1234, dport=53)
+            / DNS(id=1, rd=1, qd=DNSQR(qname="six.clown.org"))
+        )
+
+        self.pg0.add_stream([query])
+        self.pg_enable_capture(self.pg_interfaces)
+        self.pg_start()
+        upstream = self.pg0.get_capture(1)[0]
+
+        # The name exists, but only has an AAAA record
+        noerror = (
+            Ether(dst=self.pg0.local_mac, src=self.pg0.remote_mac)
+            / IP(src=self.pg0.remote_ip4, dst=self.pg0.local_ip4)
+            / UDP(sport=53, dport=upstream[UDP].sport)
+            / DNS(
+                id=upstream[DNS].id,
+                qr=1,
+                rd=1,
+                ra=1,
+                qd=upstream[DNS].qd,
+                an=DNSRR(rrname="six.clown.org", type="AAAA", rdata="2001::1"),
+            )
+        )
+        self.pg0.add_stream([noerror])
+        self.pg_enable_capture(self.pg_interfaces)
+        self.pg_start()
+        self.pg0.get_capture(1)
+
+        # The entry is cached, but can't be answered from the worker cache
+        str = self.vapi.cli("show dns cache verbose")
+        self.assertIn("six.clown.org", str)
+        self.assertNotIn("[N] six.clown.org", str)
+
+        nxdomain_hits = (
+            "/err/dns4-request/DNS pkts answered NXDOMAIN from worker cache"
+        )
+        before = self.statistics.get_err_counter(nxdomain_hits)
+        query[DNS].id = 2
+        self.pg0.add_stream([query])
+        self.pg_enable_capture(self.pg_interfaces)
+        self.pg_start()
+        reply = self.pg0.get_capture(1)[0]
+        self.assertEqual(reply[DNS].id, 2)
+        self.assertEqual(self.statistics.get_err_counter(nxdomain_hits), before)
+
+        self.vapi.dns_enable_disable(enable=0)
+        self.vapi.dns_name_server_add_del(
+            is_ip6=0,
+            is_add=0,
+            server_address=IPv4Address(self.pg0.remote_ip4).packed,
+        )
+
 
 if __name__ == "__main__":
     unittest.main(testRunner=VppTestRunner)
@@ -518,6 +518,51 @@ class TestIpsecAhHandoff(TemplateIpsecAh, IpsecTun6HandoffTests, IpsecTun4Handof
     pass
 
 
+class TestIpsecAhMultiWorker(TemplateIpsecAh, IpsecTun4):
+    """Ipsec AH - multi-worker SA tests"""
+
+    vpp_worker_count = 2
+
+    def setUp(self):
+        saf = VppEnum.vl_api_ipsec_sad_flags_t
+        self.ipv4_params = IPsecIPv4Params()
+        self.ipv4_params.flags = (
+            saf.IPSEC_API_SAD_FLAG_MULTI_WORKER | saf.IPSEC_API_SAD_FLAG_USE_ANTI_REPLAY
+        )
+        super(TestIpsecAhMultiWorker, self).setUp()
+
+    def test_tun_multi_worker_44(self):
+        """ipsec AH 4o4 tunnel single SA decrypted on all workers"""
+        self.vapi.cli("clear errors")
+        self.vapi.cli("clear ipsec sa")
+
+        N_PKTS = 15
+        p = self.params[socket.AF_INET]
+
+        # without hand-off each worker verifies what it receives
+        for worker in [0, 1]:
+            send_pkts = self.gen_encrypt_pkts(
+                p,
+                p.scapy_tun_sa,
+                self.tun_if,
+                src=p.remote_tun_if_host,
+                dst=self.pg1.remote_ip4,
+                count=N_PKTS,
+            )
+            recv_pkts = self.send_and_expect(
+                self.tun_if, send_pkts, self.pg1, worker=worker
+            )
+            self.verify_decrypted(p, recv_pkts)
+
+        self.assertEqual(p.tun_sa_in.get_stats(0)["packets"], N_PKTS)
+        self.assertEqual(p.tun_sa_in.get_stats(1)["packets"], N_PKTS)
+
+        # the shared window sees worker 1's packets as replays on worker 0
+        self.pg_send(self.tun_if, send_pkts[-5:], worker=0)
+        self.pg1.assert_nothing_captured()
+        self.assertEqual(p.tun_sa_in.get_err("replay", 0), 5)
+
+
 class TestIpsecAhAll(ConfigIpsecAH, IpsecTra4, IpsecTra6, IpsecTun4, IpsecTun6):
     """Ipsec AH all Algos"""
 
@@ -827,6 +827,45 @@ class TestIpsecEspAsync(TemplateIpsecEsp):
         self.p_async.spd.remove_vpp_config()
         self.p_async.sa.remove_vpp_config()
 
+    def test_work_stealing(self):
+        """Async frames stolen by another worker"""
+        self.vapi.ipsec_set_async_mode(async_enable=True)
+
+        # worker 0 does no crypto, so worker 1 has to take its frames
+        self.vapi.crypto_sw_scheduler_set_worker(worker_index=0, crypto_enable=False)
+        try:
+            stolen = "/crypto/sw-scheduler/frames-stolen"
+            n_stolen = self.statistics[stolen][2][0]
+
+            pkts = [
+                (
+                    Ether(src=self.pg1.remote_mac, dst=self.pg1.local_mac)
+                    / IP(src=self.pg1.remote_ip4, dst=self.p_async.remote_tun_if_host)
+                    / UDP(sport=4444, dport=4444)
+                    / Raw(b"0x0" * 200)
+                )
+            ]
+            pkts *= 257
+
+            rxs = self.send_and_expect(self.pg1, pkts, self.pg0, worker=0)
+
+            for rx in rxs:
+                self.assertEqual(rx[ESP].spi, self.p_async.vpp_tun_spi)
+                self.p_async.vpp_tun_sa.decrypt(rx[IP])
+
+            self.assertGreater(self.statistics[stolen][2][0], n_stolen)
+            self.assertEqual(self.statistics[stolen][1][0], 0)
+            self.logger.info(self.vapi.cli("show sw_scheduler workers"))
+        finally:
+            # later tests in the class expect sync mode and all workers
+            self.vapi.crypto_sw_scheduler_set_worker(worker_index=0, crypto_enable=True)
+            self.vapi.ipsec_set_async_mode(async_enable=False)
+
+        self.p_sync.spd.remove_vpp_config()
+        self.p_sync.sa.remove_vpp_config()
+        self.p_async.spd.remove_vpp_config()
+        self.p_async.sa.remove_vpp_config()
+
 
 class TestIpsecEspHandoff(
     TemplateIpsecEsp, IpsecTun6HandoffTests, IpsecTun4HandoffTests
@@ -836,6 +875,81 @@ class TestIpsecEspHandoff(
     pass
 
 
+class TestIpsecEspMultiWorker(TemplateIpsecEsp):
+    """Ipsec ESP - multi-worker SA tests"""
+
+    vpp_worker_count = 2
+
+    def config_anti_replay(self, params, anti_replay_window_size=64):
+        super(TestIpsecEspMultiWorker, self).config_anti_replay(
+            params, anti_replay_window_size
+        )
+        saf = VppEnum.vl_api_ipsec_sad_flags_t
+        for p in params:
+            p.flags |= saf.IPSEC_API_SAD_FLAG_MULTI_WORKER
+
+    def test_tun_multi_worker_44(self):
+        """ipsec 4o4 tunnel single SA decrypted on all workers"""
+        self.vapi.cli("clear errors")
+        self.vapi.cli("clear ipsec sa")
+
+        N_PKTS = 65
+        N_HELD = 5
+        p = self.params[socket.AF_INET]
+
+        # inject alternately on worker 0 and 1, the SA is not bound
+        # to either so each worker decrypts what it receives
+        for i, worker in enumerate([0, 1, 0, 1]):
+            send_pkts = self.gen_encrypt_pkts(
+                p,
+                p.scapy_tun_sa,
+                self.tun_if,
+                src=p.remote_tun_if_host,
+                dst=self.pg1.remote_ip4,
+                count=N_PKTS,
+            )
+            if i == 3:
+                # hold back a few sequence numbers in the middle of the
+                # window, they are sent later on the other worker
+                held = send_pkts[50 : 50 + N_HELD]
+                send_pkts = send_pkts[:50] + send_pkts[50 + N_HELD :]
+            recv_pkts = self.send_and_expect(
+                self.tun_if, send_pkts, self.pg1, worker=worker
+            )
+            self.verify_decrypted(p, recv_pkts)
+
+        self.assertEqual(p.tun_sa_in.get_stats(0)["packets"], 2 * N_PKTS)
+        self.assertEqual(p.tun_sa_in.get_stats(1)["packets"], 2 * N_PKTS - N_HELD)
+        self.assertEqual(p.tun_sa_in.get_err("handoff"), 0)
+
+        # the window is shared, in-window packets decrypted on worker 1
+        # are replays on worker 0
+        self.pg_send(self.tun_if, send_pkts[-10:], worker=0)
+        self.pg1.assert_nothing_captured()
+        self.assertEqual(p.tun_sa_in.get_err("replay", 0), 10)
+
+        # while the in-window ones worker 1 has not seen are accepted
+        recv_pkts = self.send_and_expect(self.tun_if, held, self.pg1, worker=0)
+        self.verify_decrypted(p, recv_pkts)
+        self.assertEqual(p.tun_sa_in.get_stats(0)["packets"], 2 * N_PKTS + N_HELD)
+
+        # and are then replays on worker 1
+        self.pg_send(self.tun_if, held, worker=1)
+        self.pg1.assert_nothing_captured()
+        self.assertEqual(p.tun_sa_in.get_err("replay", 1), N_HELD)
+        self.assertEqual(p.tun_sa_in.get_err("handoff"), 0)
+
+    def test_anti_replay_threads(self):
+        """multi-worker anti-replay window under concurrent updates"""
+        for window in [64, 1024]:
+            reply = self.vapi.cli(
+                "test ipsec anti-replay window %d threads 2 packets 100000" % window
+            )
+            self.logger.info(reply)
+            self.assertIn("multi-worker", reply)
+            self.assertNotIn("accepted twice", reply)
+
+
 class TemplateIpsecEspUdp(ConfigIpsecESP):
     """
     UDP encapped ESP
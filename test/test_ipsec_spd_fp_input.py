@@ -303,6 +303,71 @@ class IPSec4SpdTestCaseProtect(SpdFastPathInboundProtect):
         self.assertEqual(p.tra_sa_in.get_err("lost"), 0)
 
 
+class IPSec4SpdTestCaseTunProtectClassifier(SpdFastPathInboundProtect):
+    """ IPSec/IPv4 inbound: Policy mode test case with fast path \
+    (compiled classifier, SA tunnel update)"""
+
+    # The inbound protect rule matches on the tunnel endpoints of its SA,
+    # so the classifier must be compiled again when the SA is updated.
+
+    @classmethod
+    def setUpClass(cls):
+        super(IPSec4SpdTestCaseTunProtectClassifier, cls).setUpClass()
+
+    @classmethod
+    def tearDownClass(cls):
+        super(IPSec4SpdTestCaseTunProtectClassifier, cls).tearDownClass()
+
+    def setUp(self):
+        super(IPSec4SpdTestCaseTunProtectClassifier, self).setUp()
+
+    def tearDown(self):
+        super(IPSec4SpdTestCaseTunProtectClassifier, self).tearDown()
+
+    def wait_for_classifier(self):
+        for _ in range(50):
+            if "compiling" not in self.vapi.cli("show ipsec spd"):
+                return
+            self.sleep(0.02)
+        self.fail("SPD classifier was not recompiled")
+
+    def gen_tun_pkts(self, p, count):
+        return self.gen_encrypt_pkts(
+            p,
+            p.scapy_tun_sa,
+            self.tun_if,
+            src=p.remote_tun_if_host,
+            dst=self.pg1.remote_ip4,
+            count=count,
+            payload_size=64,
+        )
+
+    def test_ipsec_spd_inbound_tun_protect_classifier(self):
+        pkt_count = 5
+        p = self.params[socket.AF_INET]
+        self.vapi.cli("set ipsec spd classifier %d" % self.tun_spd_id)
+        self.wait_for_classifier()
+
+        self.send_and_expect(self.tun_if, self.gen_tun_pkts(p, pkt_count), self.pg1)
+
+        # protect rule now only matches packets from the new tunnel source
+        p.tun_sa_in.update_vpp_config(is_tun=True, tun_src="1.2.3.4")
+        self.wait_for_classifier()
+        self.send_and_assert_no_replies(self.tun_if, self.gen_tun_pkts(p, pkt_count))
+
+        p.tun_sa_in.update_vpp_config(is_tun=True, tun_src=self.tun_if.remote_ip4)
+        self.wait_for_classifier()
+        self.send_and_expect(self.tun_if, self.gen_tun_pkts(p, pkt_count), self.pg1)
+
+        self.logger.info(self.vapi.ppcli("show ipsec spd"))
+        pkts = p.tun_sa_in.get_stats()["packets"]
+        self.assertEqual(
+            pkts,
+            2 * pkt_count,
+            "incorrect SA in counts: expected %d != %d" % (2 * pkt_count, pkts),
+        )
+
+
 class IPSec4SpdTestCaseAddIPRange(SpdFastPathInbound):
     """ IPSec/IPv4 inbound: Policy mode test case with fast path \
         (add  ips  range with any port rule)"""
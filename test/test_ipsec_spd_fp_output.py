@@ -763,6 +763,94 @@ class IPSec4SpdTestCaseMultiple(SpdFastPathOutbound):
         self.verify_policy_match(pkt_count, policy_22)
 
 
+class IPSec4SpdTestCaseClassifier(SpdFastPathOutbound):
+    """ IPSec/IPv4 outbound: Policy mode test case with fast path \
+        (compiled classifier)"""
+
+    def wait_for_classifier(self):
+        for _ in range(50):
+            if "compiling" not in self.vapi.cli("show ipsec spd"):
+                return
+            self.sleep(0.02)
+        self.fail("SPD classifier was not recompiled")
+
+    def test_ipsec_spd_outbound_classifier(self):
+        # Same as the remove rule test case, with the SPD compiled into
+        # a classifier. Removing the high priority rule triggers
+        # recompilation, after which the low priority rule must match.
+        self.create_interfaces(2)
+        pkt_count = 5
+        self.spd_create_and_intf_add(1, [self.pg1])
+        self.vapi.cli("set ipsec spd classifier 1")
+        policy_0 = self.spd_add_rem_policy(  # outbound, priority 10
+            1,
+            self.pg0,
+            self.pg1,
+            socket.IPPROTO_UDP,
+            is_out=1,
+            priority=10,
+            policy_type="bypass",
+        )
+        policy_1 = self.spd_add_rem_policy(  # outbound, priority 5
+            1,
+            self.pg0,
+            self.pg1,
+            socket.IPPROTO_UDP,
+            is_out=1,
+            priority=5,
+            policy_type="discard",
+        )
+        self.wait_for_classifier()
+        self.assertIn("ip4-outbound: 2 policies", self.vapi.cli("show ipsec spd"))
+
+        packets = self.create_stream(self.pg0, self.pg1, pkt_count)
+        self.pg0.add_stream(packets)
+        self.pg0.enable_capture()
+        self.pg1.enable_capture()
+        self.pg_start()
+        capture = self.pg1.get_capture()
+        self.pg0.assert_nothing_captured()
+        self.verify_capture(self.pg0, self.pg1, capture)
+        self.verify_policy_match(pkt_count, policy_0)
+        self.verify_policy_match(0, policy_1)
+
+        # now remove the bypass rule
+        self.spd_add_rem_policy(  # outbound, priority 10
+            1,
+            self.pg0,
+            self.pg1,
+            socket.IPPROTO_UDP,
+            is_out=1,
+            priority=10,
+            policy_type="bypass",
+            remove=True,
+        )
+        self.wait_for_classifier()
+        self.assertIn("ip4-outbound: 1 policies", self.vapi.cli("show ipsec spd"))
+
+        self.pg0.add_stream(packets)
+        self.pg0.enable_capture()
+        self.pg1.enable_capture()
+        self.pg_start()
+        self.pg0.assert_nothing_captured()
+        self.pg1.assert_nothing_captured()
+        self.verify_policy_match(pkt_count, policy_0)
+        self.verify_policy_match(pkt_count, policy_1)
+
+        self.vapi.cli("set ipsec spd classifier 1 disable")
+        self.assertNotIn("classifier:", self.vapi.cli("show ipsec spd"))
+
+    def test_ipsec_spd_outbound_classifier_random(self):
+        """ compiled classifier vs fast path on random policies """
+        reply = self.vapi.cli(
+            "test ipsec spd classifier policies 2000 packets 2000 rounds 1"
+        )
+        self.logger.info(reply)
+        self.assertIn("classifier:", reply)
+        self.assertIn("0 mismatches", reply)
+        self.assertNotIn("wrong results", reply)
+
+
 class IPSec6SpdTestCaseAdd(SpdFastPathIPv6Outbound):
     """ IPSec/IPv6 outbound: Policy mode test case with fast path \
         (add rule)"""
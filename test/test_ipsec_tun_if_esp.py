@@ -3902,5 +3902,44 @@ class TestIpsecItf6MPLS(TemplateIpsec, TemplateIpsecItf6, IpsecTun6):
         self.unconfig_network(p)
 
 
+class TestIpsecTunProtectRekey(TemplateIpsec):
+    """IPsec tunnel protect rekey without worker barrier"""
+
+    vpp_worker_count = 2
+
+    def test_rekey(self):
+        """rekey SAs of many protected tunnels"""
+        route = VppIpRoute(
+            self,
+            "198.18.0.0",
+            15,
+            [VppRoutePath(self.pg0.remote_ip4, self.pg0.sw_if_index)],
+        ).add_vpp_config()
+
+        # the first round grows the pools, the following ones
+        # must replace the SAs without stopping the workers
+        reply = self.vapi.cli("test ipsec rekey tunnels 1000 rounds 3")
+        self.logger.info(reply)
+        self.assertIn("round 2: 1000 rekeys", reply)
+        self.assertNotIn("adjacencies not using the current SA", reply)
+        self.assertNotIn("rekeys stopped the workers", reply)
+        for r in range(1, 3):
+            self.assertIn("round %d: " % r, reply)
+            line = reply.split("round %d: " % r)[1].split("\n")[0]
+            self.assertIn("barrier taken 0 times", line)
+
+        reply = self.vapi.cli("show ipsec barrier")
+        self.assertIn("tun-protect-update", reply)
+
+        # a new inbound SA with the SPI of the one it replaces
+        reply = self.vapi.cli("test ipsec rekey tunnels 100 rounds 2 reuse-spi")
+        self.logger.info(reply)
+        self.assertIn("round 1: 100 rekeys", reply)
+        self.assertNotIn("not using the current SA", reply)
+        self.assertNotIn("not accepting the current SA", reply)
+
+        route.remove_vpp_config()
+
+
 if __name__ == "__main__":
     unittest.main(testRunner=VppTestRunner)
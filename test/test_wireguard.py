@@ -149,6 +149,9 @@ HANDSHAKE_NUM_BEFORE_RATELIMITING = 5
 
 HANDSHAKE_JITTER = 0.5
 
+# COUNTER_WINDOW_SIZE of the receiver
+WG_COUNTER_WINDOW = 8192 - 64
+
 
 class VppWgPeer(VppObject):
     def __init__(self, test, itf, endpoint, port, allowed_ips, persistent_keepalive=15):
@@ -451,7 +454,7 @@ class VppWgPeer(VppObject):
         self._test.assertEqual(payload, b"")
         self._test.assertTrue(self.noise.handshake_finished)
 
-    def decrypt_transport(self, p, is_ip6=False):
+    def decrypt_transport(self, p, is_ip6=False, use_counter=False):
         self.verify_header(p, is_ip6)
 
         p = Wireguard(bytes(p[Raw]))
@@ -461,10 +464,17 @@ class VppWgPeer(VppObject):
             p[WireguardTransport].receiver_index, self.receiver_index
         )
 
+        if use_counter:
+            # packets encrypted on several workers are not in nonce order
+            cs = self.noise.noise_protocol.cipher_state_decrypt
+            cs.n = p[WireguardTransport].counter
+
         d = self.noise.decrypt(p[WireguardTransport].encrypted_encapsulated_packet)
         return d
 
-    def encrypt_transport(self, p):
+    def encrypt_transport(self, p, counter=None):
+        if counter is not None:
+            self.noise.noise_protocol.cipher_state_encrypt.n = counter
         return self.noise.encrypt(bytes(p))
 
     def validate_encapped(self, rxs, tx, is_tunnel_ip6=False, is_transport_ip6=False):
@@ -2905,6 +2915,110 @@ class WireguardHandoffTests(TestWg):
         peer_1.remove_vpp_config()
         wg0.remove_vpp_config()
 
+    def test_wg_peer_multi_worker(self):
+        """Multi-worker mode"""
+
+        port = 12393
+        self.vapi.wg_set_multi_worker_mode(enable=True)
+
+        wg0 = VppWgInterface(self, self.pg1.local_ip4, port).add_vpp_config()
+        wg0.admin_up()
+        wg0.config_ip4()
+
+        self.pg_enable_capture(self.pg_interfaces)
+        self.pg_start()
+
+        peer_1 = VppWgPeer(
+            self, wg0, self.pg1.remote_ip4, port + 1, ["10.11.3.0/24"]
+        ).add_vpp_config()
+
+        r1 = VppIpRoute(
+            self, "10.11.3.0", 24, [VppRoutePath("10.11.3.1", wg0.sw_if_index)]
+        ).add_vpp_config()
+
+        # skip the first automatic handshake
+        self.pg1.get_capture(1, timeout=HANDSHAKE_JITTER)
+
+        p = peer_1.mk_handshake(self.pg1)
+        rx = self.send_and_expect(self.pg1, [p], self.pg1)
+        peer_1.consume_response(rx[0])
+
+        def mk_data(counter):
+            d = peer_1.encrypt_transport(
+                IP(src="10.11.3.1", dst=self.pg0.remote_ip4, ttl=20)
+                / UDP(sport=222, dport=223)
+                / Raw(),
+                counter,
+            )
+            return peer_1.mk_tunnel_header(self.pg1) / (
+                Wireguard(message_type=4, reserved_zero=0)
+                / WireguardTransport(
+                    receiver_index=peer_1.sender,
+                    counter=counter,
+                    encrypted_encapsulated_packet=d,
+                )
+            )
+
+        handoff_nodes = ["wg4-input-data-handoff", "wg4-output-tun-handoff"]
+        handoffs = [
+            sum(self.statistics.get_counter("/nodes/%s/vectors" % n))
+            for n in handoff_nodes
+        ]
+
+        # the peer's packets are decrypted on each of the workers that
+        # receive them
+        self.send_and_expect(self.pg1, [mk_data(0)], self.pg0, worker=0)
+        p = [mk_data(ii) for ii in range(1, 129)]
+        rxs = self.send_and_expect(self.pg1, p, self.pg0, worker=1)
+        p = [mk_data(ii) for ii in range(129, 257)]
+        rxs += self.send_and_expect(self.pg1, p, self.pg0, worker=0)
+        for rx in rxs:
+            self.assertEqual(rx[IP].dst, self.pg0.remote_ip4)
+            self.assertEqual(rx[IP].ttl, 19)
+
+        # the replay window is shared by the workers
+        self.send_and_assert_no_replies(self.pg1, [mk_data(5)], worker=0)
+        self.send_and_assert_no_replies(self.pg1, [mk_data(200)], worker=1)
+
+        # and so is the send counter, each worker takes its own nonces
+        pe = (
+            Ether(dst=self.pg0.local_mac, src=self.pg0.remote_mac)
+            / IP(src=self.pg0.remote_ip4, dst="10.11.3.2")
+            / UDP(sport=555, dport=556)
+            / Raw(b"\x00" * 80)
+        )
+        rxs = self.send_and_expect(self.pg0, pe * 100, self.pg1, worker=1)
+        rxs += self.send_and_expect(self.pg0, pe * 100, self.pg1, worker=0)
+        counters = set()
+        for rx in rxs:
+            counters.add(Wireguard(bytes(rx[Raw]))[WireguardTransport].counter)
+            rx = IP(peer_1.decrypt_transport(rx, use_counter=True))
+            self.assertEqual(rx[IP].dst, pe[IP].dst)
+            self.assertEqual(rx[IP].ttl, pe[IP].ttl - 1)
+        self.assertEqual(len(counters), len(rxs))
+
+        # a worker that sends again only after the other one moved the
+        # counter past the receiver's window does not use its stale nonces
+        rxs = self.send_and_expect(self.pg0, pe * 8200, self.pg1, worker=0)
+        last = max(
+            Wireguard(bytes(rx[Raw]))[WireguardTransport].counter for rx in rxs
+        )
+        rxs = self.send_and_expect(self.pg0, [pe], self.pg1, worker=1)
+        counter = Wireguard(bytes(rxs[0][Raw]))[WireguardTransport].counter
+        self.assertGreater(counter, last - WG_COUNTER_WINDOW)
+        rx = IP(peer_1.decrypt_transport(rxs[0], use_counter=True))
+        self.assertEqual(rx[IP].dst, pe[IP].dst)
+
+        # nothing was handed off between the workers
+        for n, before in zip(handoff_nodes, handoffs):
+            vectors = self.statistics.get_counter("/nodes/%s/vectors" % n)
+            self.assertEqual(sum(vectors), before)
+
+        r1.remove_vpp_config()
+        peer_1.remove_vpp_config()
+        wg0.remove_vpp_config()
+        self.vapi.wg_set_multi_worker_mode(enable=False)
+
     @unittest.skip("test disabled")
     def test_wg_multi_interface(self):
         """Multi-tunnel on the same port"""